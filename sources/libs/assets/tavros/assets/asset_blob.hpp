@@ -0,0 +1,112 @@
+#pragma once
+
+#include <tavros/core/io/mapped_file_reader.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/memory/dynamic_buffer.hpp>
+#include <tavros/core/memory/memory.hpp>
+#include <tavros/core/noncopyable.hpp>
+
+#include <utility>
+
+namespace tavros::assets
+{
+
+    /**
+     * @brief Read-only bytes of a whole asset, returned by @c asset_manager::map_binary().
+     *
+     * Holds either a memory mapping of the asset file or, for providers that cannot map,
+     * a buffer with the loaded bytes. Either way @ref view() exposes the content, valid for
+     * the lifetime of the blob, so decoders read it without caring where it came from.
+     */
+    class asset_blob : core::noncopyable
+    {
+    public:
+        /**
+         * @brief Constructs an empty blob.
+         */
+        asset_blob() noexcept = default;
+
+        /**
+         * @brief Takes ownership of a mapped file.
+         */
+        explicit asset_blob(core::unique_ptr<core::mapped_file_reader> mapping) noexcept
+            : m_mapping(std::move(mapping))
+            , m_view(m_mapping ? m_mapping->view() : core::buffer_view<uint8>())
+        {
+        }
+
+        /**
+         * @brief Takes ownership of loaded bytes.
+         */
+        explicit asset_blob(core::dynamic_buffer<uint8> bytes) noexcept
+            : m_bytes(std::move(bytes))
+            , m_view(m_bytes.data(), m_bytes.capacity())
+        {
+        }
+
+        asset_blob(asset_blob&& other) noexcept
+            : m_mapping(std::move(other.m_mapping))
+            , m_bytes(std::move(other.m_bytes))
+            , m_view(std::exchange(other.m_view, core::buffer_view<uint8>()))
+        {
+        }
+
+        asset_blob& operator=(asset_blob&& other) noexcept
+        {
+            if (this != &other) {
+                m_mapping = std::move(other.m_mapping);
+                m_bytes = std::move(other.m_bytes);
+                m_view = std::exchange(other.m_view, core::buffer_view<uint8>());
+            }
+            return *this;
+        }
+
+        ~asset_blob() noexcept = default;
+
+        /**
+         * @brief Returns the content of the asset.
+         */
+        [[nodiscard]] core::buffer_view<uint8> view() const noexcept
+        {
+            return m_view;
+        }
+
+        /**
+         * @brief Returns a pointer to the first byte, or nullptr if the blob is empty.
+         */
+        [[nodiscard]] const uint8* data() const noexcept
+        {
+            return m_view.data();
+        }
+
+        /**
+         * @brief Returns the size of the content in bytes.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_view.size();
+        }
+
+        /**
+         * @brief Returns true if the blob holds no bytes.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_view.empty();
+        }
+
+        /**
+         * @brief Returns true if the content is mapped from a file rather than loaded.
+         */
+        [[nodiscard]] bool is_mapped() const noexcept
+        {
+            return m_mapping != nullptr;
+        }
+
+    private:
+        core::unique_ptr<core::mapped_file_reader> m_mapping;
+        core::dynamic_buffer<uint8>                m_bytes;
+        core::buffer_view<uint8>                   m_view;
+    };
+
+} // namespace tavros::assets
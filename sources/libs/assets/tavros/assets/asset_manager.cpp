@@ -23,6 +23,18 @@ namespace
         }
         return {uri.substr(0, pos), uri.substr(pos + 3)};
     }
+
+    static bool scheme_matches(const tavros::assets::asset_provider& provider, tavros::core::string_view scheme) noexcept
+    {
+        return (provider.scheme().empty() && scheme.empty()) || provider.scheme() == scheme;
+    }
+
+    static tavros::core::dynamic_buffer<uint8> read_all(tavros::core::basic_stream_reader& rd)
+    {
+        tavros::core::dynamic_buffer<uint8> bytes(rd.size());
+        rd.read(bytes.data(), bytes.capacity());
+        return bytes;
+    }
 } // namespace
 
 namespace tavros::assets
@@ -45,10 +57,8 @@ namespace tavros::assets
     core::unique_ptr<core::basic_stream_reader> asset_manager::open_reader(core::string_view path) const
     {
         auto [scheme, only_path] = parse_uri(path);
-        for (auto& p : m_providers) {
-            if ((p->scheme().empty() && scheme.empty() || p->scheme() == scheme) && p->exists(only_path)) {
-                return p->open_reader(only_path);
-            }
+        if (auto* p = find_provider(scheme, only_path)) {
+            return p->open_reader(only_path);
         }
         throw core::file_error(core::file_error_tag::open_failed, path, "open_reader() failed");
     }
@@ -57,7 +67,7 @@ namespace tavros::assets
     {
         auto [scheme, only_path] = parse_uri(path);
         for (auto& p : m_providers) {
-            if (p->scheme().empty() && scheme.empty() || p->scheme() == scheme) {
+            if (scheme_matches(*p, scheme)) {
                 return p->open_writer(only_path);
             }
         }
@@ -103,10 +113,30 @@ namespace tavros::assets
 
     core::dynamic_buffer<uint8> asset_manager::read_binary(core::string_view path) const
     {
-        auto                        rd = open_reader(path);
-        core::dynamic_buffer<uint8> bytes(rd->size());
-        rd->read(bytes.data(), bytes.capacity());
-        return bytes;
+        auto rd = open_reader(path);
+        return read_all(*rd);
+    }
+
+    asset_blob asset_manager::map_binary(core::string_view path) const
+    {
+        auto [scheme, only_path] = parse_uri(path);
+        if (auto* p = find_provider(scheme, only_path)) {
+            if (auto mapping = p->open_mapped(only_path)) {
+                return asset_blob(std::move(mapping));
+            }
+            return asset_blob(read_all(*p->open_reader(only_path)));
+        }
+        throw core::file_error(core::file_error_tag::open_failed, path, "map_binary() failed");
+    }
+
+    asset_provider* asset_manager::find_provider(core::string_view scheme, core::string_view path) const
+    {
+        for (auto& p : m_providers) {
+            if (scheme_matches(*p, scheme) && p->exists(path)) {
+                return p.get();
+            }
+        }
+        return nullptr;
     }
 
 } // namespace tavros::assets
@@ -7,6 +7,7 @@
 #include <tavros/core/containers/fixed_vector.hpp>
 #include <tavros/core/ids/handle_allocator.hpp>
 
+#include <tavros/assets/asset_blob.hpp>
 #include <tavros/assets/asset_provider.hpp>
 
 namespace tavros::assets
@@ -111,6 +112,21 @@ namespace tavros::assets
          */
         core::dynamic_buffer<uint8> read_binary(core::string_view path) const;
 
+        /**
+         * @brief Returns the entire contents of the asset without copying it when possible.
+         *
+         * Providers that support it map the asset file into memory, so decoders read straight
+         * from the page cache. For other providers the contents are read into a buffer, as with
+         * @ref read_binary().
+         *
+         * @throws core::file_error If the asset cannot be opened or read.
+         */
+        asset_blob map_binary(core::string_view path) const;
+
+    private:
+        // Returns the first provider serving the scheme that has the asset, or nullptr
+        asset_provider* find_provider(core::string_view scheme, core::string_view path) const;
+
     private:
         core::vector<core::unique_ptr<asset_provider>> m_providers;
     };
@@ -2,6 +2,7 @@
 
 #include <tavros/core/string_view.hpp>
 #include <tavros/core/memory/memory.hpp>
+#include <tavros/core/io/mapped_file_reader.hpp>
 #include <tavros/core/io/stream_reader.hpp>
 #include <tavros/core/io/stream_writer.hpp>
 
@@ -77,6 +78,22 @@ namespace tavros::assets
          * @throws core::file_error If the asset cannot be opened due to I/O or permission errors.
          */
         [[nodiscard]] virtual core::unique_ptr<core::basic_stream_writer> open_writer(core::string_view path) = 0;
+
+        /**
+         * @brief Maps the asset at @p path into memory for reading.
+         *
+         * Optional. Providers backed by files should map them, so the content can be decoded
+         * without copying. The default implementation returns @c nullptr, and the caller falls
+         * back to @ref open_reader().
+         *
+         * @return The mapped file, or @c nullptr if the provider cannot map the asset.
+         * @throws core::file_error If the asset cannot be opened due to I/O or permission errors.
+         */
+        [[nodiscard]] virtual core::unique_ptr<core::mapped_file_reader> open_mapped(core::string_view path)
+        {
+            TAV_UNUSED(path);
+            return nullptr;
+        }
     };
 
 } // namespace tavros::assets
@@ -2,6 +2,7 @@
 
 #include <tavros/core/io/file_reader.hpp>
 #include <tavros/core/io/file_writer.hpp>
+#include <tavros/core/io/mapped_file_reader.hpp>
 #include <tavros/core/logger/logger.hpp>
 #include <tavros/core/debug/debug_break.hpp>
 #include <tavros/core/exception.hpp>
@@ -73,4 +74,14 @@ namespace tavros::assets
         return core::make_unique<core::file_writer>(full_path, core::file_open_mode::truncate);
     }
 
+    core::unique_ptr<core::mapped_file_reader> filesystem_provider::open_mapped(core::string_view path)
+    {
+        filesystem::fixed_path full_path = m_base;
+        full_path /= path;
+        if (!m_can_read) {
+            throw core::file_error(core::file_error_tag::open_failed, full_path, "unavailable for reading");
+        }
+        return core::make_unique<core::mapped_file_reader>(full_path);
+    }
+
 } // namespace tavros::assets
\ No newline at end of file
@@ -26,6 +26,8 @@ namespace tavros::assets
 
         [[nodiscard]] core::unique_ptr<core::basic_stream_writer> open_writer(core::string_view path) override;
 
+        [[nodiscard]] core::unique_ptr<core::mapped_file_reader> open_mapped(core::string_view path) override;
+
     private:
         filesystem::fixed_path m_base;
         core::fixed_string<32> m_scheme;
@@ -24,13 +24,16 @@ namespace tavros::core
      * typed @ref view() factory methods that expose a subset of columns as an
      * @ref archetype_view.
      *
+     * Use through the @ref archetype and @ref chunked_archetype aliases; the latter keeps
+     * components in fixed-size blocks, so rows never move when the archetype grows.
+     *
      * Compared to @ref basic_table, @c basic_archetype enforces that every
      * component type appears **exactly once** (via @c are_unique_unqualified_v),
      * making it suitable as the canonical per-archetype storage in an ECS.
      *
      * ### Example
      * @code
-     *   basic_archetype<Position, Velocity, Health> arch;
+     *   archetype<Position, Velocity, Health> arch;
      *   arch.typed_emplace_back(Position{0,0}, Velocity{1,0}, Health{100});
      *
      *   // Mutable view over two of the three columns
@@ -44,13 +47,14 @@ namespace tavros::core
      *   auto cv = carch.view<Health>();
      * @endcode
      *
+     * @tparam Policy     Column storage policy, e.g. @ref contiguous_policy or @ref chunked_policy.
      * @tparam Components Component types. Must all be distinct after cv-ref stripping.
      */
-    template<class... Components>
+    template<class Policy, class... Components>
         requires are_unique_unqualified_v<type_list<Components...>>
-    class basic_archetype final : public basic_table<Components...>
+    class basic_archetype final : public basic_table<Policy, Components...>
     {
-        using base = basic_table<Components...>;
+        using base = basic_table<Policy, Components...>;
 
     public:
         /// Marker type used by the @ref archetype_with concept to identify archetypes.
@@ -75,8 +79,9 @@ namespace tavros::core
          * @brief Creates a mutable view over a subset of component columns.
          *
          * The returned @ref archetype_view holds a non-owning pointer to this
-         * archetype; it is invalidated if the archetype is destroyed or if any
-         * reallocation occurs (e.g. via @c emplace_back after capacity is exceeded).
+         * archetype; it is invalidated if the archetype is destroyed. With contiguous
+         * storage, references obtained through it are also invalidated by any
+         * reallocation (e.g. via @c emplace_back after capacity is exceeded).
          *
          * @tparam Ts  Components to expose. Each type must be present in
          *             @p Components and all must be distinct. May be
@@ -121,4 +126,18 @@ namespace tavros::core
         }
     };
 
+    /**
+     * @brief Archetype whose component columns are contiguous vectors.
+     * @see contiguous_policy
+     */
+    template<class... Components>
+    using archetype = basic_archetype<contiguous_policy, Components...>;
+
+    /**
+     * @brief Archetype whose component columns are stored in fixed-size blocks.
+     * @see chunked_policy
+     */
+    template<class... Components>
+    using chunked_archetype = basic_archetype<chunked_policy<>, Components...>;
+
 } // namespace tavros::core
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <tavros/core/containers/table.hpp>
+#include <tavros/core/memory/buffer_span.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/thread/executor.hpp>
 
 namespace tavros::core
 {
@@ -11,6 +14,10 @@ namespace tavros::core
      * Provides iteration, random access, and bulk-traversal over a set of ECS columns
      * stored in a @p Table. All operations are O(1) or O(n); no heap allocation occurs.
      *
+     * Besides per-row iteration the view offers @ref each_block, which passes whole
+     * contiguous column ranges to a kernel, and @ref parallel_each, which splits the
+     * rows across the threads of an @ref executor.
+     *
      * @tparam Table      Underlying storage type (e.g. basic_archetype).
      * @tparam Components Component types exposed by this view. May be cv-qualified to
      *                    restrict mutability (e.g. @c const Position restricts that column
@@ -58,6 +65,14 @@ namespace tavros::core
         /** @brief Immutable reverse iterator. */
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
+        /**
+         * @brief Contiguous range of one column passed to @ref each_block kernels.
+         *
+         * @c buffer_span<T> for mutable components, @c buffer_view<T> for @c const ones.
+         */
+        template<class T>
+        using block_type = std::conditional_t<std::is_const_v<T>, buffer_view<std::remove_const_t<T>>, buffer_span<T>>;
+
     public:
         /**
          * @brief Constructs a view over @p table.
@@ -215,6 +230,73 @@ namespace tavros::core
             }
         }
 
+        /**
+         * @brief Calls @p func(block_type<Components>...) for every contiguous block of rows.
+         *
+         * Every call receives one span per component, all of the same length and covering
+         * the same rows. A table with contiguous columns yields a single block with all
+         * rows; a chunked table yields one block per chunk. Kernels written over plain
+         * spans let the compiler vectorize the inner loop.
+         *
+         * @tparam Func  Callable matching @c void(block_type<Components>...).
+         *
+         * @code
+         *   view.each_block([](buffer_span<Position> pos, buffer_view<Velocity> vel) {
+         *       for (size_t i = 0; i < pos.size(); ++i) {
+         *           pos[i].x += vel[i].x;
+         *       }
+         *   });
+         * @endcode
+         */
+        template<class Func>
+        void each_block(Func&& func)
+        {
+            const size_type blocks = block_count();
+            for (size_type b = 0; b < blocks; ++b) {
+                func(block_at<Components>(b)...);
+            }
+        }
+
+        /** @copydoc each_block(Func&&) */
+        template<class Func>
+        void each_block(Func&& func) const
+        {
+            const size_type blocks = block_count();
+            for (size_type b = 0; b < blocks; ++b) {
+                func(block_at<const Components>(b)...);
+            }
+        }
+
+        /**
+         * @brief Calls @p func(Components&...) for every row, spreading the rows across @p exec.
+         *
+         * Rows are split into ranges of @p grain rows; each range is one task of the executor
+         * and is visited sequentially. @p func is called concurrently from several threads and
+         * must only touch the row it is given, or synchronize otherwise. The call returns once
+         * every row has been visited.
+         *
+         * @param exec   Executor that runs the tasks.
+         * @param grain  Rows per task. 0 picks a grain that gives every thread of @p exec
+         *               a few tasks.
+         * @param func   Callable matching @c void(Components&...).
+         */
+        template<class Func>
+        void parallel_each(executor& exec, size_type grain, Func&& func)
+        {
+            parallel_ranges(exec, grain, [&](size_type first, size_type count) {
+                each_n(first, count, func);
+            });
+        }
+
+        /** @copydoc parallel_each(executor&, size_type, Func&&) */
+        template<class Func>
+        void parallel_each(executor& exec, size_type grain, Func&& func) const
+        {
+            parallel_ranges(exec, grain, [&](size_type first, size_type count) {
+                each_n(first, count, func);
+            });
+        }
+
         /** @brief Returns the number of rows in the view. */
         [[nodiscard]] size_type size() const noexcept
         {
@@ -299,6 +381,51 @@ namespace tavros::core
             return rend();
         }
 
+    private:
+        /// Number of contiguous blocks the rows are stored in.
+        size_type block_count() const noexcept
+        {
+            const auto& column = m_table->template get<0>();
+            if constexpr (requires { column.chunk_count(); }) {
+                return column.chunk_count();
+            } else {
+                return column.empty() ? 0 : 1;
+            }
+        }
+
+        /// Rows of block @p b of the column of @p T.
+        template<class T>
+        block_type<T> block_at(size_type b) const noexcept
+        {
+            auto& column = m_table->template get<std::remove_cvref_t<T>>();
+            if constexpr (requires { column.chunk_count(); }) {
+                auto chunk = column.chunk(b);
+                return block_type<T>(chunk.data(), chunk.size());
+            } else {
+                return block_type<T>(column.data(), column.size());
+            }
+        }
+
+        /// Splits [0, size()) into ranges of @p grain rows and runs @p func(first, count) for each on @p exec.
+        template<class RangeFunc>
+        void parallel_ranges(executor& exec, size_type grain, RangeFunc&& func) const
+        {
+            const size_type rows = m_table->size();
+            if (rows == 0) {
+                return;
+            }
+            if (grain == 0) {
+                const size_type tasks = exec.concurrency() * 4;
+                grain = (rows + tasks - 1) / tasks;
+            }
+
+            const size_type tasks = (rows + grain - 1) / grain;
+            exec.run(tasks, [&](size_t task) {
+                const size_type first = task * grain;
+                func(first, first + grain < rows ? grain : rows - first);
+            });
+        }
+
     private:
         /// Pointer to the underlying container.
         Table* m_table;
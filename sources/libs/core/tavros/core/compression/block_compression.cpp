@@ -0,0 +1,169 @@
+#include <tavros/core/compression/block_compression.hpp>
+
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/memory/dynamic_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    tavros::core::logger logger("block_compression");
+
+    using namespace tavros;
+
+    constexpr uint32 k_blocks_magic = 'T' | ('A' << 8) | ('V' << 16) | ('Z' << 24);
+
+    // Compressed block sizes are stored as uint32, so the bound of a block must fit it
+    constexpr size_t k_max_block_size = std::numeric_limits<uint32>::max() / 2;
+
+    struct blocks_header
+    {
+        uint32 magic;
+        uint32 block_size;
+        uint64 size;
+    };
+    static_assert(sizeof(blocks_header) == 16);
+
+    bool read_header(core::buffer_view<uint8> packed, blocks_header& header) noexcept
+    {
+        if (packed.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, packed.data(), sizeof(header));
+        return header.magic == k_blocks_magic && header.block_size != 0;
+    }
+
+    // Deflate state and output of one block of a batch, reused by every batch
+    struct block_slot
+    {
+        core::deflate_stream        stream;
+        core::dynamic_buffer<uint8> packed;
+        size_t                      size = 0;
+
+        block_slot(core::compression_level level, size_t bound)
+            : stream(level)
+            , packed(bound)
+        {
+        }
+    };
+} // namespace
+
+namespace tavros::core
+{
+
+    size_t compress_blocks(buffer_view<uint8> input, basic_stream_writer& output, executor& exec, compression_level level, size_t block_size)
+    {
+        if (block_size == 0 || block_size > k_max_block_size) {
+            ::logger.error("Failed to compress blocks: invalid block size {}", block_size);
+            return 0;
+        }
+
+        const size_t block_count = (input.size() + block_size - 1) / block_size;
+
+        // A couple of blocks per thread keeps every thread busy while the batch is written out
+        const size_t batch_size = std::max<size_t>(1, std::min(block_count, exec.concurrency() * 2));
+
+        vector<unique_ptr<block_slot>> slots;
+        slots.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            slots.push_back(make_unique<block_slot>(level, compress_bound(block_size)));
+        }
+
+        const blocks_header header{k_blocks_magic, static_cast<uint32>(block_size), static_cast<uint64>(input.size())};
+        if (output.write(reinterpret_cast<const uint8*>(&header), sizeof(header)) != sizeof(header)) {
+            ::logger.error("Failed to compress blocks: output stream failed");
+            return 0;
+        }
+        size_t written = sizeof(header);
+
+        for (size_t first = 0; first < block_count; first += batch_size) {
+            const size_t count = std::min(batch_size, block_count - first);
+            exec.run(count, [&](size_t i) {
+                const size_t begin = (first + i) * block_size;
+                const size_t size = std::min(block_size, input.size() - begin);
+                auto&        slot = *slots[i];
+                slot.size = slot.stream.compress(buffer_view<uint8>(input.data() + begin, size), buffer_span<uint8>(slot.packed.data(), slot.packed.capacity()));
+            });
+
+            for (size_t i = 0; i < count; ++i) {
+                const auto& slot = *slots[i];
+                if (slot.size == 0) {
+                    ::logger.error("Failed to compress block {}", first + i);
+                    return 0;
+                }
+                const auto size = static_cast<uint32>(slot.size);
+                if (output.write(reinterpret_cast<const uint8*>(&size), sizeof(size)) != sizeof(size) || output.write(slot.packed.data(), slot.size) != slot.size) {
+                    ::logger.error("Failed to compress blocks: output stream failed");
+                    return 0;
+                }
+                written += sizeof(uint32) + slot.size;
+            }
+        }
+        return written;
+    }
+
+    size_t uncompressed_blocks_size(buffer_view<uint8> packed) noexcept
+    {
+        blocks_header header;
+        return read_header(packed, header) ? static_cast<size_t>(header.size) : 0;
+    }
+
+    bool uncompress_blocks(buffer_view<uint8> packed, buffer_span<uint8> output, executor& exec)
+    {
+        blocks_header header;
+        if (!read_header(packed, header)) {
+            ::logger.error("Failed to uncompress blocks: invalid header");
+            return false;
+        }
+        if (output.size() != header.size) {
+            ::logger.error("Failed to uncompress blocks: expected {} bytes of output, got {}", header.size, output.size());
+            return false;
+        }
+
+        const size_t block_size = header.block_size;
+        const size_t block_count = (output.size() + block_size - 1) / block_size;
+        if (block_count == 0) {
+            return true;
+        }
+
+        // Block sizes are stored inline, a cheap serial pass finds where each block starts
+        vector<buffer_view<uint8>> blocks(block_count);
+        size_t                     offset = sizeof(header);
+        for (size_t b = 0; b < block_count; ++b) {
+            uint32 size = 0;
+            if (packed.size() - offset < sizeof(size)) {
+                ::logger.error("Failed to uncompress blocks: container truncated at block {}", b);
+                return false;
+            }
+            std::memcpy(&size, packed.data() + offset, sizeof(size));
+            offset += sizeof(size);
+            if (packed.size() - offset < size) {
+                ::logger.error("Failed to uncompress blocks: container truncated at block {}", b);
+                return false;
+            }
+            blocks[b] = buffer_view<uint8>(packed.data() + offset, size);
+            offset += size;
+        }
+
+        // One inflate state per task, each task takes every n-th block
+        const size_t     task_count = std::min(block_count, exec.concurrency());
+        std::atomic_bool failed = false;
+        exec.run(task_count, [&](size_t task) {
+            inflate_stream stream;
+            for (size_t b = task; b < block_count && !failed.load(std::memory_order_relaxed); b += task_count) {
+                const size_t begin = b * block_size;
+                const size_t size = std::min(block_size, output.size() - begin);
+                if (!stream.uncompress(blocks[b], buffer_span<uint8>(output.data() + begin, size))) {
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        return !failed.load();
+    }
+
+} // namespace tavros::core
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <tavros/core/compression/compression.hpp>
+#include <tavros/core/thread/executor.hpp>
+
+namespace tavros::core
+{
+
+    /// Default size of an independently compressed block.
+    constexpr size_t k_default_compression_block_size = 1024 * 1024;
+
+    /**
+     * @brief Compresses @p input as independent blocks spread across the threads of @p exec.
+     *
+     * zlib compresses a single stream on one core. Splitting the data into blocks that are
+     * compressed separately trades a little ratio (each block starts with an empty dictionary)
+     * for compressing on every core, and lets @ref uncompress_blocks() inflate them in parallel.
+     *
+     * Container layout, little-endian:
+     * - Header: magic @c "TAVZ" (4 bytes), block size (uint32), uncompressed size (uint64).
+     * - For each block: compressed size (uint32) followed by a zlib stream of the block.
+     *
+     * Blocks are compressed in batches of a few per thread and written in order, so the memory
+     * used does not grow with the size of @p input, and @p output does not need to be seekable.
+     *
+     * @param input      Data to compress.
+     * @param output     Writer that receives the container.
+     * @param exec       Executor running the block compression.
+     * @param level      Compression level of every block.
+     * @param block_size Uncompressed size of each block but the last.
+     *
+     * @return Number of bytes written to @p output, or 0 on failure.
+     */
+    size_t compress_blocks(
+        buffer_view<uint8>   input,
+        basic_stream_writer& output,
+        executor&            exec,
+        compression_level    level = compression_level::balanced,
+        size_t               block_size = k_default_compression_block_size
+    );
+
+    /**
+     * @brief Returns the uncompressed size stored in the header of a @ref compress_blocks() container.
+     *
+     * @return The size, or 0 if @p packed does not start with a valid header.
+     */
+    [[nodiscard]] size_t uncompressed_blocks_size(buffer_view<uint8> packed) noexcept;
+
+    /**
+     * @brief Uncompresses a @ref compress_blocks() container, inflating blocks in parallel.
+     *
+     * @param packed Whole container.
+     * @param output Destination, its size must equal @ref uncompressed_blocks_size().
+     * @param exec   Executor running the block decompression.
+     *
+     * @return true on success, false if the container is corrupt or @p output has a wrong size.
+     */
+    bool uncompress_blocks(buffer_view<uint8> packed, buffer_span<uint8> output, executor& exec);
+
+} // namespace tavros::core
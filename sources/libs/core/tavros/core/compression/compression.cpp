@@ -1,16 +1,78 @@
 #include <tavros/core/compression/compression.hpp>
 
+#include <tavros/core/debug/unreachable.hpp>
 #include <tavros/core/logger/logger.hpp>
+#include <tavros/core/memory/dynamic_buffer.hpp>
 #include <zlib/zlib.h>
 
+#include <limits>
+#include <new>
+
 namespace
 {
     tavros::core::logger logger("compression");
-}
+
+    using namespace tavros;
+
+    // Size of the staging buffers used by the stream overloads
+    constexpr size_t k_stream_chunk_size = 64 * 1024;
+
+    // zlib counts bytes of a single call in uInt
+    constexpr size_t k_max_zlib_size = std::numeric_limits<uInt>::max();
+
+    int32 zlib_level(core::compression_level level) noexcept
+    {
+        switch (level) {
+        case core::compression_level::none:
+            return Z_NO_COMPRESSION;
+        case core::compression_level::fastest:
+            return Z_BEST_SPEED;
+        case core::compression_level::balanced:
+            return 6;
+        case core::compression_level::best:
+            return Z_BEST_COMPRESSION;
+        default:
+            TAV_UNREACHABLE();
+        }
+    }
+
+    const char* zlib_error(int32 res) noexcept
+    {
+        switch (res) {
+        case Z_MEM_ERROR:
+            return "not enough memory";
+        case Z_BUF_ERROR:
+            return "output buffer too small or input truncated";
+        case Z_DATA_ERROR:
+        case Z_NEED_DICT:
+            return "corrupted data";
+        case Z_STREAM_ERROR:
+            return "invalid stream state";
+        default:
+            return "unknown error";
+        }
+    }
+} // namespace
 
 namespace tavros::core
 {
 
+    string_view to_string(compression_level level) noexcept
+    {
+        switch (level) {
+        case compression_level::none:
+            return "none";
+        case compression_level::fastest:
+            return "fastest";
+        case compression_level::balanced:
+            return "balanced";
+        case compression_level::best:
+            return "best";
+        default:
+            TAV_UNREACHABLE();
+        }
+    }
+
     bool uncompress_data(buffer_view<uint8> compressed_data, buffer_span<uint8> output)
     {
         auto dest_len = static_cast<uLongf>(output.size());
@@ -43,4 +105,191 @@ namespace tavros::core
         }
     }
 
-} // namespace tavros::core
\ No newline at end of file
+    size_t compress_bound(size_t size) noexcept
+    {
+        return static_cast<size_t>(compressBound(static_cast<uLong>(size)));
+    }
+
+    /* ------------------------------------------------------------------------- */
+
+    struct deflate_stream::impl
+    {
+        z_stream              strm{};
+        compression_level     level = compression_level::balanced;
+        dynamic_buffer<uint8> in_chunk;
+        dynamic_buffer<uint8> out_chunk;
+    };
+
+    deflate_stream::deflate_stream(compression_level level)
+        : m_impl(make_unique<impl>())
+    {
+        m_impl->level = level;
+        const auto res = deflateInit(&m_impl->strm, zlib_level(level));
+        if (res != Z_OK) {
+            ::logger.error("Failed to init deflate: {}", zlib_error(res));
+            throw std::bad_alloc();
+        }
+    }
+
+    deflate_stream::~deflate_stream() noexcept
+    {
+        deflateEnd(&m_impl->strm);
+    }
+
+    size_t deflate_stream::compress(buffer_view<uint8> input, buffer_span<uint8> output)
+    {
+        if (input.size() > k_max_zlib_size || output.size() > k_max_zlib_size) {
+            ::logger.error("Failed to compress: {} bytes do not fit a single call", input.size());
+            return 0;
+        }
+
+        auto& s = m_impl->strm;
+        deflateReset(&s);
+        s.next_in = const_cast<Bytef*>(input.data());
+        s.avail_in = static_cast<uInt>(input.size());
+        s.next_out = output.data();
+        s.avail_out = static_cast<uInt>(output.size());
+
+        const auto res = deflate(&s, Z_FINISH);
+        if (res != Z_STREAM_END) {
+            ::logger.error("Failed to compress: {}", zlib_error(res == Z_OK ? Z_BUF_ERROR : res));
+            return 0;
+        }
+        return static_cast<size_t>(s.total_out);
+    }
+
+    size_t deflate_stream::compress(basic_stream_reader& input, basic_stream_writer& output)
+    {
+        auto& s = m_impl->strm;
+        deflateReset(&s);
+        m_impl->in_chunk.reserve(k_stream_chunk_size);
+        m_impl->out_chunk.reserve(k_stream_chunk_size);
+
+        size_t written = 0;
+        int32  flush = Z_NO_FLUSH;
+        while (flush != Z_FINISH) {
+            const size_t n = input.good() ? input.read(m_impl->in_chunk.data(), k_stream_chunk_size) : 0;
+            if (input.bad()) {
+                ::logger.error("Failed to compress: input stream failed");
+                return 0;
+            }
+
+            // A short read leaves the reader at the end of the stream
+            flush = input.good() ? Z_NO_FLUSH : Z_FINISH;
+            s.next_in = m_impl->in_chunk.data();
+            s.avail_in = static_cast<uInt>(n);
+
+            do {
+                s.next_out = m_impl->out_chunk.data();
+                s.avail_out = static_cast<uInt>(k_stream_chunk_size);
+                deflate(&s, flush);
+
+                const size_t have = k_stream_chunk_size - s.avail_out;
+                if (have != 0 && output.write(m_impl->out_chunk.data(), have) != have) {
+                    ::logger.error("Failed to compress: output stream failed");
+                    return 0;
+                }
+                written += have;
+            } while (s.avail_out == 0);
+        }
+
+        return written;
+    }
+
+    compression_level deflate_stream::level() const noexcept
+    {
+        return m_impl->level;
+    }
+
+    /* ------------------------------------------------------------------------- */
+
+    struct inflate_stream::impl
+    {
+        z_stream              strm{};
+        dynamic_buffer<uint8> in_chunk;
+        dynamic_buffer<uint8> out_chunk;
+    };
+
+    inflate_stream::inflate_stream()
+        : m_impl(make_unique<impl>())
+    {
+        const auto res = inflateInit(&m_impl->strm);
+        if (res != Z_OK) {
+            ::logger.error("Failed to init inflate: {}", zlib_error(res));
+            throw std::bad_alloc();
+        }
+    }
+
+    inflate_stream::~inflate_stream() noexcept
+    {
+        inflateEnd(&m_impl->strm);
+    }
+
+    bool inflate_stream::uncompress(buffer_view<uint8> input, buffer_span<uint8> output)
+    {
+        if (input.size() > k_max_zlib_size || output.size() > k_max_zlib_size) {
+            ::logger.error("Failed to uncompress: {} bytes do not fit a single call", output.size());
+            return false;
+        }
+
+        auto& s = m_impl->strm;
+        inflateReset(&s);
+        s.next_in = const_cast<Bytef*>(input.data());
+        s.avail_in = static_cast<uInt>(input.size());
+        s.next_out = output.data();
+        s.avail_out = static_cast<uInt>(output.size());
+
+        const auto res = inflate(&s, Z_FINISH);
+        if (res != Z_STREAM_END) {
+            ::logger.error("Failed to uncompress: {}", zlib_error(res == Z_OK ? Z_BUF_ERROR : res));
+            return false;
+        }
+        if (s.avail_out != 0) {
+            ::logger.error("Failed to uncompress: expected {} bytes, got {}", output.size(), s.total_out);
+            return false;
+        }
+        return true;
+    }
+
+    bool inflate_stream::uncompress(basic_stream_reader& input, basic_stream_writer& output)
+    {
+        auto& s = m_impl->strm;
+        inflateReset(&s);
+        m_impl->in_chunk.reserve(k_stream_chunk_size);
+        m_impl->out_chunk.reserve(k_stream_chunk_size);
+
+        int32 res = Z_OK;
+        while (res != Z_STREAM_END) {
+            if (s.avail_in == 0) {
+                const size_t n = input.good() ? input.read(m_impl->in_chunk.data(), k_stream_chunk_size) : 0;
+                if (n == 0) {
+                    ::logger.error("Failed to uncompress: {}", input.bad() ? "input stream failed" : "input truncated");
+                    return false;
+                }
+                s.next_in = m_impl->in_chunk.data();
+                s.avail_in = static_cast<uInt>(n);
+            }
+
+            s.next_out = m_impl->out_chunk.data();
+            s.avail_out = static_cast<uInt>(k_stream_chunk_size);
+            res = inflate(&s, Z_NO_FLUSH);
+            if (res != Z_OK && res != Z_STREAM_END) {
+                ::logger.error("Failed to uncompress: {}", zlib_error(res));
+                return false;
+            }
+
+            const size_t have = k_stream_chunk_size - s.avail_out;
+            if (have != 0 && output.write(m_impl->out_chunk.data(), have) != have) {
+                ::logger.error("Failed to uncompress: output stream failed");
+                return false;
+            }
+        }
+
+        // Give back the bytes read past the end of the compressed data
+        if (s.avail_in != 0 && input.seekable()) {
+            input.seek(-static_cast<ssize_t>(s.avail_in), seek_dir::current);
+        }
+        return true;
+    }
+
+} // namespace tavros::core
@@ -1,11 +1,36 @@
 #pragma once
 
+#include <tavros/core/io/stream_reader.hpp>
+#include <tavros/core/io/stream_writer.hpp>
 #include <tavros/core/memory/buffer_view.hpp>
 #include <tavros/core/memory/buffer_span.hpp>
+#include <tavros/core/memory/memory.hpp>
+#include <tavros/core/noncopyable.hpp>
 
 namespace tavros::core
 {
 
+    /**
+     * @brief Trade-off between compression ratio and speed.
+     */
+    enum class compression_level : uint8
+    {
+        /// Stores the data without compression, only adds the zlib framing.
+        none,
+
+        /// Fastest compression, lowest ratio (zlib level 1).
+        fastest,
+
+        /// Default zlib trade-off (zlib level 6).
+        balanced,
+
+        /// Highest ratio, slowest compression (zlib level 9).
+        best,
+    };
+
+    /** Returns a string representation of the compression level. */
+    string_view to_string(compression_level level) noexcept;
+
     /**
      * @brief Uncompresses data from a compressed buffer into a destination buffer.
      *
@@ -24,4 +49,103 @@ namespace tavros::core
      */
     bool uncompress_data(buffer_view<uint8> compressed_data, buffer_span<uint8> output);
 
+    /**
+     * @brief Returns the largest size of zlib data compressed from @p size bytes.
+     */
+    [[nodiscard]] size_t compress_bound(size_t size) noexcept;
+
+    /**
+     * @brief Reusable zlib deflate state.
+     *
+     * Compresses either whole buffers or a stream read from a @ref basic_stream_reader into a
+     * @ref basic_stream_writer, without knowing the size up front. The zlib state and the
+     * staging buffers are allocated once and reset between calls, so one object can compress
+     * many assets without allocating again.
+     *
+     * The output is a regular zlib stream, readable by @ref inflate_stream and @ref uncompress_data().
+     * Not thread-safe; use one object per thread.
+     */
+    class deflate_stream : noncopyable
+    {
+    public:
+        /**
+         * @brief Creates the deflate state for the given @p level.
+         */
+        explicit deflate_stream(compression_level level = compression_level::balanced);
+
+        /**
+         * @brief Releases the deflate state.
+         */
+        ~deflate_stream() noexcept;
+
+        /**
+         * @brief Compresses @p input into @p output.
+         *
+         * @return Number of bytes written to @p output, or 0 if it is too small; @ref compress_bound() is always enough.
+         */
+        size_t compress(buffer_view<uint8> input, buffer_span<uint8> output);
+
+        /**
+         * @brief Compresses everything that is left in @p input and writes it to @p output.
+         *
+         * @return Number of compressed bytes written, or 0 if @p input or @p output failed.
+         */
+        size_t compress(basic_stream_reader& input, basic_stream_writer& output);
+
+        /**
+         * @brief Returns the compression level.
+         */
+        [[nodiscard]] compression_level level() const noexcept;
+
+    private:
+        struct impl;
+        unique_ptr<impl> m_impl;
+    };
+
+    /**
+     * @brief Reusable zlib inflate state.
+     *
+     * Uncompresses zlib data from buffers or from a @ref basic_stream_reader into a
+     * @ref basic_stream_writer, so the uncompressed size does not need to be known up front.
+     * Like @ref deflate_stream, the state is reset rather than recreated between calls.
+     *
+     * Notes:
+     * - The stream overload reads the input ahead in blocks. If the reader is seekable, it is
+     *   moved back to the first byte after the compressed data, so other data may follow it.
+     * - Not thread-safe; use one object per thread.
+     */
+    class inflate_stream : noncopyable
+    {
+    public:
+        /**
+         * @brief Creates the inflate state.
+         */
+        inflate_stream();
+
+        /**
+         * @brief Releases the inflate state.
+         */
+        ~inflate_stream() noexcept;
+
+        /**
+         * @brief Uncompresses @p input, which must hold one whole zlib stream, into @p output.
+         *
+         * Same contract as @ref uncompress_data(): the uncompressed size must match @p output.size().
+         *
+         * @return true on success, false if the data is corrupt or its size does not match.
+         */
+        bool uncompress(buffer_view<uint8> input, buffer_span<uint8> output);
+
+        /**
+         * @brief Uncompresses one zlib stream from @p input and writes it to @p output.
+         *
+         * @return true if the whole stream was uncompressed and written.
+         */
+        bool uncompress(basic_stream_reader& input, basic_stream_writer& output);
+
+    private:
+        struct impl;
+        unique_ptr<impl> m_impl;
+    };
+
 } // namespace tavros::core
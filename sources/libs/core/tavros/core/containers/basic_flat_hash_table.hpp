@@ -0,0 +1,715 @@
+#pragma once
+
+#include <tavros/core/types.hpp>
+#include <tavros/core/debug/assert.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tavros::core::detail
+{
+
+    /**
+     * @brief Open-addressing hash table shared by @ref flat_hash_map and @ref flat_hash_set.
+     *
+     * Elements are stored inline in a single array and placed with Robin Hood linear probing:
+     * an element that is further from its home slot takes the place of one that is closer,
+     * so probe lengths stay short and even, and a lookup for a missing key stops as soon as
+     * it meets an element closer to home than the key would be.
+     *
+     * Features and design choices:
+     * - A separate byte array keeps the probe distance of every slot (0 means empty):
+     *   - Probing touches the small distance array first and compares keys only on a distance match.
+     * - Erase shifts the following elements back by one slot, there are no tombstones:
+     *   - The table never degrades after many insert/erase cycles.
+     * - The array does not wrap around, it has an overflow area past the last home slot:
+     *   - Probing is a plain forward scan, and erasing during iteration never revisits an element.
+     *   - When a probe would run past the overflow area the table grows, whatever the load.
+     * - Keys are spread with a multiplicative (Fibonacci) hash, so identity hashes of
+     *   integers and pointers distribute well over a power-of-two capacity.
+     *
+     * Notes:
+     * - Any insertion that grows the table invalidates iterators, pointers and references.
+     *   Erase invalidates iterators and references to the elements after the erased one.
+     * - Lookups by a key of another type are enabled when both Hasher and Eq define `is_transparent`.
+     *
+     * @tparam Policy Describes the stored value: `key_type`, `value_type`, `k_const_values` and `key(value)`.
+     */
+    template<class Policy, class Hasher, class Eq>
+        requires std::is_nothrow_move_constructible_v<typename Policy::value_type>
+    class basic_flat_hash_table
+    {
+    public:
+        using key_type = typename Policy::key_type;
+        using value_type = typename Policy::value_type;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using hasher = Hasher;
+        using key_equal = Eq;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+    private:
+        template<bool IsConst>
+        class basic_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename Policy::value_type;
+            using difference_type = ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+            using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        public:
+            basic_iterator() noexcept = default;
+
+            template<bool C = IsConst>
+                requires C
+            basic_iterator(const basic_iterator<false>& other) noexcept
+                : m_slot(other.m_slot)
+                , m_dist(other.m_dist)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return *m_slot;
+            }
+
+            pointer operator->() const noexcept
+            {
+                return m_slot;
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                // The sentinel past the last slot is never zero, so the scan always stops
+                do {
+                    ++m_slot;
+                    ++m_dist;
+                } while (*m_dist == 0);
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                auto tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept
+            {
+                return a.m_slot == b.m_slot;
+            }
+
+        private:
+            basic_iterator(pointer slot, const uint8* dist) noexcept
+                : m_slot(slot)
+                , m_dist(dist)
+            {
+            }
+
+            friend class basic_flat_hash_table;
+            friend class basic_iterator<!IsConst>;
+
+        private:
+            pointer      m_slot = nullptr;
+            const uint8* m_dist = nullptr;
+        };
+
+    public:
+        using const_iterator = basic_iterator<true>;
+        using iterator = std::conditional_t<Policy::k_const_values, const_iterator, basic_iterator<false>>;
+
+        /// Whether heterogeneous lookup is enabled.
+        constexpr static bool k_transparent = requires {
+            typename Hasher::is_transparent;
+            typename Eq::is_transparent;
+        };
+
+        /// Smallest number of home slots allocated by the table.
+        constexpr static size_t k_min_capacity = 16;
+
+    public:
+        /**
+         * @brief Constructs an empty table without allocating memory.
+         */
+        basic_flat_hash_table() noexcept = default;
+
+        /**
+         * @brief Constructs an empty table able to hold @p count elements without growing.
+         */
+        explicit basic_flat_hash_table(size_t count, const Hasher& hash = Hasher(), const Eq& eq = Eq())
+            : m_hash(hash)
+            , m_eq(eq)
+        {
+            reserve(count);
+        }
+
+        basic_flat_hash_table(const basic_flat_hash_table& other)
+            : m_hash(other.m_hash)
+            , m_eq(other.m_eq)
+        {
+            copy_from(other);
+        }
+
+        basic_flat_hash_table(basic_flat_hash_table&& other) noexcept
+            : m_hash(std::move(other.m_hash))
+            , m_eq(std::move(other.m_eq))
+        {
+            steal(other);
+        }
+
+        ~basic_flat_hash_table()
+        {
+            release();
+        }
+
+        basic_flat_hash_table& operator=(const basic_flat_hash_table& other)
+        {
+            if (this != &other) {
+                release();
+                m_hash = other.m_hash;
+                m_eq = other.m_eq;
+                copy_from(other);
+            }
+            return *this;
+        }
+
+        basic_flat_hash_table& operator=(basic_flat_hash_table&& other) noexcept
+        {
+            if (this != &other) {
+                release();
+                m_hash = std::move(other.m_hash);
+                m_eq = std::move(other.m_eq);
+                steal(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Swaps contents with another table.
+         */
+        void swap(basic_flat_hash_table& other) noexcept
+        {
+            std::swap(m_slots, other.m_slots);
+            std::swap(m_dist, other.m_dist);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+            std::swap(m_slot_count, other.m_slot_count);
+            std::swap(m_max_dist, other.m_max_dist);
+            std::swap(m_shift, other.m_shift);
+            std::swap(m_hash, other.m_hash);
+            std::swap(m_eq, other.m_eq);
+        }
+
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return make_iterator(first_occupied());
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return make_iterator(first_occupied());
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return make_iterator(m_slot_count);
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return make_iterator(m_slot_count);
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        /**
+         * @brief Returns the number of stored elements.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Checks whether the table has no elements.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        /**
+         * @brief Returns the number of home slots (always zero or a power of two).
+         */
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Returns the current ratio of elements to home slots.
+         */
+        [[nodiscard]] float load_factor() const noexcept
+        {
+            return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+        }
+
+        /**
+         * @brief Grows the table so that @p count elements fit without further growth.
+         */
+        void reserve(size_t count)
+        {
+            const size_t required = capacity_for(count);
+            if (required > m_capacity) {
+                rehash_to(required);
+            }
+        }
+
+        /**
+         * @brief Destroys all elements. Capacity is preserved.
+         */
+        void clear() noexcept
+        {
+            if (m_size == 0) {
+                return;
+            }
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                for (size_t i = 0; i < m_slot_count; ++i) {
+                    if (m_dist[i]) {
+                        std::destroy_at(m_slots + i);
+                    }
+                }
+            }
+            std::memset(m_dist, 0, m_slot_count);
+            m_size = 0;
+        }
+
+        /**
+         * @brief Finds the element with the given key.
+         *
+         * @return Iterator to the element, or end() if there is none.
+         */
+        [[nodiscard]] iterator find(const key_type& key) noexcept
+        {
+            return make_iterator(find_index(key));
+        }
+
+        [[nodiscard]] const_iterator find(const key_type& key) const noexcept
+        {
+            return make_iterator(find_index(key));
+        }
+
+        template<class K>
+            requires k_transparent
+        [[nodiscard]] iterator find(const K& key) noexcept
+        {
+            return make_iterator(find_index(key));
+        }
+
+        template<class K>
+            requires k_transparent
+        [[nodiscard]] const_iterator find(const K& key) const noexcept
+        {
+            return make_iterator(find_index(key));
+        }
+
+        /**
+         * @brief Checks whether an element with the given key is present.
+         */
+        [[nodiscard]] bool contains(const key_type& key) const noexcept
+        {
+            return find_index(key) != m_slot_count;
+        }
+
+        template<class K>
+            requires k_transparent
+        [[nodiscard]] bool contains(const K& key) const noexcept
+        {
+            return find_index(key) != m_slot_count;
+        }
+
+        /**
+         * @brief Returns the number of elements with the given key (0 or 1).
+         */
+        [[nodiscard]] size_t count(const key_type& key) const noexcept
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        template<class K>
+            requires k_transparent
+        [[nodiscard]] size_t count(const K& key) const noexcept
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        /**
+         * @brief Removes the element with the given key.
+         *
+         * @return Number of removed elements (0 or 1).
+         */
+        size_t erase(const key_type& key) noexcept
+        {
+            return erase_key(key);
+        }
+
+        template<class K>
+            requires k_transparent && (!std::is_convertible_v<K, const_iterator>)
+        size_t erase(const K& key) noexcept
+        {
+            return erase_key(key);
+        }
+
+        /**
+         * @brief Removes the element at @p pos.
+         *
+         * @return Iterator to the element that followed the removed one.
+         */
+        iterator erase(const_iterator pos) noexcept
+        {
+            TAV_ASSERT(pos != end());
+            const auto i = static_cast<size_t>(pos.m_dist - m_dist);
+            erase_index(i);
+            return make_iterator(next_occupied(i));
+        }
+
+        iterator erase(iterator pos) noexcept
+            requires(!Policy::k_const_values)
+        {
+            return erase(const_iterator(pos));
+        }
+
+        /**
+         * @brief Inserts a value if no element with an equal key exists.
+         *
+         * @return Iterator to the element with the key, and whether the value was inserted.
+         */
+        std::pair<iterator, bool> insert(const value_type& value)
+        {
+            return emplace_with_key(Policy::key(value), value);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value)
+        {
+            return emplace_with_key(Policy::key(value), std::move(value));
+        }
+
+        /**
+         * @brief Constructs a value in place if no element with an equal key exists.
+         *
+         * The value is built before the lookup, so it is constructed even when the key is present.
+         */
+        template<class... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            value_type value(std::forward<Args>(args)...);
+            return emplace_with_key(Policy::key(value), std::move(value));
+        }
+
+    protected:
+        /**
+         * @brief Inserts an element with @p key constructed from @p args unless the key is present.
+         */
+        template<class K, class... Args>
+        std::pair<iterator, bool> emplace_with_key(const K& key, Args&&... args)
+        {
+            auto [i, inserted] = find_or_prepare(key);
+            if (inserted) {
+                construct_slot(i, std::forward<Args>(args)...);
+            }
+            return {make_iterator(i), inserted};
+        }
+
+        /**
+         * @brief Returns the slot that holds @p key or a freshly opened slot for it.
+         *
+         * A freshly opened slot holds no object, the caller must construct one with construct_slot().
+         */
+        template<class K>
+        std::pair<size_t, bool> find_or_prepare(const K& key)
+        {
+            const auto hash = static_cast<size_t>(m_hash(key));
+            if (m_capacity) {
+                size_t i = home_of(hash);
+                uint32 d = 1;
+                for (; m_dist[i] >= d; ++i, ++d) {
+                    if (m_dist[i] == d && m_eq(Policy::key(m_slots[i]), key)) {
+                        return {i, false};
+                    }
+                }
+                if (fits_one_more() && make_room(i, d)) {
+                    return {i, true};
+                }
+            }
+            return {prepare(hash), true};
+        }
+
+        template<class... Args>
+        void construct_slot(size_t i, Args&&... args)
+        {
+            try {
+                std::construct_at(m_slots + i, std::forward<Args>(args)...);
+            } catch (...) {
+                close_gap(i);
+                throw;
+            }
+            ++m_size;
+        }
+
+        value_type& slot(size_t i) noexcept
+        {
+            return m_slots[i];
+        }
+
+        iterator make_iterator(size_t i) noexcept
+        {
+            return iterator(m_slots + i, m_dist + i);
+        }
+
+        const_iterator make_iterator(size_t i) const noexcept
+        {
+            return const_iterator(m_slots + i, m_dist + i);
+        }
+
+        template<class K>
+        size_t find_index(const K& key) const noexcept
+        {
+            if (m_size == 0) {
+                return m_slot_count;
+            }
+            size_t i = home_of(static_cast<size_t>(m_hash(key)));
+            for (uint32 d = 1; m_dist[i] >= d; ++i, ++d) {
+                if (m_dist[i] == d && m_eq(Policy::key(m_slots[i]), key)) {
+                    return i;
+                }
+            }
+            return m_slot_count;
+        }
+
+    private:
+        // The probe distance stored for a slot is the number of steps from home plus one,
+        // the sentinel past the last slot is 1: non-zero for iteration, and below any
+        // distance a probe can have when it gets there, so lookups stop on it
+        constexpr static uint8  k_sentinel = 1;
+        constexpr static uint64 k_fibonacci = 0x9e3779b97f4a7c15ull;
+
+        static size_t capacity_for(size_t count) noexcept
+        {
+            // Max load factor is 0.8
+            if (count == 0) {
+                return 0;
+            }
+            return std::max(k_min_capacity, std::bit_ceil(count + count / 4 + 1));
+        }
+
+        size_t home_of(size_t hash) const noexcept
+        {
+            return static_cast<size_t>((static_cast<uint64>(hash) * k_fibonacci) >> m_shift);
+        }
+
+        bool fits_one_more() const noexcept
+        {
+            return (m_size + 1) * 5 <= m_capacity * 4;
+        }
+
+        size_t first_occupied() const noexcept
+        {
+            return m_size ? next_occupied(0) : m_slot_count;
+        }
+
+        size_t next_occupied(size_t i) const noexcept
+        {
+            while (m_dist[i] == 0) {
+                ++i;
+            }
+            return i;
+        }
+
+        // Opens a slot for a new element, growing the table until the element fits
+        size_t prepare(size_t hash)
+        {
+            while (true) {
+                if (m_capacity && fits_one_more()) {
+                    size_t i = home_of(hash);
+                    uint32 d = 1;
+                    for (; m_dist[i] >= d; ++i, ++d) {
+                    }
+                    if (make_room(i, d)) {
+                        return i;
+                    }
+                }
+                rehash_to(std::max(k_min_capacity, m_capacity * 2));
+            }
+        }
+
+        // Moves the run of elements starting at i one slot further to free slot i for an element
+        // with distance d. Fails if any element would end up past the allowed distance
+        bool make_room(size_t i, uint32 d) noexcept
+        {
+            if (d > m_max_dist) {
+                return false;
+            }
+
+            // The last slot can never be occupied, so the scan stops before the sentinel
+            size_t e = i;
+            for (; m_dist[e] != 0; ++e) {
+                if (m_dist[e] >= m_max_dist) {
+                    return false;
+                }
+            }
+
+            for (size_t j = e; j > i; --j) {
+                std::construct_at(m_slots + j, std::move(m_slots[j - 1]));
+                std::destroy_at(m_slots + j - 1);
+                m_dist[j] = static_cast<uint8>(m_dist[j - 1] + 1);
+            }
+            m_dist[i] = static_cast<uint8>(d);
+            return true;
+        }
+
+        template<class K>
+        size_t erase_key(const K& key) noexcept
+        {
+            const size_t i = find_index(key);
+            if (i == m_slot_count) {
+                return 0;
+            }
+            erase_index(i);
+            return 1;
+        }
+
+        void erase_index(size_t i) noexcept
+        {
+            std::destroy_at(m_slots + i);
+            --m_size;
+            close_gap(i);
+        }
+
+        // Shifts the elements after the empty slot i back towards their home slots
+        void close_gap(size_t i) noexcept
+        {
+            size_t j = i + 1;
+            for (; m_dist[j] > 1; ++j) {
+                std::construct_at(m_slots + j - 1, std::move(m_slots[j]));
+                std::destroy_at(m_slots + j);
+                m_dist[j - 1] = static_cast<uint8>(m_dist[j] - 1);
+            }
+            m_dist[j - 1] = 0;
+        }
+
+        void allocate(size_t capacity)
+        {
+            TAV_ASSERT(std::has_single_bit(capacity));
+            const auto log2 = static_cast<uint32>(std::countr_zero(capacity));
+
+            m_capacity = capacity;
+            m_shift = 64 - log2;
+            m_max_dist = std::clamp<uint32>(log2 * 4, 16, 254);
+            m_slot_count = capacity + m_max_dist;
+
+            const size_t bytes = m_slot_count * sizeof(value_type) + m_slot_count + 1;
+            void*        mem = ::operator new(bytes, std::align_val_t{alignof(value_type)});
+            m_slots = static_cast<value_type*>(mem);
+            m_dist = reinterpret_cast<uint8*>(m_slots + m_slot_count);
+            std::memset(m_dist, 0, m_slot_count);
+            m_dist[m_slot_count] = k_sentinel;
+        }
+
+        void rehash_to(size_t capacity)
+        {
+            auto* old_slots = m_slots;
+            auto* old_dist = m_dist;
+            auto  old_count = m_slot_count;
+            auto  old_size = m_size;
+
+            allocate(capacity);
+            m_size = 0;
+
+            for (size_t k = 0; k < old_count && m_size < old_size; ++k) {
+                if (old_dist[k]) {
+                    const size_t i = prepare(static_cast<size_t>(m_hash(Policy::key(old_slots[k]))));
+                    std::construct_at(m_slots + i, std::move(old_slots[k]));
+                    std::destroy_at(old_slots + k);
+                    ++m_size;
+                }
+            }
+
+            if (old_slots) {
+                ::operator delete(old_slots, std::align_val_t{alignof(value_type)});
+            }
+        }
+
+        void copy_from(const basic_flat_hash_table& other)
+        {
+            if (other.m_size == 0) {
+                return;
+            }
+
+            // Same capacity and hash, so every element keeps its slot
+            allocate(other.m_capacity);
+            for (size_t i = 0; i < other.m_slot_count; ++i) {
+                if (other.m_dist[i]) {
+                    std::construct_at(m_slots + i, other.m_slots[i]);
+                    m_dist[i] = other.m_dist[i];
+                    ++m_size;
+                }
+            }
+        }
+
+        void steal(basic_flat_hash_table& other) noexcept
+        {
+            m_slots = std::exchange(other.m_slots, nullptr);
+            m_dist = std::exchange(other.m_dist, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_slot_count = std::exchange(other.m_slot_count, 0);
+            m_max_dist = std::exchange(other.m_max_dist, 0);
+            m_shift = std::exchange(other.m_shift, 64);
+        }
+
+        void release() noexcept
+        {
+            if (!m_slots) {
+                return;
+            }
+            clear();
+            ::operator delete(m_slots, std::align_val_t{alignof(value_type)});
+            m_slots = nullptr;
+            m_dist = nullptr;
+            m_capacity = 0;
+            m_slot_count = 0;
+            m_max_dist = 0;
+            m_shift = 64;
+        }
+
+    private:
+        value_type* m_slots = nullptr;
+        uint8*      m_dist = nullptr;
+        size_t      m_size = 0;
+        size_t      m_capacity = 0;   // home slots, a power of two
+        size_t      m_slot_count = 0; // home slots plus the overflow area
+        uint32      m_max_dist = 0;
+        uint32      m_shift = 64;
+        Hasher      m_hash;
+        Eq          m_eq;
+    };
+
+} // namespace tavros::core::detail
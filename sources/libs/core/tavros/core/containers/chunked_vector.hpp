@@ -0,0 +1,490 @@
+#pragma once
+
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/memory/buffer_span.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/types.hpp>
+
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Sequence container that stores its elements in fixed-size chunks.
+     *
+     * Elements live in separately allocated chunks of @p ChunkSize elements; only the small
+     * array of chunk pointers is reallocated when the container grows. Existing elements
+     * are never moved or copied by growth, so pointers and references to them stay valid
+     * until the element is erased, and there is no copy spike when a large container
+     * crosses its capacity.
+     *
+     * Element access costs a shift and a mask on top of a plain array. Code that wants
+     * tight loops over contiguous memory can walk the chunks with @ref chunk().
+     *
+     * @tparam T         Element type. Must be nothrow move-constructible.
+     * @tparam ChunkSize Number of elements per chunk, a power of two.
+     */
+    template<class T, size_t ChunkSize = 256>
+        requires std::is_nothrow_move_constructible_v<T> && (std::has_single_bit(ChunkSize))
+    class chunked_vector
+    {
+        constexpr static size_t k_shift = std::countr_zero(ChunkSize);
+        constexpr static size_t k_mask = ChunkSize - 1;
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+
+        /// Number of elements per chunk.
+        constexpr static size_t k_chunk_size = ChunkSize;
+
+        /**
+         * @brief Random-access iterator over the elements.
+         * @tparam IsConst If @c true, yields const references.
+         */
+        template<bool IsConst>
+        class basic_iterator
+        {
+            using owner_ptr = std::conditional_t<IsConst, const chunked_vector*, chunked_vector*>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T*, T*>;
+            using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        public:
+            constexpr basic_iterator() noexcept = default;
+
+            constexpr basic_iterator(owner_ptr owner, size_type pos) noexcept
+                : m_owner(owner)
+                , m_pos(pos)
+            {
+            }
+
+            /** @brief Implicit conversion from mutable to const iterator. */
+            [[nodiscard]] operator basic_iterator<true>() const noexcept
+                requires(!IsConst)
+            {
+                return basic_iterator<true>(m_owner, m_pos);
+            }
+
+            [[nodiscard]] reference operator*() const noexcept
+            {
+                return (*m_owner)[m_pos];
+            }
+
+            [[nodiscard]] pointer operator->() const noexcept
+            {
+                return &(*m_owner)[m_pos];
+            }
+
+            [[nodiscard]] reference operator[](difference_type n) const noexcept
+            {
+                return (*m_owner)[static_cast<size_type>(static_cast<difference_type>(m_pos) + n)];
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                ++m_pos;
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                auto copy = *this;
+                ++m_pos;
+                return copy;
+            }
+
+            basic_iterator& operator--() noexcept
+            {
+                --m_pos;
+                return *this;
+            }
+
+            basic_iterator operator--(int) noexcept
+            {
+                auto copy = *this;
+                --m_pos;
+                return copy;
+            }
+
+            basic_iterator& operator+=(difference_type n) noexcept
+            {
+                m_pos = static_cast<size_type>(static_cast<difference_type>(m_pos) + n);
+                return *this;
+            }
+
+            basic_iterator& operator-=(difference_type n) noexcept
+            {
+                return *this += -n;
+            }
+
+            [[nodiscard]] basic_iterator operator+(difference_type n) const noexcept
+            {
+                auto copy = *this;
+                return copy += n;
+            }
+
+            [[nodiscard]] friend basic_iterator operator+(difference_type n, const basic_iterator& it) noexcept
+            {
+                return it + n;
+            }
+
+            [[nodiscard]] basic_iterator operator-(difference_type n) const noexcept
+            {
+                auto copy = *this;
+                return copy -= n;
+            }
+
+            [[nodiscard]] difference_type operator-(const basic_iterator& other) const noexcept
+            {
+                return static_cast<difference_type>(m_pos) - static_cast<difference_type>(other.m_pos);
+            }
+
+            [[nodiscard]] auto operator<=>(const basic_iterator& other) const noexcept
+            {
+                return m_pos <=> other.m_pos;
+            }
+
+            [[nodiscard]] bool operator==(const basic_iterator& other) const noexcept
+            {
+                return m_pos == other.m_pos;
+            }
+
+        private:
+            owner_ptr m_owner = nullptr;
+            size_type m_pos = 0;
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    public:
+        /** @brief Constructs an empty container without allocating. */
+        chunked_vector() noexcept = default;
+
+        /** @brief Takes over the chunks of @p other, which is left empty. */
+        chunked_vector(chunked_vector&& other) noexcept
+            : m_chunks(std::move(other.m_chunks))
+            , m_size(std::exchange(other.m_size, 0))
+        {
+        }
+
+        /** @brief Destroys the elements and releases all chunks. */
+        ~chunked_vector()
+        {
+            release();
+        }
+
+        /** @brief Releases the current chunks and takes over those of @p other. */
+        chunked_vector& operator=(chunked_vector&& other) noexcept
+        {
+            if (this != &other) {
+                release();
+                m_chunks = std::move(other.m_chunks);
+                m_size = std::exchange(other.m_size, 0);
+            }
+            return *this;
+        }
+
+        /** @brief Returns the element at @p index. Behavior is undefined if @p index >= size(). */
+        [[nodiscard]] T& operator[](size_type index) noexcept
+        {
+            TAV_ASSERT(index < m_size);
+            return m_chunks[index >> k_shift][index & k_mask];
+        }
+
+        /** @brief Const overload of @ref operator[]. */
+        [[nodiscard]] const T& operator[](size_type index) const noexcept
+        {
+            TAV_ASSERT(index < m_size);
+            return m_chunks[index >> k_shift][index & k_mask];
+        }
+
+        /**
+         * @brief Returns the element at @p index.
+         * @throws std::out_of_range if @p index >= size().
+         */
+        [[nodiscard]] T& at(size_type index)
+        {
+            if (index >= m_size) {
+                throw std::out_of_range("chunked_vector::at");
+            }
+            return (*this)[index];
+        }
+
+        /** @brief Const overload of @ref at(). */
+        [[nodiscard]] const T& at(size_type index) const
+        {
+            if (index >= m_size) {
+                throw std::out_of_range("chunked_vector::at");
+            }
+            return (*this)[index];
+        }
+
+        [[nodiscard]] T& front() noexcept
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] const T& front() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] T& back() noexcept
+        {
+            return (*this)[m_size - 1];
+        }
+
+        [[nodiscard]] const T& back() const noexcept
+        {
+            return (*this)[m_size - 1];
+        }
+
+        /** @brief Returns the number of chunks holding at least one element. */
+        [[nodiscard]] size_type chunk_count() const noexcept
+        {
+            return (m_size + k_mask) >> k_shift;
+        }
+
+        /**
+         * @brief Returns the elements stored in chunk @p i as a contiguous span.
+         * @pre i < chunk_count()
+         */
+        [[nodiscard]] buffer_span<T> chunk(size_type i) noexcept
+        {
+            TAV_ASSERT(i < chunk_count());
+            return buffer_span<T>(m_chunks[i], chunk_length(i));
+        }
+
+        /** @brief Const overload of @ref chunk(). */
+        [[nodiscard]] buffer_view<T> chunk(size_type i) const noexcept
+        {
+            TAV_ASSERT(i < chunk_count());
+            return buffer_view<T>(m_chunks[i], chunk_length(i));
+        }
+
+        /** @brief Returns true if the container has no elements. */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        /** @brief Returns the number of elements. */
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return m_size;
+        }
+
+        /** @brief Returns the maximum number of elements. */
+        [[nodiscard]] size_type max_size() const noexcept
+        {
+            return m_chunks.max_size() * ChunkSize;
+        }
+
+        /** @brief Returns the number of elements the allocated chunks can hold. */
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return m_chunks.size() * ChunkSize;
+        }
+
+        /** @brief Allocates chunks until at least @p new_cap elements fit. */
+        void reserve(size_type new_cap)
+        {
+            const size_type needed = (new_cap + k_mask) >> k_shift;
+            if (needed > m_chunks.size()) {
+                m_chunks.reserve(needed);
+                while (m_chunks.size() < needed) {
+                    add_chunk();
+                }
+            }
+        }
+
+        /** @brief Releases the chunks that hold no elements. */
+        void shrink_to_fit()
+        {
+            while (m_chunks.size() > chunk_count()) {
+                free_chunk(m_chunks.back());
+                m_chunks.pop_back();
+            }
+            m_chunks.shrink_to_fit();
+        }
+
+        /** @brief Destroys all elements; the chunks are kept. */
+        void clear() noexcept
+        {
+            destroy_from(0);
+            m_size = 0;
+        }
+
+        /**
+         * @brief Constructs an element in place at the end.
+         * @return Reference to the new element.
+         */
+        template<class... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size == capacity()) {
+                add_chunk();
+            }
+            T* slot = m_chunks[m_size >> k_shift] + (m_size & k_mask);
+            std::construct_at(slot, std::forward<Args>(args)...);
+            ++m_size;
+            return *slot;
+        }
+
+        /** @brief Appends a copy of @p value. */
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        /** @brief Appends @p value by moving it. */
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        /** @brief Removes the last element. @pre !empty() */
+        void pop_back() noexcept
+        {
+            TAV_ASSERT(m_size > 0);
+            --m_size;
+            std::destroy_at(&m_chunks[m_size >> k_shift][m_size & k_mask]);
+        }
+
+        /**
+         * @brief Resizes the container to @p count elements.
+         * @param count New size. New elements are value-initialized.
+         */
+        void resize(size_type count)
+        {
+            if (count < m_size) {
+                destroy_from(count);
+                m_size = count;
+                return;
+            }
+            reserve(count);
+            while (m_size < count) {
+                std::construct_at(m_chunks[m_size >> k_shift] + (m_size & k_mask));
+                ++m_size;
+            }
+        }
+
+        /** @brief Swaps the contents with @p other. */
+        void swap(chunked_vector& other) noexcept
+        {
+            m_chunks.swap(other.m_chunks);
+            std::swap(m_size, other.m_size);
+        }
+
+        [[nodiscard]] iterator begin() noexcept
+        {
+            return iterator(this, 0);
+        }
+
+        [[nodiscard]] iterator end() noexcept
+        {
+            return iterator(this, m_size);
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return const_iterator(this, 0);
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return const_iterator(this, m_size);
+        }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        [[nodiscard]] reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        [[nodiscard]] reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        [[nodiscard]] const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+    private:
+        size_type chunk_length(size_type i) const noexcept
+        {
+            const size_type first = i << k_shift;
+            return m_size - first < ChunkSize ? m_size - first : ChunkSize;
+        }
+
+        void add_chunk()
+        {
+            m_chunks.push_back(nullptr);
+            m_chunks.back() = static_cast<T*>(::operator new(ChunkSize * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+
+        static void free_chunk(T* chunk) noexcept
+        {
+            ::operator delete(chunk, std::align_val_t{alignof(T)});
+        }
+
+        void destroy_from(size_type first) noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_type i = first; i < m_size; ++i) {
+                    std::destroy_at(&(*this)[i]);
+                }
+            }
+        }
+
+        void release() noexcept
+        {
+            destroy_from(0);
+            for (T* chunk : m_chunks) {
+                free_chunk(chunk);
+            }
+            m_chunks.clear();
+            m_size = 0;
+        }
+
+    private:
+        vector<T*> m_chunks; ///< Chunk pointers; only this array moves when the container grows.
+        size_type  m_size = 0;
+    };
+
+} // namespace tavros::core
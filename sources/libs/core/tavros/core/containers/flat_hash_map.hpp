@@ -0,0 +1,117 @@
+#pragma once
+
+#include <tavros/core/containers/basic_flat_hash_table.hpp>
+
+#include <functional>
+#include <initializer_list>
+#include <tuple>
+
+namespace tavros::core
+{
+
+    namespace detail
+    {
+        template<class Key, class Value>
+        struct flat_map_policy
+        {
+            using key_type = Key;
+            using value_type = std::pair<Key, Value>;
+
+            constexpr static bool k_const_values = false;
+
+            static const key_type& key(const value_type& value) noexcept
+            {
+                return value.first;
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Cache-friendly hash map with open addressing.
+     *
+     * Key-value pairs are stored inline in one array (see detail::basic_flat_hash_table for the probing
+     * scheme), so there is no allocation per element and lookups touch few cache lines.
+     * Prefer it over @ref unordered_map unless the code relies on references staying valid
+     * while the map grows.
+     *
+     * Unlike std::unordered_map, the stored type is `std::pair<Key, Value>` with a mutable key
+     * so that elements can be moved between slots; modifying the key through an iterator is not allowed.
+     *
+     * @tparam Key Key type.
+     * @tparam Value Mapped type.
+     * @tparam Hasher Hash function, transparent hashers enable lookup by other key types.
+     * @tparam Eq Key equality, must be transparent together with the hasher.
+     */
+    template<class Key, class Value, class Hasher = std::hash<Key>, class Eq = std::equal_to<Key>>
+    class flat_hash_map : public detail::basic_flat_hash_table<detail::flat_map_policy<Key, Value>, Hasher, Eq>
+    {
+        using base = detail::basic_flat_hash_table<detail::flat_map_policy<Key, Value>, Hasher, Eq>;
+
+    public:
+        using mapped_type = Value;
+        using typename base::const_iterator;
+        using typename base::iterator;
+        using typename base::key_type;
+        using typename base::value_type;
+
+    public:
+        using base::base;
+
+        flat_hash_map() noexcept = default;
+
+        /**
+         * @brief Constructs the map from an initializer list, later duplicates are ignored.
+         */
+        flat_hash_map(std::initializer_list<value_type> init)
+            : base(init.size())
+        {
+            for (const auto& value : init) {
+                base::insert(value);
+            }
+        }
+
+        /**
+         * @brief Inserts an element constructed from @p args if the key is not present.
+         *
+         * Unlike emplace(), nothing is constructed when the key already exists.
+         */
+        template<class... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return base::emplace_with_key(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template<class... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return base::emplace_with_key(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Assigns @p value to the element with @p key, inserting it if needed.
+         */
+        template<class V>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, V&& value)
+        {
+            auto result = try_emplace(key, std::forward<V>(value));
+            if (!result.second) {
+                result.first->second = std::forward<V>(value);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Returns the value mapped to @p key, inserting a value-initialized one if needed.
+         */
+        Value& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        Value& operator[](key_type&& key)
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+    };
+
+} // namespace tavros::core
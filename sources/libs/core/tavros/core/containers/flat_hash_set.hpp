@@ -0,0 +1,62 @@
+#pragma once
+
+#include <tavros/core/containers/basic_flat_hash_table.hpp>
+
+#include <functional>
+#include <initializer_list>
+
+namespace tavros::core
+{
+
+    namespace detail
+    {
+        template<class Key>
+        struct flat_set_policy
+        {
+            using key_type = Key;
+            using value_type = Key;
+
+            constexpr static bool k_const_values = true;
+
+            static const key_type& key(const value_type& value) noexcept
+            {
+                return value;
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Cache-friendly hash set with open addressing.
+     *
+     * Keys are stored inline in one array (see detail::basic_flat_hash_table for the probing scheme),
+     * so there is no allocation per element and lookups touch few cache lines.
+     * Prefer it over @ref unordered_set unless the code relies on references staying valid
+     * while the set grows.
+     *
+     * @tparam Key Key type.
+     * @tparam Hasher Hash function, transparent hashers enable lookup by other key types.
+     * @tparam Eq Key equality, must be transparent together with the hasher.
+     */
+    template<class Key, class Hasher = std::hash<Key>, class Eq = std::equal_to<Key>>
+    class flat_hash_set : public detail::basic_flat_hash_table<detail::flat_set_policy<Key>, Hasher, Eq>
+    {
+        using base = detail::basic_flat_hash_table<detail::flat_set_policy<Key>, Hasher, Eq>;
+
+    public:
+        using base::base;
+
+        flat_hash_set() noexcept = default;
+
+        /**
+         * @brief Constructs the set from an initializer list, duplicates are ignored.
+         */
+        flat_hash_set(std::initializer_list<Key> init)
+            : base(init.size())
+        {
+            for (const auto& key : init) {
+                base::insert(key);
+            }
+        }
+    };
+
+} // namespace tavros::core
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/ids/handle_base.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Stable generational handles over the rows of a table or archetype.
+     *
+     * Wraps a @p Table (any @ref basic_table or @ref basic_archetype) and gives every row a
+     * @ref handle_base that survives the renumbering done by @c swap_and_pop. Rows stay
+     * densely packed, so iteration over the table is as fast as without handles; a handle
+     * resolves to its current row through one indirection.
+     *
+     * Features and design choices:
+     * - Every handle refers to a slot; a slot maps to the current row of its element and
+     *   every row maps back to its slot:
+     *   - @ref erase moves the last row into the hole and patches the slot of the moved row.
+     * - Slots carry a generation counter that is incremented when the slot is freed:
+     *   - Handles to erased rows fail @ref is_valid even after their slot is reused.
+     * - Freed slots are kept in an intrusive free list and reused before new slots are added.
+     * Notes:
+     * - Rows are added and removed only through this class, which is why the underlying
+     *   table is exposed read-only; component data stays writable through @ref get and @ref view.
+     * - With @ref chunked_table / @ref chunked_archetype the components of a row also keep
+     *   their address on growth; a row moves only when it is the last one and another row is erased.
+     * - The class is move-only and not thread-safe.
+     *
+     * @tparam Tag   Handle tag satisfying @ref handle_tagged.
+     * @tparam Table Row storage, e.g. @c chunked_archetype<Position, Velocity>.
+     */
+    template<handle_tagged Tag, class Table>
+    class handle_table
+    {
+    public:
+        using handle_type = handle_base<Tag>;
+        using table_type = Table;
+        using size_type = typename Table::size_type;
+        using reference = typename Table::reference;
+        using const_reference = typename Table::const_reference;
+
+    public:
+        /** @brief Constructs an empty table without allocating. */
+        handle_table() noexcept = default;
+
+        handle_table(handle_table&&) noexcept = default;
+        handle_table& operator=(handle_table&&) noexcept = default;
+
+        ~handle_table() noexcept = default;
+
+        /**
+         * @brief Appends a row by moving positional arguments into each column.
+         * @return Handle of the new row.
+         * @see basic_table::emplace_back
+         */
+        template<class... Args>
+        handle_type emplace_back(Args&&... args)
+        {
+            return append([&] { m_rows.emplace_back(std::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief Appends a row by matching arguments to columns by type.
+         * @return Handle of the new row.
+         * @see basic_table::typed_emplace_back
+         */
+        template<class... Args>
+        handle_type typed_emplace_back(Args&&... args)
+        {
+            return append([&] { m_rows.typed_emplace_back(std::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief Removes the row referenced by @p handle.
+         *
+         * The last row is moved into the freed position; its handle stays valid.
+         *
+         * @return @c true if the handle was live and its row has been removed, @c false otherwise.
+         */
+        bool erase(handle_type handle) noexcept
+        {
+            if (!is_valid(handle)) {
+                return false;
+            }
+
+            const index_t slot = handle.index();
+            const index_t row = m_slot_row[slot];
+            const index_t last = static_cast<index_t>(m_row_slot.size() - 1);
+
+            m_rows.swap_and_pop(row);
+            if (row != last) {
+                const index_t moved = m_row_slot[last];
+                m_slot_row[moved] = row;
+                m_row_slot[row] = moved;
+            }
+            m_row_slot.pop_back();
+            release_slot(slot);
+            return true;
+        }
+
+        /**
+         * @brief Returns @c true if @p handle refers to a live row of this table.
+         */
+        [[nodiscard]] bool is_valid(handle_type handle) const noexcept
+        {
+            const index_t slot = handle.index();
+            return handle.valid() && slot < m_slot_gen.size() && m_slot_gen[slot] == handle.generation();
+        }
+
+        /**
+         * @brief Returns the current row index of @p handle.
+         * @pre is_valid(handle)
+         */
+        [[nodiscard]] size_type index_of(handle_type handle) const noexcept
+        {
+            TAV_ASSERT(is_valid(handle));
+            return m_slot_row[handle.index()];
+        }
+
+        /**
+         * @brief Returns the handle of the row at @p index.
+         * @pre index < size()
+         */
+        [[nodiscard]] handle_type handle_at(size_type index) const noexcept
+        {
+            TAV_ASSERT(index < size());
+            const index_t slot = m_row_slot[index];
+            return handle_type(m_slot_gen[slot], slot);
+        }
+
+        /**
+         * @brief Returns a tuple of references to all components of the row of @p handle.
+         * @pre is_valid(handle)
+         */
+        [[nodiscard]] reference get(handle_type handle) noexcept
+        {
+            return m_rows[index_of(handle)];
+        }
+
+        /** @brief Const overload of @ref get(handle_type). */
+        [[nodiscard]] const_reference get(handle_type handle) const noexcept
+        {
+            return m_rows[index_of(handle)];
+        }
+
+        /**
+         * @brief Returns the component @p T of the row of @p handle.
+         * @pre is_valid(handle)
+         */
+        template<class T>
+        [[nodiscard]] T& get(handle_type handle) noexcept
+        {
+            return m_rows.template get<T>()[index_of(handle)];
+        }
+
+        /** @brief Const overload of @ref get(handle_type). */
+        template<class T>
+        [[nodiscard]] const T& get(handle_type handle) const noexcept
+        {
+            return m_rows.template get<T>()[index_of(handle)];
+        }
+
+        /**
+         * @brief Returns a pointer to the component @p T of the row of @p handle.
+         * @return Pointer to the component, or @c nullptr if the handle is not live.
+         */
+        template<class T>
+        [[nodiscard]] T* try_get(handle_type handle) noexcept
+        {
+            return is_valid(handle) ? &get<T>(handle) : nullptr;
+        }
+
+        /** @brief Const overload of @ref try_get(). */
+        template<class T>
+        [[nodiscard]] const T* try_get(handle_type handle) const noexcept
+        {
+            return is_valid(handle) ? &get<T>(handle) : nullptr;
+        }
+
+        /**
+         * @brief Creates a view over a subset of component columns of the underlying archetype.
+         * @see basic_archetype::view
+         */
+        template<class... Ts>
+            requires requires(Table& t) { t.template view<Ts...>(); }
+        [[nodiscard]] auto view()
+        {
+            return m_rows.template view<Ts...>();
+        }
+
+        /** @brief Const overload of @ref view(). */
+        template<class... Ts>
+            requires requires(const Table& t) { t.template view<Ts...>(); }
+        [[nodiscard]] auto view() const
+        {
+            return m_rows.template view<Ts...>();
+        }
+
+        /**
+         * @brief Returns the underlying row storage for read-only access and iteration.
+         */
+        [[nodiscard]] const Table& rows() const noexcept
+        {
+            return m_rows;
+        }
+
+        /** @brief Returns the number of rows. */
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return m_rows.size();
+        }
+
+        /** @brief Returns @c true if the table has no rows. */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_rows.empty();
+        }
+
+        /**
+         * @brief Reserves storage for at least @p new_cap rows and handles.
+         */
+        void reserve(size_type new_cap)
+        {
+            m_rows.reserve(new_cap);
+            m_row_slot.reserve(new_cap);
+            m_slot_row.reserve(new_cap);
+            m_slot_gen.reserve(new_cap);
+        }
+
+        /**
+         * @brief Removes all rows. Every handle issued so far becomes invalid.
+         */
+        void clear() noexcept
+        {
+            m_rows.clear();
+            for (index_t slot : m_row_slot) {
+                release_slot(slot);
+            }
+            m_row_slot.clear();
+        }
+
+    private:
+        template<class Emplace>
+        handle_type append(Emplace&& emplace)
+        {
+            TAV_ASSERT(m_row_slot.size() < invalid_index);
+            if (m_free_head == invalid_index) {
+                m_slot_gen.push_back(0);
+                m_slot_row.push_back(invalid_index);
+                m_free_head = static_cast<index_t>(m_slot_row.size() - 1);
+            }
+
+            const index_t slot = m_free_head;
+            m_row_slot.push_back(slot);
+            try {
+                emplace();
+            } catch (...) {
+                m_row_slot.pop_back();
+                throw;
+            }
+
+            m_free_head = m_slot_row[slot];
+            m_slot_row[slot] = static_cast<index_t>(m_row_slot.size() - 1);
+            return handle_type(m_slot_gen[slot], slot);
+        }
+
+        void release_slot(index_t slot) noexcept
+        {
+            ++m_slot_gen[slot];
+            m_slot_row[slot] = m_free_head;
+            m_free_head = slot;
+        }
+
+    private:
+        Table                m_rows;
+        vector<index_t>      m_row_slot;                  ///< Row index -> slot.
+        vector<index_t>      m_slot_row;                  ///< Slot -> row index, or next free slot while free.
+        vector<handle_gen_t> m_slot_gen;                  ///< Current generation of every slot.
+        index_t              m_free_head = invalid_index; ///< First free slot.
+    };
+
+} // namespace tavros::core
@@ -0,0 +1,578 @@
+#pragma once
+
+#include <tavros/core/memory/allocator.hpp>
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/debug/verify.hpp>
+#include <tavros/core/defines.hpp>
+#include <tavros/core/types.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Spill statistics of one @ref small_vector instantiation.
+     */
+    struct small_vector_stats
+    {
+        size_t spill_count = 0;     ///< Number of times the elements were moved to a heap buffer.
+        size_t peak_spill_size = 0; ///< Largest size that required a heap buffer.
+    };
+
+    /**
+     * @brief A vector that keeps up to `N` elements inline and moves to the heap only on overflow.
+     *
+     * Short temporary lists live entirely inside the object, so building them does not touch
+     * the heap. Once the size exceeds `N`, the elements are moved to a buffer obtained from
+     * the given @ref allocator (or the global heap when none is given), and the vector then
+     * grows like `vector`.
+     *
+     * In debug builds every instantiation counts its spills, see @ref stats(); this helps
+     * choosing `N` from real workloads.
+     *
+     * Notes:
+     * - Moving a vector that uses inline storage moves its elements one by one;
+     *   a heap buffer is taken over when both vectors use the same allocator.
+     * - Iterators and references are invalidated by any operation that changes the capacity.
+     *
+     * @tparam T Element type. Must be nothrow move-constructible.
+     * @tparam N Number of elements stored inline.
+     */
+    template<typename T, size_t N>
+        requires std::is_nothrow_move_constructible_v<T> && (N > 0)
+    class small_vector
+    {
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;                                                  /// Mutable iterator type.
+        using const_iterator = const T*;                                      /// Immutable iterator type.
+        using reverse_iterator = std::reverse_iterator<iterator>;             /// Mutable reverse iterator.
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>; /// Immutable reverse iterator.
+
+        constexpr static size_t k_inline_capacity = N;
+
+    public:
+        /**
+         * @brief Constructs an empty vector that spills to the global heap.
+         */
+        small_vector() noexcept = default;
+
+        /**
+         * @brief Constructs an empty vector that spills to @p alc.
+         *
+         * @param alc Allocator for the heap buffer; must outlive the vector. nullptr selects the global heap.
+         */
+        explicit small_vector(allocator* alc) noexcept
+            : m_allocator(alc)
+        {
+        }
+
+        /**
+         * @brief Constructs the vector with @p count copies of @p value.
+         */
+        small_vector(size_t count, const T& value, allocator* alc = nullptr)
+            : m_allocator(alc)
+        {
+            resize(count, value);
+        }
+
+        /**
+         * @brief Constructs the vector from an initializer list.
+         */
+        small_vector(std::initializer_list<T> init, allocator* alc = nullptr)
+            : m_allocator(alc)
+        {
+            reserve(init.size());
+            for (const auto& value : init) {
+                emplace_back(value);
+            }
+        }
+
+        /**
+         * @brief Copies the elements of @p other, the copy uses the same allocator.
+         */
+        small_vector(const small_vector& other)
+            : m_allocator(other.m_allocator)
+        {
+            reserve(other.m_size);
+            std::uninitialized_copy(other.begin(), other.end(), m_data);
+            m_size = other.m_size;
+        }
+
+        /**
+         * @brief Takes the elements of @p other, which is left empty.
+         */
+        small_vector(small_vector&& other) noexcept
+            : m_allocator(other.m_allocator)
+        {
+            take(other);
+        }
+
+        ~small_vector()
+        {
+            std::destroy(begin(), end());
+            release_heap();
+        }
+
+        /**
+         * @brief Replaces the contents with a copy of @p other. The allocator is kept.
+         */
+        small_vector& operator=(const small_vector& other)
+        {
+            if (this != &other) {
+                clear();
+                reserve(other.m_size);
+                std::uninitialized_copy(other.begin(), other.end(), m_data);
+                m_size = other.m_size;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Replaces the contents with the elements of @p other. The allocator is kept.
+         */
+        small_vector& operator=(small_vector&& other)
+        {
+            if (this != &other) {
+                clear();
+                if (other.is_inline() || other.m_allocator != m_allocator) {
+                    // Element-wise move; may need a heap buffer of our own allocator
+                    reserve(other.m_size);
+                    std::uninitialized_move(other.begin(), other.end(), m_data);
+                    m_size = other.m_size;
+                    other.clear();
+                } else {
+                    release_heap();
+                    take(other);
+                }
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr iterator begin() noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr iterator end() noexcept
+        {
+            return m_data + m_size;
+        }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return m_data + m_size;
+        }
+
+        [[nodiscard]] constexpr reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        [[nodiscard]] constexpr reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        [[nodiscard]] constexpr const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        /**
+         * @brief Returns the current number of elements.
+         */
+        [[nodiscard]] constexpr size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the number of elements that fit without growing.
+         */
+        [[nodiscard]] constexpr size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Checks whether the container is empty.
+         */
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        /**
+         * @brief Checks whether the elements are stored inline.
+         */
+        [[nodiscard]] constexpr bool is_inline() const noexcept
+        {
+            return m_data == inline_data();
+        }
+
+        /**
+         * @brief Returns the allocator used for the heap buffer, nullptr for the global heap.
+         */
+        [[nodiscard]] constexpr allocator* get_allocator() const noexcept
+        {
+            return m_allocator;
+        }
+
+        /**
+         * @brief Returns the element at @p p.
+         *
+         * @throws std::out_of_range if @p p is not less than size().
+         */
+        [[nodiscard]] constexpr T& at(size_t p)
+        {
+            if (p >= m_size) {
+                throw std::out_of_range("small_vector::at");
+            }
+            return m_data[p];
+        }
+
+        [[nodiscard]] constexpr const T& at(size_t p) const
+        {
+            if (p >= m_size) {
+                throw std::out_of_range("small_vector::at");
+            }
+            return m_data[p];
+        }
+
+        [[nodiscard]] constexpr T& operator[](size_t p) noexcept
+        {
+            TAV_ASSERT(p < m_size);
+            return m_data[p];
+        }
+
+        [[nodiscard]] constexpr const T& operator[](size_t p) const noexcept
+        {
+            TAV_ASSERT(p < m_size);
+            return m_data[p];
+        }
+
+        [[nodiscard]] constexpr T& front() noexcept
+        {
+            TAV_ASSERT(m_size > 0);
+            return m_data[0];
+        }
+
+        [[nodiscard]] constexpr const T& front() const noexcept
+        {
+            TAV_ASSERT(m_size > 0);
+            return m_data[0];
+        }
+
+        [[nodiscard]] constexpr T& back() noexcept
+        {
+            TAV_ASSERT(m_size > 0);
+            return m_data[m_size - 1];
+        }
+
+        [[nodiscard]] constexpr const T& back() const noexcept
+        {
+            TAV_ASSERT(m_size > 0);
+            return m_data[m_size - 1];
+        }
+
+        [[nodiscard]] constexpr T* data() noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr const T* data() const noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Adds a copy of the given value to the end.
+         */
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        /**
+         * @brief Adds a moved value to the end.
+         */
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        /**
+         * @brief Constructs a new element in place at the end.
+         *
+         * @param args Arguments to forward to T's constructor; may refer to elements of the vector.
+         * @return Reference to the newly constructed element.
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size == m_capacity) {
+                // Build the element first, the arguments may live in the old buffer
+                T value(std::forward<Args>(args)...);
+                grow(m_size + 1);
+                std::construct_at(m_data + m_size, std::move(value));
+            } else {
+                std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            }
+            return m_data[m_size++];
+        }
+
+        /**
+         * @brief Removes the last element.
+         */
+        void pop_back() noexcept
+        {
+            TAV_VERIFY(m_size > 0);
+            std::destroy_at(m_data + --m_size);
+        }
+
+        /**
+         * @brief Inserts @p value before @p pos.
+         *
+         * @return Iterator to the inserted element.
+         */
+        iterator insert(const_iterator pos, T value)
+        {
+            TAV_ASSERT(pos >= begin() && pos <= end());
+            const auto index = static_cast<size_t>(pos - begin());
+            emplace_back(std::move(value));
+            std::rotate(m_data + index, m_data + m_size - 1, m_data + m_size);
+            return m_data + index;
+        }
+
+        /**
+         * @brief Removes the element at @p pos.
+         *
+         * @return Iterator to the element that followed the removed one.
+         */
+        iterator erase(const_iterator pos) noexcept
+        {
+            return erase(pos, pos + 1);
+        }
+
+        /**
+         * @brief Removes the elements in [@p first, @p last).
+         *
+         * @return Iterator to the element that followed the last removed one.
+         */
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            TAV_ASSERT(first >= begin() && first <= last && last <= end());
+            auto* f = m_data + (first - begin());
+            auto* l = m_data + (last - begin());
+            auto* new_end = std::move(l, end(), f);
+            std::destroy(new_end, end());
+            m_size = static_cast<size_t>(new_end - m_data);
+            return f;
+        }
+
+        /**
+         * @brief Resizes the vector, new elements are value-initialized.
+         */
+        void resize(size_t count)
+        {
+            reserve(count);
+            if (count > m_size) {
+                std::uninitialized_value_construct(m_data + m_size, m_data + count);
+            } else {
+                std::destroy(m_data + count, m_data + m_size);
+            }
+            m_size = count;
+        }
+
+        /**
+         * @brief Resizes the vector, new elements are copies of @p value.
+         */
+        void resize(size_t count, const T& value)
+        {
+            if (count > m_capacity) {
+                T copy(value);
+                grow(count);
+                std::uninitialized_fill(m_data + m_size, m_data + count, copy);
+            } else if (count > m_size) {
+                std::uninitialized_fill(m_data + m_size, m_data + count, value);
+            } else {
+                std::destroy(m_data + count, m_data + m_size);
+            }
+            m_size = count;
+        }
+
+        /**
+         * @brief Makes room for at least @p count elements.
+         */
+        void reserve(size_t count)
+        {
+            if (count > m_capacity) {
+                grow(count);
+            }
+        }
+
+        /**
+         * @brief Destroys all elements. Capacity is preserved.
+         */
+        void clear() noexcept
+        {
+            std::destroy(begin(), end());
+            m_size = 0;
+        }
+
+        /**
+         * @brief Moves the elements back inline if they fit, otherwise trims the heap buffer to the size.
+         */
+        void shrink_to_fit()
+        {
+            if (is_inline() || m_size == m_capacity) {
+                return;
+            }
+
+            T* old = m_data;
+            if (m_size <= N) {
+                m_data = inline_data();
+                m_capacity = N;
+            } else {
+                m_data = allocate(m_size);
+                m_capacity = m_size;
+            }
+            std::uninitialized_move(old, old + m_size, m_data);
+            std::destroy(old, old + m_size);
+            deallocate(old);
+        }
+
+        /**
+         * @brief Returns the spill statistics of this instantiation, zeros in release builds.
+         */
+        [[nodiscard]] static small_vector_stats stats() noexcept
+        {
+#if TAV_DEBUG
+            return {s_spill_count.load(std::memory_order_relaxed), s_peak_spill_size.load(std::memory_order_relaxed)};
+#else
+            return {};
+#endif
+        }
+
+    private:
+        T* inline_data() noexcept
+        {
+            return reinterpret_cast<T*>(m_inline);
+        }
+
+        const T* inline_data() const noexcept
+        {
+            return reinterpret_cast<const T*>(m_inline);
+        }
+
+        T* allocate(size_t count)
+        {
+            const size_t bytes = count * sizeof(T);
+            void*        mem = m_allocator ? m_allocator->allocate(bytes, alignof(T), "small_vector") : ::operator new(bytes, std::align_val_t{alignof(T)});
+            if (!mem) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(mem);
+        }
+
+        void deallocate(T* ptr) noexcept
+        {
+            if (ptr == inline_data()) {
+                return;
+            }
+            if (m_allocator) {
+                m_allocator->deallocate(ptr);
+            } else {
+                ::operator delete(ptr, std::align_val_t{alignof(T)});
+            }
+        }
+
+        void grow(size_t required)
+        {
+            const size_t new_capacity = std::max(required, m_capacity * 2);
+            T*           new_data = allocate(new_capacity);
+
+#if TAV_DEBUG
+            if (is_inline()) {
+                s_spill_count.fetch_add(1, std::memory_order_relaxed);
+            }
+            auto peak = s_peak_spill_size.load(std::memory_order_relaxed);
+            while (peak < required && !s_peak_spill_size.compare_exchange_weak(peak, required, std::memory_order_relaxed)) {
+            }
+#endif
+
+            std::uninitialized_move(begin(), end(), new_data);
+            std::destroy(begin(), end());
+            deallocate(m_data);
+            m_data = new_data;
+            m_capacity = new_capacity;
+        }
+
+        void release_heap() noexcept
+        {
+            deallocate(m_data);
+            m_data = inline_data();
+            m_capacity = N;
+        }
+
+        // Expects this vector to be empty and using inline storage
+        void take(small_vector& other) noexcept
+        {
+            if (other.is_inline()) {
+                std::uninitialized_move(other.begin(), other.end(), m_data);
+                m_size = other.m_size;
+                other.clear();
+                return;
+            }
+            m_data = std::exchange(other.m_data, other.inline_data());
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, N);
+        }
+
+    private:
+        T*         m_data = inline_data();
+        size_t     m_size = 0;
+        size_t     m_capacity = N;
+        allocator* m_allocator = nullptr;
+        alignas(T) uint8 m_inline[N * sizeof(T)];
+
+#if TAV_DEBUG
+        inline static atomic_size_t s_spill_count{0};
+        inline static atomic_size_t s_peak_spill_size{0};
+#endif
+    };
+
+} // namespace tavros::core
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/containers/table_policy.hpp>
 #include <tavros/core/containers/table_iterator.hpp>
 
 namespace tavros::core
@@ -9,22 +9,28 @@ namespace tavros::core
     /**
      * @brief Structure-of-Arrays (SoA) container over a fixed set of typed columns.
      *
-     * Stores each column type @p Ty in a separate contiguous vector, providing
-     * row-wise access via tuples of references. Satisfies most named requirements
+     * Stores each column type @p Ty in a separate column container chosen by @p Policy,
+     * providing row-wise access via tuples of references. Satisfies most named requirements
      * of a reversible container. Duplicate column types are allowed at this level -
      * uniqueness constraints belong to higher-level constructs such as archetypes.
      *
-     * @tparam Ty Column types. Pack must be non-empty.
+     * Use through the @ref table and @ref chunked_table aliases.
+     *
+     * @tparam Policy Column storage policy, e.g. @ref contiguous_policy or @ref chunked_policy.
+     * @tparam Ty     Column types. Pack must be non-empty.
      */
-    template<class... Ty>
+    template<class Policy, class... Ty>
         requires(sizeof...(Ty) > 0) && are_nothrow_default_constructible_v<type_list<Ty...>>
     class basic_table
     {
         template<class T>
-        using vector_type = vector<T>;
-        using storage_type = std::tuple<vector_type<Ty>...>;
+        using column_type = typename Policy::template column_type<T>;
+        using storage_type = std::tuple<column_type<Ty>...>;
 
     public:
+        /** @brief Column storage policy. */
+        using policy_type = Policy;
+
         /** @brief Type list of all column types as declared. */
         using types = type_list<Ty...>;
 
@@ -83,7 +89,7 @@ namespace tavros::core
          */
         basic_table& operator=(basic_table&& other) noexcept = default;
 
-        /** @brief Destroys all column vectors and releases their memory. */
+        /** @brief Destroys all columns and releases their memory. */
         ~basic_table() noexcept = default;
 
         /**
@@ -136,7 +142,7 @@ namespace tavros::core
         }
 
         /**
-         * @brief Returns a reference to the column vector at compile-time index @p I.
+         * @brief Returns a reference to the column container at compile-time index @p I.
          * @tparam I Column index. Ill-formed if @p I >= column_count.
          */
         template<size_t I>
@@ -155,14 +161,14 @@ namespace tavros::core
         }
 
         /**
-         * @brief Returns a reference to the column vector for type @p T.
+         * @brief Returns a reference to the column container for type @p T.
          * @tparam T Column type. Ill-formed if @p T is not among @p Ty.
          */
         template<class T>
             requires contains_type_v<T, types>
         [[nodiscard]] auto& get() noexcept
         {
-            return std::get<vector_type<T>>(m_storage);
+            return std::get<column_type<T>>(m_storage);
         }
 
         /** @brief Const overload of type-based @ref get(). */
@@ -170,7 +176,7 @@ namespace tavros::core
             requires contains_type_v<T, types>
         [[nodiscard]] const auto& get() const noexcept
         {
-            return std::get<vector_type<T>>(m_storage);
+            return std::get<column_type<T>>(m_storage);
         }
 
         /** @brief Returns true if the table contains no rows. */
@@ -206,7 +212,7 @@ namespace tavros::core
             return std::get<0>(m_storage).capacity();
         }
 
-        /** @brief Releases excess capacity in all column vectors. */
+        /** @brief Releases excess capacity in all columns. */
         void shrink_to_fit()
         {
             (get<Ty>().shrink_to_fit(), ...);
@@ -293,7 +299,7 @@ namespace tavros::core
 
         /**
          * @brief Swaps the contents of this table with @p other.
-         * @note Only available when all column vector types are nothrow-swappable.
+         * @note Only available when all column types are nothrow-swappable.
          */
         void swap(basic_table& other) noexcept
             requires are_nothrow_swappable_v<type_list<Ty...>>
@@ -389,8 +395,22 @@ namespace tavros::core
         }
 
     private:
-        /// Tuple of per-column vectors.
+        /// Tuple of per-column containers.
         storage_type m_storage;
     };
 
+    /**
+     * @brief Table whose columns are contiguous vectors.
+     * @see contiguous_policy
+     */
+    template<class... Ty>
+    using table = basic_table<contiguous_policy, Ty...>;
+
+    /**
+     * @brief Table whose columns are stored in fixed-size blocks; rows never move on growth.
+     * @see chunked_policy
+     */
+    template<class... Ty>
+    using chunked_table = basic_table<chunked_policy<>, Ty...>;
+
 } // namespace tavros::core
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/containers/chunked_vector.hpp>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Column storage policy of @ref basic_table: every column is one contiguous vector.
+     *
+     * Gives the fastest element access and lets columns be passed around as plain arrays,
+     * but crossing the capacity reallocates and moves every column.
+     */
+    struct contiguous_policy
+    {
+        template<class T>
+        using column_type = vector<T>;
+    };
+
+    /**
+     * @brief Column storage policy of @ref basic_table: every column is split into fixed-size blocks.
+     *
+     * Growth only allocates new blocks, so rows never move in memory and references to
+     * components stay valid until the row is removed. Columns are not contiguous as a whole;
+     * each block is, see @ref chunked_vector::chunk().
+     *
+     * @tparam ChunkRows Number of rows per block, a power of two.
+     */
+    template<size_t ChunkRows = 256>
+    struct chunked_policy
+    {
+        template<class T>
+        using column_type = chunked_vector<T, ChunkRows>;
+    };
+
+} // namespace tavros::core
@@ -1,14 +1,24 @@
 #include <tavros/core/debug/profiler.hpp>
 
 #include <tavros/core/types.hpp>
-#include <tavros/core/containers/fixed_vector.hpp>
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <new>
+#include <thread>
 
 #if !!(TAV_PROFILER_ENABLED)
 
 namespace
 {
+    tavros::core::logger logger("profiler");
+
+    using namespace tavros;
+    using namespace tavros::profiler;
+
     const auto                g_start_time = std::chrono::high_resolution_clock::now();
     const thread_local uint64 g_thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
 
@@ -18,15 +28,233 @@ namespace
         return std::chrono::duration_cast<std::chrono::nanoseconds>(now - g_start_time).count();
     }
 
-    constexpr size_t                                                  k_max_sinks = 8;
-    tavros::core::fixed_vector<tavros::profiler::sink_t, k_max_sinks> g_sinks;
+    constexpr uint64 k_ring_mask = k_thread_buffer_events - 1;
+    constexpr auto   k_collect_interval = std::chrono::milliseconds(2);
+
+    static_assert((k_thread_buffer_events & k_ring_mask) == 0, "k_thread_buffer_events must be a power of two");
+
+    // Single-producer single-consumer ring owned by one instrumented thread
+    struct thread_ring
+    {
+        // Producer side
+        alignas(64) std::atomic<uint64> head{0};
+        uint64              cached_tail = 0; // last tail seen by the producer, refreshed when the ring looks full
+        std::atomic<uint64> dropped{0};      // written by the producer only
+
+        // Consumer side
+        alignas(64) std::atomic<uint64> tail{0};
+        std::atomic_bool         retired{false}; // set when the owning thread exits
+        std::atomic<const char*> name{nullptr};  // thread name, delivered before the thread's events
+        const char*              sent_name = nullptr;
+        uint64                   thread_id = g_thread_id;
+
+        perf_event events[k_thread_buffer_events];
+    };
+
+    std::atomic_bool    g_recording = false;
+    std::atomic<uint64> g_lost = 0; // events of threads whose ring could not be allocated
+
+    std::mutex                         g_rings_mutex;
+    tavros::core::vector<thread_ring*> g_rings;
+    uint64                             g_retired_dropped = 0; // guarded by g_rings_mutex
+
+    thread_ring* register_ring() noexcept
+    {
+        auto* ring = new (std::nothrow) thread_ring;
+        if (!ring) {
+            return nullptr;
+        }
+
+        try {
+            std::lock_guard lock(g_rings_mutex);
+            g_rings.push_back(ring);
+        } catch (...) {
+            delete ring;
+            return nullptr;
+        }
+        return ring;
+    }
+
+    struct ring_owner
+    {
+        thread_ring* ring = nullptr;
+        const char*  name = nullptr; // handed to the ring when it is allocated
+        bool         failed = false;
+
+        ~ring_owner()
+        {
+            if (ring) {
+                ring->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local ring_owner t_ring;
 
-    void push_perf_event(const tavros::profiler::perf_event& e) noexcept
+    thread_ring* local_ring() noexcept
     {
-        for (const auto& sink : g_sinks) {
-            sink(e);
+        if (!t_ring.ring && !t_ring.failed) {
+            t_ring.ring = register_ring();
+            t_ring.failed = !t_ring.ring;
+            if (t_ring.ring) {
+                t_ring.ring->name.store(t_ring.name, std::memory_order_release);
+            }
+        }
+        return t_ring.ring;
+    }
+
+    void record(const char* tag, event_type type, double value) noexcept
+    {
+        if (!g_recording.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        auto* ring = local_ring();
+        if (!ring) {
+            g_lost.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const uint64 head = ring->head.load(std::memory_order_relaxed);
+        if (head - ring->cached_tail >= k_thread_buffer_events) {
+            ring->cached_tail = ring->tail.load(std::memory_order_acquire);
+            if (head - ring->cached_tail >= k_thread_buffer_events) {
+                ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
         }
+
+        ring->events[head & k_ring_mask] = perf_event{.tag = tag, .time_ns = cur_time_ns(), .thread_id = g_thread_id, .value = value, .type = type};
+        ring->head.store(head + 1, std::memory_order_release);
     }
+
+    class collector
+    {
+    public:
+        ~collector()
+        {
+            shutdown();
+
+            std::lock_guard lock(g_rings_mutex);
+            for (auto* ring : g_rings) {
+                delete ring;
+            }
+            g_rings.clear();
+        }
+
+        void add_sink(sink_t sink)
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_sinks.push_back(std::move(sink));
+            }
+
+            std::lock_guard lock(m_thread_mutex);
+            if (!m_thread.joinable()) {
+                m_stop = false;
+                m_thread = std::thread([this] { run(); });
+            }
+            g_recording.store(true, std::memory_order_relaxed);
+        }
+
+        void shutdown() noexcept
+        {
+            g_recording.store(false, std::memory_order_relaxed);
+            {
+                std::lock_guard lock(m_thread_mutex);
+                if (m_thread.joinable()) {
+                    {
+                        std::lock_guard wake_lock(m_wake_mutex);
+                        m_stop = true;
+                    }
+                    m_wake.notify_all();
+                    m_thread.join();
+                }
+            }
+
+            flush();
+            std::lock_guard lock(m_mutex);
+            m_sinks.clear();
+        }
+
+        // Drains every ring to the sinks; serialized by m_mutex
+        void flush() noexcept
+        {
+            std::lock_guard lock(m_mutex);
+
+            try {
+                std::lock_guard rings_lock(g_rings_mutex);
+                m_snapshot.assign(g_rings.begin(), g_rings.end());
+            } catch (...) {
+                return; // out of memory, try again on the next flush
+            }
+
+            for (auto* ring : m_snapshot) {
+                // Read the flag before head, so a retired ring is seen with its final head
+                const bool   retired = ring->retired.load(std::memory_order_acquire);
+                const uint64 head = ring->head.load(std::memory_order_acquire);
+                uint64       tail = ring->tail.load(std::memory_order_relaxed);
+
+                const char* name = ring->name.load(std::memory_order_acquire);
+                if (name != ring->sent_name) {
+                    const perf_event e{.tag = name, .time_ns = 0, .thread_id = ring->thread_id, .value = 0.0, .type = event_type::thread_name};
+                    deliver(core::buffer_view<perf_event>(&e, 1));
+                    ring->sent_name = name;
+                }
+
+                while (tail != head) {
+                    const uint64 first = tail & k_ring_mask;
+                    const uint64 count = std::min<uint64>(head - tail, k_thread_buffer_events - first);
+                    deliver(core::buffer_view<perf_event>(ring->events + first, static_cast<size_t>(count)));
+                    tail += count;
+                    ring->tail.store(tail, std::memory_order_release);
+                }
+
+                if (retired) {
+                    std::lock_guard rings_lock(g_rings_mutex);
+                    std::erase(g_rings, ring);
+                    g_retired_dropped += ring->dropped.load(std::memory_order_relaxed);
+                    delete ring;
+                }
+            }
+        }
+
+    private:
+        void deliver(core::buffer_view<perf_event> events) noexcept
+        {
+            for (const auto& sink : m_sinks) {
+                try {
+                    sink(events);
+                } catch (...) {
+                    ::logger.error("Profiler sink threw an exception, {} events lost for it", events.size());
+                }
+            }
+        }
+
+        void run()
+        {
+            std::unique_lock lock(m_wake_mutex);
+            while (!m_stop) {
+                m_wake.wait_for(lock, k_collect_interval, [this] { return m_stop; });
+                lock.unlock();
+                flush();
+                lock.lock();
+            }
+        }
+
+    private:
+        std::mutex                         m_mutex; // guards sinks and draining
+        tavros::core::vector<sink_t>       m_sinks;
+        tavros::core::vector<thread_ring*> m_snapshot;
+
+        std::mutex              m_thread_mutex; // guards starting and stopping the collector thread
+        std::thread             m_thread;
+        std::mutex              m_wake_mutex;
+        std::condition_variable m_wake;
+        bool                    m_stop = false;
+    };
+
+    collector g_collector;
 } // namespace
 
 #endif
@@ -36,9 +264,41 @@ namespace tavros::profiler
     void add_sink(sink_t s) noexcept
     {
 #if !!(TAV_PROFILER_ENABLED)
-        g_sinks.push_back(std::move(s));
+        try {
+            g_collector.add_sink(std::move(s));
+        } catch (...) {
+            ::logger.error("Failed to add a profiler sink");
+        }
 #else
         TAV_UNUSED(s);
+#endif // TAV_PROFILER_ENABLED
+    }
+
+    void flush() noexcept
+    {
+#if !!(TAV_PROFILER_ENABLED)
+        g_collector.flush();
+#endif // TAV_PROFILER_ENABLED
+    }
+
+    void shutdown() noexcept
+    {
+#if !!(TAV_PROFILER_ENABLED)
+        g_collector.shutdown();
+#endif // TAV_PROFILER_ENABLED
+    }
+
+    uint64 dropped_events() noexcept
+    {
+#if !!(TAV_PROFILER_ENABLED)
+        std::lock_guard lock(g_rings_mutex);
+        uint64          total = g_retired_dropped + g_lost.load(std::memory_order_relaxed);
+        for (auto* ring : g_rings) {
+            total += ring->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+#else
+        return 0;
 #endif // TAV_PROFILER_ENABLED
     }
 } // namespace tavros::profiler
@@ -49,26 +309,27 @@ namespace tavros::profiler::detail
 {
     void thread_name(const char* name) noexcept
     {
-        perf_event e{.tag = name, .time_ns = cur_time_ns(), .thread_id = g_thread_id, .value = 0.0, .type = event_type::thread_name};
-        ::push_perf_event(e);
+        // Kept with the ring rather than recorded, so that sinks added later still learn the name.
+        // The ring is allocated by the first recorded event, threads that are only named cost nothing.
+        t_ring.name = name;
+        if (t_ring.ring) {
+            t_ring.ring->name.store(name, std::memory_order_release);
+        }
     }
 
     void zone_begin(const char* tag) noexcept
     {
-        perf_event e{.tag = tag, .time_ns = cur_time_ns(), .thread_id = g_thread_id, .value = 0.0, .type = event_type::zone_begin};
-        ::push_perf_event(e);
+        ::record(tag, event_type::zone_begin, 0.0);
     }
 
     void zone_end(const char* tag) noexcept
     {
-        perf_event e{.tag = tag, .time_ns = cur_time_ns(), .thread_id = g_thread_id, .value = 0.0, .type = event_type::zone_end};
-        ::push_perf_event(e);
+        ::record(tag, event_type::zone_end, 0.0);
     }
 
     void counter(const char* tag, double value) noexcept
     {
-        perf_event e{.tag = tag, .time_ns = cur_time_ns(), .thread_id = g_thread_id, .value = value, .type = event_type::counter};
-        ::push_perf_event(e);
+        ::record(tag, event_type::counter, value);
     }
 } // namespace tavros::profiler::detail
 
@@ -3,6 +3,7 @@
 #include <tavros/core/noncopyable.hpp>
 #include <tavros/core/nonmovable.hpp>
 #include <tavros/core/types.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
 
 #include <functional>
 
@@ -28,11 +29,44 @@ namespace tavros::profiler
     static_assert(sizeof(perf_event) == 64);
     static_assert(alignof(perf_event) == 64);
 
-    using sink_t = std::function<void(const perf_event&)>;
+    /// Number of events buffered per thread before new events are dropped.
+    constexpr size_t k_thread_buffer_events = 8192;
+
+    /**
+     * @brief Receives recorded events in batches.
+     *
+     * Sinks are called from the collector thread, or from the thread calling @ref flush().
+     * Events of one batch come from a single thread and are in recording order.
+     */
+    using sink_t = std::function<void(core::buffer_view<perf_event> events)>;
+
+    /**
+     * @brief Registers a sink and starts recording.
+     *
+     * Instrumented threads record events into their own ring buffer without locks. The first
+     * call starts a background collector thread that periodically drains the buffers and
+     * passes the events to every sink. Thread-safe.
+     */
     void add_sink(sink_t sink) noexcept;
 
+    /**
+     * @brief Drains the buffers of all threads to the sinks on the calling thread.
+     */
+    void flush() noexcept;
+
+    /**
+     * @brief Stops recording, drains the remaining events and removes all sinks.
+     */
+    void shutdown() noexcept;
+
+    /**
+     * @brief Returns the number of events dropped because a thread buffer was full.
+     */
+    [[nodiscard]] uint64 dropped_events() noexcept;
+
 } // namespace tavros::profiler
 
+// Set for the whole build by the TAV_ENABLE_PROFILER CMake option
 #ifndef TAV_PROFILER_ENABLED
     #define TAV_PROFILER_ENABLED 0
 #endif // TAV_PROFILER_ENABLED
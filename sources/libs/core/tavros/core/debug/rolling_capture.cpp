@@ -0,0 +1,145 @@
+#include <tavros/core/debug/rolling_capture.hpp>
+
+#include <tavros/core/containers/flat_hash_map.hpp>
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/debug/trace_capture.hpp>
+#include <tavros/core/io/file_writer.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+namespace
+{
+    tavros::core::logger logger("rolling_capture");
+} // namespace
+
+namespace tavros::profiler
+{
+
+    struct rolling_capture::state
+    {
+        mutable std::mutex                       mutex;
+        core::vector<perf_event>                 events; ///< Ring storage.
+        size_t                                   first = 0;
+        size_t                                   count = 0;
+        uint64                                   window_ns = 0;
+        uint64                                   newest_ns = 0;
+        core::flat_hash_map<uint64, const char*> thread_names;
+
+        void push(core::buffer_view<perf_event> batch)
+        {
+            std::lock_guard lock(mutex);
+
+            const size_t capacity = events.size();
+            for (const auto& e : batch) {
+                if (e.type == event_type::thread_name) {
+                    thread_names[e.thread_id] = e.tag;
+                    continue;
+                }
+
+                if (count == capacity) {
+                    first = (first + 1) % capacity;
+                    --count;
+                }
+                events[(first + count) % capacity] = e;
+                ++count;
+                newest_ns = std::max(newest_ns, e.time_ns);
+            }
+
+            while (count != 0 && events[first].time_ns + window_ns < newest_ns) {
+                first = (first + 1) % capacity;
+                --count;
+            }
+        }
+
+        // Thread names first, then the window in delivery order
+        core::vector<perf_event> snapshot() const
+        {
+            std::lock_guard lock(mutex);
+
+            core::vector<perf_event> result;
+            result.reserve(thread_names.size() + count);
+            for (const auto& [thread_id, name] : thread_names) {
+                result.push_back(perf_event{.tag = name, .time_ns = 0, .thread_id = thread_id, .value = 0.0, .type = event_type::thread_name});
+            }
+
+            const size_t capacity = events.size();
+            const size_t head = std::min(count, capacity - first);
+            result.insert(result.end(), events.begin() + first, events.begin() + first + head);
+            result.insert(result.end(), events.begin(), events.begin() + (count - head));
+            return result;
+        }
+    };
+
+    rolling_capture::rolling_capture(std::chrono::milliseconds window, size_t max_events)
+        : m_state(core::make_shared<state>())
+    {
+        TAV_ASSERT(max_events > 0);
+        m_state->events.resize(max_events);
+        m_state->window_ns = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(window).count());
+    }
+
+    sink_t rolling_capture::sink() const
+    {
+        return [state = m_state](core::buffer_view<perf_event> events) {
+            state->push(events);
+        };
+    }
+
+    bool rolling_capture::dump(core::string_view path) const
+    {
+        try {
+            const auto events = m_state->snapshot();
+
+            core::file_writer file(path);
+            capture_writer    writer(file);
+            writer.write(core::buffer_view<perf_event>(events.data(), events.size()));
+            if (!writer.good()) {
+                ::logger.error("Failed to write capture {}", path);
+                return false;
+            }
+
+            ::logger.info("Dumped {} events to {}", events.size(), path);
+            return true;
+        } catch (const std::exception& e) {
+            ::logger.error("Failed to dump capture {}: {}", path, e.what());
+            return false;
+        }
+    }
+
+    void rolling_capture::set_spike_dump(std::chrono::microseconds threshold, core::string_view path_prefix)
+    {
+        m_spike_threshold = threshold;
+        m_spike_prefix = core::string(path_prefix);
+    }
+
+    bool rolling_capture::end_frame(std::chrono::microseconds frame_time)
+    {
+        if (m_spike_threshold.count() <= 0 || frame_time <= m_spike_threshold) {
+            return false;
+        }
+
+        const auto now = clock::now();
+        const auto window = std::chrono::nanoseconds(m_state->window_ns);
+        if (m_spike_dumped && now - m_last_spike_dump < window) {
+            return false;
+        }
+        m_spike_dumped = true;
+        m_last_spike_dump = now;
+
+        ::logger.warning("Frame took {} us, over the {} us threshold", frame_time.count(), m_spike_threshold.count());
+        flush();
+        return dump(fmt::format("{}_{}.tavtrace", m_spike_prefix, m_spike_count++));
+    }
+
+    size_t rolling_capture::size() const
+    {
+        std::lock_guard lock(m_state->mutex);
+        return m_state->count;
+    }
+
+} // namespace tavros::profiler
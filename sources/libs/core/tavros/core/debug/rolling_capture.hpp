@@ -0,0 +1,104 @@
+#pragma once
+
+#include <tavros/core/debug/profiler.hpp>
+#include <tavros/core/memory/memory.hpp>
+#include <tavros/core/noncopyable.hpp>
+#include <tavros/core/string.hpp>
+#include <tavros/core/string_view.hpp>
+
+#include <chrono>
+
+namespace tavros::profiler
+{
+
+    /**
+     * @brief Keeps the last few seconds of profiler events in memory and dumps them on request.
+     *
+     * Meant to stay attached on production machines: recording costs the same as with any other
+     * sink, and nothing is written to disk until a hitch is worth looking at. A dump is a regular
+     * capture file, see @ref convert_capture_to_chrome_trace().
+     *
+     * Features and design choices:
+     * - Events are kept in a ring of fixed size allocated up front, so recording events never
+     *   allocates. Events older than the window are discarded, and when the ring is full the
+     *   oldest events are overwritten before the window ends.
+     * - Thread names are kept aside in a map, so a dump names every thread even after the
+     *   original thread name event has left the window. The map grows when a thread is named
+     *   for the first time, which is the only allocation the sink makes.
+     * - @ref end_frame() dumps the window automatically when a frame takes longer than the
+     *   threshold set with @ref set_spike_dump(), at most once per window.
+     * Notes:
+     * - @ref sink() and @ref dump() are thread-safe. @ref end_frame() must be called from one
+     *   thread, usually the one that runs the frame loop.
+     * - The window is measured on event timestamps; batches of different threads arrive a few
+     *   milliseconds apart, so the boundary is approximate.
+     */
+    class rolling_capture : core::noncopyable
+    {
+    public:
+        /// Default ring size, 8 MB of events.
+        static constexpr size_t k_default_max_events = 128 * 1024;
+
+    public:
+        /**
+         * @brief Allocates the ring.
+         *
+         * @param window     How much history to keep.
+         * @param max_events Ring size; limits memory when events arrive faster than expected.
+         */
+        explicit rolling_capture(std::chrono::milliseconds window, size_t max_events = k_default_max_events);
+
+        /**
+         * @brief Returns a sink that records into this capture, to be passed to @ref add_sink().
+         *
+         * The sink shares the ring with this object, so either may outlive the other.
+         */
+        [[nodiscard]] sink_t sink() const;
+
+        /**
+         * @brief Writes the events currently in the window to a capture file.
+         *
+         * Events still buffered by instrumented threads are not included; call @ref flush()
+         * first to include them. Must not be called from a sink.
+         *
+         * @return false if the file could not be written, the error is logged.
+         */
+        bool dump(core::string_view path) const;
+
+        /**
+         * @brief Enables dumps on frame-time spikes.
+         *
+         * @param threshold   Frames longer than this trigger a dump. Zero disables spike dumps.
+         * @param path_prefix Dumps are written to @c "<path_prefix>_<n>.tavtrace".
+         */
+        void set_spike_dump(std::chrono::microseconds threshold, core::string_view path_prefix);
+
+        /**
+         * @brief Reports the duration of a finished frame.
+         *
+         * On a spike, flushes the profiler and dumps the window on the calling thread, unless
+         * the previous spike dump happened less than one window ago.
+         *
+         * @return true if a dump was written.
+         */
+        bool end_frame(std::chrono::microseconds frame_time);
+
+        /**
+         * @brief Returns the number of events currently in the window.
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        struct state;
+
+        using clock = std::chrono::steady_clock;
+
+        core::shared_ptr<state>   m_state;
+        std::chrono::microseconds m_spike_threshold{0};
+        core::string              m_spike_prefix;
+        uint32                    m_spike_count = 0;
+        clock::time_point         m_last_spike_dump;
+        bool                      m_spike_dumped = false;
+    };
+
+} // namespace tavros::profiler
@@ -0,0 +1,427 @@
+#include <tavros/core/debug/trace_capture.hpp>
+
+#include <tavros/core/exception.hpp>
+#include <tavros/core/io/file_reader.hpp>
+#include <tavros/core/io/file_writer.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/memory/memory.hpp>
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    tavros::core::logger logger("trace_capture");
+
+    using namespace tavros;
+    using namespace tavros::profiler;
+
+    constexpr uint8 k_string_record = static_cast<uint8>(capture_record::string);
+    constexpr uint8 k_thread_record = static_cast<uint8>(capture_record::thread);
+    constexpr uint8 k_event_record = static_cast<uint8>(capture_record::event_base);
+    constexpr uint8 k_last_event_record = k_event_record + static_cast<uint8>(event_type::counter);
+
+    uint64 zigzag_encode(int64 value) noexcept
+    {
+        return (static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63);
+    }
+
+    int64 zigzag_decode(uint64 value) noexcept
+    {
+        return static_cast<int64>(value >> 1) ^ -static_cast<int64>(value & 1);
+    }
+
+    // Decodes a capture held in memory; every read checks the bounds and throws on malformed data
+    class capture_parser
+    {
+    public:
+        capture_parser(core::buffer_view<uint8> data, core::string_view path)
+            : m_data(data)
+            , m_path(path)
+        {
+        }
+
+        bool at_end() const noexcept
+        {
+            return m_pos == m_data.size();
+        }
+
+        uint8 byte()
+        {
+            require(1);
+            return m_data[m_pos++];
+        }
+
+        uint64 varint()
+        {
+            uint64 value = 0;
+            for (uint32 shift = 0; shift < 64; shift += 7) {
+                const uint8 b = byte();
+                value |= static_cast<uint64>(b & 0x7f) << shift;
+                if (!(b & 0x80)) {
+                    return value;
+                }
+            }
+            fail("varint is too long");
+        }
+
+        template<class T>
+        T raw()
+        {
+            require(sizeof(T));
+            T value;
+            std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+            m_pos += sizeof(T);
+            return value;
+        }
+
+        core::string_view chars(size_t size)
+        {
+            require(size);
+            core::string_view str(reinterpret_cast<const char*>(m_data.data() + m_pos), size);
+            m_pos += size;
+            return str;
+        }
+
+        [[noreturn]] void fail(const char* what) const
+        {
+            throw core::file_error(core::file_error_tag::read_error, m_path, fmt::format("malformed capture at byte {}: {}", m_pos, what));
+        }
+
+    private:
+        void require(size_t size) const
+        {
+            if (m_data.size() - m_pos < size) {
+                fail("unexpected end of file");
+            }
+        }
+
+    private:
+        core::buffer_view<uint8> m_data;
+        core::string_view        m_path;
+        size_t                   m_pos = 0;
+    };
+
+    core::vector<uint8> read_file(core::string_view path)
+    {
+        core::file_reader   reader(path);
+        core::vector<uint8> data(reader.size());
+        if (reader.read(data.data(), data.size()) != data.size()) {
+            throw core::file_error(core::file_error_tag::read_error, path, "failed to read capture file");
+        }
+        return data;
+    }
+
+    void append_json_string(fmt::memory_buffer& out, core::string_view str)
+    {
+        out.push_back('"');
+        for (char c : str) {
+            switch (c) {
+            case '"':
+                out.append(core::string_view("\\\""));
+                break;
+            case '\\':
+                out.append(core::string_view("\\\\"));
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    out.push_back(c);
+                }
+                break;
+            }
+        }
+        out.push_back('"');
+    }
+
+    // Chrome trace-event timestamps are microseconds
+    void append_timestamp(fmt::memory_buffer& out, uint64 time_ns)
+    {
+        fmt::format_to(std::back_inserter(out), "{}.{:03}", time_ns / 1000, time_ns % 1000);
+    }
+
+    struct json_thread
+    {
+        uint64               last_time_ns = 0;
+        core::vector<uint32> open_zones; // string ids of zones without an end yet
+    };
+
+    class chrome_trace_builder
+    {
+    public:
+        explicit chrome_trace_builder(core::string_view json_path)
+            : m_file(json_path)
+            , m_path(json_path)
+        {
+            fmt::format_to(std::back_inserter(m_out), "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+        }
+
+        void thread_name(uint32 tid, core::string_view name)
+        {
+            begin_event();
+            fmt::format_to(std::back_inserter(m_out), "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":", tid);
+            append_json_string(m_out, name);
+            m_out.append(core::string_view("}}"));
+        }
+
+        void zone(char phase, uint32 tid, core::string_view name, uint64 time_ns)
+        {
+            begin_event();
+            m_out.append(core::string_view("{\"name\":"));
+            append_json_string(m_out, name);
+            fmt::format_to(std::back_inserter(m_out), ",\"ph\":\"{}\",\"pid\":1,\"tid\":{},\"ts\":", phase, tid);
+            append_timestamp(m_out, time_ns);
+            m_out.push_back('}');
+        }
+
+        void counter(core::string_view name, uint64 time_ns, double value)
+        {
+            begin_event();
+            m_out.append(core::string_view("{\"name\":"));
+            append_json_string(m_out, name);
+            m_out.append(core::string_view(",\"ph\":\"C\",\"pid\":1,\"ts\":"));
+            append_timestamp(m_out, time_ns);
+            // JSON has no inf or nan
+            fmt::format_to(std::back_inserter(m_out), ",\"args\":{{\"value\":{}}}}}", std::isfinite(value) ? value : 0.0);
+        }
+
+        size_t finish()
+        {
+            m_out.append(core::string_view("]}\n"));
+            flush();
+            return m_count;
+        }
+
+    private:
+        void begin_event()
+        {
+            if (m_count++ != 0) {
+                m_out.push_back(',');
+            }
+            m_out.push_back('\n');
+            if (m_out.size() >= k_flush_size) {
+                flush();
+            }
+        }
+
+        void flush()
+        {
+            if (m_file.write(reinterpret_cast<const uint8*>(m_out.data()), m_out.size()) != m_out.size()) {
+                throw core::file_error(core::file_error_tag::write_error, m_path, "failed to write trace file");
+            }
+            m_out.clear();
+        }
+
+    private:
+        static constexpr size_t k_flush_size = 64 * 1024;
+
+        core::file_writer  m_file;
+        core::string_view  m_path;
+        fmt::memory_buffer m_out;
+        size_t             m_count = 0;
+    };
+
+    // Sink state shared by the copies of the sink function
+    struct capture_file_state
+    {
+        core::file_writer        file;
+        profiler::capture_writer writer;
+
+        explicit capture_file_state(core::string_view path)
+            : file(path)
+            , writer(file)
+        {
+        }
+    };
+} // namespace
+
+namespace tavros::profiler
+{
+
+    capture_writer::capture_writer(core::basic_stream_writer& out)
+        : m_out(&out)
+    {
+        put_raw(k_capture_magic, sizeof(k_capture_magic));
+        put_raw(&k_capture_version, sizeof(k_capture_version));
+        m_out->write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+    void capture_writer::write(core::buffer_view<perf_event> events)
+    {
+        for (const auto& e : events) {
+            const uint32 tag = string_id(e.tag);
+            auto&        t = thread(e.thread_id);
+
+            put_byte(static_cast<uint8>(k_event_record + static_cast<uint8>(e.type)));
+            put_varint(t.index);
+            put_varint(tag);
+            if (e.type != event_type::thread_name) {
+                put_varint(zigzag_encode(static_cast<int64>(e.time_ns - t.last_time_ns)));
+                t.last_time_ns = e.time_ns;
+            }
+            if (e.type == event_type::counter) {
+                put_raw(&e.value, sizeof(e.value));
+            }
+        }
+
+        m_event_count += events.size();
+        if (!m_buffer.empty()) {
+            m_out->write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
+    uint64 capture_writer::event_count() const noexcept
+    {
+        return m_event_count;
+    }
+
+    bool capture_writer::good() const noexcept
+    {
+        return m_out->good();
+    }
+
+    uint32 capture_writer::string_id(const char* str)
+    {
+        auto [it, inserted] = m_strings.try_emplace(str, static_cast<uint32>(m_strings.size()));
+        if (inserted) {
+            const core::string_view chars = str ? core::string_view(str) : core::string_view();
+            put_byte(k_string_record);
+            put_varint(it->second);
+            put_varint(chars.size());
+            put_raw(chars.data(), chars.size());
+        }
+        return it->second;
+    }
+
+    capture_writer::thread_state& capture_writer::thread(uint64 thread_id)
+    {
+        auto [it, inserted] = m_threads.try_emplace(thread_id);
+        if (inserted) {
+            it->second.index = static_cast<uint32>(m_threads.size() - 1);
+            put_byte(k_thread_record);
+            put_varint(it->second.index);
+            put_raw(&thread_id, sizeof(thread_id));
+        }
+        return it->second;
+    }
+
+    void capture_writer::put_byte(uint8 value)
+    {
+        m_buffer.push_back(value);
+    }
+
+    void capture_writer::put_varint(uint64 value)
+    {
+        while (value >= 0x80) {
+            m_buffer.push_back(static_cast<uint8>(value | 0x80));
+            value >>= 7;
+        }
+        m_buffer.push_back(static_cast<uint8>(value));
+    }
+
+    void capture_writer::put_raw(const void* data, size_t size)
+    {
+        const auto* bytes = static_cast<const uint8*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    sink_t make_capture_file_sink(core::string_view path)
+    {
+        auto state = core::make_shared<capture_file_state>(path);
+        return [state](core::buffer_view<perf_event> events) {
+            state->writer.write(events);
+        };
+    }
+
+    size_t convert_capture_to_chrome_trace(core::string_view capture_path, core::string_view json_path)
+    {
+        const auto     data = read_file(capture_path);
+        capture_parser in(core::buffer_view<uint8>(data.data(), data.size()), capture_path);
+
+        if (in.chars(sizeof(k_capture_magic)) != core::string_view(k_capture_magic, sizeof(k_capture_magic))) {
+            in.fail("not a capture file");
+        }
+        if (const auto version = in.raw<uint32>(); version != k_capture_version) {
+            throw core::file_error(core::file_error_tag::read_error, capture_path, fmt::format("unsupported capture version {}", version));
+        }
+
+        core::vector<core::string_view> strings;
+        core::vector<json_thread>       threads;
+        uint64                          last_time_ns = 0;
+        chrome_trace_builder            out(json_path);
+
+        while (!in.at_end()) {
+            const uint8 kind = in.byte();
+            if (kind == k_string_record) {
+                const auto id = in.varint();
+                const auto size = in.varint();
+                if (id != strings.size()) {
+                    in.fail("string ids are out of order");
+                }
+                strings.push_back(in.chars(static_cast<size_t>(size)));
+            } else if (kind == k_thread_record) {
+                const auto index = in.varint();
+                TAV_UNUSED(in.raw<uint64>()); // the original thread id is not needed in the trace
+                if (index != threads.size()) {
+                    in.fail("thread indices are out of order");
+                }
+                threads.emplace_back();
+            } else if (kind >= k_event_record && kind <= k_last_event_record) {
+                const auto type = static_cast<event_type>(kind - k_event_record);
+                const auto tid = in.varint();
+                const auto tag = in.varint();
+                if (tid >= threads.size() || tag >= strings.size()) {
+                    in.fail("event references an unknown thread or string");
+                }
+
+                auto& t = threads[static_cast<size_t>(tid)];
+                if (type != event_type::thread_name) {
+                    t.last_time_ns += static_cast<uint64>(zigzag_decode(in.varint()));
+                    last_time_ns = std::max(last_time_ns, t.last_time_ns);
+                }
+
+                // Thread ids start from 1, Perfetto treats tid 0 as the idle thread
+                const auto json_tid = static_cast<uint32>(tid + 1);
+                const auto name = strings[static_cast<size_t>(tag)];
+                switch (type) {
+                case event_type::thread_name:
+                    out.thread_name(json_tid, name);
+                    break;
+                case event_type::zone_begin:
+                    t.open_zones.push_back(static_cast<uint32>(tag));
+                    out.zone('B', json_tid, name, t.last_time_ns);
+                    break;
+                case event_type::zone_end:
+                    if (!t.open_zones.empty()) {
+                        t.open_zones.pop_back();
+                        out.zone('E', json_tid, name, t.last_time_ns);
+                    }
+                    break;
+                case event_type::counter:
+                    out.counter(name, t.last_time_ns, in.raw<double>());
+                    break;
+                }
+            } else {
+                in.fail("unknown record kind");
+            }
+        }
+
+        for (size_t tid = 0; tid < threads.size(); ++tid) {
+            auto& zones = threads[tid].open_zones;
+            while (!zones.empty()) {
+                out.zone('E', static_cast<uint32>(tid + 1), strings[zones.back()], last_time_ns);
+                zones.pop_back();
+            }
+        }
+
+        const size_t count = out.finish();
+        ::logger.info("Converted {} to {}: {} trace events", capture_path, json_path, count);
+        return count;
+    }
+
+} // namespace tavros::profiler
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <tavros/core/debug/profiler.hpp>
+#include <tavros/core/containers/flat_hash_map.hpp>
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/io/stream_writer.hpp>
+#include <tavros/core/noncopyable.hpp>
+#include <tavros/core/string_view.hpp>
+
+namespace tavros::profiler
+{
+
+    /// First bytes of every capture file.
+    constexpr char k_capture_magic[8] = {'T', 'A', 'V', 'T', 'R', 'A', 'C', 'E'};
+
+    /// Version of the capture format, bumped on incompatible changes.
+    constexpr uint32 k_capture_version = 1;
+
+    /**
+     * @brief Kind of a record in a capture file, stored in the first byte of the record.
+     *
+     * Record layout after the kind byte (varint = unsigned LEB128):
+     * - @c string     - varint id, varint length, characters without a terminator.
+     * - @c thread     - varint index, uint64 thread id.
+     * - @c event_base + @ref event_type - varint thread index, varint string id,
+     *   varint zigzag time delta to the previous event of the thread (not for @c thread_name),
+     *   double value (@c counter only).
+     */
+    enum class capture_record : uint8
+    {
+        string = 0,
+        thread = 1,
+        event_base = 2,
+    };
+
+    /**
+     * @brief Encodes profiler events into the compact binary capture format.
+     *
+     * Features and design choices:
+     * - Tags are written once as string records and referenced by id afterwards. Tags are
+     *   identified by pointer, as the profiler requires them to have static storage duration.
+     * - Thread ids are replaced by small indices, and timestamps are stored as deltas to the
+     *   previous event of the same thread, so a zone event usually takes 4-6 bytes instead
+     *   of the 64 bytes of @ref perf_event.
+     * Notes:
+     * - The writer does not own the stream; it must outlive the writer.
+     * - Not thread-safe. Sinks are called one batch at a time, so a sink may use it directly.
+     */
+    class capture_writer : core::noncopyable
+    {
+    public:
+        /**
+         * @brief Writes the capture header to @p out.
+         */
+        explicit capture_writer(core::basic_stream_writer& out);
+
+        /**
+         * @brief Encodes and writes a batch of events.
+         *
+         * Events of one thread must be passed in recording order.
+         */
+        void write(core::buffer_view<perf_event> events);
+
+        /**
+         * @brief Returns the number of events written so far.
+         */
+        [[nodiscard]] uint64 event_count() const noexcept;
+
+        /**
+         * @brief Returns true while every write to the stream succeeded.
+         */
+        [[nodiscard]] bool good() const noexcept;
+
+    private:
+        struct thread_state
+        {
+            uint32 index = 0;
+            uint64 last_time_ns = 0;
+        };
+
+        uint32        string_id(const char* str);
+        thread_state& thread(uint64 thread_id);
+
+        void put_byte(uint8 value);
+        void put_varint(uint64 value);
+        void put_raw(const void* data, size_t size);
+
+    private:
+        core::basic_stream_writer*                m_out;
+        core::vector<uint8>                       m_buffer;  ///< Encoded batch, written with one call.
+        core::flat_hash_map<const char*, uint32>  m_strings; ///< Tag pointer to string id.
+        core::flat_hash_map<uint64, thread_state> m_threads; ///< Thread id to index and last timestamp.
+        uint64                                    m_event_count = 0;
+    };
+
+    /**
+     * @brief Creates a sink that streams events into a capture file at @p path.
+     *
+     * The file is written as batches arrive and closed when the sink is destroyed, which
+     * happens on @ref shutdown(). Convert the file with @ref convert_capture_to_chrome_trace().
+     *
+     * @throws core::file_error if the file cannot be created.
+     */
+    [[nodiscard]] sink_t make_capture_file_sink(core::string_view path);
+
+    /**
+     * @brief Converts a capture file into Chrome trace-event JSON.
+     *
+     * The result loads in Perfetto (ui.perfetto.dev) and in chrome://tracing. Zones become
+     * B/E slices on the thread that recorded them, counters become C events and thread names
+     * become metadata events. Zone ends without a begin, as left by a rolling capture, are
+     * skipped; zones still open at the end of the capture are closed at its last timestamp.
+     *
+     * @param capture_path Capture file written by @ref capture_writer.
+     * @param json_path    Output file, overwritten.
+     * @return Number of trace events written.
+     * @throws core::file_error if a file cannot be opened or the capture is malformed.
+     */
+    size_t convert_capture_to_chrome_trace(core::string_view capture_path, core::string_view json_path);
+
+} // namespace tavros::profiler
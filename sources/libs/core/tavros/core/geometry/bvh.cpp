@@ -0,0 +1,291 @@
+#include <tavros/core/geometry/bvh.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+    using namespace tavros;
+    using geometry::aabb3;
+    using node = geometry::bvh::node;
+
+    // Centroids of a node are sorted into this many bins along each axis, candidate split
+    // planes are the bin boundaries
+    constexpr uint32 k_bin_count = 12;
+
+    // Cost of visiting a node relative to testing a primitive
+    constexpr float k_traversal_cost = 1.0f;
+
+    // Smallest subtree built as a separate task in parallel builds
+    constexpr uint32 k_min_task_size = 1024;
+
+    struct bounds
+    {
+        math::vec3 min = math::vec3(std::numeric_limits<float>::max());
+        math::vec3 max = math::vec3(std::numeric_limits<float>::lowest());
+
+        void grow(const math::vec3& point) noexcept
+        {
+            min = math::min(min, point);
+            max = math::max(max, point);
+        }
+
+        void grow(const math::vec3& box_min, const math::vec3& box_max) noexcept
+        {
+            min = math::min(min, box_min);
+            max = math::max(max, box_max);
+        }
+
+        // Half of the surface area, the factor cancels out in the heuristic
+        float half_area() const noexcept
+        {
+            const auto s = max - min;
+            return s.x * s.y + s.y * s.z + s.z * s.x;
+        }
+    };
+
+    // Node with the primitives [begin, end) still to be built
+    struct range
+    {
+        uint32 node;
+        uint32 begin;
+        uint32 end;
+    };
+
+    class builder
+    {
+    public:
+        builder(const aabb3* boxes, const math::vec3* centroids, uint32* indices, uint32 max_leaf_size) noexcept
+            : m_boxes(boxes)
+            , m_centroids(centroids)
+            , m_indices(indices)
+            , m_max_leaf_size(max_leaf_size)
+        {
+        }
+
+        // Builds the subtree rooted at nodes[root.node]. With `tasks` set, ranges of at most
+        // task_size primitives are not split but added to `tasks`.
+        void build(core::vector<node>& nodes, range root, core::vector<range>* tasks, uint32 task_size) const
+        {
+            core::vector<range> stack;
+            stack.push_back(root);
+            while (!stack.empty()) {
+                const range r = stack.back();
+                stack.pop_back();
+
+                bounds box_bounds;
+                bounds centroid_bounds;
+                for (uint32 i = r.begin; i < r.end; ++i) {
+                    const uint32 index = m_indices[i];
+                    box_bounds.grow(m_boxes[index].min, m_boxes[index].max);
+                    centroid_bounds.grow(m_centroids[index]);
+                }
+                nodes[r.node].min = box_bounds.min;
+                nodes[r.node].max = box_bounds.max;
+
+                const uint32 count = r.end - r.begin;
+                if (tasks && count <= task_size && count > m_max_leaf_size) {
+                    tasks->push_back(r);
+                    continue;
+                }
+
+                const uint32 mid = split(r, box_bounds, centroid_bounds);
+                if (mid == r.begin) {
+                    nodes[r.node].first = r.begin;
+                    nodes[r.node].count = count;
+                    continue;
+                }
+
+                // Children are allocated together, the left one is built first
+                const auto left = static_cast<uint32>(nodes.size());
+                nodes.resize(nodes.size() + 2);
+                nodes[r.node].first = left;
+                nodes[r.node].count = 0;
+                stack.push_back({left + 1, mid, r.end});
+                stack.push_back({left, r.begin, mid});
+            }
+        }
+
+    private:
+        uint32 bin_of(const math::vec3& centroid, size_t axis, float origin, float scale) const noexcept
+        {
+            const auto bin = static_cast<uint32>((centroid[axis] - origin) * scale);
+            return std::min(bin, k_bin_count - 1);
+        }
+
+        // Partitions the range and returns the first primitive of the right child,
+        // or r.begin if the node should be a leaf
+        uint32 split(const range& r, const bounds& box_bounds, const bounds& centroid_bounds) const noexcept
+        {
+            const uint32 count = r.end - r.begin;
+            if (count <= 1) {
+                return r.begin;
+            }
+
+            float  best_cost = std::numeric_limits<float>::max();
+            size_t best_axis = 0;
+            uint32 best_bin = 0;
+            for (size_t axis = 0; axis < 3; ++axis) {
+                const float extent = centroid_bounds.max[axis] - centroid_bounds.min[axis];
+                if (extent <= 0.0f) {
+                    continue;
+                }
+                const float origin = centroid_bounds.min[axis];
+                const float scale = static_cast<float>(k_bin_count) / extent;
+
+                bounds bins[k_bin_count];
+                uint32 counts[k_bin_count] = {};
+                for (uint32 i = r.begin; i < r.end; ++i) {
+                    const uint32 index = m_indices[i];
+                    const uint32 bin = bin_of(m_centroids[index], axis, origin, scale);
+                    bins[bin].grow(m_boxes[index].min, m_boxes[index].max);
+                    ++counts[bin];
+                }
+
+                // Sweep from the left, then from the right evaluating every boundary
+                float  left_area[k_bin_count - 1];
+                uint32 left_count[k_bin_count - 1];
+                bounds left;
+                uint32 left_sum = 0;
+                for (uint32 b = 0; b + 1 < k_bin_count; ++b) {
+                    if (counts[b] != 0) {
+                        left.grow(bins[b].min, bins[b].max);
+                    }
+                    left_sum += counts[b];
+                    left_area[b] = left_sum != 0 ? left.half_area() : 0.0f;
+                    left_count[b] = left_sum;
+                }
+
+                bounds right;
+                uint32 right_sum = 0;
+                for (uint32 b = k_bin_count - 1; b > 0; --b) {
+                    if (counts[b] != 0) {
+                        right.grow(bins[b].min, bins[b].max);
+                    }
+                    right_sum += counts[b];
+                    if (left_count[b - 1] == 0 || right_sum == 0) {
+                        continue;
+                    }
+                    const float cost = left_area[b - 1] * static_cast<float>(left_count[b - 1]) + right.half_area() * static_cast<float>(right_sum);
+                    if (cost < best_cost) {
+                        best_cost = cost;
+                        best_axis = axis;
+                        best_bin = b;
+                    }
+                }
+            }
+
+            uint32* first = m_indices + r.begin;
+            uint32* last = m_indices + r.end;
+
+            if (best_cost == std::numeric_limits<float>::max()) {
+                // All centroids coincide, any split is as good as another
+                return count <= m_max_leaf_size ? r.begin : r.begin + count / 2;
+            }
+
+            // Flat or degenerate nodes have no area to compare costs with, they split down to the leaf size
+            const float area = box_bounds.half_area();
+            const bool  split_is_cheaper = area > 0.0f && k_traversal_cost + best_cost / area < static_cast<float>(count);
+            if (count <= m_max_leaf_size && !split_is_cheaper) {
+                return r.begin;
+            }
+
+            const float origin = centroid_bounds.min[best_axis];
+            const float scale = static_cast<float>(k_bin_count) / (centroid_bounds.max[best_axis] - origin);
+            uint32*     mid = std::partition(first, last, [&](uint32 index) {
+                return bin_of(m_centroids[index], best_axis, origin, scale) < best_bin;
+            });
+            return static_cast<uint32>(mid - m_indices);
+        }
+
+    private:
+        const aabb3*      m_boxes;
+        const math::vec3* m_centroids;
+        uint32*           m_indices;
+        uint32            m_max_leaf_size;
+    };
+} // namespace
+
+namespace tavros::geometry
+{
+
+    void bvh::build(core::buffer_view<aabb3> boxes, uint32 max_leaf_size)
+    {
+        build_impl(boxes, nullptr, max_leaf_size);
+    }
+
+    void bvh::build(core::buffer_view<aabb3> boxes, core::executor& exec, uint32 max_leaf_size)
+    {
+        build_impl(boxes, &exec, max_leaf_size);
+    }
+
+    void bvh::clear() noexcept
+    {
+        m_nodes.clear();
+        m_indices.clear();
+        m_boxes.clear();
+    }
+
+    void bvh::build_impl(core::buffer_view<aabb3> boxes, core::executor* exec, uint32 max_leaf_size)
+    {
+        TAV_ASSERT(max_leaf_size > 0);
+        TAV_ASSERT(boxes.size() < std::numeric_limits<uint32>::max());
+
+        clear();
+        const auto count = static_cast<uint32>(boxes.size());
+        if (count == 0) {
+            return;
+        }
+
+        core::vector<math::vec3> centroids(count);
+        for (uint32 i = 0; i < count; ++i) {
+            centroids[i] = boxes[i].center();
+        }
+        m_indices.resize(count);
+        std::iota(m_indices.begin(), m_indices.end(), 0u);
+
+        m_nodes.reserve(2 * static_cast<size_t>(count) - 1);
+        m_nodes.resize(1);
+
+        const builder b(boxes.data(), centroids.data(), m_indices.data(), max_leaf_size);
+        if (exec == nullptr || count < 2 * k_min_task_size) {
+            b.build(m_nodes, {0, 0, count}, nullptr, 0);
+        } else {
+            // A few tasks per thread balance subtrees of different cost
+            const auto task_size = std::max(k_min_task_size, static_cast<uint32>(count / (exec->concurrency() * 4)));
+
+            core::vector<range> tasks;
+            b.build(m_nodes, {0, 0, count}, &tasks, task_size);
+
+            // Tasks work on disjoint ranges of the indices and on their own node arrays
+            core::vector<core::vector<node>> subtrees(tasks.size());
+            exec->run(tasks.size(), [&](size_t t) {
+                subtrees[t].resize(1);
+                b.build(subtrees[t], {0, tasks[t].begin, tasks[t].end}, nullptr, 0);
+            });
+
+            // Each subtree root replaces its reserved node, the rest is appended
+            for (size_t t = 0; t < tasks.size(); ++t) {
+                const auto& subtree = subtrees[t];
+                const auto  base = static_cast<uint32>(m_nodes.size());
+                auto        relocate = [&](node n) {
+                    if (!n.is_leaf()) {
+                        n.first = base + n.first - 1;
+                    }
+                    return n;
+                };
+                m_nodes[tasks[t].node] = relocate(subtree[0]);
+                for (size_t i = 1; i < subtree.size(); ++i) {
+                    m_nodes.push_back(relocate(subtree[i]));
+                }
+            }
+        }
+
+        m_boxes.resize(count);
+        for (uint32 i = 0; i < count; ++i) {
+            m_boxes[i] = boxes[m_indices[i]];
+        }
+    }
+
+} // namespace tavros::geometry
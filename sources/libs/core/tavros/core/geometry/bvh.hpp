@@ -0,0 +1,369 @@
+#pragma once
+
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/geometry/aabb3.hpp>
+#include <tavros/core/geometry/frustum.hpp>
+#include <tavros/core/geometry/ray3.hpp>
+#include <tavros/core/geometry/functions/intersect.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/thread/executor.hpp>
+#include <tavros/core/debug/assert.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace tavros::geometry
+{
+
+    /**
+     * @brief Static bounding volume hierarchy over an array of boxes.
+     *
+     * Built once from the bounds of objects that do not move (level geometry, UI layouts,
+     * static entities) and queried many times. Primitives are reported by their index in the
+     * array given to @ref build(). For objects that move, see @ref dynamic_aabb_tree.
+     *
+     * Features and design choices:
+     * - Split planes are chosen with the surface area heuristic over binned centroids.
+     * - The tree is flattened into one array of 32-byte nodes, two per cache line; the children
+     *   of a node are adjacent, and leaves refer to a range of primitives copied in tree order,
+     *   so leaf tests read memory sequentially.
+     * - The build can run on an @ref core::executor: the top of the tree is split serially,
+     *   the subtrees below are built in parallel and then spliced into the node array.
+     * - Frustum queries track the planes a node is fully inside of, subtrees inside the whole
+     *   frustum are reported without further tests.
+     * - Ray queries visit the nearer child first and skip nodes beyond the closest hit so far.
+     *
+     * Notes:
+     * - Results are the same as testing every box: @ref intersects() for boxes,
+     *   @ref frustum::contains_aabb() for frustums and @ref intersect() for rays.
+     * - The tree keeps its own copy of the boxes, the source array may be released after the build.
+     */
+    class bvh
+    {
+    public:
+        /**
+         * @brief Node of the flattened tree.
+         *
+         * An interior node has `count == 0` and its children at `first` and `first + 1`;
+         * a leaf holds the primitives [first, first + count) of the tree order.
+         */
+        struct node
+        {
+            math::vec3 min;
+            uint32     first = 0;
+            math::vec3 max;
+            uint32     count = 0;
+
+            [[nodiscard]] bool is_leaf() const noexcept
+            {
+                return count != 0;
+            }
+        };
+
+        static_assert(sizeof(node) == 32, "incorrect size");
+
+        /// Default maximal number of primitives in a leaf.
+        constexpr static uint32 k_default_leaf_size = 4;
+
+    public:
+        bvh() noexcept = default;
+
+        /**
+         * @brief Builds the tree over @p boxes, replacing the previous contents.
+         *
+         * @param boxes         Bounds of the primitives.
+         * @param max_leaf_size Leaves with more primitives are always split, smaller leaves
+         *                      are split when the heuristic finds it cheaper.
+         */
+        void build(core::buffer_view<aabb3> boxes, uint32 max_leaf_size = k_default_leaf_size);
+
+        /**
+         * @brief Builds the tree over @p boxes with subtrees built in parallel on @p exec.
+         *
+         * Gives the same tree as the serial version.
+         */
+        void build(core::buffer_view<aabb3> boxes, core::executor& exec, uint32 max_leaf_size = k_default_leaf_size);
+
+        /**
+         * @brief Removes all primitives.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Returns the number of primitives.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_indices.size();
+        }
+
+        /**
+         * @brief Returns true if the tree has no primitives.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_indices.empty();
+        }
+
+        /**
+         * @brief Returns the nodes, the root is the first one.
+         */
+        [[nodiscard]] core::buffer_view<node> nodes() const noexcept
+        {
+            return m_nodes;
+        }
+
+        /**
+         * @brief Returns the primitive indices in tree order, referred to by the leaves.
+         */
+        [[nodiscard]] core::buffer_view<uint32> indices() const noexcept
+        {
+            return m_indices;
+        }
+
+        /**
+         * @brief Calls @p func(index) for every primitive overlapping @p box.
+         *
+         * @param func Callable matching `bool(uint32)`, returning false stops the query.
+         */
+        template<class Func>
+            requires std::is_invocable_r_v<bool, Func&, uint32>
+        void query(const aabb3& box, Func&& func) const
+        {
+            if (m_nodes.empty()) {
+                return;
+            }
+
+            uint32 stack[k_stack_size];
+            size_t top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const node& n = m_nodes[stack[--top]];
+                if (!intersects(aabb3(n.min, n.max), box)) {
+                    continue;
+                }
+                if (n.is_leaf()) {
+                    for (uint32 i = n.first; i < n.first + n.count; ++i) {
+                        if (intersects(m_boxes[i], box) && !func(m_indices[i])) {
+                            return;
+                        }
+                    }
+                } else {
+                    TAV_ASSERT(top + 2 <= k_stack_size);
+                    stack[top++] = n.first + 1;
+                    stack[top++] = n.first;
+                }
+            }
+        }
+
+        /**
+         * @brief Calls @p func(index) for every primitive inside or intersecting frustum @p f.
+         *
+         * @param func Callable matching `bool(uint32)`, returning false stops the query.
+         */
+        template<class Func>
+            requires std::is_invocable_r_v<bool, Func&, uint32>
+        void query(const frustum& f, Func&& func) const
+        {
+            if (m_nodes.empty()) {
+                return;
+            }
+
+            // Each entry keeps a bit per plane the node still crosses
+            constexpr uint32 k_all_planes = 0x3f;
+
+            std::pair<uint32, uint32> stack[k_stack_size];
+            size_t                    top = 0;
+            stack[top++] = {0, k_all_planes};
+            while (top > 0) {
+                const auto [index, parent_planes] = stack[--top];
+                const node& n = m_nodes[index];
+                uint32      planes = parent_planes;
+                if (!classify(f, n.min, n.max, planes)) {
+                    continue;
+                }
+
+                if (planes == 0) {
+                    // Fully inside, no primitive below needs a test
+                    const auto [first, last] = primitive_range(index);
+                    for (uint32 i = first; i < last; ++i) {
+                        if (!func(m_indices[i])) {
+                            return;
+                        }
+                    }
+                } else if (n.is_leaf()) {
+                    for (uint32 i = n.first; i < n.first + n.count; ++i) {
+                        uint32 box_planes = planes;
+                        if (classify(f, m_boxes[i].min, m_boxes[i].max, box_planes) && !func(m_indices[i])) {
+                            return;
+                        }
+                    }
+                } else {
+                    TAV_ASSERT(top + 2 <= k_stack_size);
+                    stack[top++] = {n.first + 1, planes};
+                    stack[top++] = {n.first, planes};
+                }
+            }
+        }
+
+        /**
+         * @brief Calls @p func(index, distance) for primitives whose box the ray hits within @p max_distance.
+         *
+         * @p distance is where the ray enters the box. The callback returns the new maximal
+         * distance: the distance of its exact hit to clip the ray, @p max_distance to go on
+         * unchanged, or a negative value to stop. Nearer subtrees are visited first, so clipping
+         * the ray finds the closest hit quickly.
+         *
+         * @param func Callable matching `float(uint32, float)`.
+         */
+        template<class Func>
+            requires std::is_invocable_r_v<float, Func&, uint32, float>
+        void ray_cast(const ray3& ray, float max_distance, Func&& func) const
+        {
+            if (m_nodes.empty()) {
+                return;
+            }
+
+            const ray_slab slab(ray);
+
+            uint32 stack[k_stack_size];
+            size_t top = 0;
+            if (slab.hit(m_nodes[0].min, m_nodes[0].max, max_distance) >= 0.0f) {
+                stack[top++] = 0;
+            }
+            while (top > 0) {
+                const node& n = m_nodes[stack[--top]];
+                if (n.is_leaf()) {
+                    for (uint32 i = n.first; i < n.first + n.count; ++i) {
+                        const float t = slab.hit(m_boxes[i].min, m_boxes[i].max, max_distance);
+                        if (t >= 0.0f) {
+                            max_distance = func(m_indices[i], t);
+                            if (max_distance < 0.0f) {
+                                return;
+                            }
+                        }
+                    }
+                    continue;
+                }
+
+                // Children are tested when pushed, a clipped ray may still visit a few extra nodes
+                const uint32 near = n.first;
+                const uint32 far = n.first + 1;
+                float        t_near = slab.hit(m_nodes[near].min, m_nodes[near].max, max_distance);
+                float        t_far = slab.hit(m_nodes[far].min, m_nodes[far].max, max_distance);
+                uint32       first = near;
+                uint32       second = far;
+                if (t_far >= 0.0f && (t_near < 0.0f || t_far < t_near)) {
+                    std::swap(first, second);
+                    std::swap(t_near, t_far);
+                }
+                TAV_ASSERT(top + 2 <= k_stack_size);
+                if (t_far >= 0.0f) {
+                    stack[top++] = second;
+                }
+                if (t_near >= 0.0f) {
+                    stack[top++] = first;
+                }
+            }
+        }
+
+        /**
+         * @brief Calls @p func(a, b) once for every pair of overlapping primitives.
+         *
+         * @param func Callable matching `void(uint32, uint32)`, with `a < b`.
+         */
+        template<class Func>
+            requires std::is_invocable_v<Func&, uint32, uint32>
+        void query_pairs(Func&& func) const
+        {
+            for (uint32 i = 0; i < m_boxes.size(); ++i) {
+                const uint32 a = m_indices[i];
+                query(m_boxes[i], [&](uint32 b) {
+                    if (a < b) {
+                        func(a, b);
+                    }
+                    return true;
+                });
+            }
+        }
+
+    private:
+        // SAH trees are not balanced, but stay far from this depth in practice
+        constexpr static size_t k_stack_size = 256;
+
+        // Ray with the inverse direction precomputed for slab tests
+        struct ray_slab
+        {
+            math::vec3 origin;
+            math::vec3 inv_dir;
+
+            explicit ray_slab(const ray3& ray) noexcept
+                : origin(ray.origin)
+                , inv_dir(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z)
+            {
+            }
+
+            // Entry distance, or a negative value on a miss or beyond max_distance
+            float hit(const math::vec3& min, const math::vec3& max, float max_distance) const noexcept
+            {
+                float t_enter = 0.0f;
+                float t_exit = max_distance;
+                for (size_t i = 0; i < 3; ++i) {
+                    float t0 = (min[i] - origin[i]) * inv_dir[i];
+                    float t1 = (max[i] - origin[i]) * inv_dir[i];
+                    if (t0 > t1) {
+                        std::swap(t0, t1);
+                    }
+                    // Written so that NaN from 0 * inf leaves the bounds unchanged
+                    t_enter = t0 > t_enter ? t0 : t_enter;
+                    t_exit = t1 < t_exit ? t1 : t_exit;
+                }
+                return t_enter <= t_exit ? t_enter : -1.0f;
+            }
+        };
+
+        // Returns false if the box is outside a plane in `planes`, clears the bits of the planes
+        // the box is fully inside of
+        static bool classify(const frustum& f, const math::vec3& min, const math::vec3& max, uint32& planes) noexcept
+        {
+            for (uint32 p = 0; p < 6; ++p) {
+                if ((planes & (1u << p)) == 0) {
+                    continue;
+                }
+                const auto& pl = f.planes[p];
+                const auto  positive = math::vec3(pl.normal.x >= 0.0f ? max.x : min.x, pl.normal.y >= 0.0f ? max.y : min.y, pl.normal.z >= 0.0f ? max.z : min.z);
+                if (math::dot(pl.normal, positive) + pl.distance < 0.0f) {
+                    return false;
+                }
+                const auto negative = math::vec3(pl.normal.x >= 0.0f ? min.x : max.x, pl.normal.y >= 0.0f ? min.y : max.y, pl.normal.z >= 0.0f ? min.z : max.z);
+                if (math::dot(pl.normal, negative) + pl.distance >= 0.0f) {
+                    planes &= ~(1u << p);
+                }
+            }
+            return true;
+        }
+
+        // Primitives of the subtree at node `index`, the leftmost and rightmost leaves bound them
+        std::pair<uint32, uint32> primitive_range(uint32 index) const noexcept
+        {
+            uint32 left = index;
+            while (!m_nodes[left].is_leaf()) {
+                left = m_nodes[left].first;
+            }
+            uint32 right = index;
+            while (!m_nodes[right].is_leaf()) {
+                right = m_nodes[right].first + 1;
+            }
+            return {m_nodes[left].first, m_nodes[right].first + m_nodes[right].count};
+        }
+
+        void build_impl(core::buffer_view<aabb3> boxes, core::executor* exec, uint32 max_leaf_size);
+
+    private:
+        core::vector<node>   m_nodes;
+        core::vector<uint32> m_indices;
+        core::vector<aabb3>  m_boxes;
+    };
+
+} // namespace tavros::geometry
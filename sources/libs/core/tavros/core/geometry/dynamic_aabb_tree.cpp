@@ -0,0 +1,306 @@
+#include <tavros/core/geometry/dynamic_aabb_tree.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    using tavros::geometry::aabb3;
+
+    // Extra room along the displacement, in units of the displacement
+    constexpr float k_displacement_multiplier = 2.0f;
+
+    float surface_area(const aabb3& box) noexcept
+    {
+        const auto s = box.size();
+        return 2.0f * (s.x * s.y + s.y * s.z + s.z * s.x);
+    }
+
+    bool contains(const aabb3& outer, const aabb3& inner) noexcept
+    {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z
+            && inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+    }
+} // namespace
+
+namespace tavros::geometry
+{
+
+    dynamic_aabb_tree::dynamic_aabb_tree(float margin) noexcept
+        : m_margin(margin)
+    {
+        TAV_ASSERT(margin >= 0.0f);
+    }
+
+    dynamic_aabb_tree::proxy_id dynamic_aabb_tree::insert(const aabb3& box, uint64 user_data)
+    {
+        const uint32 leaf = allocate_node();
+        auto&        n = m_nodes[leaf];
+        n.box = aabb3(box.min - math::vec3(m_margin), box.max + math::vec3(m_margin));
+        n.user_data = user_data;
+        n.height = 0;
+
+        insert_leaf(leaf);
+        ++m_proxy_count;
+        return leaf;
+    }
+
+    void dynamic_aabb_tree::remove(proxy_id id) noexcept
+    {
+        TAV_ASSERT(is_proxy(id));
+        remove_leaf(id);
+        free_node(id);
+        --m_proxy_count;
+    }
+
+    bool dynamic_aabb_tree::move(proxy_id id, const aabb3& box, const math::vec3& displacement) noexcept
+    {
+        TAV_ASSERT(is_proxy(id));
+        if (contains(m_nodes[id].box, box)) {
+            return false;
+        }
+
+        remove_leaf(id);
+
+        aabb3      fat(box.min - math::vec3(m_margin), box.max + math::vec3(m_margin));
+        const auto d = displacement * k_displacement_multiplier;
+        for (size_t i = 0; i < 3; ++i) {
+            if (d[i] < 0.0f) {
+                fat.min[i] += d[i];
+            } else {
+                fat.max[i] += d[i];
+            }
+        }
+        m_nodes[id].box = fat;
+
+        insert_leaf(id);
+        return true;
+    }
+
+    void dynamic_aabb_tree::clear() noexcept
+    {
+        m_nodes.clear();
+        m_root = k_null_proxy;
+        m_free_list = k_null_proxy;
+        m_proxy_count = 0;
+    }
+
+    uint32 dynamic_aabb_tree::allocate_node()
+    {
+        if (m_free_list == k_null_proxy) {
+            m_nodes.emplace_back();
+            return static_cast<uint32>(m_nodes.size() - 1);
+        }
+
+        const uint32 index = m_free_list;
+        m_free_list = m_nodes[index].parent;
+        m_nodes[index] = node();
+        return index;
+    }
+
+    void dynamic_aabb_tree::free_node(uint32 index) noexcept
+    {
+        auto& n = m_nodes[index];
+        n.parent = m_free_list;
+        n.child1 = k_null_proxy;
+        n.child2 = k_null_proxy;
+        n.height = -1;
+        m_free_list = index;
+    }
+
+    void dynamic_aabb_tree::insert_leaf(uint32 leaf) noexcept
+    {
+        if (m_root == k_null_proxy) {
+            m_root = leaf;
+            m_nodes[leaf].parent = k_null_proxy;
+            return;
+        }
+
+        // Descend towards the sibling with the smallest increase of the total surface area
+        const aabb3 leaf_box = m_nodes[leaf].box;
+        uint32      index = m_root;
+        while (!m_nodes[index].is_leaf()) {
+            const auto& n = m_nodes[index];
+            const float area = surface_area(n.box);
+            const float combined_area = surface_area(n.box.merged(leaf_box));
+
+            // Cost of making the leaf a sibling of this node
+            const float cost = 2.0f * combined_area;
+            // Growth of the ancestors if the leaf goes further down
+            const float inheritance_cost = 2.0f * (combined_area - area);
+
+            auto descend_cost = [&](uint32 child) {
+                const auto& c = m_nodes[child];
+                const float merged_area = surface_area(c.box.merged(leaf_box));
+                return (c.is_leaf() ? merged_area : merged_area - surface_area(c.box)) + inheritance_cost;
+            };
+            const float cost1 = descend_cost(n.child1);
+            const float cost2 = descend_cost(n.child2);
+
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? n.child1 : n.child2;
+        }
+
+        // Replace the sibling with a new parent of the sibling and the leaf
+        const uint32 sibling = index;
+        const uint32 old_parent = m_nodes[sibling].parent;
+        const uint32 new_parent = allocate_node();
+        auto&        p = m_nodes[new_parent];
+        p.parent = old_parent;
+        p.box = m_nodes[sibling].box.merged(leaf_box);
+        p.height = m_nodes[sibling].height + 1;
+        p.child1 = sibling;
+        p.child2 = leaf;
+        m_nodes[sibling].parent = new_parent;
+        m_nodes[leaf].parent = new_parent;
+
+        if (old_parent == k_null_proxy) {
+            m_root = new_parent;
+        } else if (m_nodes[old_parent].child1 == sibling) {
+            m_nodes[old_parent].child1 = new_parent;
+        } else {
+            m_nodes[old_parent].child2 = new_parent;
+        }
+
+        refit_ancestors(new_parent);
+    }
+
+    void dynamic_aabb_tree::remove_leaf(uint32 leaf) noexcept
+    {
+        if (leaf == m_root) {
+            m_root = k_null_proxy;
+            return;
+        }
+
+        // The sibling takes the place of the parent
+        const uint32 parent = m_nodes[leaf].parent;
+        const uint32 grand_parent = m_nodes[parent].parent;
+        const uint32 sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        m_nodes[sibling].parent = grand_parent;
+        free_node(parent);
+
+        if (grand_parent == k_null_proxy) {
+            m_root = sibling;
+            return;
+        }
+
+        if (m_nodes[grand_parent].child1 == parent) {
+            m_nodes[grand_parent].child1 = sibling;
+        } else {
+            m_nodes[grand_parent].child2 = sibling;
+        }
+        refit_ancestors(grand_parent);
+    }
+
+    void dynamic_aabb_tree::refit_ancestors(uint32 index) noexcept
+    {
+        while (index != k_null_proxy) {
+            index = balance(index);
+
+            auto&       n = m_nodes[index];
+            const auto& c1 = m_nodes[n.child1];
+            const auto& c2 = m_nodes[n.child2];
+            n.height = 1 + std::max(c1.height, c2.height);
+            n.box = c1.box.merged(c2.box);
+
+            index = n.parent;
+        }
+    }
+
+    uint32 dynamic_aabb_tree::balance(uint32 index_a) noexcept
+    {
+        /*
+         * Rotates the higher child of A up when the heights of its children differ by more than one:
+         *
+         *       A                 C
+         *     /   \             /   \
+         *    B     C    ->     A     F/G
+         *         / \         / \
+         *        F   G       B   G/F
+         *
+         * and the mirrored case when B is the higher one. Returns the node now at the place of A.
+         */
+
+        auto& a = m_nodes[index_a];
+        if (a.is_leaf() || a.height < 2) {
+            return index_a;
+        }
+
+        const uint32 index_b = a.child1;
+        const uint32 index_c = a.child2;
+        auto&        b = m_nodes[index_b];
+        auto&        c = m_nodes[index_c];
+        const int32  diff = c.height - b.height;
+
+        auto replace_in_parent = [&](uint32 old_child, uint32 new_child) {
+            const uint32 parent = m_nodes[new_child].parent;
+            if (parent == k_null_proxy) {
+                m_root = new_child;
+            } else if (m_nodes[parent].child1 == old_child) {
+                m_nodes[parent].child1 = new_child;
+            } else {
+                m_nodes[parent].child2 = new_child;
+            }
+        };
+
+        if (diff > 1) {
+            const uint32 index_f = c.child1;
+            const uint32 index_g = c.child2;
+            auto&        f = m_nodes[index_f];
+            auto&        g = m_nodes[index_g];
+
+            c.child1 = index_a;
+            c.parent = a.parent;
+            a.parent = index_c;
+            replace_in_parent(index_a, index_c);
+
+            // The higher grandchild stays under C
+            const bool   keep_f = f.height > g.height;
+            const uint32 index_kept = keep_f ? index_f : index_g;
+            const uint32 index_moved = keep_f ? index_g : index_f;
+            auto&        kept = m_nodes[index_kept];
+            auto&        moved = m_nodes[index_moved];
+
+            c.child2 = index_kept;
+            a.child2 = index_moved;
+            moved.parent = index_a;
+            a.box = b.box.merged(moved.box);
+            c.box = a.box.merged(kept.box);
+            a.height = 1 + std::max(b.height, moved.height);
+            c.height = 1 + std::max(a.height, kept.height);
+            return index_c;
+        }
+
+        if (diff < -1) {
+            const uint32 index_d = b.child1;
+            const uint32 index_e = b.child2;
+            auto&        d = m_nodes[index_d];
+            auto&        e = m_nodes[index_e];
+
+            b.child1 = index_a;
+            b.parent = a.parent;
+            a.parent = index_b;
+            replace_in_parent(index_a, index_b);
+
+            const bool   keep_d = d.height > e.height;
+            const uint32 index_kept = keep_d ? index_d : index_e;
+            const uint32 index_moved = keep_d ? index_e : index_d;
+            auto&        kept = m_nodes[index_kept];
+            auto&        moved = m_nodes[index_moved];
+
+            b.child2 = index_kept;
+            a.child1 = index_moved;
+            moved.parent = index_a;
+            a.box = c.box.merged(moved.box);
+            b.box = a.box.merged(kept.box);
+            a.height = 1 + std::max(c.height, moved.height);
+            b.height = 1 + std::max(a.height, kept.height);
+            return index_b;
+        }
+
+        return index_a;
+    }
+
+} // namespace tavros::geometry
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/geometry/aabb3.hpp>
+#include <tavros/core/geometry/frustum.hpp>
+#include <tavros/core/geometry/ray3.hpp>
+#include <tavros/core/geometry/functions/intersect.hpp>
+#include <tavros/core/debug/assert.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace tavros::geometry
+{
+
+    /**
+     * @brief Bounding volume hierarchy of moving objects, updated incrementally.
+     *
+     * Every object (a proxy) is a leaf holding a fat box: the object bounds grown by a margin.
+     * While an object stays inside its fat box, moving it costs nothing; when it leaves, the
+     * leaf is removed and inserted again. Suited for objects that are added, removed and moved
+     * every frame; for geometry that does not change, @ref bvh gives faster queries.
+     *
+     * Features and design choices:
+     * - Nodes live in one array with a free list, proxy ids are node indices and stay valid
+     *   until the proxy is removed.
+     * - Insertion picks the sibling with the surface area heuristic; tree rotations keep the
+     *   tree balanced whatever the insertion order.
+     * - Movement is predicted: the fat box is also extended along the displacement, so objects
+     *   moving steadily are re-inserted less often.
+     * - Queries are templates taking the callback, without allocations.
+     *
+     * Notes:
+     * - Queries test fat boxes, so they report candidates; callers test the exact bounds.
+     * - The tree must not be modified from inside a query callback.
+     */
+    class dynamic_aabb_tree
+    {
+    public:
+        using proxy_id = uint32;
+
+        /// Id that never refers to a proxy.
+        constexpr static proxy_id k_null_proxy = 0xffffffff;
+
+    public:
+        /**
+         * @brief Creates an empty tree.
+         *
+         * @param margin Distance by which the fat boxes extend the object bounds on every side.
+         */
+        explicit dynamic_aabb_tree(float margin = 0.1f) noexcept;
+
+        /**
+         * @brief Adds an object with bounds @p box and returns its proxy id.
+         *
+         * @param box       Bounds of the object.
+         * @param user_data Arbitrary value kept with the proxy, see @ref user_data().
+         */
+        proxy_id insert(const aabb3& box, uint64 user_data = 0);
+
+        /**
+         * @brief Removes the proxy @p id, the id may be reused by later insertions.
+         */
+        void remove(proxy_id id) noexcept;
+
+        /**
+         * @brief Updates the bounds of proxy @p id after the object moved.
+         *
+         * Nothing happens while @p box stays inside the fat box. Otherwise the proxy is
+         * re-inserted with a new fat box, extended along @p displacement (the expected motion
+         * until the next update).
+         *
+         * @return true if the proxy was re-inserted.
+         */
+        bool move(proxy_id id, const aabb3& box, const math::vec3& displacement = math::vec3(0.0f)) noexcept;
+
+        /**
+         * @brief Removes all proxies.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Returns the fat box of proxy @p id.
+         */
+        [[nodiscard]] const aabb3& fat_box(proxy_id id) const noexcept
+        {
+            TAV_ASSERT(is_proxy(id));
+            return m_nodes[id].box;
+        }
+
+        /**
+         * @brief Returns the user data given on insertion of proxy @p id.
+         */
+        [[nodiscard]] uint64 user_data(proxy_id id) const noexcept
+        {
+            TAV_ASSERT(is_proxy(id));
+            return m_nodes[id].user_data;
+        }
+
+        /**
+         * @brief Returns the number of proxies.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_proxy_count;
+        }
+
+        /**
+         * @brief Returns true if the tree has no proxies.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_proxy_count == 0;
+        }
+
+        /**
+         * @brief Returns the height of the tree, 0 for an empty tree or a single proxy.
+         */
+        [[nodiscard]] int32 height() const noexcept
+        {
+            return m_root == k_null_proxy ? 0 : m_nodes[m_root].height;
+        }
+
+        /**
+         * @brief Calls @p func(id) for every proxy whose fat box overlaps @p box.
+         *
+         * @param func Callable matching `bool(proxy_id)`, returning false stops the query.
+         */
+        template<class Func>
+            requires std::is_invocable_r_v<bool, Func&, proxy_id>
+        void query(const aabb3& box, Func&& func) const
+        {
+            traverse([&](const node& n) { return intersects(n.box, box); }, func);
+        }
+
+        /**
+         * @brief Calls @p func(id) for every proxy whose fat box is inside or intersects frustum @p f.
+         *
+         * @param func Callable matching `bool(proxy_id)`, returning false stops the query.
+         */
+        template<class Func>
+            requires std::is_invocable_r_v<bool, Func&, proxy_id>
+        void query(const frustum& f, Func&& func) const
+        {
+            traverse([&](const node& n) { return f.contains_aabb(n.box); }, func);
+        }
+
+        /**
+         * @brief Calls @p func(id, distance) for proxies whose fat box the ray hits within @p max_distance.
+         *
+         * @p distance is where the ray enters the fat box. The callback returns the new maximal
+         * distance: the distance of its exact hit to clip the ray, @p max_distance to go on
+         * unchanged, or a negative value to stop. Proxies are visited in no particular order.
+         *
+         * @param func Callable matching `float(proxy_id, float)`.
+         */
+        template<class Func>
+            requires std::is_invocable_r_v<float, Func&, proxy_id, float>
+        void ray_cast(const ray3& ray, float max_distance, Func&& func) const
+        {
+            traverse(
+                [&](const node& n) {
+                    const float t = intersect(ray, n.box);
+                    return t >= 0.0f && t <= max_distance;
+                },
+                [&](proxy_id id) {
+                    max_distance = func(id, intersect(ray, m_nodes[id].box));
+                    return max_distance >= 0.0f;
+                }
+            );
+        }
+
+        /**
+         * @brief Calls @p func(a, b) once for every pair of proxies with overlapping fat boxes.
+         *
+         * @param func Callable matching `void(proxy_id, proxy_id)`, with `a < b`.
+         */
+        template<class Func>
+            requires std::is_invocable_v<Func&, proxy_id, proxy_id>
+        void query_pairs(Func&& func) const
+        {
+            for (proxy_id a = 0; a < m_nodes.size(); ++a) {
+                if (!is_proxy(a)) {
+                    continue;
+                }
+                query(m_nodes[a].box, [&](proxy_id b) {
+                    if (a < b) {
+                        func(a, b);
+                    }
+                    return true;
+                });
+            }
+        }
+
+    private:
+        struct node
+        {
+            aabb3  box;
+            uint64 user_data = 0;
+            // Parent for nodes in the tree, next free node for nodes in the free list
+            uint32 parent = k_null_proxy;
+            uint32 child1 = k_null_proxy;
+            uint32 child2 = k_null_proxy;
+            // 0 for leaves, -1 for free nodes
+            int32 height = -1;
+
+            [[nodiscard]] bool is_leaf() const noexcept
+            {
+                return child1 == k_null_proxy;
+            }
+        };
+
+        [[nodiscard]] bool is_proxy(proxy_id id) const noexcept
+        {
+            return id < m_nodes.size() && m_nodes[id].height == 0;
+        }
+
+        // Depth-first walk calling leaf(id) for leaves whose ancestors all pass accept(node)
+        template<class Accept, class Leaf>
+        void traverse(Accept&& accept, Leaf&& leaf) const
+        {
+            if (m_root == k_null_proxy) {
+                return;
+            }
+
+            // Rotations bound the height to about 1.44 * log2(size)
+            uint32 stack[128];
+            size_t top = 0;
+            stack[top++] = m_root;
+            while (top > 0) {
+                const uint32 index = stack[--top];
+                const node&  n = m_nodes[index];
+                if (!accept(n)) {
+                    continue;
+                }
+                if (n.is_leaf()) {
+                    if (!leaf(static_cast<proxy_id>(index))) {
+                        return;
+                    }
+                } else {
+                    TAV_ASSERT(top + 2 <= std::size(stack));
+                    stack[top++] = n.child1;
+                    stack[top++] = n.child2;
+                }
+            }
+        }
+
+        uint32 allocate_node();
+        void   free_node(uint32 index) noexcept;
+        void   insert_leaf(uint32 leaf) noexcept;
+        void   remove_leaf(uint32 leaf) noexcept;
+        uint32 balance(uint32 index) noexcept;
+        void   refit_ancestors(uint32 index) noexcept;
+
+    private:
+        core::vector<node> m_nodes;
+        uint32             m_root = k_null_proxy;
+        uint32             m_free_list = k_null_proxy;
+        size_t             m_proxy_count = 0;
+        float              m_margin;
+    };
+
+} // namespace tavros::geometry
@@ -13,9 +13,10 @@ namespace tavros::geometry
         auto r2 = math::vec3(m[0][2], m[1][2], m[2][2]);
         auto r3 = math::vec3(m[0][3], m[1][3], m[2][3]);
 
-        float w0 = m[0][3];
-        float w1 = m[1][3];
-        float w2 = m[2][3];
+        // Fourth components of the rows, the translation column
+        float w0 = m[3][0];
+        float w1 = m[3][1];
+        float w2 = m[3][2];
         float w3 = m[3][3];
 
         auto make_plane = [](const math::vec3& normal, float d) -> plane {
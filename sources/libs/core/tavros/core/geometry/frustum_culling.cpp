@@ -0,0 +1,280 @@
+#include <tavros/core/geometry/frustum_culling.hpp>
+
+#include <tavros/core/math/bitops.hpp>
+#include <tavros/core/math/simd/float4.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    using namespace tavros;
+    using geometry::aabb3_soa;
+    using geometry::frustum;
+    using geometry::sphere_soa;
+
+    // Index of the pass-all plane in plane tables, used for objects without a cached plane
+    constexpr size_t k_pass_plane = 6;
+
+    // Plane with the absolute normal precomputed for the box test
+    struct plane_data
+    {
+        float nx, ny, nz, d;
+        float ax, ay, az;
+    };
+
+    void make_planes(const frustum& f, plane_data (&planes)[7]) noexcept
+    {
+        for (size_t p = 0; p < 6; ++p) {
+            const auto& pl = f.planes[p];
+            planes[p] = {pl.normal.x, pl.normal.y, pl.normal.z, pl.distance, math::abs(pl.normal.x), math::abs(pl.normal.y), math::abs(pl.normal.z)};
+        }
+        // Every object is on the positive side of this one
+        planes[k_pass_plane] = {0.0f, 0.0f, 0.0f, std::numeric_limits<float>::max(), 0.0f, 0.0f, 0.0f};
+    }
+
+    // A bounds policy gives the signed distance of the object point farthest along the plane
+    // normal, the object is outside the plane when it is negative
+
+    struct sphere_bounds
+    {
+        const float* cx;
+        const float* cy;
+        const float* cz;
+        const float* r;
+
+        explicit sphere_bounds(const sphere_soa& s) noexcept
+            : cx(s.center_x.data())
+            , cy(s.center_y.data())
+            , cz(s.center_z.data())
+            , r(s.radius.data())
+        {
+            TAV_ASSERT(s.center_x.size() == s.size() && s.center_y.size() == s.size() && s.center_z.size() == s.size());
+        }
+
+        float reach(const plane_data& p, size_t i) const noexcept
+        {
+            return p.nx * cx[i] + p.ny * cy[i] + p.nz * cz[i] + p.d + r[i];
+        }
+
+#if TAV_MATH_SIMD_ENABLED
+        struct wide
+        {
+            math::simd::float4 cx, cy, cz, r;
+        };
+
+        wide load(size_t i) const noexcept
+        {
+            using math::simd::load;
+            return {load(cx + i), load(cy + i), load(cz + i), load(r + i)};
+        }
+
+        template<class WidePlane>
+        static math::simd::float4 reach(const WidePlane& p, const wide& o) noexcept
+        {
+            using namespace math::simd;
+            return madd(p.nx, o.cx, madd(p.ny, o.cy, madd(p.nz, o.cz, add(p.d, o.r))));
+        }
+#endif
+    };
+
+    struct aabb3_bounds
+    {
+        const float* cx;
+        const float* cy;
+        const float* cz;
+        const float* ex;
+        const float* ey;
+        const float* ez;
+
+        explicit aabb3_bounds(const aabb3_soa& b) noexcept
+            : cx(b.center_x.data())
+            , cy(b.center_y.data())
+            , cz(b.center_z.data())
+            , ex(b.extent_x.data())
+            , ey(b.extent_y.data())
+            , ez(b.extent_z.data())
+        {
+            TAV_ASSERT(b.center_y.size() == b.size() && b.center_z.size() == b.size());
+            TAV_ASSERT(b.extent_x.size() == b.size() && b.extent_y.size() == b.size() && b.extent_z.size() == b.size());
+        }
+
+        float reach(const plane_data& p, size_t i) const noexcept
+        {
+            const float center = p.nx * cx[i] + p.ny * cy[i] + p.nz * cz[i] + p.d;
+            return center + p.ax * ex[i] + p.ay * ey[i] + p.az * ez[i];
+        }
+
+#if TAV_MATH_SIMD_ENABLED
+        struct wide
+        {
+            math::simd::float4 cx, cy, cz, ex, ey, ez;
+        };
+
+        wide load(size_t i) const noexcept
+        {
+            using math::simd::load;
+            return {load(cx + i), load(cy + i), load(cz + i), load(ex + i), load(ey + i), load(ez + i)};
+        }
+
+        template<class WidePlane>
+        static math::simd::float4 reach(const WidePlane& p, const wide& o) noexcept
+        {
+            using namespace math::simd;
+            const float4 center = madd(p.nx, o.cx, madd(p.ny, o.cy, madd(p.nz, o.cz, p.d)));
+            return madd(p.ax, o.ex, madd(p.ay, o.ey, madd(p.az, o.ez, center)));
+        }
+#endif
+    };
+
+#if TAV_MATH_SIMD_ENABLED
+    // One plane broadcast to all lanes, or a different plane per lane
+    struct wide_plane
+    {
+        math::simd::float4 nx, ny, nz, d;
+        math::simd::float4 ax, ay, az;
+
+        explicit wide_plane(const plane_data& p) noexcept
+        {
+            using namespace math::simd;
+            nx = set1(p.nx), ny = set1(p.ny), nz = set1(p.nz), d = set1(p.d);
+            ax = set1(p.ax), ay = set1(p.ay), az = set1(p.az);
+        }
+
+        wide_plane(const plane_data& p0, const plane_data& p1, const plane_data& p2, const plane_data& p3) noexcept
+        {
+            using namespace math::simd;
+            nx = set4(p0.nx, p1.nx, p2.nx, p3.nx), ny = set4(p0.ny, p1.ny, p2.ny, p3.ny);
+            nz = set4(p0.nz, p1.nz, p2.nz, p3.nz), d = set4(p0.d, p1.d, p2.d, p3.d);
+            ax = set4(p0.ax, p1.ax, p2.ax, p3.ax), ay = set4(p0.ay, p1.ay, p2.ay, p3.ay);
+            az = set4(p0.az, p1.az, p2.az, p3.az);
+        }
+    };
+#endif
+
+    // Tests every object and calls emit(first, bits) with a bit per visible object starting at
+    // index first. Groups of four always start at a multiple of four.
+    template<class Bounds, class Emit>
+    size_t cull_impl(const frustum& f, const Bounds& bounds, size_t n, core::buffer_span<uint8> cache, Emit&& emit) noexcept
+    {
+        const bool use_cache = !cache.empty();
+        TAV_ASSERT(!use_cache || cache.size() >= n);
+
+        plane_data planes[7];
+        make_planes(f, planes);
+
+        size_t visible = 0;
+        size_t i = 0;
+
+#if TAV_MATH_SIMD_ENABLED
+        using namespace math::simd;
+
+        const wide_plane wide_planes[6] = {
+            wide_plane(planes[0]),
+            wide_plane(planes[1]),
+            wide_plane(planes[2]),
+            wide_plane(planes[3]),
+            wide_plane(planes[4]),
+            wide_plane(planes[5]),
+        };
+        const float4 zero = set1(0.0f);
+
+        for (; i + 4 <= n; i += 4) {
+            const auto object = bounds.load(i);
+            uint32     outside = 0;
+
+            if (use_cache) {
+                // Each lane tests the plane that rejected it last time first
+                const wide_plane cached(
+                    planes[std::min<size_t>(cache[i], k_pass_plane)],
+                    planes[std::min<size_t>(cache[i + 1], k_pass_plane)],
+                    planes[std::min<size_t>(cache[i + 2], k_pass_plane)],
+                    planes[std::min<size_t>(cache[i + 3], k_pass_plane)]
+                );
+                outside = mask_bits(less(Bounds::reach(cached, object), zero));
+            }
+
+            for (uint8 p = 0; p < 6 && outside != 0xf; ++p) {
+                const uint32 rejected = mask_bits(less(Bounds::reach(wide_planes[p], object), zero)) & ~outside;
+                if (use_cache) {
+                    for (uint32 lanes = rejected; lanes != 0; lanes &= lanes - 1) {
+                        cache[i + math::count_trailing_zeros(lanes)] = p;
+                    }
+                }
+                outside |= rejected;
+            }
+
+            const uint32 inside = ~outside & 0xf;
+            visible += math::bit_count(inside);
+            emit(i, inside);
+        }
+#endif
+
+        for (; i < n; ++i) {
+            bool is_outside = use_cache && bounds.reach(planes[std::min<size_t>(cache[i], k_pass_plane)], i) < 0.0f;
+            for (uint8 p = 0; p < 6 && !is_outside; ++p) {
+                if (bounds.reach(planes[p], i) < 0.0f) {
+                    is_outside = true;
+                    if (use_cache) {
+                        cache[i] = p;
+                    }
+                }
+            }
+            if (!is_outside) {
+                ++visible;
+                emit(i, 1u);
+            }
+        }
+
+        return visible;
+    }
+
+    template<class Bounds>
+    size_t cull_to_indices(const frustum& f, const Bounds& bounds, size_t n, core::buffer_span<uint32> visible, core::buffer_span<uint8> cache) noexcept
+    {
+        TAV_ASSERT(visible.size() >= n);
+        uint32* out = visible.data();
+        return cull_impl(f, bounds, n, cache, [&](size_t first, uint32 bits) {
+            for (; bits != 0; bits &= bits - 1) {
+                *out++ = static_cast<uint32>(first + math::count_trailing_zeros(bits));
+            }
+        });
+    }
+
+    template<class Bounds>
+    size_t cull_to_mask(const frustum& f, const Bounds& bounds, size_t n, core::buffer_span<uint64> mask, core::buffer_span<uint8> cache) noexcept
+    {
+        const size_t words = (n + 63) / 64;
+        TAV_ASSERT(mask.size() >= words);
+        std::fill(mask.data(), mask.data() + words, uint64(0));
+        return cull_impl(f, bounds, n, cache, [&](size_t first, uint32 bits) {
+            // Groups of four never cross a word, they start at a multiple of four
+            mask[first / 64] |= static_cast<uint64>(bits) << (first % 64);
+        });
+    }
+} // namespace
+
+namespace tavros::geometry
+{
+
+    size_t frustum_cull(const frustum& f, const sphere_soa& spheres, core::buffer_span<uint32> visible, core::buffer_span<uint8> plane_cache) noexcept
+    {
+        return cull_to_indices(f, sphere_bounds(spheres), spheres.size(), visible, plane_cache);
+    }
+
+    size_t frustum_cull(const frustum& f, const aabb3_soa& boxes, core::buffer_span<uint32> visible, core::buffer_span<uint8> plane_cache) noexcept
+    {
+        return cull_to_indices(f, aabb3_bounds(boxes), boxes.size(), visible, plane_cache);
+    }
+
+    size_t frustum_cull_mask(const frustum& f, const sphere_soa& spheres, core::buffer_span<uint64> mask, core::buffer_span<uint8> plane_cache) noexcept
+    {
+        return cull_to_mask(f, sphere_bounds(spheres), spheres.size(), mask, plane_cache);
+    }
+
+    size_t frustum_cull_mask(const frustum& f, const aabb3_soa& boxes, core::buffer_span<uint64> mask, core::buffer_span<uint8> plane_cache) noexcept
+    {
+        return cull_to_mask(f, aabb3_bounds(boxes), boxes.size(), mask, plane_cache);
+    }
+
+} // namespace tavros::geometry
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <tavros/core/geometry/frustum.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+
+namespace tavros::geometry
+{
+
+    /**
+     * @brief Bounding spheres stored as separate component arrays.
+     *
+     * All arrays must have the same size.
+     */
+    struct sphere_soa
+    {
+        core::buffer_view<float> center_x;
+        core::buffer_view<float> center_y;
+        core::buffer_view<float> center_z;
+        core::buffer_view<float> radius;
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return radius.size();
+        }
+    };
+
+    /**
+     * @brief Axis-aligned boxes stored as separate arrays of centers and half extents.
+     *
+     * Center and half extent give a cheaper plane test than min/max corners:
+     * no per-plane corner selection is needed. All arrays must have the same size.
+     */
+    struct aabb3_soa
+    {
+        core::buffer_view<float> center_x;
+        core::buffer_view<float> center_y;
+        core::buffer_view<float> center_z;
+        core::buffer_view<float> extent_x;
+        core::buffer_view<float> extent_y;
+        core::buffer_view<float> extent_z;
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return center_x.size();
+        }
+    };
+
+    /// Value of a plane cache entry for an object that no plane has rejected yet.
+    constexpr uint8 k_no_rejecting_plane = 0xff;
+
+    /**
+     * @brief Writes the indices of spheres visible in frustum @p f to @p visible.
+     *
+     * Tests arrays of bounds with the same result as @ref frustum::contains_sphere() applied to
+     * every object. With the SIMD layer enabled (`TAV_ENABLE_MATH_SIMD`) each plane is tested against
+     * four objects per instruction.
+     *
+     * Temporal coherency: pass a @p plane_cache of one byte per object, initialized to
+     * @ref k_no_rejecting_plane and kept between frames. Each call records which plane rejected
+     * an object and tests that plane first next time, so objects that stay outside are rejected
+     * with a single plane test. With an empty cache all planes are tested.
+     *
+     * @param f           The frustum.
+     * @param spheres     Bounds to test.
+     * @param visible     Output, must hold at least `spheres.size()` indices.
+     * @param plane_cache Optional cache of rejecting planes, one entry per sphere.
+     *
+     * @return Number of indices written to @p visible, in increasing order.
+     */
+    size_t frustum_cull(const frustum& f, const sphere_soa& spheres, core::buffer_span<uint32> visible, core::buffer_span<uint8> plane_cache = {}) noexcept;
+
+    /**
+     * @brief Writes the indices of boxes visible in frustum @p f to @p visible.
+     *
+     * Same as the sphere version, with the result of @ref frustum::contains_aabb().
+     */
+    size_t frustum_cull(const frustum& f, const aabb3_soa& boxes, core::buffer_span<uint32> visible, core::buffer_span<uint8> plane_cache = {}) noexcept;
+
+    /**
+     * @brief Writes a visibility bitmask of spheres in frustum @p f.
+     *
+     * Bit `i % 64` of word `i / 64` is set if sphere `i` is visible, the remaining bits of
+     * the last word are cleared. See @ref frustum_cull() for @p plane_cache.
+     *
+     * @param mask Output, must hold at least `(spheres.size() + 63) / 64` words.
+     *
+     * @return Number of visible spheres.
+     */
+    size_t frustum_cull_mask(const frustum& f, const sphere_soa& spheres, core::buffer_span<uint64> mask, core::buffer_span<uint8> plane_cache = {}) noexcept;
+
+    /**
+     * @brief Writes a visibility bitmask of boxes in frustum @p f.
+     *
+     * Same as the sphere version, with the result of @ref frustum::contains_aabb().
+     */
+    size_t frustum_cull_mask(const frustum& f, const aabb3_soa& boxes, core::buffer_span<uint64> mask, core::buffer_span<uint8> plane_cache = {}) noexcept;
+
+} // namespace tavros::geometry
@@ -4,6 +4,10 @@
 #include <tavros/core/geometry/sphere.hpp>
 #include <tavros/core/geometry/ray3.hpp>
 #include <tavros/core/geometry/aabb2.hpp>
+#include <tavros/core/geometry/aabb3.hpp>
+
+#include <limits>
+#include <utility>
 
 namespace tavros::geometry
 {
@@ -44,5 +48,32 @@ namespace tavros::geometry
         return overlap_x && overlap_y;
     }
 
+    bool intersects(const aabb3& box1, const aabb3& box2) noexcept
+    {
+        auto overlap_x = box1.min.x <= box2.max.x && box1.max.x >= box2.min.x;
+        auto overlap_y = box1.min.y <= box2.max.y && box1.max.y >= box2.min.y;
+        auto overlap_z = box1.min.z <= box2.max.z && box1.max.z >= box2.min.z;
+        return overlap_x && overlap_y && overlap_z;
+    }
+
+    float intersect(const ray3& ray, const aabb3& box) noexcept
+    {
+        // Slab test, a zero direction component gives infinite slab distances
+        float t_enter = 0.0f;
+        float t_exit = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < 3; ++i) {
+            const float inv_dir = 1.0f / ray.direction[i];
+            float       t0 = (box.min[i] - ray.origin[i]) * inv_dir;
+            float       t1 = (box.max[i] - ray.origin[i]) * inv_dir;
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            // Written so that NaN from 0 * inf leaves the bounds unchanged
+            t_enter = t0 > t_enter ? t0 : t_enter;
+            t_exit = t1 < t_exit ? t1 : t_exit;
+        }
+        return t_enter <= t_exit ? t_enter : -1.0f;
+    }
+
 } // namespace tavros::geometry
 
@@ -12,6 +12,7 @@ namespace tavros::geometry
     class sphere;
     class ray3;
     class aabb2;
+    class aabb3;
 
     float intersect(const ray3& ray, const plane& plane) noexcept;
 
@@ -19,5 +20,14 @@ namespace tavros::geometry
 
     bool intersects(const aabb2& box1, const aabb2& box2) noexcept;
 
+    bool intersects(const aabb3& box1, const aabb3& box2) noexcept;
+
+    /**
+     * @brief Distance along the ray to the point where it enters the box.
+     *
+     * Returns 0 if the ray starts inside the box and a negative value if the ray misses it.
+     */
+    float intersect(const ray3& ray, const aabb3& box) noexcept;
+
 } // namespace tavros::geometry
 
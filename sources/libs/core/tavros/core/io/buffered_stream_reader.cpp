@@ -0,0 +1,186 @@
+#include <tavros/core/io/buffered_stream_reader.hpp>
+
+#include <tavros/core/debug/unreachable.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+namespace
+{
+    tavros::core::logger logger("buffered_stream_reader");
+} // namespace
+
+namespace tavros::core
+{
+
+    buffered_stream_reader::buffered_stream_reader(basic_stream_reader& source, size_t buffer_size)
+        : m_source(source)
+        , m_buffer(buffer_size)
+    {
+        TAV_ASSERT(buffer_size > 0);
+    }
+
+    size_t buffered_stream_reader::read(uint8* dst, size_t size)
+    {
+        if (size == 0) {
+            ::logger.warning("Read called with empty size");
+            return 0;
+        }
+
+        if (!good()) {
+            return 0;
+        }
+
+        size_t done = std::min(size, m_end - m_pos);
+        std::memcpy(dst, m_buffer.data() + m_pos, done);
+        m_pos += done;
+
+        if (done < size) {
+            const size_t rest = size - done;
+            if (rest >= m_buffer.capacity()) {
+                // Too large for the window, copying through it would only add a memcpy
+                if (m_source.good()) {
+                    done += m_source.read(dst + done, rest);
+                }
+            } else {
+                const size_t n = std::min(rest, refill(rest));
+                std::memcpy(dst + done, m_buffer.data() + m_pos, n);
+                m_pos += n;
+                done += n;
+            }
+        }
+
+        if (done < size) {
+            set_state(m_source.bad() ? stream_state::bad : stream_state::eos);
+        }
+        return done;
+    }
+
+    buffer_view<uint8> buffered_stream_reader::peek(size_t size)
+    {
+        if (!good()) {
+            return {};
+        }
+
+        size = std::min(size, m_buffer.capacity());
+        if (m_end - m_pos < size) {
+            refill(size);
+        }
+        return buffer_view<uint8>(m_buffer.data() + m_pos, std::min(size, m_end - m_pos));
+    }
+
+    string buffered_stream_reader::read_as_zstr()
+    {
+        if (!good()) {
+            return {};
+        }
+
+        using char_t = string::value_type;
+        static_assert(sizeof(char_t) == 1, "memchr scan requires single-byte characters");
+
+        string out;
+        while (true) {
+            if (m_pos == m_end && refill(1) == 0) {
+                // missing \0 means corrupt data
+                set_state(stream_state::bad);
+                return out;
+            }
+
+            const size_t count = m_end - m_pos;
+            const auto*  begin = reinterpret_cast<const char_t*>(m_buffer.data() + m_pos);
+            const auto*  zero = static_cast<const char_t*>(std::memchr(begin, 0, count));
+            if (zero) {
+                out.append(begin, zero);
+                m_pos += static_cast<size_t>(zero - begin) + 1;
+                return out;
+            }
+
+            out.append(begin, count);
+            m_pos = m_end;
+        }
+    }
+
+    bool buffered_stream_reader::seekable() const noexcept
+    {
+        return m_source.seekable();
+    }
+
+    bool buffered_stream_reader::seek(ssize_t offset, seek_dir dir) noexcept
+    {
+        if (!m_source.seekable()) {
+            return false;
+        }
+
+        const ssize_t pos = tell();
+        ssize_t       target = 0;
+        switch (dir) {
+        case seek_dir::begin:
+            target = offset;
+            break;
+        case seek_dir::current:
+            target = pos + offset;
+            break;
+        case seek_dir::end:
+            target = static_cast<ssize_t>(size()) + offset;
+            break;
+        default:
+            TAV_UNREACHABLE();
+        }
+
+        if (target < 0) {
+            ::logger.error("Failed to seek to position `{}` {}", to_string(dir), offset);
+            return false;
+        }
+
+        // Short skips stay inside the window and do not touch the source
+        const ssize_t window_begin = pos - static_cast<ssize_t>(m_pos);
+        if (target >= window_begin && target <= window_begin + static_cast<ssize_t>(m_end)) {
+            m_pos = static_cast<size_t>(target - window_begin);
+        } else {
+            if (!m_source.seek(target, seek_dir::begin)) {
+                return false;
+            }
+            m_pos = 0;
+            m_end = 0;
+        }
+
+        if (eos() && static_cast<size_t>(target) < size()) {
+            set_state(stream_state::good);
+        }
+        return true;
+    }
+
+    ssize_t buffered_stream_reader::tell() const noexcept
+    {
+        const ssize_t source_pos = m_source.tell();
+        if (source_pos < 0) {
+            return -1;
+        }
+        return source_pos - static_cast<ssize_t>(m_end - m_pos);
+    }
+
+    size_t buffered_stream_reader::size() const noexcept
+    {
+        return m_source.size();
+    }
+
+    size_t buffered_stream_reader::refill(size_t want)
+    {
+        TAV_ASSERT(want <= m_buffer.capacity());
+
+        if (m_pos != 0) {
+            std::memmove(m_buffer.data(), m_buffer.data() + m_pos, m_end - m_pos);
+            m_end -= m_pos;
+            m_pos = 0;
+        }
+
+        // One source read fills the whole free part of the window, not just what was asked for
+        while (m_end < want && m_source.good()) {
+            const size_t n = m_source.read(m_buffer.data() + m_end, m_buffer.capacity() - m_end);
+            if (n == 0) {
+                break;
+            }
+            m_end += n;
+        }
+        return m_end;
+    }
+
+} // namespace tavros::core
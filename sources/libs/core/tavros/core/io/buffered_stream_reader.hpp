@@ -0,0 +1,143 @@
+#pragma once
+
+#include <tavros/core/io/stream_reader.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/memory/dynamic_buffer.hpp>
+#include <tavros/core/noncopyable.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Reader that serves small reads from a window filled by large reads of another reader.
+     *
+     * Binary parsers read many small fields; through the plain reader interface each of them is
+     * a virtual call into the backend, and a string is read one character per call. This reader
+     * refills its window with one call per @p buffer_size bytes of the source, copies fields out
+     * of it, and finds string terminators with @c memchr over the whole window.
+     *
+     * Features and design choices:
+     * - Reads that are larger than the window bypass it and go straight to the source.
+     * - @ref peek() looks at upcoming bytes without consuming them, e.g. to check a magic value.
+     * - @ref read_as_zstr() hides the per-character version of the base class, so call it on
+     *   this type rather than through a @ref basic_stream_reader reference.
+     *
+     * Notes:
+     * - The source is not owned and must outlive the reader.
+     * - The source is read ahead of the reader position; seek the reader, not the source.
+     */
+    class buffered_stream_reader final : public basic_stream_reader, noncopyable
+    {
+    public:
+        /// Default size of the window in bytes.
+        static constexpr size_t k_default_buffer_size = 64 * 1024;
+
+    public:
+        /**
+         * @brief Wraps @p source with a window of @p buffer_size bytes.
+         *
+         * @param source      Reader to pull the data from.
+         * @param buffer_size Size of the window in bytes, must be non-zero.
+         */
+        explicit buffered_stream_reader(basic_stream_reader& source, size_t buffer_size = k_default_buffer_size);
+
+        ~buffered_stream_reader() noexcept override = default;
+
+        using basic_stream_reader::read;
+
+        /** @brief Reads up to @p size bytes into @p dst. Sets state to @c eos or @c bad if the source ends or fails. */
+        size_t read(uint8* dst, size_t size) override;
+
+        /**
+         * @brief Returns up to @p size upcoming bytes without consuming them.
+         *
+         * Refills the window if fewer bytes are buffered. The view is shorter than @p size near
+         * the end of the stream or if @p size exceeds the window, and stays valid until the next
+         * read or seek.
+         */
+        [[nodiscard]] buffer_view<uint8> peek(size_t size);
+
+        /**
+         * @brief Reads a null-terminated string into a @c string.
+         *
+         * Same behavior as @ref basic_stream_reader::read_as_zstr(), but scans the window for
+         * the terminator instead of reading one character at a time.
+         */
+        [[nodiscard]] string read_as_zstr();
+
+        /**
+         * @brief Reads a null-terminated string into a @c fixed_string<N>.
+         *
+         * Same behavior as @ref basic_stream_reader::read_as_zstr<N>(), but scans the window for
+         * the terminator instead of reading one character at a time.
+         */
+        template<size_t N>
+        [[nodiscard]] fixed_string<N> read_as_zstr()
+        {
+            if (!good()) {
+                return {};
+            }
+
+            using char_t = typename fixed_string<N>::value_type;
+            static_assert(sizeof(char_t) == 1, "memchr scan requires single-byte characters");
+
+            fixed_string<N> out;
+            while (true) {
+                if (m_pos == m_end && refill(1) == 0) {
+                    // missing \0 means corrupt data
+                    set_state(stream_state::bad);
+                    return out;
+                }
+
+                // Up to the remaining capacity plus one byte for the terminator
+                const size_t room = N - 1 - out.size();
+                const size_t count = std::min(m_end - m_pos, room + 1);
+                const auto*  begin = reinterpret_cast<const char_t*>(m_buffer.data() + m_pos);
+                const auto*  zero = static_cast<const char_t*>(std::memchr(begin, 0, count));
+                if (zero) {
+                    out.append(begin, static_cast<size_t>(zero - begin));
+                    m_pos += static_cast<size_t>(zero - begin) + 1;
+                    return out;
+                }
+
+                if (count > room) {
+                    // Buffer full and the next byte is not \0, it is consumed like in the base class
+                    out.append(begin, room);
+                    m_pos += room + 1;
+                    set_state(stream_state::bad);
+                    return out;
+                }
+
+                out.append(begin, count);
+                m_pos += count;
+            }
+        }
+
+        /** @brief Returns true if the source is seekable. */
+        [[nodiscard]] bool seekable() const noexcept override;
+
+        /** @brief Moves within the window, or seeks the source and drops the window. Returns false on failure. */
+        bool seek(ssize_t offset, seek_dir dir = seek_dir::begin) noexcept override;
+
+        /** @brief Returns the reader position, or -1 if the source is not seekable. */
+        [[nodiscard]] ssize_t tell() const noexcept override;
+
+        /** @brief Returns the total size of the source. */
+        [[nodiscard]] size_t size() const noexcept override;
+
+    private:
+        // Moves the buffered bytes to the front and reads the source until at least `want` bytes are buffered
+        // or the source ends. Returns the number of buffered bytes.
+        size_t refill(size_t want);
+
+    private:
+        basic_stream_reader&  m_source;
+        dynamic_buffer<uint8> m_buffer;
+        size_t                m_pos = 0;
+        size_t                m_end = 0;
+    };
+
+} // namespace tavros::core
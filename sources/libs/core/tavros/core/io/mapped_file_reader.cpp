@@ -0,0 +1,226 @@
+#include <tavros/core/io/mapped_file_reader.hpp>
+
+#include <tavros/core/defines.hpp>
+#include <tavros/core/exception.hpp>
+#include <tavros/core/fixed_string.hpp>
+#include <tavros/core/debug/unreachable.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if TAV_PLATFORM_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <filesystem>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    tavros::core::logger logger("mapped_file_reader");
+
+    using namespace tavros;
+
+#if TAV_PLATFORM_WINDOWS
+
+    struct handle_guard
+    {
+        HANDLE handle;
+
+        ~handle_guard()
+        {
+            if (handle && handle != INVALID_HANDLE_VALUE) {
+                CloseHandle(handle);
+            }
+        }
+    };
+
+    // The mapping and file handles may be closed right away, the view keeps the mapping alive
+    const uint8* map_file(core::string_view path, size_t& size)
+    {
+        const std::filesystem::path native(std::u8string_view(reinterpret_cast<const char8_t*>(path.data()), path.size()));
+
+        handle_guard file{CreateFileW(native.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr)};
+        if (file.handle == INVALID_HANDLE_VALUE) {
+            const auto tag = GetLastError() == ERROR_FILE_NOT_FOUND ? core::file_error_tag::not_found : core::file_error_tag::open_failed;
+            throw core::file_error(tag, path, "failed to open file for mapping");
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file.handle, &file_size)) {
+            throw core::file_error(core::file_error_tag::read_error, path, "failed to query file size");
+        }
+        size = static_cast<size_t>(file_size.QuadPart);
+        if (size == 0) {
+            return nullptr;
+        }
+
+        handle_guard mapping{CreateFileMappingW(file.handle, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+        if (!mapping.handle) {
+            throw core::file_error(core::file_error_tag::read_error, path, "failed to create file mapping");
+        }
+
+        const void* data = MapViewOfFile(mapping.handle, FILE_MAP_READ, 0, 0, 0);
+        if (!data) {
+            throw core::file_error(core::file_error_tag::read_error, path, "failed to map file");
+        }
+        return static_cast<const uint8*>(data);
+    }
+
+    void unmap_file(const uint8* data, size_t size) noexcept
+    {
+        TAV_UNUSED(size);
+        UnmapViewOfFile(data);
+    }
+
+#else
+
+    // The descriptor may be closed right away, the mapping stays valid until munmap
+    const uint8* map_file(core::string_view path, size_t& size)
+    {
+        if (path.size() >= core::k_fixed_path_size) {
+            throw core::file_error(core::file_error_tag::invalid_path, path, "path is too long");
+        }
+        const core::fixed_path c_path(path);
+
+        const int fd = ::open(c_path.data(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            const auto tag = errno == ENOENT ? core::file_error_tag::not_found : errno == EACCES ? core::file_error_tag::permission_denied
+                                                                                                 : core::file_error_tag::open_failed;
+            throw core::file_error(tag, path, "failed to open file for mapping");
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw core::file_error(core::file_error_tag::read_error, path, "failed to query file size");
+        }
+        if (S_ISDIR(st.st_mode)) {
+            ::close(fd);
+            throw core::file_error(core::file_error_tag::is_directory, path, "path is a directory");
+        }
+
+        size = static_cast<size_t>(st.st_size);
+        if (size == 0) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw core::file_error(core::file_error_tag::read_error, path, "failed to map file");
+        }
+
+        // Assets are decoded front to back
+        ::madvise(data, size, MADV_SEQUENTIAL);
+        return static_cast<const uint8*>(data);
+    }
+
+    void unmap_file(const uint8* data, size_t size) noexcept
+    {
+        ::munmap(const_cast<uint8*>(data), size);
+    }
+
+#endif
+} // namespace
+
+namespace tavros::core
+{
+
+    mapped_file_reader::mapped_file_reader(string_view path)
+    {
+        m_data = map_file(path, m_size);
+    }
+
+    mapped_file_reader::~mapped_file_reader() noexcept
+    {
+        if (m_data) {
+            unmap_file(m_data, m_size);
+        }
+    }
+
+    size_t mapped_file_reader::read(uint8* dst, size_t size)
+    {
+        if (size == 0) {
+            ::logger.warning("Read called with empty size");
+            return 0;
+        }
+
+        if (!good()) {
+            return 0;
+        }
+
+        const size_t n = std::min(size, m_size - m_pos);
+        if (n != 0) {
+            std::memcpy(dst, m_data + m_pos, n);
+            m_pos += n;
+        }
+        if (n < size) {
+            set_state(stream_state::eos);
+        }
+        return n;
+    }
+
+    bool mapped_file_reader::seekable() const noexcept
+    {
+        return true;
+    }
+
+    bool mapped_file_reader::seek(ssize_t offset, seek_dir dir) noexcept
+    {
+        ssize_t base = 0;
+        switch (dir) {
+        case seek_dir::begin:
+            base = 0;
+            break;
+        case seek_dir::current:
+            base = static_cast<ssize_t>(m_pos);
+            break;
+        case seek_dir::end:
+            base = static_cast<ssize_t>(m_size);
+            break;
+        default:
+            TAV_UNREACHABLE();
+        }
+
+        const ssize_t pos = base + offset;
+        if (pos < 0 || pos > static_cast<ssize_t>(m_size)) {
+            ::logger.error("Failed to seek to position `{}` {}", to_string(dir), offset);
+            return false;
+        }
+
+        m_pos = static_cast<size_t>(pos);
+        if (eos() && m_pos < m_size) {
+            set_state(stream_state::good);
+        }
+        return true;
+    }
+
+    ssize_t mapped_file_reader::tell() const noexcept
+    {
+        return static_cast<ssize_t>(m_pos);
+    }
+
+    size_t mapped_file_reader::size() const noexcept
+    {
+        return m_size;
+    }
+
+    buffer_view<uint8> mapped_file_reader::view() const noexcept
+    {
+        return buffer_view<uint8>(m_data, m_size);
+    }
+
+} // namespace tavros::core
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <tavros/core/io/stream_reader.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/noncopyable.hpp>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Binary reader over a read-only memory mapping of a whole file.
+     *
+     * The file is mapped on construction (mmap on POSIX, a file mapping view on Windows), and
+     * its content is available through @ref view() without copying: pages are loaded from
+     * the page cache on first access. The stream interface reads from the same memory, so the
+     * reader can also be passed to code that expects a @ref basic_stream_reader.
+     *
+     * Notes:
+     * - The mapping reflects the file as it is on disk; the file must not be truncated while
+     *   mapped, as on most systems accessing the cut pages terminates the process.
+     * - An empty file is not mapped; @ref view() is then empty.
+     *
+     * @throws file_error if the file cannot be opened or mapped.
+     */
+    class mapped_file_reader final : public basic_stream_reader, noncopyable
+    {
+    public:
+        /**
+         * @brief Maps the file at @p path for reading.
+         *
+         * @param path Path to the file.
+         * @throws file_error if the file cannot be opened or mapped.
+         */
+        explicit mapped_file_reader(string_view path);
+
+        /** @brief Unmaps the file. Views returned by @ref view() become invalid. */
+        ~mapped_file_reader() noexcept override;
+
+        /** @brief Copies up to @p size bytes into @p dst. Sets state to @c eos at the end of the file. */
+        size_t read(uint8* dst, size_t size) override;
+
+        /** @brief Returns true, the mapping is random access. */
+        [[nodiscard]] bool seekable() const noexcept override;
+
+        /** @brief Seeks within the file. Returns false if the target is out of the file. */
+        bool seek(ssize_t offset, seek_dir dir = seek_dir::begin) noexcept override;
+
+        /** @brief Returns the current read position. */
+        [[nodiscard]] ssize_t tell() const noexcept override;
+
+        /** @brief Returns the size of the file in bytes. */
+        [[nodiscard]] size_t size() const noexcept override;
+
+        /** @brief Returns the whole mapped file, valid while the reader is alive. */
+        [[nodiscard]] buffer_view<uint8> view() const noexcept;
+
+    private:
+        const uint8* m_data = nullptr;
+        size_t       m_size = 0;
+        size_t       m_pos = 0;
+    };
+
+} // namespace tavros::core
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <tavros/core/io/stream_base.hpp>
+#include <tavros/core/memory/buffer_span.hpp>
 
 namespace tavros::core
 {
@@ -10,6 +11,8 @@ namespace tavros::core
      *
      * Provides typed read methods over a binary stream.
      * Derived classes implement the low-level @c read(uint8*, size_t) method.
+     * Typed reads call it once per value and string reads once per character; wrap
+     * the reader into a @ref buffered_stream_reader to parse many small fields.
      *
      * State transitions:
      * - @c good -> @c eos  when read returns fewer bytes than requested
@@ -83,6 +86,52 @@ namespace tavros::core
             return out;
         }
 
+        /**
+         * @brief Reads @p out.size() consecutive values of type @p T with a single @c read call.
+         *
+         * @tparam T Must satisfy @c stream_readable (trivially copyable, not a string type).
+         * Returns the number of whole values read.
+         * Sets state to @c eos if the stream has insufficient data.
+         * No-op and returns 0 if state is not @c good.
+         */
+        template<stream_readable T>
+        size_t read_span(buffer_span<T> out)
+        {
+            if (!good() || out.empty()) {
+                return 0;
+            }
+
+            const size_t size = out.size() * sizeof(T);
+            auto         bytes_read = read(reinterpret_cast<uint8*>(out.data()), size);
+            if (bytes_read != size) {
+                set_state(stream_state::eos);
+            }
+
+            return bytes_read / sizeof(T);
+        }
+
+        /**
+         * @brief Reads and returns @p count consecutive values of type @p T.
+         *
+         * @tparam T Must satisfy @c stream_readable (trivially copyable, not a string type).
+         * Sets state to @c eos if the stream has insufficient data.
+         * No-op and returns an empty buffer if state is not @c good or the data is incomplete.
+         */
+        template<stream_readable T>
+        [[nodiscard]] dynamic_buffer<T> read_span_as(size_t count)
+        {
+            if (!good() || count == 0) {
+                return {};
+            }
+
+            dynamic_buffer<T> out(count);
+            if (read_span(buffer_span<T>(out.data(), count)) != count) {
+                return {};
+            }
+
+            return out;
+        }
+
         /**
          * @brief Reads a null-terminated string into a @c string.
          *
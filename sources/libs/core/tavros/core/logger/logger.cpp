@@ -3,9 +3,13 @@
 #include <tavros/core/containers/vector.hpp>
 #include <tavros/core/debug/assert.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <cstdio>
+#include <cstring>
 #include <thread>
 #include <chrono>
 
@@ -20,6 +24,304 @@ namespace
     };
 
     static log_helper g_log;
+
+    void call_consumers(tavros::core::severity_level level, tavros::core::string_view tag, tavros::core::string_view msg) noexcept
+    {
+        std::scoped_lock<std::mutex> lock(g_log.mtx);
+        for (auto& consumer : g_log.consumers) {
+            consumer(level, tag, msg);
+        }
+    }
+
+    constexpr size_t k_slot_size = 256;
+    constexpr size_t k_slot_data = k_slot_size - 24;
+    constexpr size_t k_max_tag = 255;
+    constexpr size_t k_max_record = 8192; // tag and message, longer messages are truncated
+
+    // One slot of the async queue; a record takes one or more consecutive slots
+    struct alignas(64) log_slot
+    {
+        std::atomic<uint64>          sequence{0};  // position the slot is free for, or first position + 1 once published
+        uint32                       size = 0;     // record bytes, first slot only
+        uint16                       count = 0;    // slots taken by the record, first slot only
+        uint8                        tag_size = 0; // first slot only
+        tavros::core::severity_level level = tavros::core::severity_level::debug;
+        char                         data[k_slot_data];
+    };
+
+    static_assert(sizeof(log_slot) == k_slot_size);
+
+    constexpr auto k_idle_interval = std::chrono::milliseconds(2); // how often an idle writer looks for messages
+
+    thread_local bool t_log_writer = false; // set on the writer thread, which must never wait for itself
+
+    // Bounded lock-free multi-producer queue of formatted messages and the thread that drains it.
+    // Slots follow the scheme of a bounded MPMC ring: the sequence of a slot tells which position
+    // may use it next. A record claims n slots at once by checking that its last slot is free;
+    // the single consumer frees slots in order, so the slots before it are free as well.
+    class async_writer
+    {
+    public:
+        using overflow_policy = tavros::core::logger::overflow_policy;
+
+        ~async_writer()
+        {
+            stop();
+        }
+
+        void start(overflow_policy policy, size_t capacity)
+        {
+            if (m_thread.joinable()) {
+                return;
+            }
+
+            const size_t slots = std::bit_ceil(std::max(capacity / k_slot_size, size_t{k_max_record / k_slot_data + 2}));
+            if (m_slots.size() != slots) {
+                m_slots = tavros::core::vector<log_slot>(slots);
+            }
+            for (size_t i = 0; i < slots; ++i) {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            m_mask = slots - 1;
+            m_policy = policy;
+            m_enqueue_pos.store(0, std::memory_order_relaxed);
+            m_dequeue_pos = 0;
+            m_consumed.store(0, std::memory_order_relaxed);
+            m_stop.store(false, std::memory_order_relaxed);
+
+            m_thread = std::thread([this] { run(); });
+            m_active.store(true, std::memory_order_seq_cst);
+        }
+
+        void stop() noexcept
+        {
+            if (!m_thread.joinable()) {
+                return;
+            }
+
+            // New messages go the synchronous way; wait for pushes that already started
+            m_active.store(false, std::memory_order_seq_cst);
+            while (m_producers.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+
+            m_stop.store(true, std::memory_order_release);
+            wake();
+            m_thread.join();
+        }
+
+        // Returns false when async mode is off and the message must be printed synchronously
+        bool push(tavros::core::severity_level level, tavros::core::string_view tag, tavros::core::string_view msg) noexcept
+        {
+            m_producers.fetch_add(1, std::memory_order_seq_cst);
+            if (!m_active.load(std::memory_order_seq_cst)) {
+                m_producers.fetch_sub(1, std::memory_order_release);
+                return false;
+            }
+
+            tag = tag.substr(0, k_max_tag);
+            msg = msg.substr(0, k_max_record - tag.size());
+            const size_t size = tag.size() + msg.size();
+            const size_t count = std::max<size_t>(1, (size + k_slot_data - 1) / k_slot_data);
+            const bool   block = !t_log_writer && (m_policy == overflow_policy::block || level == tavros::core::severity_level::fatal);
+
+            uint64 pos = 0;
+            while (!try_claim(count, pos)) {
+                if (!block) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    m_producers.fetch_sub(1, std::memory_order_release);
+                    return true;
+                }
+                wake();
+                std::this_thread::yield();
+            }
+
+            auto& first = m_slots[pos & m_mask];
+            first.size = static_cast<uint32>(size);
+            first.count = static_cast<uint16>(count);
+            first.tag_size = static_cast<uint8>(tag.size());
+            first.level = level;
+
+            size_t offset = 0;
+            for (const auto part : {tag, msg}) {
+                for (size_t done = 0; done < part.size();) {
+                    auto&        slot = m_slots[(pos + offset / k_slot_data) & m_mask];
+                    const size_t in_slot = offset % k_slot_data;
+                    const size_t n = std::min(part.size() - done, k_slot_data - in_slot);
+                    std::memcpy(slot.data + in_slot, part.data() + done, n);
+                    done += n;
+                    offset += n;
+                }
+            }
+
+            first.sequence.store(pos + 1, std::memory_order_release);
+
+            // The idle writer polls on its own; wake it early only when the queue fills up
+            if (pos + count - m_consumed.load(std::memory_order_relaxed) > (m_mask + 1) / 4) {
+                wake();
+            }
+
+            m_producers.fetch_sub(1, std::memory_order_release);
+
+            if (level == tavros::core::severity_level::fatal) {
+                drain();
+            }
+            return true;
+        }
+
+        void drain() noexcept
+        {
+            if (!m_active.load(std::memory_order_acquire) || t_log_writer) {
+                return;
+            }
+
+            const uint64 target = m_enqueue_pos.load(std::memory_order_acquire);
+            for (uint64 consumed = m_consumed.load(std::memory_order_acquire); consumed < target; consumed = m_consumed.load(std::memory_order_acquire)) {
+                wake();
+                m_consumed.wait(consumed, std::memory_order_acquire);
+            }
+        }
+
+        uint64 dropped() const noexcept
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        bool try_claim(size_t count, uint64& pos) noexcept
+        {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            for (;;) {
+                const uint64 last = pos + count - 1;
+                const auto   diff = static_cast<int64>(m_slots[last & m_mask].sequence.load(std::memory_order_acquire) - last);
+                if (diff == 0) {
+                    if (m_enqueue_pos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false; // the consumer has not freed the slot from the previous lap
+                } else {
+                    pos = m_enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool pop(char* record) noexcept
+        {
+            const uint64 pos = m_dequeue_pos;
+            auto&        first = m_slots[pos & m_mask];
+            if (first.sequence.load(std::memory_order_acquire) != pos + 1) {
+                return false;
+            }
+
+            const size_t size = first.size;
+            const size_t count = first.count;
+            for (size_t offset = 0; offset < size;) {
+                const auto&  slot = m_slots[(pos + offset / k_slot_data) & m_mask];
+                const size_t n = std::min(size - offset, k_slot_data);
+                std::memcpy(record + offset, slot.data, n);
+                offset += n;
+            }
+            record[size] = 0; // consumers may rely on a terminated message
+
+            const tavros::core::string_view tag(record, first.tag_size);
+            const tavros::core::string_view msg(record + first.tag_size, size - first.tag_size);
+            call_consumers(first.level, tag, msg);
+
+            // Free in order, the claim of the next lap checks only the last slot of its range
+            for (size_t i = 0; i < count; ++i) {
+                m_slots[(pos + i) & m_mask].sequence.store(pos + i + m_mask + 1, std::memory_order_release);
+            }
+            m_dequeue_pos = pos + count;
+            return true;
+        }
+
+        void run()
+        {
+            t_log_writer = true;
+            char   record[k_max_record + 1];
+            uint64 reported_dropped = 0;
+
+            for (;;) {
+                while (pop(record)) {
+                }
+                m_consumed.store(m_dequeue_pos, std::memory_order_release);
+                m_consumed.notify_all();
+
+                if (const uint64 dropped = m_dropped.load(std::memory_order_relaxed); dropped != reported_dropped) {
+                    tavros::core::logger::print_warning("logger", "{} messages dropped, the async log queue is full", dropped - reported_dropped);
+                    reported_dropped = dropped;
+                    continue;
+                }
+
+                const bool empty = m_slots[m_dequeue_pos & m_mask].sequence.load(std::memory_order_acquire) != m_dequeue_pos + 1;
+                if (empty && m_stop.load(std::memory_order_acquire)) {
+                    break;
+                }
+                if (empty) {
+                    std::unique_lock lock(m_wake_mutex);
+                    m_wake.wait_for(lock, k_idle_interval, [this] { return m_wake_requested.load(std::memory_order_relaxed); });
+                }
+                m_wake_requested.store(false, std::memory_order_relaxed);
+            }
+
+            t_log_writer = false;
+        }
+
+        void wake() noexcept
+        {
+            if (!m_wake_requested.exchange(true, std::memory_order_relaxed)) {
+                std::lock_guard lock(m_wake_mutex);
+                m_wake.notify_one();
+            }
+        }
+
+    private:
+        tavros::core::vector<log_slot> m_slots;
+        uint64                         m_mask = 0;
+        overflow_policy                m_policy = overflow_policy::drop;
+
+        // Producer side
+        alignas(64) std::atomic<uint64> m_enqueue_pos{0}; // next position to claim
+        std::atomic<uint32>             m_producers{0};   // pushes in progress, waited for on stop
+        std::atomic_bool                m_active{false};
+        std::atomic<uint64>             m_dropped{0};
+
+        // Writer side
+        alignas(64) uint64              m_dequeue_pos = 0; // writer thread only
+        std::atomic_bool                m_stop{false};
+        alignas(64) std::atomic<uint64> m_consumed{0};     // position up to which consumers were called, read by producers
+
+        std::mutex              m_wake_mutex;
+        std::condition_variable m_wake;
+        std::atomic_bool        m_wake_requested{false}; // set by wake(), cleared by the writer
+        std::thread             m_thread;
+    };
+
+    async_writer g_async;
+    std::mutex   g_async_mutex; // serializes start_async and stop_async
+
+    // Rate limit state; tags are hashed into buckets, colliding tags share a limit
+    struct rate_bucket
+    {
+        std::atomic<int64>  second{0};
+        std::atomic<uint32> count{0};
+        std::atomic<uint32> suppressed{0};
+    };
+
+    constexpr size_t k_rate_buckets = 256;
+
+    std::atomic<uint32> g_rate_limit{0};
+    rate_bucket         g_rate_buckets[k_rate_buckets];
+
+    size_t tag_hash(tavros::core::string_view tag) noexcept
+    {
+        uint32 h = 2166136261u;
+        for (char c : tag) {
+            h = (h ^ static_cast<uint8>(c)) * 16777619u;
+        }
+        return h;
+    }
 } // namespace
 
 namespace tavros::core
@@ -37,11 +339,67 @@ namespace tavros::core
         g_log.has_consumers = true;
     }
 
+    void logger::start_async(overflow_policy policy, size_t capacity) noexcept
+    {
+        std::scoped_lock<std::mutex> lock(g_async_mutex);
+        try {
+            g_async.start(policy, capacity);
+        } catch (...) {
+            print_error("logger", "Failed to start the async log writer, logging stays synchronous");
+        }
+    }
+
+    void logger::stop_async() noexcept
+    {
+        std::scoped_lock<std::mutex> lock(g_async_mutex);
+        g_async.stop();
+    }
+
+    void logger::drain() noexcept
+    {
+        g_async.drain();
+    }
+
+    uint64 logger::dropped_messages() noexcept
+    {
+        return g_async.dropped();
+    }
+
+    void logger::set_rate_limit(uint32 messages_per_second) noexcept
+    {
+        g_rate_limit.store(messages_per_second, std::memory_order_relaxed);
+    }
+
     bool logger::allowed_print(severity_level level) noexcept
     {
         return level >= g_log.level && g_log.has_consumers;
     }
 
+    bool logger::rate_limited(severity_level level, string_view tag) noexcept
+    {
+        const uint32 limit = g_rate_limit.load(std::memory_order_relaxed);
+        if (limit == 0 || level == severity_level::fatal) {
+            return false;
+        }
+
+        auto&       bucket = g_rate_buckets[tag_hash(tag) % k_rate_buckets];
+        const int64 now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        int64 second = bucket.second.load(std::memory_order_relaxed);
+        if (second != now && bucket.second.compare_exchange_strong(second, now, std::memory_order_relaxed)) {
+            bucket.count.store(0, std::memory_order_relaxed);
+            if (const uint32 suppressed = bucket.suppressed.exchange(0, std::memory_order_relaxed)) {
+                make_message(severity_level::warning, tag, "{} messages suppressed by the rate limit", suppressed);
+            }
+        }
+
+        if (bucket.count.fetch_add(1, std::memory_order_relaxed) < limit) {
+            return false;
+        }
+        bucket.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
     string_view logger::now_time() noexcept
     {
         static const char         alpha[] = "0123456789";
@@ -100,9 +458,8 @@ namespace tavros::core
 
     void logger::print_message(severity_level level, string_view tag, string_view msg) noexcept
     {
-        std::scoped_lock<std::mutex> lock(g_log.mtx);
-        for (auto& consumer : g_log.consumers) {
-            consumer(level, tag, msg);
+        if (!g_async.push(level, tag, msg)) {
+            call_consumers(level, tag, msg);
         }
     }
 
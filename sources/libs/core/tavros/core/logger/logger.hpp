@@ -18,6 +18,16 @@ namespace tavros::core
      * The logger allows printing messages with different severity levels, tagging,
      * and customizable output consumers. Supports formatting via {fmt} library
      * and ANSI styling for colored output.
+     *
+     * By default consumers are called on the logging thread under a global lock. After
+     * @ref start_async() messages are formatted on the logging thread into a stack buffer,
+     * copied into a bounded lock-free queue and passed to the consumers by a background
+     * writer thread, so a burst of messages does not stall the caller on console I/O.
+     *
+     * Notes:
+     * - In async mode a fatal message blocks until it and every earlier message reached the
+     *   consumers, so it is not lost if the process terminates right after.
+     * - @ref set_rate_limit() limits how many messages per second each tag may print.
      */
     class logger
     {
@@ -30,6 +40,18 @@ namespace tavros::core
          */
         using consumer_type = std::function<void(severity_level, string_view, string_view)>;
 
+        /**
+         * @brief What a producer does when the async queue is full.
+         */
+        enum class overflow_policy : uint8
+        {
+            drop,  ///< Discard the message and count it, see @ref dropped_messages().
+            block, ///< Wait until the writer thread frees enough space.
+        };
+
+        /// Default size of the async queue in bytes.
+        static constexpr size_t k_default_async_capacity = 1024 * 1024;
+
     public:
         /**
          * @brief Constructs a logger with a given tag.
@@ -174,11 +196,49 @@ namespace tavros::core
          */
         static void add_consumer(const consumer_type& consumer) noexcept;
 
+        /**
+         * @brief Switches to async mode and starts the writer thread.
+         *
+         * The queue is allocated once here; logging itself never allocates. Does nothing if
+         * async mode is already active.
+         *
+         * @param policy   What to do with messages that do not fit into the queue.
+         * @param capacity Queue size in bytes. Messages take 256 byte slots, a long message
+         *                 takes several.
+         */
+        static void start_async(overflow_policy policy = overflow_policy::drop, size_t capacity = k_default_async_capacity) noexcept;
+
+        /**
+         * @brief Passes the queued messages to the consumers, stops the writer thread and
+         *        switches back to synchronous mode.
+         */
+        static void stop_async() noexcept;
+
+        /**
+         * @brief Blocks until every message logged before the call reached the consumers.
+         *
+         * Returns immediately in synchronous mode, and when called from a consumer.
+         */
+        static void drain() noexcept;
+
+        /**
+         * @brief Returns the number of messages dropped because the async queue was full.
+         */
+        [[nodiscard]] static uint64 dropped_messages() noexcept;
+
+        /**
+         * @brief Limits each tag to @p messages_per_second messages per second.
+         *
+         * Messages over the limit are discarded; when the next second starts, the tag prints
+         * how many were suppressed. Fatal messages are never limited. Zero disables the limit.
+         */
+        static void set_rate_limit(uint32 messages_per_second) noexcept;
+
     private:
         template<typename... Args>
         static void make_message(severity_level level, string_view tag, fmt::format_string<Args...> fmt, Args&&... args) noexcept
         {
-            if (!allowed_print(level)) {
+            if (!allowed_print(level) || rate_limited(level, tag)) {
                 return;
             }
 
@@ -233,6 +293,8 @@ namespace tavros::core
 
         static bool allowed_print(severity_level level) noexcept;
 
+        static bool rate_limited(severity_level level, string_view tag) noexcept;
+
         static string_view now_time() noexcept;
 
         static void print_message(severity_level level, string_view tag, string_view msg) noexcept;
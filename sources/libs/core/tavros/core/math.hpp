@@ -13,6 +13,7 @@
 #include <tavros/core/math/functions/almost_equal.hpp>
 #include <tavros/core/math/functions/angle.hpp>
 #include <tavros/core/math/functions/basic_math.hpp>
+#include <tavros/core/math/functions/batch.hpp>
 #include <tavros/core/math/functions/clamp.hpp>
 #include <tavros/core/math/functions/conjugate.hpp>
 #include <tavros/core/math/functions/cross.hpp>
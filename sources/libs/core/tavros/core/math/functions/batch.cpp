@@ -0,0 +1,225 @@
+#include <tavros/core/math/functions/batch.hpp>
+
+#include <tavros/core/math/functions/dot.hpp>
+#include <tavros/core/math/simd/float4.hpp>
+
+#include <cmath>
+
+namespace
+{
+    using namespace tavros::math;
+
+    static_assert(sizeof(vec2) == 2 * sizeof(float));
+    static_assert(sizeof(vec3) == 3 * sizeof(float));
+    static_assert(sizeof(vec4) == 4 * sizeof(float));
+
+#if TAV_MATH_SIMD_ENABLED
+
+    using namespace tavros::math::simd;
+
+    // Upper 3x4 of a mat4 broadcast to lanes, with translation scaled by w
+    struct wide_mat3x4
+    {
+        float4 m[4][3];
+
+        wide_mat3x4(const mat4& src, float w) noexcept
+        {
+            for (size_t c = 0; c < 4; ++c) {
+                const float s = c == 3 ? w : 1.0f;
+                for (size_t r = 0; r < 3; ++r) {
+                    m[c][r] = set1(src[c][r] * s);
+                }
+            }
+        }
+
+        float4x3 transform(const float4x3& p) const noexcept
+        {
+            return {
+                madd(p.x, m[0][0], madd(p.y, m[1][0], madd(p.z, m[2][0], m[3][0]))),
+                madd(p.x, m[0][1], madd(p.y, m[1][1], madd(p.z, m[2][1], m[3][1]))),
+                madd(p.x, m[0][2], madd(p.y, m[1][2], madd(p.z, m[2][2], m[3][2]))),
+            };
+        }
+    };
+
+#endif // TAV_MATH_SIMD_ENABLED
+
+    // (m * vec4(v, w)).xyz for interleaved vec3 arrays
+    void transform_vec3(const mat4& m, float w, const vec3* in, vec3* out, size_t n) noexcept
+    {
+        size_t i = 0;
+#if TAV_MATH_SIMD_ENABLED
+        const wide_mat3x4 wm(m, w);
+        for (; i + 4 <= n; i += 4) {
+            store3(out[i].data(), wm.transform(load3(in[i].data())));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = (m * vec4(in[i], w)).xyz;
+        }
+    }
+
+    void lerp_floats(const float* a, const float* b, float coef, float* out, size_t n) noexcept
+    {
+        size_t i = 0;
+#if TAV_MATH_SIMD_ENABLED
+        const float4 t = set1(coef);
+        for (; i + 4 <= n; i += 4) {
+            const float4 va = load(a + i);
+            store(out + i, madd(sub(load(b + i), va), t, va));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = a[i] + (b[i] - a[i]) * coef;
+        }
+    }
+} // namespace
+
+namespace tavros::math
+{
+
+    void transform_points(const mat4& m, core::buffer_view<vec3> points, core::buffer_span<vec3> out) noexcept
+    {
+        TAV_ASSERT(out.size() >= points.size());
+        transform_vec3(m, 1.0f, points.data(), out.data(), points.size());
+    }
+
+    void transform_points(const mat4& m, core::buffer_view<vec4> points, core::buffer_span<vec4> out) noexcept
+    {
+        TAV_ASSERT(out.size() >= points.size());
+        // vec4 fills a register on its own, the mat4 * vec4 kernel needs no transposes
+        for (size_t i = 0; i < points.size(); ++i) {
+            out[i] = m * points[i];
+        }
+    }
+
+    void transform_vectors(const mat4& m, core::buffer_view<vec3> vectors, core::buffer_span<vec3> out) noexcept
+    {
+        TAV_ASSERT(out.size() >= vectors.size());
+        transform_vec3(m, 0.0f, vectors.data(), out.data(), vectors.size());
+    }
+
+    void transform_points_soa(
+        const mat4&              m,
+        core::buffer_view<float> x,
+        core::buffer_view<float> y,
+        core::buffer_view<float> z,
+        core::buffer_span<float> out_x,
+        core::buffer_span<float> out_y,
+        core::buffer_span<float> out_z
+    ) noexcept
+    {
+        const size_t n = x.size();
+        TAV_ASSERT(y.size() >= n && z.size() >= n);
+        TAV_ASSERT(out_x.size() >= n && out_y.size() >= n && out_z.size() >= n);
+
+        size_t i = 0;
+#if TAV_MATH_SIMD_ENABLED
+        const wide_mat3x4 wm(m, 1.0f);
+        for (; i + 4 <= n; i += 4) {
+            const float4x3 r = wm.transform({load(x.data() + i), load(y.data() + i), load(z.data() + i)});
+            store(out_x.data() + i, r.x);
+            store(out_y.data() + i, r.y);
+            store(out_z.data() + i, r.z);
+        }
+#endif
+        for (; i < n; ++i) {
+            const vec3 r = m[0].xyz * x[i] + m[1].xyz * y[i] + m[2].xyz * z[i] + m[3].xyz;
+            out_x[i] = r.x;
+            out_y[i] = r.y;
+            out_z[i] = r.z;
+        }
+    }
+
+    void transform_points_2d(const mat3& m, core::buffer_view<vec2> points, core::buffer_span<vec2> out) noexcept
+    {
+        TAV_ASSERT(out.size() >= points.size());
+        const size_t n = points.size();
+
+        size_t i = 0;
+#if TAV_MATH_SIMD_ENABLED
+        const float4 m00 = set1(m[0].x), m01 = set1(m[0].y);
+        const float4 m10 = set1(m[1].x), m11 = set1(m[1].y);
+        const float4 m20 = set1(m[2].x), m21 = set1(m[2].y);
+        for (; i + 4 <= n; i += 4) {
+            const float4x2 p = load2(points[i].data());
+            store2(out[i].data(), {madd(p.x, m00, madd(p.y, m10, m20)), madd(p.x, m01, madd(p.y, m11, m21))});
+        }
+#endif
+        for (; i < n; ++i) {
+            const vec2 p = points[i];
+            out[i] = vec2(m[0].x * p.x + m[1].x * p.y + m[2].x, m[0].y * p.x + m[1].y * p.y + m[2].y);
+        }
+    }
+
+    void normalize_many(core::buffer_view<vec3> vectors, core::buffer_span<vec3> out) noexcept
+    {
+        TAV_ASSERT(out.size() >= vectors.size());
+        const size_t n = vectors.size();
+
+        size_t i = 0;
+#if TAV_MATH_SIMD_ENABLED
+        const float4 zero = set1(0.0f);
+        const float4 one = set1(1.0f);
+        for (; i + 4 <= n; i += 4) {
+            const float4x3 v = load3(vectors[i].data());
+            const float4   len2 = madd(v.x, v.x, madd(v.y, v.y, mul(v.z, v.z)));
+            const float4   inv = inv_sqrt(len2);
+            const mask4    valid = greater(len2, zero);
+            store3(out[i].data(), {
+                select(valid, mul(v.x, inv), zero),
+                select(valid, mul(v.y, inv), zero),
+                select(valid, mul(v.z, inv), one),
+            });
+        }
+#endif
+        for (; i < n; ++i) {
+            const vec3  v = vectors[i];
+            const float len2 = dot(v, v);
+            out[i] = len2 > 0.0f ? v / std::sqrt(len2) : vec3(0.0f, 0.0f, 1.0f);
+        }
+    }
+
+    void dot_many(core::buffer_view<vec3> a, core::buffer_view<vec3> b, core::buffer_span<float> out) noexcept
+    {
+        TAV_ASSERT(b.size() >= a.size() && out.size() >= a.size());
+        const size_t n = a.size();
+
+        size_t i = 0;
+#if TAV_MATH_SIMD_ENABLED
+        for (; i + 4 <= n; i += 4) {
+            const float4x3 va = load3(a[i].data());
+            const float4x3 vb = load3(b[i].data());
+            store(out.data() + i, madd(va.x, vb.x, madd(va.y, vb.y, mul(va.z, vb.z))));
+        }
+#endif
+        for (; i < n; ++i) {
+            out[i] = dot(a[i], b[i]);
+        }
+    }
+
+    void lerp_many(core::buffer_view<float> a, core::buffer_view<float> b, float coef, core::buffer_span<float> out) noexcept
+    {
+        TAV_ASSERT(b.size() >= a.size() && out.size() >= a.size());
+        lerp_floats(a.data(), b.data(), coef, out.data(), a.size());
+    }
+
+    void lerp_many(core::buffer_view<vec2> a, core::buffer_view<vec2> b, float coef, core::buffer_span<vec2> out) noexcept
+    {
+        TAV_ASSERT(b.size() >= a.size() && out.size() >= a.size());
+        lerp_floats(reinterpret_cast<const float*>(a.data()), reinterpret_cast<const float*>(b.data()), coef, reinterpret_cast<float*>(out.data()), a.size() * 2);
+    }
+
+    void lerp_many(core::buffer_view<vec3> a, core::buffer_view<vec3> b, float coef, core::buffer_span<vec3> out) noexcept
+    {
+        TAV_ASSERT(b.size() >= a.size() && out.size() >= a.size());
+        lerp_floats(reinterpret_cast<const float*>(a.data()), reinterpret_cast<const float*>(b.data()), coef, reinterpret_cast<float*>(out.data()), a.size() * 3);
+    }
+
+    void lerp_many(core::buffer_view<vec4> a, core::buffer_view<vec4> b, float coef, core::buffer_span<vec4> out) noexcept
+    {
+        TAV_ASSERT(b.size() >= a.size() && out.size() >= a.size());
+        lerp_floats(reinterpret_cast<const float*>(a.data()), reinterpret_cast<const float*>(b.data()), coef, reinterpret_cast<float*>(out.data()), a.size() * 4);
+    }
+
+} // namespace tavros::math
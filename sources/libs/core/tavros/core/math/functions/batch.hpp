@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @file batch.hpp
+ *
+ * @brief Array versions of the transform, normalize, dot and lerp operations
+ *
+ * Each function processes a whole array in one call. With the SIMD layer enabled
+ * (see @ref simd.hpp) the arrays are processed several elements at a time, otherwise
+ * the functions are plain loops over the scalar operations.
+ *
+ * Layouts:
+ * - AoS: `buffer_view<vec3>` and similar, the layout of vertex arrays.
+ *   `vec3` elements are transposed to components in registers four at a time.
+ * - SoA: separate `x`, `y`, `z` float arrays, see @ref transform_points_soa().
+ *   No transposes are needed, so it is the fastest layout for large arrays.
+ *
+ * Notes:
+ * - The output must have at least as many elements as the input, only the first
+ *   `input.size()` elements are written.
+ * - The output may be the input itself (in-place), partially overlapping arrays are not supported.
+ * - 2D affine transforms use a `mat3`: columns 0 and 1 are the linear part and column 2
+ *   is the translation, the bottom row is ignored.
+ */
+
+#include <tavros/core/math/mat3.hpp>
+#include <tavros/core/math/mat4.hpp>
+#include <tavros/core/math/vec2.hpp>
+#include <tavros/core/math/vec3.hpp>
+#include <tavros/core/math/vec4.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+
+namespace tavros::math
+{
+
+    /**
+     * @brief Transforms points by @p m: `out[i] = (m * vec4(points[i], 1)).xyz`.
+     *
+     * No perspective divide is done, the function is meant for affine transforms.
+     */
+    void transform_points(const mat4& m, core::buffer_view<vec3> points, core::buffer_span<vec3> out) noexcept;
+
+    /**
+     * @brief Transforms homogeneous points by @p m: `out[i] = m * points[i]`.
+     */
+    void transform_points(const mat4& m, core::buffer_view<vec4> points, core::buffer_span<vec4> out) noexcept;
+
+    /**
+     * @brief Transforms directions by @p m ignoring translation: `out[i] = (m * vec4(vectors[i], 0)).xyz`.
+     *
+     * To transform normals under non-uniform scale, pass the inverse transpose of the matrix.
+     */
+    void transform_vectors(const mat4& m, core::buffer_view<vec3> vectors, core::buffer_span<vec3> out) noexcept;
+
+    /**
+     * @brief Transforms points stored as separate component arrays, see @ref transform_points().
+     *
+     * All input and output arrays must have the size of @p x.
+     */
+    void transform_points_soa(
+        const mat4&              m,
+        core::buffer_view<float> x,
+        core::buffer_view<float> y,
+        core::buffer_view<float> z,
+        core::buffer_span<float> out_x,
+        core::buffer_span<float> out_y,
+        core::buffer_span<float> out_z
+    ) noexcept;
+
+    /**
+     * @brief Transforms 2D points by the affine transform @p m: `out[i] = m[0].xy * p.x + m[1].xy * p.y + m[2].xy`.
+     */
+    void transform_points_2d(const mat3& m, core::buffer_view<vec2> points, core::buffer_span<vec2> out) noexcept;
+
+    /**
+     * @brief Normalizes every vector.
+     *
+     * Zero-length vectors give `(0, 0, 1)` like @ref normalize(), but without an assertion,
+     * degenerate entries are common in vertex data.
+     */
+    void normalize_many(core::buffer_view<vec3> vectors, core::buffer_span<vec3> out) noexcept;
+
+    /**
+     * @brief Computes `out[i] = dot(a[i], b[i])`. @p b must have the size of @p a.
+     */
+    void dot_many(core::buffer_view<vec3> a, core::buffer_view<vec3> b, core::buffer_span<float> out) noexcept;
+
+    /**
+     * @brief Computes `out[i] = lerp(a[i], b[i], coef)` with one coefficient for the whole array.
+     *
+     * @p b must have the size of @p a. Used to blend between two animation frames.
+     */
+    void lerp_many(core::buffer_view<float> a, core::buffer_view<float> b, float coef, core::buffer_span<float> out) noexcept;
+
+    /// @copydoc lerp_many(core::buffer_view<float>, core::buffer_view<float>, float, core::buffer_span<float>)
+    void lerp_many(core::buffer_view<vec2> a, core::buffer_view<vec2> b, float coef, core::buffer_span<vec2> out) noexcept;
+
+    /// @copydoc lerp_many(core::buffer_view<float>, core::buffer_view<float>, float, core::buffer_span<float>)
+    void lerp_many(core::buffer_view<vec3> a, core::buffer_view<vec3> b, float coef, core::buffer_span<vec3> out) noexcept;
+
+    /// @copydoc lerp_many(core::buffer_view<float>, core::buffer_view<float>, float, core::buffer_span<float>)
+    void lerp_many(core::buffer_view<vec4> a, core::buffer_view<vec4> b, float coef, core::buffer_span<vec4> out) noexcept;
+
+} // namespace tavros::math
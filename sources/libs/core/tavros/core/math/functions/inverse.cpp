@@ -1,8 +1,163 @@
 #include <tavros/core/math/functions/inverse.hpp>
 
+#include <tavros/core/math/simd/simd.hpp>
+
 namespace tavros::math
 {
 
+    namespace scalar
+    {
+
+        mat4 inverse(const mat4& m) noexcept
+        {
+            // https://github.com/g-truc/glm/blob/master/glm/gtc/matrix_inverse.inl#L66
+            mat4 inv;
+
+            // clang-format off
+            inv[0][0] =
+                + m[1][1] * m[2][2] * m[3][3]
+                - m[1][1] * m[2][3] * m[3][2]
+                - m[2][1] * m[1][2] * m[3][3]
+                + m[2][1] * m[1][3] * m[3][2]
+                + m[3][1] * m[1][2] * m[2][3]
+                - m[3][1] * m[1][3] * m[2][2];
+
+            inv[0][1] =  
+                - m[0][1] * m[2][2] * m[3][3]
+                + m[0][1] * m[2][3] * m[3][2]
+                + m[2][1] * m[0][2] * m[3][3]
+                - m[2][1] * m[0][3] * m[3][2]
+                - m[3][1] * m[0][2] * m[2][3]
+                + m[3][1] * m[0][3] * m[2][2];
+
+            inv[0][2] = 
+                + m[0][1] * m[1][2] * m[3][3]
+                - m[0][1] * m[1][3] * m[3][2]
+                - m[1][1] * m[0][2] * m[3][3]
+                + m[1][1] * m[0][3] * m[3][2]
+                + m[3][1] * m[0][2] * m[1][3]
+                - m[3][1] * m[0][3] * m[1][2];
+
+            inv[0][3] =
+                - m[0][1] * m[1][2] * m[2][3]
+                + m[0][1] * m[1][3] * m[2][2]
+                + m[1][1] * m[0][2] * m[2][3]
+                - m[1][1] * m[0][3] * m[2][2]
+                - m[2][1] * m[0][2] * m[1][3]
+                + m[2][1] * m[0][3] * m[1][2];
+
+            inv[1][0] =
+                - m[1][0] * m[2][2] * m[3][3]
+                + m[1][0] * m[2][3] * m[3][2]
+                + m[2][0] * m[1][2] * m[3][3]
+                - m[2][0] * m[1][3] * m[3][2]
+                - m[3][0] * m[1][2] * m[2][3]
+                + m[3][0] * m[1][3] * m[2][2];
+
+            inv[1][1] =
+                + m[0][0] * m[2][2] * m[3][3]
+                - m[0][0] * m[2][3] * m[3][2]
+                - m[2][0] * m[0][2] * m[3][3]
+                + m[2][0] * m[0][3] * m[3][2]
+                + m[3][0] * m[0][2] * m[2][3]
+                - m[3][0] * m[0][3] * m[2][2];
+
+            inv[1][2] = 
+                - m[0][0] * m[1][2] * m[3][3]
+                + m[0][0] * m[1][3] * m[3][2]
+                + m[1][0] * m[0][2] * m[3][3]
+                - m[1][0] * m[0][3] * m[3][2]
+                - m[3][0] * m[0][2] * m[1][3]
+                + m[3][0] * m[0][3] * m[1][2];
+
+            inv[1][3] =
+                + m[0][0] * m[1][2] * m[2][3]
+                - m[0][0] * m[1][3] * m[2][2]
+                - m[1][0] * m[0][2] * m[2][3]
+                + m[1][0] * m[0][3] * m[2][2]
+                + m[2][0] * m[0][2] * m[1][3]
+                - m[2][0] * m[0][3] * m[1][2];
+
+            inv[2][0] =
+                + m[1][0] * m[2][1] * m[3][3]
+                - m[1][0] * m[2][3] * m[3][1]
+                - m[2][0] * m[1][1] * m[3][3]
+                + m[2][0] * m[1][3] * m[3][1]
+                + m[3][0] * m[1][1] * m[2][3]
+                - m[3][0] * m[1][3] * m[2][1];
+
+            inv[2][1] =
+                - m[0][0] * m[2][1] * m[3][3]
+                + m[0][0] * m[2][3] * m[3][1]
+                + m[2][0] * m[0][1] * m[3][3]
+                - m[2][0] * m[0][3] * m[3][1]
+                - m[3][0] * m[0][1] * m[2][3]
+                + m[3][0] * m[0][3] * m[2][1];
+
+            inv[2][2] =
+                + m[0][0] * m[1][1] * m[3][3]
+                - m[0][0] * m[1][3] * m[3][1]
+                - m[1][0] * m[0][1] * m[3][3]
+                + m[1][0] * m[0][3] * m[3][1]
+                + m[3][0] * m[0][1] * m[1][3]
+                - m[3][0] * m[0][3] * m[1][1];
+
+            inv[2][3] = 
+                - m[0][0] * m[1][1] * m[2][3]
+                + m[0][0] * m[1][3] * m[2][1]
+                + m[1][0] * m[0][1] * m[2][3]
+                - m[1][0] * m[0][3] * m[2][1]
+                - m[2][0] * m[0][1] * m[1][3]
+                + m[2][0] * m[0][3] * m[1][1];
+
+            inv[3][0] = 
+                - m[1][0] * m[2][1] * m[3][2]
+                + m[1][0] * m[2][2] * m[3][1]
+                + m[2][0] * m[1][1] * m[3][2]
+                - m[2][0] * m[1][2] * m[3][1]
+                - m[3][0] * m[1][1] * m[2][2]
+                + m[3][0] * m[1][2] * m[2][1];
+
+            inv[3][1] =
+                + m[0][0] * m[2][1] * m[3][2]
+                - m[0][0] * m[2][2] * m[3][1]
+                - m[2][0] * m[0][1] * m[3][2]
+                + m[2][0] * m[0][2] * m[3][1]
+                + m[3][0] * m[0][1] * m[2][2]
+                - m[3][0] * m[0][2] * m[2][1];
+
+            inv[3][2] = 
+                - m[0][0] * m[1][1] * m[3][2]
+                + m[0][0] * m[1][2] * m[3][1]
+                + m[1][0] * m[0][1] * m[3][2]
+                - m[1][0] * m[0][2] * m[3][1]
+                - m[3][0] * m[0][1] * m[1][2]
+                + m[3][0] * m[0][2] * m[1][1];
+
+            inv[3][3] =
+                + m[0][0] * m[1][1] * m[2][2]
+                - m[0][0] * m[1][2] * m[2][1]
+                - m[1][0] * m[0][1] * m[2][2]
+                + m[1][0] * m[0][2] * m[2][1]
+                + m[2][0] * m[0][1] * m[1][2]
+                - m[2][0] * m[0][2] * m[1][1];
+            // clang-format on
+
+            // Calc det by the first row
+            float det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0] + m[0][3] * inv[3][0];
+            TAV_ASSERT(!almost_zero(det, k_epsilon6));
+            if (almost_zero(det, k_epsilon6)) {
+                // Can't calculate inverse matrix, so return zero matrix
+                return mat4(0.0f);
+            }
+
+            // Apply inverse determinant to the whole matrix
+            inv *= 1.0f / det;
+            return inv;
+        }
+
+    } // namespace scalar
+
     mat3 inverse(const mat3& m) noexcept
     {
         // https://github.com/g-truc/glm/blob/master/glm/gtc/matrix_inverse.inl#L43
@@ -33,152 +188,18 @@ namespace tavros::math
 
     mat4 inverse(const mat4& m) noexcept
     {
-        // For future, links for quick calculation of the inverse matrix:
-        // https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html?utm_source
-        // https://github.com/g-truc/glm/blob/master/glm/gtc/matrix_inverse.inl#L66
+#if TAV_MATH_SIMD_SSE
         mat4 inv;
-
-        // clang-format off
-        inv[0][0] =
-            + m[1][1] * m[2][2] * m[3][3]
-            - m[1][1] * m[2][3] * m[3][2]
-            - m[2][1] * m[1][2] * m[3][3]
-            + m[2][1] * m[1][3] * m[3][2]
-            + m[3][1] * m[1][2] * m[2][3]
-            - m[3][1] * m[1][3] * m[2][2];
-
-        inv[0][1] =  
-            - m[0][1] * m[2][2] * m[3][3]
-            + m[0][1] * m[2][3] * m[3][2]
-            + m[2][1] * m[0][2] * m[3][3]
-            - m[2][1] * m[0][3] * m[3][2]
-            - m[3][1] * m[0][2] * m[2][3]
-            + m[3][1] * m[0][3] * m[2][2];
-
-        inv[0][2] = 
-            + m[0][1] * m[1][2] * m[3][3]
-            - m[0][1] * m[1][3] * m[3][2]
-            - m[1][1] * m[0][2] * m[3][3]
-            + m[1][1] * m[0][3] * m[3][2]
-            + m[3][1] * m[0][2] * m[1][3]
-            - m[3][1] * m[0][3] * m[1][2];
-
-        inv[0][3] =
-            - m[0][1] * m[1][2] * m[2][3]
-            + m[0][1] * m[1][3] * m[2][2]
-            + m[1][1] * m[0][2] * m[2][3]
-            - m[1][1] * m[0][3] * m[2][2]
-            - m[2][1] * m[0][2] * m[1][3]
-            + m[2][1] * m[0][3] * m[1][2];
-
-        inv[1][0] =
-            - m[1][0] * m[2][2] * m[3][3]
-            + m[1][0] * m[2][3] * m[3][2]
-            + m[2][0] * m[1][2] * m[3][3]
-            - m[2][0] * m[1][3] * m[3][2]
-            - m[3][0] * m[1][2] * m[2][3]
-            + m[3][0] * m[1][3] * m[2][2];
-
-        inv[1][1] =
-            + m[0][0] * m[2][2] * m[3][3]
-            - m[0][0] * m[2][3] * m[3][2]
-            - m[2][0] * m[0][2] * m[3][3]
-            + m[2][0] * m[0][3] * m[3][2]
-            + m[3][0] * m[0][2] * m[2][3]
-            - m[3][0] * m[0][3] * m[2][2];
-
-        inv[1][2] = 
-            - m[0][0] * m[1][2] * m[3][3]
-            + m[0][0] * m[1][3] * m[3][2]
-            + m[1][0] * m[0][2] * m[3][3]
-            - m[1][0] * m[0][3] * m[3][2]
-            - m[3][0] * m[0][2] * m[1][3]
-            + m[3][0] * m[0][3] * m[1][2];
-
-        inv[1][3] =
-            + m[0][0] * m[1][2] * m[2][3]
-            - m[0][0] * m[1][3] * m[2][2]
-            - m[1][0] * m[0][2] * m[2][3]
-            + m[1][0] * m[0][3] * m[2][2]
-            + m[2][0] * m[0][2] * m[1][3]
-            - m[2][0] * m[0][3] * m[1][2];
-
-        inv[2][0] =
-            + m[1][0] * m[2][1] * m[3][3]
-            - m[1][0] * m[2][3] * m[3][1]
-            - m[2][0] * m[1][1] * m[3][3]
-            + m[2][0] * m[1][3] * m[3][1]
-            + m[3][0] * m[1][1] * m[2][3]
-            - m[3][0] * m[1][3] * m[2][1];
-
-        inv[2][1] =
-            - m[0][0] * m[2][1] * m[3][3]
-            + m[0][0] * m[2][3] * m[3][1]
-            + m[2][0] * m[0][1] * m[3][3]
-            - m[2][0] * m[0][3] * m[3][1]
-            - m[3][0] * m[0][1] * m[2][3]
-            + m[3][0] * m[0][3] * m[2][1];
-
-        inv[2][2] =
-            + m[0][0] * m[1][1] * m[3][3]
-            - m[0][0] * m[1][3] * m[3][1]
-            - m[1][0] * m[0][1] * m[3][3]
-            + m[1][0] * m[0][3] * m[3][1]
-            + m[3][0] * m[0][1] * m[1][3]
-            - m[3][0] * m[0][3] * m[1][1];
-
-        inv[2][3] = 
-            - m[0][0] * m[1][1] * m[2][3]
-            + m[0][0] * m[1][3] * m[2][1]
-            + m[1][0] * m[0][1] * m[2][3]
-            - m[1][0] * m[0][3] * m[2][1]
-            - m[2][0] * m[0][1] * m[1][3]
-            + m[2][0] * m[0][3] * m[1][1];
-
-        inv[3][0] = 
-            - m[1][0] * m[2][1] * m[3][2]
-            + m[1][0] * m[2][2] * m[3][1]
-            + m[2][0] * m[1][1] * m[3][2]
-            - m[2][0] * m[1][2] * m[3][1]
-            - m[3][0] * m[1][1] * m[2][2]
-            + m[3][0] * m[1][2] * m[2][1];
-
-        inv[3][1] =
-            + m[0][0] * m[2][1] * m[3][2]
-            - m[0][0] * m[2][2] * m[3][1]
-            - m[2][0] * m[0][1] * m[3][2]
-            + m[2][0] * m[0][2] * m[3][1]
-            + m[3][0] * m[0][1] * m[2][2]
-            - m[3][0] * m[0][2] * m[2][1];
-
-        inv[3][2] = 
-            - m[0][0] * m[1][1] * m[3][2]
-            + m[0][0] * m[1][2] * m[3][1]
-            + m[1][0] * m[0][1] * m[3][2]
-            - m[1][0] * m[0][2] * m[3][1]
-            - m[3][0] * m[0][1] * m[1][2]
-            + m[3][0] * m[0][2] * m[1][1];
-
-        inv[3][3] =
-            + m[0][0] * m[1][1] * m[2][2]
-            - m[0][0] * m[1][2] * m[2][1]
-            - m[1][0] * m[0][1] * m[2][2]
-            + m[1][0] * m[0][2] * m[2][1]
-            + m[2][0] * m[0][1] * m[1][2]
-            - m[2][0] * m[0][2] * m[1][1];
-        // clang-format on
-
-        // Calc det by the first row
-        float det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0] + m[0][3] * inv[3][0];
-        TAV_ASSERT(!almost_zero(det, k_epsilon6));
-        if (almost_zero(det, k_epsilon6)) {
+        const bool invertible = simd::mat4_inverse(m.data(), inv.data());
+        TAV_ASSERT(invertible);
+        if (!invertible) {
             // Can't calculate inverse matrix, so return zero matrix
             return mat4(0.0f);
         }
-
-        // Apply inverse determinant to the whole matrix
-        inv *= 1.0f / det;
         return inv;
+#else
+        return scalar::inverse(m);
+#endif
     }
 
     quat inverse(const quat& q) noexcept
@@ -49,4 +49,12 @@ namespace tavros::math
 
     quat inverse(const quat& q) noexcept;
 
+    namespace scalar
+    {
+
+        /// Scalar version of @ref inverse(const mat4&), used when the SIMD kernel is not available.
+        mat4 inverse(const mat4& m) noexcept;
+
+    } // namespace scalar
+
 } // namespace tavros::math
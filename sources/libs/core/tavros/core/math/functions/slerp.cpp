@@ -2,26 +2,43 @@
 
 #include <tavros/core/math/functions/dot.hpp>
 #include <tavros/core/math/functions/normalize.hpp>
+#include <tavros/core/math/simd/simd.hpp>
 
 namespace tavros::math
 {
 
-    quat slerp(const quat& a, const quat& b, float coef) noexcept
+    namespace scalar
     {
-        auto cos_theta = dot(a, b);
-        auto to = b;
-        if (cos_theta < 0.0f) {
-            to = -to;
-            cos_theta = -cos_theta;
-        }
-        if (cos_theta > 0.9995f) {
-            return normalize(a * (1.0f - coef) + to * coef);
+
+        quat slerp(const quat& a, const quat& b, float coef) noexcept
+        {
+            auto cos_theta = dot(a, b);
+            auto to = b;
+            if (cos_theta < 0.0f) {
+                to = -to;
+                cos_theta = -cos_theta;
+            }
+            if (cos_theta > 0.9995f) {
+                return normalize(a * (1.0f - coef) + to * coef);
+            }
+            auto theta = acos(cos_theta);
+            auto sin_theta = sqrt(1.0f - cos_theta * cos_theta);
+            auto sa = sin((1.0f - coef) * theta) / sin_theta;
+            auto sb = sin(coef * theta) / sin_theta;
+            return a * sa + to * sb;
         }
-        auto theta = acos(cos_theta);
-        auto sin_theta = sqrt(1.0f - cos_theta * cos_theta);
-        auto sa = sin((1.0f - coef) * theta) / sin_theta;
-        auto sb = sin(coef * theta) / sin_theta;
-        return a * sa + to * sb;
+
+    } // namespace scalar
+
+    quat slerp(const quat& a, const quat& b, float coef) noexcept
+    {
+#if TAV_MATH_SIMD_ENABLED
+        quat result;
+        simd::quat_slerp(a.data(), b.data(), coef, result.data());
+        return result;
+#else
+        return scalar::slerp(a, b, coef);
+#endif
     }
 
 } // namespace tavros::math
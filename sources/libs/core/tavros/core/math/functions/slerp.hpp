@@ -18,4 +18,12 @@ namespace tavros::math
 
     quat slerp(const quat& a, const quat& b, float coef) noexcept;
 
+    namespace scalar
+    {
+
+        /// Scalar version of @ref slerp(), used when the SIMD kernel is not available.
+        quat slerp(const quat& a, const quat& b, float coef) noexcept;
+
+    } // namespace scalar
+
 } // namespace tavros::math
@@ -1,6 +1,9 @@
 #include <tavros/core/math/mat4.hpp>
 
 #include <tavros/core/math/functions/make_mat.hpp>
+#include <tavros/core/math/simd/simd.hpp>
+
+#include <type_traits>
 
 namespace tavros::math
 {
@@ -137,6 +140,32 @@ namespace tavros::math
         return cols[0].data();
     }
 
+    namespace scalar
+    {
+
+        inline constexpr mat4 mul(const mat4& a, const mat4& b) noexcept
+        {
+            mat4 result;
+            for (size_t col = 0; col < 4; ++col) {
+                for (size_t row = 0; row < 4; ++row) {
+                    // Compute the element at [row][col] as a dot product of:
+                    // - the 'row'-th row of this matrix
+                    // - the 'col'-th column of matrix 'm'
+                    // Note: in column-major layout, rows are accessed as [col][row]
+                    result[col][row] =
+                        a[0][row] * b[col][0] + a[1][row] * b[col][1] + a[2][row] * b[col][2] + a[3][row] * b[col][3];
+                }
+            }
+            return result;
+        }
+
+        inline constexpr vec4 mul(const mat4& m, const vec4& v) noexcept
+        {
+            return m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w;
+        }
+
+    } // namespace scalar
+
     inline constexpr mat4 operator-(const mat4& m) noexcept
     {
         return mat4(-m[0], -m[1], -m[2], -m[3]);
@@ -154,23 +183,26 @@ namespace tavros::math
 
     inline constexpr mat4 operator*(const mat4& a, const mat4& b) noexcept
     {
-        mat4 result;
-        for (size_t col = 0; col < 4; ++col) {
-            for (size_t row = 0; row < 4; ++row) {
-                // Compute the element at [row][col] as a dot product of:
-                // - the 'row'-th row of this matrix
-                // - the 'col'-th column of matrix 'm'
-                // Note: in column-major layout, rows are accessed as [col][row]
-                result[col][row] =
-                    a[0][row] * b[col][0] + a[1][row] * b[col][1] + a[2][row] * b[col][2] + a[3][row] * b[col][3];
-            }
+#if TAV_MATH_SIMD_ENABLED
+        if (!std::is_constant_evaluated()) {
+            mat4 result;
+            simd::mat4_mul(a.data(), b.data(), result.data());
+            return result;
         }
-        return result;
+#endif
+        return scalar::mul(a, b);
     }
 
     inline constexpr vec4 operator*(const mat4& m, const vec4& v) noexcept
     {
-        return m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w;
+#if TAV_MATH_SIMD_ENABLED
+        if (!std::is_constant_evaluated()) {
+            vec4 result;
+            simd::mat4_mul_vec4(m.data(), v.data(), result.data());
+            return result;
+        }
+#endif
+        return scalar::mul(m, v);
     }
 
     inline constexpr vec4 operator*(const vec4& v, const mat4& m) noexcept
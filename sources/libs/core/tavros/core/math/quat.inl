@@ -3,6 +3,9 @@
 #include <tavros/core/math/functions/make_quat.hpp>
 #include <tavros/core/math/functions/normalize.hpp>
 #include <tavros/core/math/functions/rotate.hpp>
+#include <tavros/core/math/simd/simd.hpp>
+
+#include <type_traits>
 
 namespace tavros::math
 {
@@ -177,6 +180,21 @@ namespace tavros::math
         return &x;
     }
 
+    namespace scalar
+    {
+
+        inline constexpr quat mul(const quat& a, const quat& b) noexcept
+        {
+            return quat(
+                a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+            );
+        }
+
+    } // namespace scalar
+
     inline constexpr quat operator-(const quat& q) noexcept
     {
         return quat(-q.x, -q.y, -q.z, -q.w);
@@ -194,12 +212,14 @@ namespace tavros::math
 
     inline constexpr quat operator*(const quat& a, const quat& b) noexcept
     {
-        return quat(
-            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
-            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
-            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
-            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
-        );
+#if TAV_MATH_SIMD_ENABLED
+        if (!std::is_constant_evaluated()) {
+            quat result;
+            simd::quat_mul(a.data(), b.data(), result.data());
+            return result;
+        }
+#endif
+        return scalar::mul(a, b);
     }
 
     inline vec3 operator*(const quat& q, const vec3& p) noexcept
@@ -0,0 +1,286 @@
+#pragma once
+
+/**
+ * @file float4.hpp
+ * @brief Four-lane float operations mapped to SSE or NEON.
+ *
+ * The array kernels (see @ref batch.hpp and the frustum culling) are written once against
+ * these helpers. Only available when `TAV_MATH_SIMD_ENABLED` is set, see @ref simd.hpp.
+ *
+ * Loads and stores are unaligned, arrays of `vec2`/`vec3` and raw float arrays have no
+ * 16-byte alignment guarantee.
+ */
+
+#include <tavros/core/math/simd/simd.hpp>
+
+#if TAV_MATH_SIMD_ENABLED
+
+namespace tavros::math::simd
+{
+
+    #if TAV_MATH_SIMD_SSE
+
+    using float4 = __m128;
+
+    // Per-lane comparison result, all bits set where the comparison holds
+    using mask4 = __m128;
+
+    inline float4 load(const float* p) noexcept
+    {
+        return _mm_loadu_ps(p);
+    }
+
+    inline void store(float* p, float4 v) noexcept
+    {
+        _mm_storeu_ps(p, v);
+    }
+
+    inline float4 set1(float s) noexcept
+    {
+        return _mm_set1_ps(s);
+    }
+
+    inline float4 set4(float a, float b, float c, float d) noexcept
+    {
+        return _mm_setr_ps(a, b, c, d);
+    }
+
+    inline float4 add(float4 a, float4 b) noexcept
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    inline float4 sub(float4 a, float4 b) noexcept
+    {
+        return _mm_sub_ps(a, b);
+    }
+
+    inline float4 mul(float4 a, float4 b) noexcept
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    // a * b + c
+    inline float4 madd(float4 a, float4 b, float4 c) noexcept
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
+    inline float4 abs(float4 v) noexcept
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+
+    inline float4 inv_sqrt(float4 v) noexcept
+    {
+        // The exact version, rsqrt estimates are not precise enough for normals
+        return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(v));
+    }
+
+    inline mask4 less(float4 a, float4 b) noexcept
+    {
+        return _mm_cmplt_ps(a, b);
+    }
+
+    inline mask4 greater(float4 a, float4 b) noexcept
+    {
+        return _mm_cmpgt_ps(a, b);
+    }
+
+    inline mask4 mask_or(mask4 a, mask4 b) noexcept
+    {
+        return _mm_or_ps(a, b);
+    }
+
+    // Lanes of a where the mask is set, lanes of b elsewhere
+    inline float4 select(mask4 mask, float4 a, float4 b) noexcept
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    // Bit i is set if lane i of the mask is set
+    inline uint32 mask_bits(mask4 mask) noexcept
+    {
+        return static_cast<uint32>(_mm_movemask_ps(mask));
+    }
+
+    struct float4x2
+    {
+        float4 x, y;
+    };
+
+    struct float4x3
+    {
+        float4 x, y, z;
+    };
+
+    // Four interleaved vec2 to components
+    inline float4x2 load2(const float* p) noexcept
+    {
+        const float4 a = _mm_loadu_ps(p);     // x0 y0 x1 y1
+        const float4 b = _mm_loadu_ps(p + 4); // x2 y2 x3 y3
+        return {shuffle<0, 2, 0, 2>(a, b), shuffle<1, 3, 1, 3>(a, b)};
+    }
+
+    inline void store2(float* p, const float4x2& v) noexcept
+    {
+        _mm_storeu_ps(p, _mm_unpacklo_ps(v.x, v.y));
+        _mm_storeu_ps(p + 4, _mm_unpackhi_ps(v.x, v.y));
+    }
+
+    // Four interleaved vec3 to components
+    inline float4x3 load3(const float* p) noexcept
+    {
+        const float4 a = _mm_loadu_ps(p);     // x0 y0 z0 x1
+        const float4 b = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+        const float4 c = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+
+        const float4 x2y2z2x3 = shuffle<2, 3, 0, 1>(b, c);
+        const float4 y0z0y1z1 = shuffle<1, 2, 0, 1>(a, b);
+        const float4 y2y2y3y3 = shuffle<1, 1, 2, 2>(x2y2z2x3, c);
+        return {
+            shuffle<0, 3, 0, 3>(a, x2y2z2x3),
+            shuffle<0, 2, 0, 2>(y0z0y1z1, y2y2y3y3),
+            shuffle<1, 3, 0, 3>(y0z0y1z1, c),
+        };
+    }
+
+    inline void store3(float* p, const float4x3& v) noexcept
+    {
+        const float4 x0y0x1y1 = _mm_unpacklo_ps(v.x, v.y);
+        const float4 x2y2x3y3 = _mm_unpackhi_ps(v.x, v.y);
+        const float4 z0z0x1x1 = shuffle<0, 0, 2, 2>(v.z, x0y0x1y1);
+        const float4 y1y1z1z1 = shuffle<3, 3, 1, 1>(x0y0x1y1, v.z);
+        const float4 z2z2x3x3 = shuffle<2, 2, 2, 2>(v.z, x2y2x3y3);
+        const float4 y3y3z3z3 = shuffle<3, 3, 3, 3>(x2y2x3y3, v.z);
+        _mm_storeu_ps(p, shuffle<0, 1, 0, 2>(x0y0x1y1, z0z0x1x1));
+        _mm_storeu_ps(p + 4, shuffle<0, 2, 0, 1>(y1y1z1z1, x2y2x3y3));
+        _mm_storeu_ps(p + 8, shuffle<0, 2, 0, 2>(z2z2x3x3, y3y3z3z3));
+    }
+
+    #elif TAV_MATH_SIMD_NEON
+
+    using float4 = float32x4_t;
+
+    // Per-lane comparison result, all bits set where the comparison holds
+    using mask4 = uint32x4_t;
+
+    inline float4 load(const float* p) noexcept
+    {
+        return vld1q_f32(p);
+    }
+
+    inline void store(float* p, float4 v) noexcept
+    {
+        vst1q_f32(p, v);
+    }
+
+    inline float4 set1(float s) noexcept
+    {
+        return vdupq_n_f32(s);
+    }
+
+    inline float4 set4(float a, float b, float c, float d) noexcept
+    {
+        const float lanes[4] = {a, b, c, d};
+        return vld1q_f32(lanes);
+    }
+
+    inline float4 add(float4 a, float4 b) noexcept
+    {
+        return vaddq_f32(a, b);
+    }
+
+    inline float4 sub(float4 a, float4 b) noexcept
+    {
+        return vsubq_f32(a, b);
+    }
+
+    inline float4 mul(float4 a, float4 b) noexcept
+    {
+        return vmulq_f32(a, b);
+    }
+
+    // a * b + c
+    inline float4 madd(float4 a, float4 b, float4 c) noexcept
+    {
+        return vfmaq_f32(c, a, b);
+    }
+
+    inline float4 abs(float4 v) noexcept
+    {
+        return vabsq_f32(v);
+    }
+
+    inline float4 inv_sqrt(float4 v) noexcept
+    {
+        return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(v));
+    }
+
+    inline mask4 less(float4 a, float4 b) noexcept
+    {
+        return vcltq_f32(a, b);
+    }
+
+    inline mask4 greater(float4 a, float4 b) noexcept
+    {
+        return vcgtq_f32(a, b);
+    }
+
+    inline mask4 mask_or(mask4 a, mask4 b) noexcept
+    {
+        return vorrq_u32(a, b);
+    }
+
+    // Lanes of a where the mask is set, lanes of b elsewhere
+    inline float4 select(mask4 mask, float4 a, float4 b) noexcept
+    {
+        return vbslq_f32(mask, a, b);
+    }
+
+    // Bit i is set if lane i of the mask is set
+    inline uint32 mask_bits(mask4 mask) noexcept
+    {
+        static constexpr uint32 k_lane_bits[4] = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(mask, vld1q_u32(k_lane_bits)));
+    }
+
+    struct float4x2
+    {
+        float4 x, y;
+    };
+
+    struct float4x3
+    {
+        float4 x, y, z;
+    };
+
+    // NEON de-interleaves structures on load and interleaves them back on store
+
+    inline float4x2 load2(const float* p) noexcept
+    {
+        const float32x4x2_t v = vld2q_f32(p);
+        return {v.val[0], v.val[1]};
+    }
+
+    inline void store2(float* p, const float4x2& v) noexcept
+    {
+        vst2q_f32(p, float32x4x2_t{{v.x, v.y}});
+    }
+
+    inline float4x3 load3(const float* p) noexcept
+    {
+        const float32x4x3_t v = vld3q_f32(p);
+        return {v.val[0], v.val[1], v.val[2]};
+    }
+
+    inline void store3(float* p, const float4x3& v) noexcept
+    {
+        vst3q_f32(p, float32x4x3_t{{v.x, v.y, v.z}});
+    }
+
+    #endif
+
+} // namespace tavros::math::simd
+
+#endif // TAV_MATH_SIMD_ENABLED
@@ -0,0 +1,144 @@
+#include <tavros/core/math/simd/simd.hpp>
+
+#if TAV_MATH_SIMD_ENABLED
+
+    #include <cmath>
+
+namespace tavros::math::simd
+{
+
+    #if TAV_MATH_SIMD_SSE
+
+    namespace
+    {
+        // 2x2 matrices packed as (m00, m01, m10, m11)
+
+        // A * B
+        inline __m128 mat2_mul(__m128 a, __m128 b) noexcept
+        {
+            return _mm_add_ps(_mm_mul_ps(a, swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // adj(A) * B
+        inline __m128 mat2_adj_mul(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
+        }
+
+        // A * adj(B)
+        inline __m128 mat2_mul_adj(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+        }
+    } // namespace
+
+    bool mat4_inverse(const float* m, float* out) noexcept
+    {
+        // Block inversion over 2x2 sub-matrices, see
+        // https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+        // Columns are treated as rows: inverting the transpose and storing it transposed again gives the inverse.
+        const __m128 c0 = _mm_load_ps(m);
+        const __m128 c1 = _mm_load_ps(m + 4);
+        const __m128 c2 = _mm_load_ps(m + 8);
+        const __m128 c3 = _mm_load_ps(m + 12);
+
+        const __m128 a = _mm_movelh_ps(c0, c1);
+        const __m128 b = _mm_movehl_ps(c1, c0);
+        const __m128 c = _mm_movelh_ps(c2, c3);
+        const __m128 d = _mm_movehl_ps(c3, c2);
+
+        // Determinants of the sub-matrices as (|A|, |B|, |C|, |D|)
+        const __m128 det_sub = _mm_sub_ps(
+            _mm_mul_ps(shuffle<0, 2, 0, 2>(c0, c2), shuffle<1, 3, 1, 3>(c1, c3)),
+            _mm_mul_ps(shuffle<1, 3, 1, 3>(c0, c2), shuffle<0, 2, 0, 2>(c1, c3))
+        );
+        const __m128 det_a = swizzle<0, 0, 0, 0>(det_sub);
+        const __m128 det_b = swizzle<1, 1, 1, 1>(det_sub);
+        const __m128 det_c = swizzle<2, 2, 2, 2>(det_sub);
+        const __m128 det_d = swizzle<3, 3, 3, 3>(det_sub);
+
+        const __m128 d_c = mat2_adj_mul(d, c);
+        const __m128 a_b = mat2_adj_mul(a, b);
+
+        __m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), mat2_mul(b, d_c));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), mat2_mul(c, a_b));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), mat2_mul_adj(d, a_b));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), mat2_mul_adj(a, d_c));
+
+        // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+        const __m128 tr = hsum(_mm_mul_ps(a_b, swizzle<0, 2, 1, 3>(d_c)));
+        const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), tr);
+
+        const float det_s = _mm_cvtss_f32(det);
+        if (std::fabs(det_s) < 1e-6f) {
+            return false;
+        }
+
+        const __m128 r_det = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+        x = _mm_mul_ps(x, r_det);
+        y = _mm_mul_ps(y, r_det);
+        z = _mm_mul_ps(z, r_det);
+        w = _mm_mul_ps(w, r_det);
+
+        // The adjugate shuffle and the transposed store in one step
+        _mm_store_ps(out, shuffle<3, 1, 3, 1>(x, y));
+        _mm_store_ps(out + 4, shuffle<2, 0, 2, 0>(x, y));
+        _mm_store_ps(out + 8, shuffle<3, 1, 3, 1>(z, w));
+        _mm_store_ps(out + 12, shuffle<2, 0, 2, 0>(z, w));
+        return true;
+    }
+
+    namespace
+    {
+        inline void blend(const float* a, const float* b, float sa, float sb, bool normalize, float* out) noexcept
+        {
+            __m128 r = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(sa)), _mm_mul_ps(_mm_loadu_ps(b), _mm_set1_ps(sb)));
+            if (normalize) {
+                r = _mm_div_ps(r, _mm_sqrt_ps(hsum(_mm_mul_ps(r, r))));
+            }
+            _mm_storeu_ps(out, r);
+        }
+    } // namespace
+
+    #elif TAV_MATH_SIMD_NEON
+
+    namespace
+    {
+        inline void blend(const float* a, const float* b, float sa, float sb, bool normalize, float* out) noexcept
+        {
+            float32x4_t r = vfmaq_n_f32(vmulq_n_f32(vld1q_f32(a), sa), vld1q_f32(b), sb);
+            if (normalize) {
+                r = vdivq_f32(r, vdupq_n_f32(std::sqrt(vaddvq_f32(vmulq_f32(r, r)))));
+            }
+            vst1q_f32(out, r);
+        }
+    } // namespace
+
+    #endif
+
+    void quat_slerp(const float* a, const float* b, float coef, float* out) noexcept
+    {
+        // Take the shortest arc, the negated quaternion is the same rotation
+        float cos_theta = dot4(a, b);
+        float sign = 1.0f;
+        if (cos_theta < 0.0f) {
+            cos_theta = -cos_theta;
+            sign = -1.0f;
+        }
+
+        // Nearly parallel, a normalized lerp avoids dividing by a tiny sine
+        if (cos_theta > 0.9995f) {
+            blend(a, b, 1.0f - coef, coef * sign, true, out);
+            return;
+        }
+
+        const float theta = std::acos(cos_theta);
+        const float sin_theta = std::sqrt(1.0f - cos_theta * cos_theta);
+        const float sa = std::sin((1.0f - coef) * theta) / sin_theta;
+        const float sb = std::sin(coef * theta) / sin_theta;
+        blend(a, b, sa, sb * sign, false, out);
+    }
+
+} // namespace tavros::math::simd
+
+#endif // TAV_MATH_SIMD_ENABLED
@@ -0,0 +1,214 @@
+#pragma once
+
+/**
+ * @file simd.hpp
+ * @brief Optional SSE/NEON kernels behind the hot `tavros::math` operations.
+ *
+ * The layer is controlled by `TAV_MATH_SIMD`, which the `TAV_ENABLE_MATH_SIMD` CMake option
+ * (on by default) defines for tav_core and everything linking it. The backend is then chosen
+ * at compile time:
+ * - SSE2 on x86-64, and on x86 when the compiler targets SSE2.
+ * - NEON on ARM64.
+ * On other targets, or without the define, every operation uses the scalar code.
+ *
+ * The kernels back these operations:
+ * - `mat4 * mat4` and `mat4 * vec4`
+ * - `inverse(mat4)` (SSE only, NEON uses the scalar version)
+ * - `quat * quat` and `slerp(quat, quat, float)`
+ *
+ * The public operators stay `constexpr`: constant evaluation always takes the scalar path.
+ * The scalar implementations remain available in `tavros::math::scalar`, so tests can
+ * compare both paths in the same build.
+ *
+ * Matrix kernels take pointers to 16-byte aligned floats, which `vec4` and `mat4` guarantee.
+ * `quat` has no alignment requirement, so quaternion kernels use unaligned loads.
+ */
+
+#include <tavros/core/defines.hpp>
+#include <tavros/core/types.hpp>
+
+#ifndef TAV_MATH_SIMD
+    #define TAV_MATH_SIMD 0
+#endif // TAV_MATH_SIMD
+
+#if !!(TAV_MATH_SIMD) && (TAV_ARCH_X64 || (TAV_ARCH_X86 && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))))
+    #define TAV_MATH_SIMD_SSE 1
+#else
+    #define TAV_MATH_SIMD_SSE 0
+#endif
+
+#if !!(TAV_MATH_SIMD) && TAV_ARCH_ARM64
+    #define TAV_MATH_SIMD_NEON 1
+#else
+    #define TAV_MATH_SIMD_NEON 0
+#endif
+
+#if TAV_MATH_SIMD_SSE || TAV_MATH_SIMD_NEON
+    #define TAV_MATH_SIMD_ENABLED 1
+#else
+    #define TAV_MATH_SIMD_ENABLED 0
+#endif
+
+#if TAV_MATH_SIMD_SSE
+    #include <emmintrin.h>
+#elif TAV_MATH_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+#if TAV_MATH_SIMD_ENABLED
+
+namespace tavros::math::simd
+{
+
+    #if TAV_MATH_SIMD_SSE
+
+    // Lanes (a[X], a[Y], b[Z], b[W])
+    template<int X, int Y, int Z, int W>
+    inline __m128 shuffle(__m128 a, __m128 b) noexcept
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    // Lanes (v[X], v[Y], v[Z], v[W])
+    template<int X, int Y, int Z, int W>
+    inline __m128 swizzle(__m128 v) noexcept
+    {
+        return shuffle<X, Y, Z, W>(v, v);
+    }
+
+    // Broadcasts lane I of v to all lanes
+    template<int I>
+    inline __m128 splat(__m128 v) noexcept
+    {
+        return swizzle<I, I, I, I>(v);
+    }
+
+    // Sum of all lanes in every lane
+    inline __m128 hsum(__m128 v) noexcept
+    {
+        v = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    // Column-major product of four columns and one vector
+    inline __m128 mul_columns(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v) noexcept
+    {
+        __m128 r = _mm_mul_ps(c0, splat<0>(v));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, splat<1>(v)));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, splat<2>(v)));
+        return _mm_add_ps(r, _mm_mul_ps(c3, splat<3>(v)));
+    }
+
+    inline void mat4_mul(const float* a, const float* b, float* out) noexcept
+    {
+        const __m128 c0 = _mm_load_ps(a);
+        const __m128 c1 = _mm_load_ps(a + 4);
+        const __m128 c2 = _mm_load_ps(a + 8);
+        const __m128 c3 = _mm_load_ps(a + 12);
+        const __m128 r0 = mul_columns(c0, c1, c2, c3, _mm_load_ps(b));
+        const __m128 r1 = mul_columns(c0, c1, c2, c3, _mm_load_ps(b + 4));
+        const __m128 r2 = mul_columns(c0, c1, c2, c3, _mm_load_ps(b + 8));
+        const __m128 r3 = mul_columns(c0, c1, c2, c3, _mm_load_ps(b + 12));
+        _mm_store_ps(out, r0);
+        _mm_store_ps(out + 4, r1);
+        _mm_store_ps(out + 8, r2);
+        _mm_store_ps(out + 12, r3);
+    }
+
+    inline void mat4_mul_vec4(const float* m, const float* v, float* out) noexcept
+    {
+        _mm_store_ps(out, mul_columns(_mm_load_ps(m), _mm_load_ps(m + 4), _mm_load_ps(m + 8), _mm_load_ps(m + 12), _mm_load_ps(v)));
+    }
+
+    inline void quat_mul(const float* a, const float* b, float* out) noexcept
+    {
+        // Each term is a lane of `a` times a permutation of `b` with per-lane signs
+        const __m128 qa = _mm_loadu_ps(a);
+        const __m128 qb = _mm_loadu_ps(b);
+        const __m128 sign_x = _mm_castsi128_ps(_mm_set_epi32(static_cast<int32>(0x80000000), 0, static_cast<int32>(0x80000000), 0));
+        const __m128 sign_y = _mm_castsi128_ps(_mm_set_epi32(static_cast<int32>(0x80000000), static_cast<int32>(0x80000000), 0, 0));
+        const __m128 sign_z = _mm_castsi128_ps(_mm_set_epi32(static_cast<int32>(0x80000000), 0, 0, static_cast<int32>(0x80000000)));
+
+        __m128 r = _mm_mul_ps(splat<3>(qa), qb);
+        r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(splat<0>(qa), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(0, 1, 2, 3))), sign_x));
+        r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(splat<1>(qa), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(1, 0, 3, 2))), sign_y));
+        r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(splat<2>(qa), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(2, 3, 0, 1))), sign_z));
+        _mm_storeu_ps(out, r);
+    }
+
+    inline float dot4(const float* a, const float* b) noexcept
+    {
+        return _mm_cvtss_f32(hsum(_mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))));
+    }
+
+    /**
+     * @brief Inverts a column-major 4x4 matrix with the 2x2 block method.
+     *
+     * @return false if the matrix is singular, @p out is then left unchanged.
+     */
+    bool mat4_inverse(const float* m, float* out) noexcept;
+
+    #elif TAV_MATH_SIMD_NEON
+
+    inline float32x4_t mul_columns(float32x4_t c0, float32x4_t c1, float32x4_t c2, float32x4_t c3, float32x4_t v) noexcept
+    {
+        float32x4_t r = vmulq_laneq_f32(c0, v, 0);
+        r = vfmaq_laneq_f32(r, c1, v, 1);
+        r = vfmaq_laneq_f32(r, c2, v, 2);
+        return vfmaq_laneq_f32(r, c3, v, 3);
+    }
+
+    inline void mat4_mul(const float* a, const float* b, float* out) noexcept
+    {
+        const float32x4_t c0 = vld1q_f32(a);
+        const float32x4_t c1 = vld1q_f32(a + 4);
+        const float32x4_t c2 = vld1q_f32(a + 8);
+        const float32x4_t c3 = vld1q_f32(a + 12);
+        const float32x4_t r0 = mul_columns(c0, c1, c2, c3, vld1q_f32(b));
+        const float32x4_t r1 = mul_columns(c0, c1, c2, c3, vld1q_f32(b + 4));
+        const float32x4_t r2 = mul_columns(c0, c1, c2, c3, vld1q_f32(b + 8));
+        const float32x4_t r3 = mul_columns(c0, c1, c2, c3, vld1q_f32(b + 12));
+        vst1q_f32(out, r0);
+        vst1q_f32(out + 4, r1);
+        vst1q_f32(out + 8, r2);
+        vst1q_f32(out + 12, r3);
+    }
+
+    inline void mat4_mul_vec4(const float* m, const float* v, float* out) noexcept
+    {
+        vst1q_f32(out, mul_columns(vld1q_f32(m), vld1q_f32(m + 4), vld1q_f32(m + 8), vld1q_f32(m + 12), vld1q_f32(v)));
+    }
+
+    inline void quat_mul(const float* a, const float* b, float* out) noexcept
+    {
+        // Same decomposition as the SSE version: lanes of `a` times signed permutations of `b`
+        static constexpr float k_sign_x[4] = {1.0f, -1.0f, 1.0f, -1.0f};
+        static constexpr float k_sign_y[4] = {1.0f, 1.0f, -1.0f, -1.0f};
+        static constexpr float k_sign_z[4] = {-1.0f, 1.0f, 1.0f, -1.0f};
+
+        const float32x4_t qa = vld1q_f32(a);
+        const float32x4_t qb = vld1q_f32(b);
+        const float32x4_t zwxy = vextq_f32(qb, qb, 2);
+
+        float32x4_t r = vmulq_laneq_f32(qb, qa, 3);
+        r = vfmaq_f32(r, vmulq_laneq_f32(vrev64q_f32(zwxy), qa, 0), vld1q_f32(k_sign_x));
+        r = vfmaq_f32(r, vmulq_laneq_f32(zwxy, qa, 1), vld1q_f32(k_sign_y));
+        r = vfmaq_f32(r, vmulq_laneq_f32(vrev64q_f32(qb), qa, 2), vld1q_f32(k_sign_z));
+        vst1q_f32(out, r);
+    }
+
+    inline float dot4(const float* a, const float* b) noexcept
+    {
+        return vaddvq_f32(vmulq_f32(vld1q_f32(a), vld1q_f32(b)));
+    }
+
+    #endif
+
+    /**
+     * @brief Spherical interpolation between two quaternions, see @ref tavros::math::slerp().
+     */
+    void quat_slerp(const float* a, const float* b, float coef, float* out) noexcept;
+
+} // namespace tavros::math::simd
+
+#endif // TAV_MATH_SIMD_ENABLED
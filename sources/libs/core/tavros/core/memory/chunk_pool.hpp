@@ -0,0 +1,333 @@
+#pragma once
+
+#include <tavros/core/memory/chunk_allocator.hpp>
+#include <tavros/core/types.hpp>
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/noncopyable.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace tavros::core
+{
+
+    /**
+     * @class chunk_pool
+     * @brief Unbounded fixed-size block pool built from @ref chunk_allocator pages.
+     *
+     * The pool grows by adding pages on demand; every page is a @ref chunk_allocator of up
+     * to 512 blocks placed right after its header in a single system allocation.
+     *
+     * Features and design choices:
+     * - Pages that have free blocks are linked into a free-page list:
+     *   - Allocation takes the first page of the list, so finding space is O(1)
+     *     no matter how many pages the pool has.
+     *   - A page leaves the list when it fills up and rejoins it on the first free.
+     * - Pages are aligned to their power-of-two size:
+     *   - The page of a block is found by masking the pointer, so deallocation is O(1)
+     *     and needs no lookup structure.
+     * - Empty pages are kept for reuse up to a high-water mark:
+     *   - Past @ref max_empty_pages() an emptied page is returned to the system, so a pool
+     *     that shrinks after a peak does not hold on to all its memory.
+     * Notes:
+     * - The pool hands out raw blocks; constructing and destroying objects is up to the caller.
+     * - The class is non-copyable and not thread-safe.
+     */
+    template<class T>
+    class chunk_pool : noncopyable
+    {
+    public:
+        using chunk_type = chunk_allocator<T, 512>;
+
+        constexpr static size_t k_type_size = chunk_type::k_type_size;
+        constexpr static size_t k_type_align = chunk_type::k_type_align;
+
+    private:
+        struct page
+        {
+            page*      prev_free; // free-page list links, valid while the page has free blocks
+            page*      next_free;
+            page*      prev;   // list of all pages
+            page*      next;
+            bool       listed; // whether the page is in the free-page list
+            size_t     blocks; // number of blocks in the page
+            chunk_type chunk;
+
+            page(uint8* storage, size_t total_blocks)
+                : prev_free(nullptr)
+                , next_free(nullptr)
+                , prev(nullptr)
+                , next(nullptr)
+                , listed(false)
+                , blocks(total_blocks)
+                , chunk(storage, total_blocks)
+            {
+            }
+        };
+
+        constexpr static size_t k_header_size = (sizeof(page) + k_type_align - 1) & ~(k_type_align - 1);
+
+        // The largest power of two not exceeding a full 512-block page, so that at most
+        // one block worth of memory is lost to the rounding
+        constexpr static size_t compute_page_size() noexcept
+        {
+            const size_t full = k_header_size + 512 * k_type_size;
+            const size_t floor = size_t{1} << (63 - std::countl_zero(static_cast<uint64>(full)));
+            return floor - k_header_size >= 64 * k_type_size ? floor : floor * 2;
+        }
+
+    public:
+        constexpr static size_t k_page_size = compute_page_size();
+        constexpr static size_t k_blocks_per_page = std::min<size_t>(512, (k_page_size - k_header_size) / k_type_size);
+
+    public:
+        /**
+         * @brief Constructs an empty pool.
+         *
+         * @param max_empty_pages Number of empty pages kept for reuse before pages are returned to the system.
+         */
+        explicit chunk_pool(size_t max_empty_pages = 1) noexcept
+            : m_max_empty_pages(max_empty_pages)
+        {
+        }
+
+        /**
+         * @brief Returns all pages to the system.
+         *
+         * @note Objects still living in the pool are not destroyed.
+         */
+        ~chunk_pool()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Allocates a single block, adding a page if every page is full.
+         *
+         * @return Pointer to a free block of type T, or nullptr if a new page could not be allocated.
+         */
+        [[nodiscard]] T* allocate_block()
+        {
+            auto* p = m_free_pages;
+            if (!p) {
+                p = add_page();
+                if (!p) {
+                    return nullptr;
+                }
+            }
+
+            if (p->chunk.available_blocks() == p->blocks) {
+                TAV_ASSERT(m_empty_pages > 0);
+                --m_empty_pages;
+            }
+
+            auto* block = p->chunk.allocate_block();
+            TAV_ASSERT(block);
+            ++m_allocated;
+
+            if (p->chunk.filled()) {
+                unlink_free(p);
+            }
+            return block;
+        }
+
+        /**
+         * @brief Deallocates a block previously returned by @ref allocate_block().
+         *
+         * @param ptr Pointer to the block to release.
+         */
+        void deallocate_block(T* ptr)
+        {
+            TAV_ASSERT(ptr);
+            auto* p = page_of(ptr);
+            TAV_ASSERT(p->chunk.owns(ptr));
+
+            const auto before = p->chunk.available_blocks();
+            p->chunk.deallocate_block(ptr);
+            if (p->chunk.available_blocks() == before) {
+                return; // invalid or already free block, reported by the chunk
+            }
+            --m_allocated;
+
+            if (!p->listed) {
+                link_free(p);
+            }
+
+            if (p->chunk.available_blocks() == p->blocks) {
+                if (m_empty_pages >= m_max_empty_pages) {
+                    remove_page(p);
+                } else {
+                    ++m_empty_pages;
+                }
+            }
+        }
+
+        /**
+         * @brief Checks whether a pointer belongs to a page of this pool.
+         *
+         * @note Walks all pages; meant for validation, not for hot paths.
+         */
+        [[nodiscard]] bool owns(const T* ptr) const noexcept
+        {
+            for (auto* p = m_pages; p; p = p->next) {
+                if (p->chunk.owns(const_cast<T*>(ptr))) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Returns all pages to the system at once.
+         *
+         * @note Objects still living in the pool are not destroyed.
+         */
+        void clear()
+        {
+            while (m_pages) {
+                auto* p = m_pages;
+                m_pages = p->next;
+                free_page(p);
+            }
+            m_free_pages = nullptr;
+            m_page_count = 0;
+            m_empty_pages = 0;
+            m_allocated = 0;
+        }
+
+        /**
+         * @brief Returns the number of allocated blocks.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_allocated;
+        }
+
+        /**
+         * @brief Returns the number of blocks the current pages can hold.
+         */
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return m_page_count * k_blocks_per_page;
+        }
+
+        /**
+         * @brief Returns the number of pages held by the pool.
+         */
+        [[nodiscard]] size_t page_count() const noexcept
+        {
+            return m_page_count;
+        }
+
+        /**
+         * @brief Returns the number of pages without allocated blocks.
+         */
+        [[nodiscard]] size_t empty_page_count() const noexcept
+        {
+            return m_empty_pages;
+        }
+
+        /**
+         * @brief Returns the number of empty pages kept before pages are returned to the system.
+         */
+        [[nodiscard]] size_t max_empty_pages() const noexcept
+        {
+            return m_max_empty_pages;
+        }
+
+        /**
+         * @brief Sets the number of empty pages kept for reuse.
+         *
+         * Surplus empty pages are returned to the system when they are emptied next time.
+         */
+        void set_max_empty_pages(size_t n) noexcept
+        {
+            m_max_empty_pages = n;
+        }
+
+    private:
+        static page* page_of(const T* ptr) noexcept
+        {
+            return reinterpret_cast<page*>(reinterpret_cast<size_t>(ptr) & ~(k_page_size - 1));
+        }
+
+        page* add_page()
+        {
+            auto* mem = static_cast<uint8*>(::operator new(k_page_size, std::align_val_t{k_page_size}, std::nothrow));
+            if (!mem) {
+                return nullptr;
+            }
+
+            auto* p = new (mem) page(mem + k_header_size, k_blocks_per_page);
+            p->next = m_pages;
+            if (m_pages) {
+                m_pages->prev = p;
+            }
+            m_pages = p;
+
+            ++m_page_count;
+            ++m_empty_pages;
+            link_free(p);
+            return p;
+        }
+
+        void remove_page(page* p)
+        {
+            unlink_free(p);
+            if (p->prev) {
+                p->prev->next = p->next;
+            } else {
+                m_pages = p->next;
+            }
+            if (p->next) {
+                p->next->prev = p->prev;
+            }
+            --m_page_count;
+            free_page(p);
+        }
+
+        static void free_page(page* p)
+        {
+            p->~page();
+            ::operator delete(p, std::align_val_t{k_page_size});
+        }
+
+        void link_free(page* p) noexcept
+        {
+            TAV_ASSERT(!p->listed);
+            p->prev_free = nullptr;
+            p->next_free = m_free_pages;
+            if (m_free_pages) {
+                m_free_pages->prev_free = p;
+            }
+            m_free_pages = p;
+            p->listed = true;
+        }
+
+        void unlink_free(page* p) noexcept
+        {
+            if (!p->listed) {
+                return;
+            }
+            if (p->prev_free) {
+                p->prev_free->next_free = p->next_free;
+            } else {
+                m_free_pages = p->next_free;
+            }
+            if (p->next_free) {
+                p->next_free->prev_free = p->prev_free;
+            }
+            p->listed = false;
+        }
+
+    private:
+        page*  m_pages = nullptr;      // all pages
+        page*  m_free_pages = nullptr; // pages with at least one free block
+        size_t m_page_count = 0;
+        size_t m_empty_pages = 0;
+        size_t m_max_empty_pages = 1;
+        size_t m_allocated = 0;
+    };
+
+} // namespace tavros::core
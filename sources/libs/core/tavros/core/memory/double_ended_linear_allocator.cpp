@@ -0,0 +1,209 @@
+#include <tavros/core/memory/double_ended_linear_allocator.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/debug/debug_break.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/math/bitops.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    tavros::core::logger logger("double_ended_linear_allocator");
+}
+
+namespace tavros::core
+{
+
+    double_ended_linear_allocator::double_ended_linear_allocator(size_t capacity)
+        : m_capacity(capacity)
+        , m_high(capacity)
+    {
+        TAV_ASSERT(capacity > 0);
+        m_begin = static_cast<uint8*>(std::malloc(capacity));
+        if (!m_begin) {
+            ::logger.error("Failed to reserve {} bytes", capacity);
+            TAV_DEBUG_BREAK();
+            m_capacity = 0;
+            m_high = 0;
+        }
+    }
+
+    double_ended_linear_allocator::~double_ended_linear_allocator()
+    {
+        std::free(m_begin);
+    }
+
+    void* double_ended_linear_allocator::allocate(size_t size, size_t align, const char* tag)
+    {
+        return allocate_low(size, align, tag);
+    }
+
+    void* double_ended_linear_allocator::allocate_low(size_t size, size_t align, const char* tag)
+    {
+        TAV_UNUSED(tag);
+
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to allocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        const auto base = reinterpret_cast<size_t>(m_begin);
+        const auto offset = math::align_up(base + m_low, align) - base;
+        if (offset > m_high || size > m_high - offset) {
+            return nullptr;
+        }
+
+        m_last_low_block = offset;
+        m_last_low_top = m_low;
+        m_low = offset + size;
+        update_high_water_mark();
+
+        return m_begin + offset;
+    }
+
+    void* double_ended_linear_allocator::allocate_high(size_t size, size_t align, const char* tag)
+    {
+        TAV_UNUSED(tag);
+
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to allocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        if (size > m_high - m_low) {
+            return nullptr;
+        }
+
+        const auto base = reinterpret_cast<size_t>(m_begin);
+        const auto offset = ((base + m_high - size) & ~(align - 1)) - base;
+        if (offset < m_low) {
+            return nullptr;
+        }
+
+        m_last_high_block = offset;
+        m_last_high_top = m_high;
+        m_high = offset;
+        update_high_water_mark();
+
+        return m_begin + offset;
+    }
+
+    void* double_ended_linear_allocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
+    {
+        if (ptr == nullptr) {
+            return allocate(new_size, align, tag);
+        }
+
+        if (new_size == 0) {
+            deallocate(ptr);
+            return nullptr;
+        }
+
+        TAV_ASSERT(owns(ptr));
+        const auto offset = static_cast<size_t>(static_cast<uint8*>(ptr) - m_begin);
+        const bool is_low = offset < m_low;
+
+        // The most recent low block can be resized in place
+        if (offset == m_last_low_block && new_size <= m_high - offset) {
+            m_low = offset + new_size;
+            update_high_water_mark();
+            return ptr;
+        }
+
+        // The old size is unknown, but the block cannot extend past the top of its side
+        // (low blocks) or the end of the region (high blocks)
+        const auto old_size = is_low ? m_low - offset : m_capacity - offset;
+
+        void* new_ptr = is_low ? allocate_low(new_size, align, tag) : allocate_high(new_size, align, tag);
+        if (!new_ptr) {
+            return nullptr;
+        }
+
+        std::memmove(new_ptr, ptr, std::min(new_size, old_size));
+        return new_ptr;
+    }
+
+    void double_ended_linear_allocator::deallocate(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+
+        TAV_ASSERT(owns(ptr));
+        const auto offset = static_cast<size_t>(static_cast<uint8*>(ptr) - m_begin);
+
+        if (offset == m_last_low_block) {
+            m_low = m_last_low_top;
+            m_last_low_block = k_no_block;
+        } else if (offset == m_last_high_block) {
+            m_high = m_last_high_top;
+            m_last_high_block = k_no_block;
+        }
+    }
+
+    void double_ended_linear_allocator::clear()
+    {
+        m_low = 0;
+        m_high = m_capacity;
+        m_last_low_block = k_no_block;
+        m_last_high_block = k_no_block;
+    }
+
+    double_ended_linear_allocator::marker double_ended_linear_allocator::mark() const noexcept
+    {
+        return {m_low, m_high};
+    }
+
+    void double_ended_linear_allocator::rewind(const marker& m) noexcept
+    {
+        TAV_ASSERT(m.low <= m_low);
+        TAV_ASSERT(m.high >= m_high && m.high <= m_capacity);
+
+        m_low = m.low;
+        m_high = m.high;
+        m_last_low_block = k_no_block;
+        m_last_high_block = k_no_block;
+    }
+
+    bool double_ended_linear_allocator::owns(const void* ptr) const noexcept
+    {
+        auto* p = static_cast<const uint8*>(ptr);
+        return p >= m_begin && p < m_begin + m_capacity;
+    }
+
+    size_t double_ended_linear_allocator::size() const noexcept
+    {
+        return low_size() + high_size();
+    }
+
+    size_t double_ended_linear_allocator::low_size() const noexcept
+    {
+        return m_low;
+    }
+
+    size_t double_ended_linear_allocator::high_size() const noexcept
+    {
+        return m_capacity - m_high;
+    }
+
+    size_t double_ended_linear_allocator::capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    size_t double_ended_linear_allocator::high_water_mark() const noexcept
+    {
+        return m_high_water_mark;
+    }
+
+    void double_ended_linear_allocator::update_high_water_mark() noexcept
+    {
+        m_high_water_mark = std::max(m_high_water_mark, size());
+    }
+
+} // namespace tavros::core
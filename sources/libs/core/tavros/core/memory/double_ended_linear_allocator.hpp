@@ -0,0 +1,144 @@
+#pragma once
+
+#include <tavros/core/memory/allocator.hpp>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Pointer-bump allocator that grows from both ends of a single reserved region.
+     *
+     * The low side grows upwards from the start of the region and the high side grows
+     * downwards from its end; the region is exhausted when the two tops meet. Keeping
+     * two independent stacks in one reservation lets callers separate allocations by
+     * lifetime or usage (e.g. the Quake 3 hunk `h_low`/`h_high` preference) without
+     * splitting the memory budget up front.
+     *
+     * The generic @ref allocate() serves the low side. Both sides are rewound together
+     * via @ref mark() / @ref rewind() or @ref clear(), all O(1). @ref deallocate() only
+     * pops a block if it is the most recent one on its side; other blocks are reclaimed
+     * by rewinding.
+     *
+     * Allocated memory is not zeroed.
+     *
+     * @note The allocator is not thread-safe.
+     */
+    class double_ended_linear_allocator final : public allocator
+    {
+    public:
+        /**
+         * @brief Positions of both tops, returned by @ref mark().
+         */
+        struct marker
+        {
+            size_t low = 0;
+            size_t high = 0;
+        };
+
+    public:
+        /**
+         * @brief Reserves a region of @p capacity bytes.
+         *
+         * @param capacity Size of the region in bytes. Must be greater than zero.
+         */
+        explicit double_ended_linear_allocator(size_t capacity);
+
+        ~double_ended_linear_allocator() override;
+
+        /**
+         * @brief Allocates from the low side. Same as @ref allocate_low().
+         */
+        void* allocate(size_t size, size_t align, const char* tag = nullptr) override;
+
+        /**
+         * @brief Resizes a block on the side it was allocated from.
+         *
+         * The most recent low block is resized in place when possible, otherwise a new
+         * block is allocated on the same side and the contents are copied.
+         */
+        void* reallocate(void* ptr, size_t new_size, size_t align, const char* tag = nullptr) override;
+
+        /**
+         * @brief Pops the block if it is the most recent allocation on its side; otherwise no-op.
+         */
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Rewinds both sides to the ends of the region in O(1).
+         */
+        void clear() override;
+
+        /**
+         * @brief Bumps the low top upwards.
+         *
+         * @return Pointer to the block, or nullptr if the sides would overlap.
+         */
+        [[nodiscard]] void* allocate_low(size_t size, size_t align, const char* tag = nullptr);
+
+        /**
+         * @brief Bumps the high top downwards.
+         *
+         * @return Pointer to the block, or nullptr if the sides would overlap.
+         */
+        [[nodiscard]] void* allocate_high(size_t size, size_t align, const char* tag = nullptr);
+
+        /**
+         * @brief Returns the current tops of both sides.
+         */
+        [[nodiscard]] marker mark() const noexcept;
+
+        /**
+         * @brief Releases everything allocated on either side after @p m was taken.
+         *
+         * @param m Marker previously returned by @ref mark().
+         */
+        void rewind(const marker& m) noexcept;
+
+        /**
+         * @brief Returns @c true if @p ptr points into the reserved region.
+         */
+        [[nodiscard]] bool owns(const void* ptr) const noexcept;
+
+        /**
+         * @brief Returns the number of bytes in use on both sides, including alignment padding.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes in use on the low side.
+         */
+        [[nodiscard]] size_t low_size() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes in use on the high side.
+         */
+        [[nodiscard]] size_t high_size() const noexcept;
+
+        /**
+         * @brief Returns the size of the reserved region in bytes.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns the largest value @ref size() has reached since construction.
+         */
+        [[nodiscard]] size_t high_water_mark() const noexcept;
+
+    private:
+        void update_high_water_mark() noexcept;
+
+    private:
+        static constexpr size_t k_no_block = static_cast<size_t>(-1);
+
+        uint8* m_begin = nullptr;
+        size_t m_capacity = 0;
+        size_t m_low = 0;  // offset of the first free byte above the low side
+        size_t m_high = 0; // offset of the first used byte of the high side
+        size_t m_last_low_block = k_no_block;
+        size_t m_last_low_top = 0;
+        size_t m_last_high_block = k_no_block;
+        size_t m_last_high_top = 0;
+        size_t m_high_water_mark = 0;
+    }; // class double_ended_linear_allocator
+
+} // namespace tavros::core
@@ -0,0 +1,166 @@
+#include <tavros/core/memory/linear_allocator.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/debug/debug_break.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/math/bitops.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    tavros::core::logger logger("linear_allocator");
+}
+
+namespace tavros::core
+{
+
+    linear_allocator::linear_allocator(size_t capacity)
+        : m_capacity(capacity)
+    {
+        TAV_ASSERT(capacity > 0);
+        m_begin = static_cast<uint8*>(std::malloc(capacity));
+        if (!m_begin) {
+            ::logger.error("Failed to reserve {} bytes", capacity);
+            TAV_DEBUG_BREAK();
+            m_capacity = 0;
+        }
+    }
+
+    linear_allocator::~linear_allocator()
+    {
+        std::free(m_begin);
+    }
+
+    void* linear_allocator::allocate(size_t size, size_t align, const char* tag)
+    {
+        TAV_UNUSED(tag);
+
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to allocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        const auto base = reinterpret_cast<size_t>(m_begin);
+        const auto offset = math::align_up(base + m_top, align) - base;
+        if (offset > m_capacity || size > m_capacity - offset) {
+            return nullptr;
+        }
+
+        m_last_block = offset;
+        m_last_top = m_top;
+        m_top = offset + size;
+        m_high_water_mark = std::max(m_high_water_mark, m_top);
+        ++m_live;
+
+        return m_begin + offset;
+    }
+
+    void* linear_allocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
+    {
+        if (ptr == nullptr) {
+            return allocate(new_size, align, tag);
+        }
+
+        if (new_size == 0) {
+            deallocate(ptr);
+            return nullptr;
+        }
+
+        TAV_ASSERT(owns(ptr));
+        const auto offset = static_cast<size_t>(static_cast<uint8*>(ptr) - m_begin);
+
+        // The most recent block can be resized in place
+        if (offset == m_last_block && new_size <= m_capacity - offset) {
+            m_top = offset + new_size;
+            m_high_water_mark = std::max(m_high_water_mark, m_top);
+            return ptr;
+        }
+
+        void* new_ptr = allocate(new_size, align, tag);
+        if (!new_ptr) {
+            return nullptr;
+        }
+
+        // The old size is unknown, but everything up to the previous top belongs to the region
+        const auto old_size = m_last_top - offset;
+        std::memcpy(new_ptr, ptr, std::min(new_size, old_size));
+
+        TAV_ASSERT(m_live > 0);
+        --m_live;
+
+        return new_ptr;
+    }
+
+    void linear_allocator::deallocate(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+
+        TAV_ASSERT(owns(ptr));
+        TAV_ASSERT(m_live > 0);
+
+        if (--m_live == 0) {
+            clear();
+            return;
+        }
+
+        const auto offset = static_cast<size_t>(static_cast<uint8*>(ptr) - m_begin);
+        if (offset == m_last_block) {
+            m_top = m_last_top;
+            m_last_block = k_no_block;
+        }
+    }
+
+    void linear_allocator::clear()
+    {
+        m_top = 0;
+        m_last_block = k_no_block;
+        m_last_top = 0;
+        m_live = 0;
+    }
+
+    linear_allocator::marker linear_allocator::mark() const noexcept
+    {
+        return {m_top, m_live};
+    }
+
+    void linear_allocator::rewind(const marker& m) noexcept
+    {
+        TAV_ASSERT(m.top <= m_top);
+        if (m.live == 0) {
+            clear();
+            return;
+        }
+
+        m_top = m.top;
+        m_live = m.live;
+        m_last_block = k_no_block;
+    }
+
+    bool linear_allocator::owns(const void* ptr) const noexcept
+    {
+        auto* p = static_cast<const uint8*>(ptr);
+        return p >= m_begin && p < m_begin + m_capacity;
+    }
+
+    size_t linear_allocator::size() const noexcept
+    {
+        return m_top;
+    }
+
+    size_t linear_allocator::capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    size_t linear_allocator::high_water_mark() const noexcept
+    {
+        return m_high_water_mark;
+    }
+
+} // namespace tavros::core
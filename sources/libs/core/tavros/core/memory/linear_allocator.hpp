@@ -0,0 +1,121 @@
+#pragma once
+
+#include <tavros/core/memory/allocator.hpp>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Pointer-bump allocator over a single region reserved at construction.
+     *
+     * Allocation advances an offset inside the region, so it costs only an alignment
+     * round-up and a bounds check. Individual blocks are not tracked; memory is reclaimed
+     * in bulk with @ref rewind() or @ref clear(), both of which are O(1).
+     *
+     * @ref deallocate() follows stack discipline: freeing the most recent allocation pops it,
+     * and once every live allocation has been freed the allocator resets to its start.
+     * Out-of-order frees are legal but only reclaim memory when the allocator becomes empty.
+     *
+     * Allocated memory is not zeroed.
+     *
+     * @note The allocator is not thread-safe.
+     */
+    class linear_allocator final : public allocator
+    {
+    public:
+        /**
+         * @brief Position of the top and number of live blocks, returned by @ref mark().
+         */
+        struct marker
+        {
+            size_t top = 0;
+            size_t live = 0;
+        };
+
+    public:
+        /**
+         * @brief Reserves a region of @p capacity bytes.
+         *
+         * @param capacity Size of the region in bytes. Must be greater than zero.
+         */
+        explicit linear_allocator(size_t capacity);
+
+        ~linear_allocator() override;
+
+        /**
+         * @brief Bumps the top of the region by @p size bytes aligned to @p align.
+         *
+         * @return Pointer to the block, or nullptr if the region is exhausted.
+         */
+        void* allocate(size_t size, size_t align, const char* tag = nullptr) override;
+
+        /**
+         * @brief Resizes a block.
+         *
+         * The most recent allocation is grown or shrunk in place when the region allows it,
+         * otherwise a new block is bumped and the contents are copied.
+         */
+        void* reallocate(void* ptr, size_t new_size, size_t align, const char* tag = nullptr) override;
+
+        /**
+         * @brief Releases a block.
+         *
+         * Pops the block if it is the most recent allocation. When no live allocations
+         * remain the whole region is rewound to the start.
+         */
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Rewinds the region to the start in O(1).
+         */
+        void clear() override;
+
+        /**
+         * @brief Returns the current top of the region and the number of live blocks.
+         */
+        [[nodiscard]] marker mark() const noexcept;
+
+        /**
+         * @brief Releases everything allocated after @p m was taken.
+         *
+         * The live block count is restored to its value at @ref mark(), so blocks allocated
+         * before the marker can still be freed with @ref deallocate() and reset the allocator.
+         * Those blocks must not be freed between @ref mark() and @ref rewind().
+         *
+         * @param m Marker previously returned by @ref mark(). Must not be above the current top.
+         */
+        void rewind(const marker& m) noexcept;
+
+        /**
+         * @brief Returns @c true if @p ptr points into the reserved region.
+         */
+        [[nodiscard]] bool owns(const void* ptr) const noexcept;
+
+        /**
+         * @brief Returns the number of bytes in use, including alignment padding.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the size of the reserved region in bytes.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns the largest value @ref size() has reached since construction.
+         */
+        [[nodiscard]] size_t high_water_mark() const noexcept;
+
+    private:
+        static constexpr size_t k_no_block = static_cast<size_t>(-1);
+
+        uint8* m_begin = nullptr;
+        size_t m_capacity = 0;
+        size_t m_top = 0;
+        size_t m_last_block = k_no_block; // offset of the most recent block, if it can be popped
+        size_t m_last_top = 0;            // top before the most recent block was bumped
+        size_t m_live = 0;
+        size_t m_high_water_mark = 0;
+    }; // class linear_allocator
+
+} // namespace tavros::core
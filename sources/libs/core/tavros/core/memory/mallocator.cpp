@@ -1,14 +1,12 @@
 #include <tavros/core/memory/mallocator.hpp>
 
-#include <tavros/core/containers/unordered_map.hpp>
 #include <tavros/core/debug/assert.hpp>
 #include <tavros/core/debug/debug_break.hpp>
-#include <tavros/core/debug/unreachable.hpp>
 #include <tavros/core/logger/logger.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
-#include <malloc.h>
 
 #include <tavros/core/math/bitops.hpp>
 
@@ -16,17 +14,51 @@
 namespace
 {
     tavros::core::logger logger("mallocator");
-}
+
+    constexpr uint8 k_block_magic = 0xa5;
+
+    // Alignment guaranteed by std::malloc; larger alignments are served by over-allocation
+    constexpr size_t k_malloc_align = alignof(std::max_align_t);
+} // namespace
 
 namespace tavros::core
 {
 
-    mallocator::mallocator() = default;
+    struct alignas(16) mallocator::block_header
+    {
+        block_header* prev;
+        block_header* next;
+        size_t        size;       // requested size of the block
+        uint32        offset;     // distance from the malloc pointer to the user pointer
+        uint16        tag_id;     // index into m_tags
+        uint8         align_log2; // log2 of the requested alignment
+        uint8         magic;
+
+        uint8* raw() noexcept
+        {
+            return reinterpret_cast<uint8*>(this) + sizeof(block_header) - offset;
+        }
+
+        void* memptr() noexcept
+        {
+            return reinterpret_cast<uint8*>(this) + sizeof(block_header);
+        }
+
+        static block_header* from(void* ptr) noexcept
+        {
+            return reinterpret_cast<block_header*>(static_cast<uint8*>(ptr) - sizeof(block_header));
+        }
+    };
+
+    mallocator::mallocator()
+    {
+        static_assert(sizeof(block_header) == 32);
+    }
 
     mallocator::~mallocator()
     {
-        if (!m_allocations.empty()) {
-            ::logger.warning("Called an allocator destructor with active allocations {} - possible memory leak", m_allocations.size());
+        if (m_head) {
+            ::logger.warning("Called an allocator destructor with active allocations {} - possible memory leak", allocation_count());
         }
 
         clear();
@@ -40,25 +72,31 @@ namespace tavros::core
             return nullptr;
         }
 
-        void* ptr = _aligned_malloc(size, align);
+        const size_t padding = align > k_malloc_align ? align - 1 : 0;
+        auto*        raw = static_cast<uint8*>(std::malloc(sizeof(block_header) + padding + size));
 
-        if (!ptr) {
+        if (!raw) {
             ::logger.error("Failed to allocate {} bytes (align {}), tag: {}", size, align, (tag ? tag : "(not provided)"));
             TAV_DEBUG_BREAK();
             return nullptr;
         }
 
-        // Sometimes the allocator may allocate already released memory pointer
-        if (auto it = m_released.find(ptr); it != m_released.end()) {
-            // So just rease released info
-            m_released.erase(it);
+        auto* mem = raw + sizeof(block_header);
+        if (padding) {
+            mem = reinterpret_cast<uint8*>(math::align_up(reinterpret_cast<size_t>(mem), align));
         }
-        // And add to the allocations
-        m_allocations[ptr] = allocation_info{size, align, tag};
 
-        memset(ptr, 0, size);
+        auto* header = block_header::from(mem);
+        header->size = size;
+        header->offset = static_cast<uint32>(mem - raw);
+        header->tag_id = find_tag(tag);
+        header->align_log2 = static_cast<uint8>(math::count_trailing_zeros(align));
+        header->magic = k_block_magic;
 
-        return ptr;
+        link(header);
+        on_allocate(header->tag_id, size);
+
+        return mem;
     }
 
     void* mallocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
@@ -79,47 +117,45 @@ namespace tavros::core
             return nullptr;
         }
 
-        if (auto it = m_allocations.find(ptr); it == m_allocations.end()) {
-            ::logger.error("Attempt to reallocate an unknown pointer {}", fmt::ptr(ptr));
-            TAV_DEBUG_BREAK();
-            return nullptr;
+        auto* header = block_header::from(ptr);
+        TAV_ASSERT(header->magic == k_block_magic);
+        TAV_ASSERT((size_t{1} << header->align_log2) == align);
+
+        // Blocks with the natural malloc alignment keep a fixed header offset, so they can
+        // be resized by the CRT in place; over-aligned blocks are moved manually
+        if (align > k_malloc_align) {
+            void* new_ptr = allocate(new_size, align, tag ? tag : m_tags[header->tag_id].tag.load(std::memory_order_relaxed));
+            if (!new_ptr) {
+                return nullptr;
+            }
+            std::memcpy(new_ptr, ptr, std::min(new_size, header->size));
+            deallocate(ptr);
+            return new_ptr;
         }
 
-        void* new_ptr = _aligned_realloc(ptr, new_size, align);
-        if (!new_ptr) {
+        const auto old_size = header->size;
+        const auto old_tag_id = header->tag_id;
+
+        unlink(header);
+        auto* raw = static_cast<uint8*>(std::realloc(header->raw(), sizeof(block_header) + new_size));
+        if (!raw) {
+            link(header);
             ::logger.error("Failed to reallocate {} bytes (align {}), tag: {}", new_size, align, (tag ? tag : "(not provided)"));
             TAV_DEBUG_BREAK();
             return nullptr;
         }
 
-        // Update track data
-        if (new_ptr == ptr) {
-            // Just update old data
-            auto old_info = m_allocations[new_ptr];
-            m_allocations[new_ptr] = allocation_info{new_size, align, tag ? tag : old_info.tag};
-        } else {
-            // First of all check the released memory
-            // Sometimes the allocator may allocate already released memory pointer
-            if (auto it = m_released.find(new_ptr); it != m_released.end()) {
-                // So just rease released info
-                m_released.erase(it);
-            }
-
-            // And add new data
-            m_allocations[new_ptr] = allocation_info{new_size, align, tag};
-
-            // Migrate old data
-            if (auto it = m_allocations.find(ptr); it != m_allocations.end()) {
-                auto info = it->second;
-                m_allocations.erase(it);
-                m_released[ptr] = info;
-            } else {
-                // Something went wrong
-                TAV_UNREACHABLE();
-            }
+        header = reinterpret_cast<block_header*>(raw);
+        header->size = new_size;
+        if (tag) {
+            header->tag_id = find_tag(tag);
         }
+        link(header);
+
+        on_deallocate(old_tag_id, old_size);
+        on_allocate(header->tag_id, new_size);
 
-        return new_ptr;
+        return header->memptr();
     }
 
     void mallocator::deallocate(void* ptr)
@@ -128,27 +164,161 @@ namespace tavros::core
             return;
         }
 
-        if (auto it = m_allocations.find(ptr); it != m_allocations.end()) {
-            auto info = it->second;
-            m_allocations.erase(it);
-            m_released[ptr] = info;
-            _aligned_free(ptr);
-        } else if (auto it_released = m_released.find(ptr); it_released != m_released.end()) {
-            ::logger.error("Double free detected for pointer {}", fmt::ptr(ptr));
-            TAV_DEBUG_BREAK();
-        } else {
-            ::logger.error("Attempt to free an unknown pointer {}", fmt::ptr(ptr));
+        auto* header = block_header::from(ptr);
+        if (header->magic != k_block_magic) {
+            ::logger.error("Attempt to free an unknown or already freed pointer {}", fmt::ptr(ptr));
             TAV_DEBUG_BREAK();
+            return;
         }
+
+        header->magic = 0;
+        unlink(header);
+        on_deallocate(header->tag_id, header->size);
+        std::free(header->raw());
     }
 
     void mallocator::clear()
     {
-        for (auto& [ptr, info] : m_allocations) {
-            _aligned_free(ptr);
-            m_released[ptr] = info;
+        while (m_head) {
+            deallocate(m_head->memptr());
+        }
+    }
+
+    size_t mallocator::allocated_bytes() const noexcept
+    {
+        size_t     total = 0;
+        const auto n = m_tags_number.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            total += m_tags[i].allocated_bytes.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_t mallocator::allocation_count() const noexcept
+    {
+        size_t     total = 0;
+        const auto n = m_tags_number.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            total += m_tags[i].allocation_count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    mallocator::tag_stats mallocator::stats(const char* tag) const noexcept
+    {
+        const auto n = m_tags_number.load(std::memory_order_acquire);
+        size_t     id = 0;
+        if (tag) {
+            for (size_t i = 1; i < n; ++i) {
+                if (std::strcmp(m_tags[i].tag.load(std::memory_order_relaxed), tag) == 0) {
+                    id = i;
+                    break;
+                }
+            }
+            if (id == 0) {
+                return tag_stats{tag};
+            }
+        }
+
+        const auto& c = m_tags[id];
+        return {
+            c.tag.load(std::memory_order_relaxed),
+            c.allocated_bytes.load(std::memory_order_relaxed),
+            c.allocation_count.load(std::memory_order_relaxed),
+            c.peak_bytes.load(std::memory_order_relaxed),
+            c.total_allocations.load(std::memory_order_relaxed),
+        };
+    }
+
+    size_t mallocator::collect_stats(buffer_span<tag_stats> out) const noexcept
+    {
+        const auto n = std::min(m_tags_number.load(std::memory_order_acquire), out.size());
+        for (size_t i = 0; i < n; ++i) {
+            const auto& c = m_tags[i];
+            out[i] = {
+                c.tag.load(std::memory_order_relaxed),
+                c.allocated_bytes.load(std::memory_order_relaxed),
+                c.allocation_count.load(std::memory_order_relaxed),
+                c.peak_bytes.load(std::memory_order_relaxed),
+                c.total_allocations.load(std::memory_order_relaxed),
+            };
+        }
+        return n;
+    }
+
+    uint16 mallocator::find_tag(const char* tag) noexcept
+    {
+        if (!tag) {
+            return 0;
+        }
+
+        // Tags are almost always string literals and consecutive allocations tend to share one
+        if (tag == m_last_tag) {
+            return m_last_tag_id;
+        }
+
+        const auto n = m_tags_number.load(std::memory_order_relaxed);
+        size_t     id = 0;
+        for (size_t i = 1; i < n; ++i) {
+            const char* t = m_tags[i].tag.load(std::memory_order_relaxed);
+            if (t == tag || std::strcmp(t, tag) == 0) {
+                id = i;
+                break;
+            }
+        }
+
+        if (id == 0 && n < k_max_tags) {
+            id = n;
+            m_tags[id].tag.store(tag, std::memory_order_relaxed);
+            m_tags_number.store(n + 1, std::memory_order_release);
+        }
+
+        m_last_tag = tag;
+        m_last_tag_id = static_cast<uint16>(id);
+        return m_last_tag_id;
+    }
+
+    // Counters are only written by the allocating thread, so plain relaxed stores are
+    // enough and avoid locked read-modify-write instructions on the hot path
+    void mallocator::on_allocate(uint16 tag_id, size_t size) noexcept
+    {
+        auto&      c = m_tags[tag_id];
+        const auto bytes = c.allocated_bytes.load(std::memory_order_relaxed) + size;
+        c.allocated_bytes.store(bytes, std::memory_order_relaxed);
+        c.allocation_count.store(c.allocation_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        c.total_allocations.store(c.total_allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (bytes > c.peak_bytes.load(std::memory_order_relaxed)) {
+            c.peak_bytes.store(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    void mallocator::on_deallocate(uint16 tag_id, size_t size) noexcept
+    {
+        auto& c = m_tags[tag_id];
+        c.allocated_bytes.store(c.allocated_bytes.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+        c.allocation_count.store(c.allocation_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+
+    void mallocator::link(block_header* header) noexcept
+    {
+        header->prev = nullptr;
+        header->next = m_head;
+        if (m_head) {
+            m_head->prev = header;
+        }
+        m_head = header;
+    }
+
+    void mallocator::unlink(block_header* header) noexcept
+    {
+        if (header->prev) {
+            header->prev->next = header->next;
+        } else {
+            m_head = header->next;
+        }
+        if (header->next) {
+            header->next->prev = header->prev;
         }
-        m_allocations.clear();
     }
 
 } // namespace tavros::core
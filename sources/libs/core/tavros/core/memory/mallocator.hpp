@@ -1,28 +1,53 @@
 #pragma once
 
 #include <tavros/core/memory/allocator.hpp>
-#include <tavros/core/containers/unordered_map.hpp>
+#include <tavros/core/memory/buffer_span.hpp>
 #include <tavros/core/defines.hpp>
 
 namespace tavros::core
 {
 
     /**
-     * @brief A memory allocator implementation based on aligned heap allocation.
+     * @brief A general-purpose aligned heap allocator with lightweight per-tag statistics.
      *
-     * This allocator provides aligned dynamic memory management using
-     * platform-specific functions (`aligned_malloc`, `aligned_realloc`, and `aligned_free`).
-     * It ensures that allocated memory respects the specified alignment, which must be a power of two.
+     * Every block carries a small in-band header placed right before the returned pointer.
+     * The header stores the block size, alignment and tag id, and links the block into an
+     * intrusive list of live allocations so that @ref clear() can release everything at once.
+     * Allocation, reallocation and deallocation are O(1) and do not touch any hash map.
      *
-     * The allocator also includes optional debug checks that verify allocation
-     * and deallocation correctness, helping detect memory leaks or invalid frees
-     * during development.
+     * Allocations are grouped by their tag string. Each tag has its own atomic counters
+     * (live bytes, live blocks, peak bytes, total allocations), which can be queried from
+     * any thread while the allocator is in use.
      *
-     * This class serves as a general-purpose aligned allocator, suitable for
-     * systems that require explicit memory alignment (e.g., SIMD data, GPU resources, etc.).
+     * Memory returned by this allocator is not zeroed.
+     *
+     * Full pointer validation (leak reports, double-free and unknown-pointer detection)
+     * is not done here; compose a @ref tracking_allocator over this allocator when needed.
+     *
+     * @note Allocation functions are not thread-safe; statistics queries are.
      */
     class mallocator final : public allocator
     {
+    public:
+        /**
+         * @brief Maximum number of distinct tags with their own counters.
+         *
+         * Tag id 0 is shared by untagged allocations and by tags past this limit.
+         */
+        static constexpr size_t k_max_tags = 64;
+
+        /**
+         * @brief Snapshot of the counters of a single tag.
+         */
+        struct tag_stats
+        {
+            const char* tag = nullptr;         ///< Tag string, nullptr for untagged allocations.
+            size_t      allocated_bytes = 0;   ///< Bytes currently allocated.
+            size_t      allocation_count = 0;  ///< Blocks currently allocated.
+            size_t      peak_bytes = 0;        ///< Largest value allocated_bytes has reached.
+            size_t      total_allocations = 0; ///< Number of allocations since construction.
+        };
+
     public:
         mallocator();
 
@@ -36,18 +61,55 @@ namespace tavros::core
 
         void clear() override;
 
+        /**
+         * @brief Returns the number of bytes currently allocated over all tags.
+         */
+        [[nodiscard]] size_t allocated_bytes() const noexcept;
+
+        /**
+         * @brief Returns the number of blocks currently allocated over all tags.
+         */
+        [[nodiscard]] size_t allocation_count() const noexcept;
+
+        /**
+         * @brief Returns the counters of a single tag.
+         *
+         * @param tag Tag string, compared by content. nullptr selects untagged allocations.
+         */
+        [[nodiscard]] tag_stats stats(const char* tag) const noexcept;
+
+        /**
+         * @brief Copies the counters of every tag seen so far into @p out.
+         *
+         * @param out Destination span, filled from the front.
+         * @return The number of entries written.
+         */
+        size_t collect_stats(buffer_span<tag_stats> out) const noexcept;
+
     private:
-        // #if TAV_DEBUG
-        struct allocation_info
+        struct block_header;
+
+        struct tag_counters
         {
-            size_t      size;
-            size_t      align;
-            const char* tag;
+            std::atomic<const char*> tag = nullptr;
+            atomic_size_t            allocated_bytes = 0;
+            atomic_size_t            allocation_count = 0;
+            atomic_size_t            peak_bytes = 0;
+            atomic_size_t            total_allocations = 0;
         };
 
-        unordered_map<void*, allocation_info> m_allocations;
-        unordered_map<void*, allocation_info> m_released;
-        // #endif // TAV_DEBUG
+        uint16 find_tag(const char* tag) noexcept;
+        void   on_allocate(uint16 tag_id, size_t size) noexcept;
+        void   on_deallocate(uint16 tag_id, size_t size) noexcept;
+        void   link(block_header* header) noexcept;
+        void   unlink(block_header* header) noexcept;
+
+    private:
+        block_header* m_head = nullptr;
+        const char*   m_last_tag = nullptr;
+        uint16        m_last_tag_id = 0;
+        atomic_size_t m_tags_number = 1;
+        tag_counters  m_tags[k_max_tags];
     };
 
 } // namespace tavros::core
@@ -0,0 +1,677 @@
+#include <tavros/core/memory/thread_caching_allocator.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/debug/debug_break.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/math/bitops.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <new>
+
+namespace
+{
+    tavros::core::logger logger("thread_caching_allocator");
+
+    using namespace tavros::core;
+
+    constexpr uint8  k_large_class = 0xff;
+    constexpr size_t k_block_align = 16;
+    constexpr size_t k_data_align = 64;
+    constexpr size_t k_tls_slots = 4;
+
+    constexpr size_t class_index(size_t size) noexcept
+    {
+        if (size <= 128) {
+            return size ? (size - 1) / 16 : 0;
+        }
+        const auto p = 63 - static_cast<size_t>(std::countl_zero(static_cast<uint64>(size - 1)));
+        return 8 + (p - 7) * 4 + ((size - 1) >> (p - 2)) - 4;
+    }
+
+    constexpr size_t class_size(size_t cls) noexcept
+    {
+        if (cls < 8) {
+            return (cls + 1) * 16;
+        }
+        const auto k = cls - 8;
+        return ((k % 4) + 5) << (7 + k / 4 - 2);
+    }
+
+    static_assert(class_index(thread_caching_allocator::k_max_small_size) == thread_caching_allocator::k_size_classes - 1);
+    static_assert(class_size(thread_caching_allocator::k_size_classes - 1) == thread_caching_allocator::k_max_small_size);
+
+    // Number of blocks moved between a thread cache and the central pool at once
+    constexpr size_t batch_size(size_t cls) noexcept
+    {
+        return std::clamp<size_t>(16_kib / class_size(cls), 4, 64);
+    }
+
+    // Ids are never reused, so a thread-local slot of a destroyed allocator can not be
+    // mistaken for a new allocator created at the same address
+    atomic_uint64 g_next_id = 1;
+
+    struct alive_registry
+    {
+        std::mutex     mutex;
+        vector<uint64> ids;
+    };
+
+    alive_registry& alive()
+    {
+        static alive_registry registry;
+        return registry;
+    }
+
+    struct tls_slot
+    {
+        uint64 id = 0;
+        void*  owner = nullptr;
+        void*  cache = nullptr;
+        void (*release)(void*, void*) = nullptr;
+    };
+
+    struct tls_caches
+    {
+        tls_slot slots[k_tls_slots];
+        size_t   next_victim = 0;
+
+        ~tls_caches()
+        {
+            auto&                        reg = alive();
+            std::scoped_lock<std::mutex> lock(reg.mutex);
+            for (auto& slot : slots) {
+                if (slot.id && std::find(reg.ids.begin(), reg.ids.end(), slot.id) != reg.ids.end()) {
+                    slot.release(slot.owner, slot.cache);
+                }
+                slot = tls_slot{};
+            }
+        }
+    };
+
+    thread_local tls_caches t_caches;
+} // namespace
+
+namespace tavros::core
+{
+
+    struct thread_caching_allocator::span
+    {
+        span*  prev;
+        span*  next;
+        void*  owner;       // allocator the span belongs to
+        size_t bytes;       // bytes obtained from the system
+        size_t block_size;  // size of a block, or the requested size for a dedicated span
+        uint8* data;        // first block
+        uint32 block_count; // number of blocks, 1 for a dedicated span
+        uint8  size_class;  // size class, or k_large_class for a dedicated span
+        uint8  large_tag;   // tag id of a dedicated span
+
+        // Tag ids of the blocks follow the header
+        uint8* tags() noexcept
+        {
+            return reinterpret_cast<uint8*>(this + 1);
+        }
+
+        static span* from(void* ptr) noexcept
+        {
+            return reinterpret_cast<span*>(reinterpret_cast<size_t>(ptr) & ~(k_span_size - 1));
+        }
+    };
+
+    struct thread_caching_allocator::thread_cache
+    {
+        struct bin
+        {
+            free_block* head = nullptr;
+            size_t      count = 0;
+        };
+
+        // Written only by the owning thread, read by stats queries from any thread
+        struct tag_counters
+        {
+            atomic_size_t allocated_bytes = 0;
+            atomic_size_t allocation_count = 0;
+            atomic_size_t total_allocations = 0;
+        };
+
+        bin          bins[k_size_classes];
+        const char*  last_tag = nullptr;
+        uint8        last_tag_id = 0;
+        tag_counters counters[k_max_tags];
+
+        void on_allocate(uint8 tag_id, size_t size) noexcept
+        {
+            auto& c = counters[tag_id];
+            c.allocated_bytes.store(c.allocated_bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+            c.allocation_count.store(c.allocation_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            c.total_allocations.store(c.total_allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        // The block may have been allocated by another thread, so the counters of this
+        // cache can wrap below zero; only the sum over all caches is meaningful
+        void on_deallocate(uint8 tag_id, size_t size) noexcept
+        {
+            auto& c = counters[tag_id];
+            c.allocated_bytes.store(c.allocated_bytes.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+            c.allocation_count.store(c.allocation_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        }
+    };
+
+    thread_caching_allocator::thread_caching_allocator()
+        : m_id(g_next_id.fetch_add(1, std::memory_order_relaxed))
+    {
+        auto&                        reg = alive();
+        std::scoped_lock<std::mutex> lock(reg.mutex);
+        reg.ids.push_back(m_id);
+    }
+
+    thread_caching_allocator::~thread_caching_allocator()
+    {
+        {
+            // After this no exiting thread will touch the caches of this allocator
+            auto&                        reg = alive();
+            std::scoped_lock<std::mutex> lock(reg.mutex);
+            reg.ids.erase(std::find(reg.ids.begin(), reg.ids.end(), m_id));
+        }
+
+        if (auto n = allocation_count()) {
+            ::logger.warning("Called an allocator destructor with active allocations {} - possible memory leak", n);
+        }
+
+        clear();
+
+        // Thread-local slots still referring to this allocator are ignored from now on,
+        // because its id is no longer registered
+        for (auto* cache : m_caches) {
+            delete cache;
+        }
+    }
+
+    void* thread_caching_allocator::allocate(size_t size, size_t align, const char* tag)
+    {
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to allocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        auto* cache = local_cache();
+        if (!cache) {
+            return nullptr;
+        }
+
+        const auto tag_id = find_tag(cache, tag);
+
+        if (size > k_max_small_size || align > k_data_align) {
+            return allocate_large(cache, size, align, tag_id);
+        }
+
+        auto cls = class_index(size);
+        if (align > k_block_align) {
+            // Blocks of a class are aligned to the largest power of two dividing the class size
+            while (cls < k_size_classes && class_size(cls) % align != 0) {
+                ++cls;
+            }
+            if (cls == k_size_classes) {
+                return allocate_large(cache, size, align, tag_id);
+            }
+        }
+
+        auto& bin = cache->bins[cls];
+        if (!bin.head) {
+            refill(cache, cls);
+            if (!bin.head) {
+                ::logger.error("Failed to allocate {} bytes (align {}), tag: {}", size, align, (tag ? tag : "(not provided)"));
+                TAV_DEBUG_BREAK();
+                return nullptr;
+            }
+        }
+
+        auto* block = bin.head;
+        bin.head = block->next;
+        --bin.count;
+
+        auto*      s = span::from(block);
+        const auto index = static_cast<size_t>(reinterpret_cast<uint8*>(block) - s->data) / s->block_size;
+        s->tags()[index] = tag_id;
+        cache->on_allocate(tag_id, s->block_size);
+
+        return block;
+    }
+
+    void* thread_caching_allocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
+    {
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to reallocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        // handle realloc semantics explicitly
+        if (ptr == nullptr) {
+            return allocate(new_size, align, tag);
+        }
+
+        if (new_size == 0) {
+            deallocate(ptr);
+            return nullptr;
+        }
+
+        auto* s = span::from(ptr);
+        TAV_ASSERT(s->owner == this);
+
+        auto* cache = local_cache();
+        if (!cache) {
+            return nullptr;
+        }
+
+        uint8 old_tag_id = s->large_tag;
+        if (s->size_class != k_large_class) {
+            const auto index = static_cast<size_t>(static_cast<uint8*>(ptr) - s->data) / s->block_size;
+            old_tag_id = s->tags()[index];
+
+            // The block already has room for the new size
+            if (new_size <= s->block_size && (!tag || find_tag(cache, tag) == old_tag_id)) {
+                return ptr;
+            }
+        }
+
+        const auto old_size = s->block_size;
+        if (!tag) {
+            tag = m_tags[old_tag_id].load(std::memory_order_relaxed);
+        }
+
+        void* new_ptr = allocate(new_size, align, tag);
+        if (!new_ptr) {
+            return nullptr;
+        }
+        std::memcpy(new_ptr, ptr, std::min(new_size, old_size));
+        deallocate(ptr);
+        return new_ptr;
+    }
+
+    void thread_caching_allocator::deallocate(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+
+        auto* s = span::from(ptr);
+        if (s->owner != this) {
+            ::logger.error("Attempt to free a pointer {} not owned by this allocator", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+            return;
+        }
+
+        auto* cache = local_cache();
+        if (!cache) {
+            return;
+        }
+
+        if (s->size_class == k_large_class) {
+            deallocate_large(cache, s);
+            return;
+        }
+
+        const auto cls = s->size_class;
+        const auto index = static_cast<size_t>(static_cast<uint8*>(ptr) - s->data) / s->block_size;
+        cache->on_deallocate(s->tags()[index], s->block_size);
+
+        auto& bin = cache->bins[cls];
+        auto* block = static_cast<free_block*>(ptr);
+        block->next = bin.head;
+        bin.head = block;
+        ++bin.count;
+
+        if (bin.count > 2 * batch_size(cls)) {
+            flush(cache, cls, batch_size(cls));
+        }
+    }
+
+    void thread_caching_allocator::clear()
+    {
+        {
+            std::scoped_lock<std::mutex> lock(m_caches_mutex);
+            for (auto* cache : m_caches) {
+                for (auto& bin : cache->bins) {
+                    bin = {};
+                }
+                for (auto& c : cache->counters) {
+                    c.allocated_bytes.store(0, std::memory_order_relaxed);
+                    c.allocation_count.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        for (auto& central : m_central) {
+            std::scoped_lock<std::mutex> lock(central.mutex);
+            central.head = nullptr;
+            central.count = 0;
+        }
+
+        std::scoped_lock<std::mutex> lock(m_spans_mutex);
+        while (m_spans) {
+            auto* s = m_spans;
+            m_spans = s->next;
+            m_reserved_bytes.fetch_sub(s->bytes, std::memory_order_relaxed);
+            ::operator delete(s, std::align_val_t{k_span_size});
+        }
+    }
+
+    size_t thread_caching_allocator::allocated_bytes() const noexcept
+    {
+        size_t     total = 0;
+        const auto n = m_tags_number.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            total += gather(i).allocated_bytes;
+        }
+        return total;
+    }
+
+    size_t thread_caching_allocator::allocation_count() const noexcept
+    {
+        size_t     total = 0;
+        const auto n = m_tags_number.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            total += gather(i).allocation_count;
+        }
+        return total;
+    }
+
+    size_t thread_caching_allocator::reserved_bytes() const noexcept
+    {
+        return m_reserved_bytes.load(std::memory_order_relaxed);
+    }
+
+    thread_caching_allocator::tag_stats thread_caching_allocator::stats(const char* tag) const noexcept
+    {
+        if (!tag) {
+            return gather(0);
+        }
+
+        const auto n = m_tags_number.load(std::memory_order_acquire);
+        for (size_t i = 1; i < n; ++i) {
+            if (std::strcmp(m_tags[i].load(std::memory_order_relaxed), tag) == 0) {
+                return gather(i);
+            }
+        }
+        return tag_stats{tag};
+    }
+
+    size_t thread_caching_allocator::collect_stats(buffer_span<tag_stats> out) const noexcept
+    {
+        const auto n = std::min(m_tags_number.load(std::memory_order_acquire), out.size());
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = gather(i);
+        }
+        return n;
+    }
+
+    size_t thread_caching_allocator::size_class_size(size_t size) noexcept
+    {
+        return size <= k_max_small_size ? class_size(class_index(size)) : 0;
+    }
+
+    thread_caching_allocator::thread_cache* thread_caching_allocator::local_cache()
+    {
+        auto& slots = t_caches.slots;
+        for (auto& slot : slots) {
+            if (slot.id == m_id) {
+                return static_cast<thread_cache*>(slot.cache);
+            }
+        }
+
+        auto* cache = acquire_cache();
+        if (!cache) {
+            return nullptr;
+        }
+
+        // Take a free slot, or hand the cache in the oldest slot back to its allocator
+        tls_slot* slot = std::find_if(std::begin(slots), std::end(slots), [](const tls_slot& s) { return s.id == 0; });
+        if (slot == std::end(slots)) {
+            slot = &slots[t_caches.next_victim];
+            t_caches.next_victim = (t_caches.next_victim + 1) % k_tls_slots;
+
+            auto&                        reg = alive();
+            std::scoped_lock<std::mutex> lock(reg.mutex);
+            if (std::find(reg.ids.begin(), reg.ids.end(), slot->id) != reg.ids.end()) {
+                slot->release(slot->owner, slot->cache);
+            }
+        }
+
+        *slot = tls_slot{m_id, this, cache, &thread_caching_allocator::release_cache};
+        return cache;
+    }
+
+    thread_caching_allocator::thread_cache* thread_caching_allocator::acquire_cache()
+    {
+        std::scoped_lock<std::mutex> lock(m_caches_mutex);
+        if (!m_free_caches.empty()) {
+            auto* cache = m_free_caches.back();
+            m_free_caches.pop_back();
+            return cache;
+        }
+
+        auto* cache = new (std::nothrow) thread_cache();
+        if (!cache) {
+            ::logger.error("Failed to allocate a thread cache");
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+        m_caches.push_back(cache);
+        return cache;
+    }
+
+    void thread_caching_allocator::release_cache(void* owner, void* cache)
+    {
+        auto* self = static_cast<thread_caching_allocator*>(owner);
+        auto* c = static_cast<thread_cache*>(cache);
+
+        for (size_t cls = 0; cls < k_size_classes; ++cls) {
+            self->flush(c, cls, c->bins[cls].count);
+        }
+        c->last_tag = nullptr;
+        c->last_tag_id = 0;
+
+        // The counters are kept, they still take part in the sums
+        std::scoped_lock<std::mutex> lock(self->m_caches_mutex);
+        self->m_free_caches.push_back(c);
+    }
+
+    uint8 thread_caching_allocator::find_tag(thread_cache* cache, const char* tag)
+    {
+        if (!tag) {
+            return 0;
+        }
+
+        // Tags are almost always string literals and consecutive allocations tend to share one
+        if (tag == cache->last_tag) {
+            return cache->last_tag_id;
+        }
+
+        auto lookup = [&](size_t n) -> size_t {
+            for (size_t i = 1; i < n; ++i) {
+                const char* t = m_tags[i].load(std::memory_order_relaxed);
+                if (t == tag || std::strcmp(t, tag) == 0) {
+                    return i;
+                }
+            }
+            return 0;
+        };
+
+        auto id = lookup(m_tags_number.load(std::memory_order_acquire));
+        if (id == 0) {
+            std::scoped_lock<std::mutex> lock(m_tags_mutex);
+            const auto                   n = m_tags_number.load(std::memory_order_relaxed);
+            id = lookup(n);
+            if (id == 0 && n < k_max_tags) {
+                id = n;
+                m_tags[id].store(tag, std::memory_order_relaxed);
+                m_tags_number.store(n + 1, std::memory_order_release);
+            }
+        }
+
+        cache->last_tag = tag;
+        cache->last_tag_id = static_cast<uint8>(id);
+        return cache->last_tag_id;
+    }
+
+    void thread_caching_allocator::refill(thread_cache* cache, size_t cls)
+    {
+        auto&      bin = cache->bins[cls];
+        auto&      central = m_central[cls];
+        const auto batch = batch_size(cls);
+
+        std::scoped_lock<std::mutex> lock(central.mutex);
+
+        if (!central.head) {
+            auto* s = allocate_span(0, 0);
+            if (!s) {
+                return;
+            }
+
+            s->size_class = static_cast<uint8>(cls);
+            s->block_size = class_size(cls);
+            s->block_count = static_cast<uint32>((k_span_size - sizeof(span) - k_data_align) / (s->block_size + 1));
+            s->data = reinterpret_cast<uint8*>(s) + math::align_up(sizeof(span) + s->block_count, k_data_align);
+            TAV_ASSERT(s->data + s->block_count * s->block_size <= reinterpret_cast<uint8*>(s) + k_span_size);
+
+            // Thread the blocks in address order
+            for (size_t i = s->block_count; i-- > 0;) {
+                auto* block = reinterpret_cast<free_block*>(s->data + i * s->block_size);
+                block->next = central.head;
+                central.head = block;
+            }
+            central.count += s->block_count;
+        }
+
+        for (size_t i = 0; i < batch && central.head; ++i) {
+            auto* block = central.head;
+            central.head = block->next;
+            block->next = bin.head;
+            bin.head = block;
+        }
+
+        const auto moved = std::min(batch, central.count);
+        central.count -= moved;
+        bin.count += moved;
+    }
+
+    void thread_caching_allocator::flush(thread_cache* cache, size_t cls, size_t n)
+    {
+        auto& bin = cache->bins[cls];
+        n = std::min(n, bin.count);
+        if (n == 0) {
+            return;
+        }
+
+        // Detach a chain of n blocks outside of the lock, then splice it in one step
+        auto* first = bin.head;
+        auto* last = first;
+        for (size_t i = 1; i < n; ++i) {
+            last = last->next;
+        }
+        bin.head = last->next;
+        bin.count -= n;
+
+        auto&                        central = m_central[cls];
+        std::scoped_lock<std::mutex> lock(central.mutex);
+        last->next = central.head;
+        central.head = first;
+        central.count += n;
+    }
+
+    thread_caching_allocator::span* thread_caching_allocator::allocate_span(size_t size, size_t align)
+    {
+        const auto header = math::align_up(sizeof(span), std::max(align, k_data_align));
+        const auto bytes = size ? header + size : k_span_size;
+
+        auto* mem = ::operator new(bytes, std::align_val_t{k_span_size}, std::nothrow);
+        if (!mem) {
+            return nullptr;
+        }
+
+        auto* s = static_cast<span*>(mem);
+        s->owner = this;
+        s->bytes = bytes;
+        s->block_size = size;
+        s->data = static_cast<uint8*>(mem) + header;
+        s->block_count = 1;
+        s->size_class = k_large_class;
+        s->large_tag = 0;
+
+        std::scoped_lock<std::mutex> lock(m_spans_mutex);
+        s->prev = nullptr;
+        s->next = m_spans;
+        if (m_spans) {
+            m_spans->prev = s;
+        }
+        m_spans = s;
+        m_reserved_bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        return s;
+    }
+
+    void thread_caching_allocator::free_span(span* s)
+    {
+        {
+            std::scoped_lock<std::mutex> lock(m_spans_mutex);
+            if (s->prev) {
+                s->prev->next = s->next;
+            } else {
+                m_spans = s->next;
+            }
+            if (s->next) {
+                s->next->prev = s->prev;
+            }
+            m_reserved_bytes.fetch_sub(s->bytes, std::memory_order_relaxed);
+        }
+
+        s->owner = nullptr;
+        ::operator delete(s, std::align_val_t{k_span_size});
+    }
+
+    void* thread_caching_allocator::allocate_large(thread_cache* cache, size_t size, size_t align, uint8 tag_id)
+    {
+        // The header must stay inside the first span-sized window to be found by masking
+        if (align >= k_span_size) {
+            ::logger.error("Alignment {} is not supported; must be less than {}", align, k_span_size);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        auto* s = allocate_span(std::max<size_t>(size, 1), align);
+        if (!s) {
+            ::logger.error("Failed to allocate {} bytes (align {})", size, align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        s->large_tag = tag_id;
+        cache->on_allocate(tag_id, s->block_size);
+        return s->data;
+    }
+
+    void thread_caching_allocator::deallocate_large(thread_cache* cache, span* s)
+    {
+        cache->on_deallocate(s->large_tag, s->block_size);
+        free_span(s);
+    }
+
+    thread_caching_allocator::tag_stats thread_caching_allocator::gather(size_t tag_id) const noexcept
+    {
+        tag_stats result{m_tags[tag_id].load(std::memory_order_relaxed)};
+
+        std::scoped_lock<std::mutex> lock(m_caches_mutex);
+        for (const auto* cache : m_caches) {
+            const auto& c = cache->counters[tag_id];
+            result.allocated_bytes += c.allocated_bytes.load(std::memory_order_relaxed);
+            result.allocation_count += c.allocation_count.load(std::memory_order_relaxed);
+            result.total_allocations += c.total_allocations.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+} // namespace tavros::core
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <tavros/core/memory/allocator.hpp>
+#include <tavros/core/memory/buffer_span.hpp>
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/defines.hpp>
+
+#include <mutex>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief A thread-safe size-class allocator with per-thread caches.
+     *
+     * Small requests are rounded up to one of @ref k_size_classes size classes and served
+     * from blocks carved out of 64 KiB spans. Every thread that uses the allocator gets its
+     * own cache of free blocks per size class, so the common allocate/deallocate path takes
+     * no lock and executes no atomic read-modify-write instruction.
+     *
+     * A block may be freed by any thread, not only by the one that allocated it: the block
+     * simply goes into the cache of the freeing thread. Caches exchange blocks with a central
+     * pool in batches - a cache that runs empty takes a batch from the pool, and a cache that
+     * grows past its limit gives a batch back. Caches of exited threads are flushed to the
+     * central pool and reused by new threads.
+     *
+     * Requests larger than @ref k_max_small_size, or aligned to more than 64 bytes, get a
+     * dedicated span each.
+     *
+     * Allocations are grouped by their tag string. Statistics are kept per tag and can be
+     * queried from any thread; small allocations are accounted with their size-class size.
+     *
+     * Memory returned by this allocator is not zeroed. Spans are returned to the system only
+     * by @ref clear() and by the destructor.
+     *
+     * @note @ref clear() and the destructor must not race with other calls to the allocator.
+     */
+    class thread_caching_allocator final : public allocator
+    {
+    public:
+        /**
+         * @brief Size and alignment of a span.
+         */
+        static constexpr size_t k_span_size = 64_kib;
+
+        /**
+         * @brief Largest request served by the size classes.
+         */
+        static constexpr size_t k_max_small_size = 8_kib;
+
+        /**
+         * @brief Number of size classes (16 to 128 bytes in 16-byte steps, then four classes per doubling).
+         */
+        static constexpr size_t k_size_classes = 32;
+
+        /**
+         * @brief Maximum number of distinct tags with their own counters.
+         *
+         * Tag id 0 is shared by untagged allocations and by tags past this limit.
+         */
+        static constexpr size_t k_max_tags = 64;
+
+        /**
+         * @brief Snapshot of the counters of a single tag, summed over all threads.
+         */
+        struct tag_stats
+        {
+            const char* tag = nullptr;         ///< Tag string, nullptr for untagged allocations.
+            size_t      allocated_bytes = 0;   ///< Bytes currently allocated.
+            size_t      allocation_count = 0;  ///< Blocks currently allocated.
+            size_t      total_allocations = 0; ///< Number of allocations since construction.
+        };
+
+    public:
+        thread_caching_allocator();
+
+        ~thread_caching_allocator() override;
+
+        void* allocate(size_t size, size_t align, const char* tag = nullptr) override;
+
+        void* reallocate(void* ptr, size_t new_size, size_t align, const char* tag = nullptr) override;
+
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Releases every allocation and returns all spans to the system.
+         */
+        void clear() override;
+
+        /**
+         * @brief Returns the number of bytes currently allocated over all tags.
+         */
+        [[nodiscard]] size_t allocated_bytes() const noexcept;
+
+        /**
+         * @brief Returns the number of blocks currently allocated over all tags.
+         */
+        [[nodiscard]] size_t allocation_count() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes obtained from the system for spans.
+         */
+        [[nodiscard]] size_t reserved_bytes() const noexcept;
+
+        /**
+         * @brief Returns the counters of a single tag.
+         *
+         * @param tag Tag string, compared by content. nullptr selects untagged allocations.
+         */
+        [[nodiscard]] tag_stats stats(const char* tag) const noexcept;
+
+        /**
+         * @brief Copies the counters of every tag seen so far into @p out.
+         *
+         * @param out Destination span, filled from the front.
+         * @return The number of entries written.
+         */
+        size_t collect_stats(buffer_span<tag_stats> out) const noexcept;
+
+        /**
+         * @brief Returns the size of the size class that serves @p size bytes.
+         *
+         * @return The class size, or 0 if @p size is served by a dedicated span.
+         */
+        [[nodiscard]] static size_t size_class_size(size_t size) noexcept;
+
+    private:
+        struct span;
+        struct thread_cache;
+
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        struct central_list
+        {
+            std::mutex  mutex;
+            free_block* head = nullptr;
+            size_t      count = 0;
+        };
+
+        thread_cache* local_cache();
+        thread_cache* acquire_cache();
+        static void   release_cache(void* owner, void* cache);
+
+        uint8 find_tag(thread_cache* cache, const char* tag);
+        void  refill(thread_cache* cache, size_t cls);
+        void  flush(thread_cache* cache, size_t cls, size_t n);
+        span* allocate_span(size_t size, size_t align);
+        void  free_span(span* s);
+
+        void* allocate_large(thread_cache* cache, size_t size, size_t align, uint8 tag_id);
+        void  deallocate_large(thread_cache* cache, span* s);
+
+        tag_stats gather(size_t tag_id) const noexcept;
+
+    private:
+        uint64 m_id;
+
+        central_list m_central[k_size_classes];
+
+        mutable std::mutex    m_caches_mutex;
+        vector<thread_cache*> m_caches;
+        vector<thread_cache*> m_free_caches;
+
+        mutable std::mutex m_spans_mutex;
+        span*              m_spans = nullptr;
+        atomic_size_t      m_reserved_bytes = 0;
+
+        std::mutex                m_tags_mutex;
+        std::atomic<const char*>  m_tags[k_max_tags] = {};
+        atomic_size_t             m_tags_number = 1;
+    };
+
+} // namespace tavros::core
@@ -0,0 +1,162 @@
+#include <tavros/core/memory/tracking_allocator.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/debug/debug_break.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+namespace
+{
+    tavros::core::logger logger("tracking_allocator");
+}
+
+namespace tavros::core
+{
+
+    tracking_allocator::tracking_allocator(allocator& upstream, size_t released_history)
+        : m_upstream(&upstream)
+    {
+        TAV_ASSERT(released_history > 0);
+        m_released_history.resize(released_history, nullptr);
+        m_released.reserve(released_history);
+    }
+
+    tracking_allocator::~tracking_allocator()
+    {
+        if (!m_allocations.empty()) {
+            ::logger.warning("Called an allocator destructor with active allocations {} - possible memory leak", m_allocations.size());
+            report_leaks();
+        }
+
+        clear();
+    }
+
+    void* tracking_allocator::allocate(size_t size, size_t align, const char* tag)
+    {
+        void* ptr = m_upstream->allocate(size, align, tag);
+        if (!ptr) {
+            return nullptr;
+        }
+
+        // Sometimes the allocator may allocate already released memory pointer
+        forget_released(ptr);
+
+        m_allocations[ptr] = allocation_info{size, align, tag};
+        m_allocated_bytes += size;
+
+        return ptr;
+    }
+
+    void* tracking_allocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
+    {
+        if (ptr == nullptr) {
+            return allocate(new_size, align, tag);
+        }
+
+        if (new_size == 0) {
+            deallocate(ptr);
+            return nullptr;
+        }
+
+        auto it = m_allocations.find(ptr);
+        if (it == m_allocations.end()) {
+            ::logger.error("Attempt to reallocate an unknown pointer {}", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
+
+        if (it->second.align != align) {
+            ::logger.error("Reallocation of {} with alignment {} differs from the original {}", fmt::ptr(ptr), align, it->second.align);
+            TAV_DEBUG_BREAK();
+        }
+
+        void* new_ptr = m_upstream->reallocate(ptr, new_size, align, tag);
+        if (!new_ptr) {
+            return nullptr;
+        }
+
+        auto info = it->second;
+        m_allocations.erase(it);
+        m_allocated_bytes -= info.size;
+
+        if (new_ptr != ptr) {
+            remember_released(ptr);
+            forget_released(new_ptr);
+        }
+
+        m_allocations[new_ptr] = allocation_info{new_size, align, tag ? tag : info.tag};
+        m_allocated_bytes += new_size;
+
+        return new_ptr;
+    }
+
+    void tracking_allocator::deallocate(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+
+        if (auto it = m_allocations.find(ptr); it != m_allocations.end()) {
+            m_allocated_bytes -= it->second.size;
+            m_allocations.erase(it);
+            remember_released(ptr);
+            m_upstream->deallocate(ptr);
+        } else if (m_released.contains(ptr)) {
+            ::logger.error("Double free detected for pointer {}", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+        } else {
+            ::logger.error("Attempt to free an unknown pointer {}", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+        }
+    }
+
+    void tracking_allocator::clear()
+    {
+        for (auto& [ptr, info] : m_allocations) {
+            m_upstream->deallocate(ptr);
+            remember_released(ptr);
+        }
+        m_allocations.clear();
+        m_allocated_bytes = 0;
+    }
+
+    size_t tracking_allocator::allocation_count() const noexcept
+    {
+        return m_allocations.size();
+    }
+
+    size_t tracking_allocator::allocated_bytes() const noexcept
+    {
+        return m_allocated_bytes;
+    }
+
+    bool tracking_allocator::contains(const void* ptr) const noexcept
+    {
+        return m_allocations.contains(const_cast<void*>(ptr));
+    }
+
+    void tracking_allocator::report_leaks() const
+    {
+        for (const auto& [ptr, info] : m_allocations) {
+            ::logger.warning("Leaked {} bytes (align {}) at {}, tag: {}", info.size, info.align, fmt::ptr(ptr), (info.tag ? info.tag : "(not provided)"));
+        }
+    }
+
+    void tracking_allocator::remember_released(void* ptr)
+    {
+        // Evict the oldest entry of the ring so the history stays bounded
+        if (void* oldest = m_released_history[m_released_pos]) {
+            m_released.erase(oldest);
+        }
+
+        m_released_history[m_released_pos] = ptr;
+        m_released.insert(ptr);
+        m_released_pos = (m_released_pos + 1) % m_released_history.size();
+    }
+
+    void tracking_allocator::forget_released(void* ptr)
+    {
+        // The ring slot keeps the stale pointer; it only costs a no-op erase when evicted
+        m_released.erase(ptr);
+    }
+
+} // namespace tavros::core
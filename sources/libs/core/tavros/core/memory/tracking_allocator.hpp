@@ -0,0 +1,96 @@
+#pragma once
+
+#include <tavros/core/memory/allocator.hpp>
+#include <tavros/core/containers/flat_hash_map.hpp>
+#include <tavros/core/containers/flat_hash_set.hpp>
+#include <tavros/core/containers/vector.hpp>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Debug decorator that validates every pointer passed through another allocator.
+     *
+     * Forwards all requests to an upstream allocator and keeps a record of every live
+     * allocation (size, alignment and tag). This makes it possible to:
+     * - report leaks when the decorator is destroyed,
+     * - detect double frees and frees of unknown pointers before they reach the upstream,
+     * - inspect live allocations at any time.
+     *
+     * Freed pointers are remembered in a bounded history so that double frees can be told
+     * apart from unknown pointers without the history growing over the program lifetime.
+     *
+     * The bookkeeping costs a hash-map update per call, so the decorator is meant for debug
+     * builds and for hunting memory bugs; the upstream allocator is used unchanged otherwise.
+     *
+     * @note The decorator does not own the upstream allocator, which must outlive it.
+     * @note The decorator is not thread-safe.
+     */
+    class tracking_allocator final : public allocator
+    {
+    public:
+        /**
+         * @brief Default number of freed pointers remembered for double-free detection.
+         */
+        static constexpr size_t k_default_released_history = 4096;
+
+    public:
+        /**
+         * @brief Wraps @p upstream.
+         *
+         * @param upstream Allocator that actually serves the memory.
+         * @param released_history Number of recently freed pointers to remember.
+         */
+        explicit tracking_allocator(allocator& upstream, size_t released_history = k_default_released_history);
+
+        ~tracking_allocator() override;
+
+        void* allocate(size_t size, size_t align, const char* tag = nullptr) override;
+
+        void* reallocate(void* ptr, size_t new_size, size_t align, const char* tag = nullptr) override;
+
+        void deallocate(void* ptr) override;
+
+        void clear() override;
+
+        /**
+         * @brief Returns the number of live allocations.
+         */
+        [[nodiscard]] size_t allocation_count() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes in live allocations.
+         */
+        [[nodiscard]] size_t allocated_bytes() const noexcept;
+
+        /**
+         * @brief Returns @c true if @p ptr is a live allocation made through this decorator.
+         */
+        [[nodiscard]] bool contains(const void* ptr) const noexcept;
+
+        /**
+         * @brief Logs every live allocation with its size and tag.
+         */
+        void report_leaks() const;
+
+    private:
+        struct allocation_info
+        {
+            size_t      size;
+            size_t      align;
+            const char* tag;
+        };
+
+        void remember_released(void* ptr);
+        void forget_released(void* ptr);
+
+    private:
+        allocator*                            m_upstream;
+        flat_hash_map<void*, allocation_info> m_allocations;
+        flat_hash_set<void*>                  m_released;
+        vector<void*>                         m_released_history;
+        size_t                                m_released_pos = 0;
+        size_t                                m_allocated_bytes = 0;
+    };
+
+} // namespace tavros::core
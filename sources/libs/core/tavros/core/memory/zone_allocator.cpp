@@ -1,269 +1,495 @@
 #include <tavros/core/memory/zone_allocator.hpp>
 
-#include <tavros/core/containers/unordered_map.hpp>
 #include <tavros/core/debug/assert.hpp>
-#include <tavros/core/debug/unreachable.hpp>
+#include <tavros/core/debug/debug_break.hpp>
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/math/bitops.hpp>
 
+#include <algorithm>
 #include <new>
 #include <cstdlib>
 #include <cstring>
 
-using namespace tavros::core;
-
 namespace
 {
-    struct alignas(32) zone_chunk
+    tavros::core::logger logger("zone_allocator");
+
+    // Two-level segregated fit: the first level splits sizes by powers of two, the second
+    // splits every power-of-two range into k_sl_count linear steps
+    constexpr size_t k_align_log2 = 5;
+    constexpr size_t k_align = size_t{1} << k_align_log2;
+    constexpr size_t k_sl_log2 = 5;
+    constexpr size_t k_sl_count = size_t{1} << k_sl_log2;
+    constexpr size_t k_fl_shift = k_sl_log2 + k_align_log2;
+    constexpr size_t k_small_block = size_t{1} << k_fl_shift;
+    constexpr size_t k_fl_max = 48;
+    constexpr size_t k_fl_count = k_fl_max - k_fl_shift + 1;
+
+    constexpr size_t k_free_bit = 1;
+    constexpr size_t k_flags_mask = k_align - 1;
+
+    struct alignas(k_align) zone_block
     {
-        zone_chunk(size_t chunk_size)
-            : next(nullptr)
-            , prev(nullptr)
-            , size(chunk_size - sizeof(zone_chunk))
-            , free(true)
-        {
-            TAV_ASSERT(chunk_size == align(chunk_size));
-            TAV_ASSERT(chunk_size > sizeof(zone_chunk));
-        }
+        zone_block* prev_phys; // previous block in memory, nullptr for the first one
+        size_t      bits;      // payload size, the low bits hold the flags
+        zone_block* next_free; // links of the free list, valid only while the block is free
+        zone_block* prev_free;
 
-        ~zone_chunk()
+        size_t size() const noexcept
         {
-            extract();
+            return bits & ~k_flags_mask;
         }
 
-        void insert_this_after(zone_chunk* chunk)
+        void set_size(size_t size) noexcept
         {
-            TAV_ASSERT(!next);
-            TAV_ASSERT(!prev);
-            TAV_ASSERT(chunk);
-
-            next = chunk->next;
-            prev = chunk;
-            chunk->next = this;
-            if (next) {
-                next->prev = this;
-            }
-
-            TAV_ASSERT(next && next->prev == this || !next);
-            TAV_ASSERT(prev->next == this);
+            bits = size | (bits & k_flags_mask);
         }
 
-        void extract()
+        bool is_free() const noexcept
         {
-            if (prev) {
-                prev->next = next;
-            }
-            if (next) {
-                next->prev = prev;
-            }
-            TAV_ASSERT(prev && prev->next == next || !prev);
-            TAV_ASSERT(next && next->prev == prev || !next);
-
-            next = prev = nullptr;
+            return bits & k_free_bit;
         }
 
-        size_t chunk_size()
+        void set_free(bool free) noexcept
         {
-            return size + sizeof(zone_chunk);
+            bits = free ? bits | k_free_bit : bits & ~k_free_bit;
         }
 
-        uint8_t* memptr()
+        uint8* memptr() noexcept
         {
-            return reinterpret_cast<uint8_t*>(this) + sizeof(zone_chunk);
+            return reinterpret_cast<uint8*>(this) + sizeof(zone_block);
         }
 
-        static size_t align(size_t val)
+        zone_block* next_phys() noexcept
         {
-            constexpr auto align_bits = sizeof(zone_chunk) - 1;
-            return (val + align_bits) & ~align_bits;
+            return reinterpret_cast<zone_block*>(memptr() + size());
         }
 
-        static uint8_t* align(uint8_t* ptr)
+        static zone_block* from(void* ptr) noexcept
         {
-            return reinterpret_cast<uint8_t*>(align(reinterpret_cast<size_t>(ptr)));
+            return reinterpret_cast<zone_block*>(static_cast<uint8*>(ptr) - sizeof(zone_block));
         }
+    }; // struct zone_block
 
-        zone_chunk* next; // next chunk
-        zone_chunk* prev; // prev chunk
-        size_t      size; // size of free memory to the right of the chunk
-        bool        free; // is current chunk free
-        uint32_t    tag;
-    }; // struct zone_chunk
-} // namespace
+    static_assert(sizeof(zone_block) == k_align);
 
+    // Smallest free block worth splitting off: a header and the minimal payload
+    constexpr size_t k_min_block = sizeof(zone_block) + k_align;
 
-struct zone_allocator::impl
-{
-    impl(size_t zone_size)
+    struct zone_control
     {
-        TAV_ASSERT(zone_size >= 1024);
-        TAV_ASSERT(zone_size == zone_chunk::align(zone_size));
+        uint64      fl_bitmap;
+        uint32      sl_bitmap[k_fl_count];
+        zone_block* blocks[k_fl_count][k_sl_count];
+    }; // struct zone_control
 
-        this->zone_size = zone_size;
-        alloced_size = zone_size + sizeof(zone_chunk);
-        mptr = static_cast<uint8_t*>(std::malloc(alloced_size));
-        clear();
+    void mapping_insert(size_t size, size_t& fl, size_t& sl) noexcept
+    {
+        if (size < k_small_block) {
+            fl = 0;
+            sl = size >> k_align_log2;
+        } else {
+            const auto msb = tavros::math::highest_set_bit(size);
+            sl = (size >> (msb - k_sl_log2)) ^ k_sl_count;
+            fl = msb - k_fl_shift + 1;
+        }
     }
 
-    ~impl()
+    // Rounds the size up to the next list boundary, so that any block of the found list fits
+    void mapping_search(size_t size, size_t& fl, size_t& sl) noexcept
     {
-        base->~zone_chunk();
-        std::memset(mptr, 0, alloced_size);
-        std::free(mptr);
+        if (size >= k_small_block) {
+            size += (size_t{1} << (tavros::math::highest_set_bit(size) - k_sl_log2)) - 1;
+        }
+        mapping_insert(size, fl, sl);
     }
+} // namespace
 
-    zone_chunk* find_nearest(size_t size)
+namespace tavros::core
+{
+
+    struct zone_allocator::impl
     {
-        auto* chunk = pivot;
-        while (chunk && (!chunk->free || chunk->size < size)) {
-            chunk = chunk->next;
+        impl(size_t size)
+        {
+            TAV_ASSERT(size >= 1024);
+            TAV_ASSERT(size == math::align_up(size, k_align));
+            TAV_ASSERT(math::highest_set_bit(size) <= k_fl_max);
+
+            zone_size = size;
+            alloced_size = sizeof(zone_control) + k_align + zone_size + sizeof(zone_block);
+            mptr = static_cast<uint8*>(std::malloc(alloced_size));
+            ctl = reinterpret_cast<zone_control*>(mptr);
+            clear();
         }
-        if (chunk) {
-            return chunk;
+
+        ~impl()
+        {
+            std::free(mptr);
         }
 
-        chunk = base;
-        while (chunk && chunk != pivot && (!chunk->free || chunk->size < size)) {
-            chunk = chunk->next;
+        void insert_free(zone_block* block) noexcept
+        {
+            size_t fl, sl;
+            mapping_insert(block->size(), fl, sl);
+
+            auto*& head = ctl->blocks[fl][sl];
+            block->prev_free = nullptr;
+            block->next_free = head;
+            if (head) {
+                head->prev_free = block;
+            }
+            head = block;
+
+            ctl->fl_bitmap |= uint64{1} << fl;
+            ctl->sl_bitmap[fl] |= uint32{1} << sl;
+
+            block->set_free(true);
+            free_bytes += block->size();
+            ++free_block_count;
         }
-        return chunk;
-    }
 
-    zone_chunk* allocate_chunk(size_t size)
-    {
-        size = zone_chunk::align(size);
+        void remove_free(zone_block* block) noexcept
+        {
+            size_t fl, sl;
+            mapping_insert(block->size(), fl, sl);
+
+            if (block->prev_free) {
+                block->prev_free->next_free = block->next_free;
+            } else {
+                ctl->blocks[fl][sl] = block->next_free;
+                if (!block->next_free) {
+                    ctl->sl_bitmap[fl] &= ~(uint32{1} << sl);
+                    if (!ctl->sl_bitmap[fl]) {
+                        ctl->fl_bitmap &= ~(uint64{1} << fl);
+                    }
+                }
+            }
+            if (block->next_free) {
+                block->next_free->prev_free = block->prev_free;
+            }
 
-        auto* chunk = find_nearest(size);
-        if (!chunk) {
-            return nullptr;
+            block->set_free(false);
+            free_bytes -= block->size();
+            --free_block_count;
         }
-        TAV_ASSERT(chunk->free);
 
-        auto extra_size = chunk->size - size;
-        if (extra_size > sizeof(zone_chunk)) {
-            auto* mem = chunk->memptr();
+        zone_block* find_free(size_t size) noexcept
+        {
+            size_t fl, sl;
+            mapping_search(size, fl, sl);
+            if (fl >= k_fl_count) {
+                return nullptr;
+            }
 
-            TAV_ASSERT(extra_size == zone_chunk::align(extra_size));
-            TAV_ASSERT(mem == zone_chunk::align(mem));
+            auto sl_map = ctl->sl_bitmap[fl] & (~uint32{0} << sl);
+            if (!sl_map) {
+                const auto fl_map = ctl->fl_bitmap & (~uint64{0} << (fl + 1));
+                if (!fl_map) {
+                    return nullptr;
+                }
+                fl = math::count_trailing_zeros(fl_map);
+                sl_map = ctl->sl_bitmap[fl];
+            }
+            sl = math::count_trailing_zeros(sl_map);
 
-            // add a free chunk to the right
-            chunk->size = size;
-            auto* extra_chunk = new (mem + chunk->size) zone_chunk(extra_size);
-            extra_chunk->insert_this_after(chunk);
-            pivot = extra_chunk;
+            auto* block = ctl->blocks[fl][sl];
+            TAV_ASSERT(block && block->size() >= size);
+            remove_free(block);
+            return block;
         }
 
-        chunk->free = false;
-        chunk->tag = 0xdaf321ca;
-        std::memset(chunk->memptr(), 0, chunk->size);
-        return chunk;
-    }
+        // Cuts the tail past size bytes into a free block, merging it with a free right neighbour
+        void split(zone_block* block, size_t size) noexcept
+        {
+            TAV_ASSERT(!block->is_free());
+            if (block->size() < size + k_min_block) {
+                return;
+            }
 
-    void free_chunk(zone_chunk* chunk)
-    {
-        TAV_ASSERT(reinterpret_cast<uint8_t*>(chunk) >= reinterpret_cast<uint8_t*>(base));
-        TAV_ASSERT(reinterpret_cast<uint8_t*>(chunk) < (reinterpret_cast<uint8_t*>(base) + zone_size));
-        TAV_ASSERT(!chunk->free);
-        TAV_ASSERT(chunk->tag == 0xdaf321ca);
-
-        chunk->free = true;
-        auto* next = chunk->next;
-        if (next && next->free) {
-            // remove the next chunk
-            chunk->size += next->chunk_size();
-            next->~zone_chunk();
-        }
-
-        auto* prev = chunk->prev;
-        if (prev && prev->free) {
-            next = chunk->next;
-            prev->size += chunk->chunk_size();
-            chunk->~zone_chunk();
-            if (pivot == chunk) {
-                pivot = prev;
+            auto* rest = reinterpret_cast<zone_block*>(block->memptr() + size);
+            rest->prev_phys = block;
+            rest->bits = block->size() - size - sizeof(zone_block);
+            block->set_size(size);
+            ++block_count;
+
+            auto* next = rest->next_phys();
+            if (next->is_free()) {
+                remove_free(next);
+                rest->set_size(rest->size() + sizeof(zone_block) + next->size());
+                --block_count;
+                next = rest->next_phys();
+            }
+            next->prev_phys = rest;
+
+            insert_free(rest);
+        }
+
+        // Merges a block that is not in any free list with its free neighbours
+        zone_block* merge(zone_block* block) noexcept
+        {
+            if (auto* next = block->next_phys(); next->is_free()) {
+                remove_free(next);
+                block->set_size(block->size() + sizeof(zone_block) + next->size());
+                block->next_phys()->prev_phys = block;
+                --block_count;
+            }
+
+            if (auto* prev = block->prev_phys; prev && prev->is_free()) {
+                remove_free(prev);
+                prev->set_size(prev->size() + sizeof(zone_block) + block->size());
+                prev->next_phys()->prev_phys = prev;
+                --block_count;
+                block = prev;
+            }
+
+            return block;
+        }
+
+        zone_block* allocate_block(size_t size, size_t align) noexcept
+        {
+            size = std::max(math::align_up(size, k_align), k_align);
+
+            if (align <= k_align) {
+                auto* block = find_free(size);
+                if (block) {
+                    split(block, size);
+                }
+                return block;
+            }
+
+            // Over-aligned: take a block big enough to cut off a free block in front
+            auto* block = find_free(size + align + k_min_block);
+            if (!block) {
+                return nullptr;
+            }
+
+            auto gap = math::align_up(reinterpret_cast<size_t>(block->memptr()), align) - reinterpret_cast<size_t>(block->memptr());
+            if (gap != 0 && gap < k_min_block) {
+                gap += align;
+            }
+
+            if (gap != 0) {
+                auto* aligned = reinterpret_cast<zone_block*>(reinterpret_cast<uint8*>(block) + gap);
+                aligned->prev_phys = block;
+                aligned->bits = block->size() - gap;
+                aligned->next_phys()->prev_phys = aligned;
+                block->set_size(gap - sizeof(zone_block));
+                ++block_count;
+                insert_free(block);
+                block = aligned;
+            }
+
+            split(block, size);
+            return block;
+        }
+
+        bool is_valid(zone_block* block) noexcept
+        {
+            auto* p = reinterpret_cast<uint8*>(block);
+            if (p < reinterpret_cast<uint8*>(base) || p >= reinterpret_cast<uint8*>(sentinel)) {
+                return false;
             }
-            chunk = prev;
+            if (reinterpret_cast<size_t>(p) % k_align != 0) {
+                return false;
+            }
+
+            // Boundary tags of both neighbours must point back to the block
+            return (block->prev_phys ? block->prev_phys->next_phys() == block : block == base) && block->next_phys()->prev_phys == block;
         }
 
-        pivot = chunk;
-        std::memset(chunk->memptr(), 0, chunk->size);
+        void on_allocate(zone_block* block) noexcept
+        {
+            used_bytes += sizeof(zone_block) + block->size();
+            peak_used_bytes = std::max(peak_used_bytes, used_bytes);
+            ++allocation_count;
+        }
+
+        void on_deallocate(zone_block* block) noexcept
+        {
+            used_bytes -= sizeof(zone_block) + block->size();
+            --allocation_count;
+        }
+
+        void clear()
+        {
+            std::memset(ctl, 0, sizeof(zone_control));
+
+            base = reinterpret_cast<zone_block*>(math::align_up(reinterpret_cast<size_t>(mptr + sizeof(zone_control)), k_align));
+            base->prev_phys = nullptr;
+            base->bits = zone_size - sizeof(zone_block);
+
+            // Zero-sized allocated block at the end, so the last real block always has a right neighbour
+            sentinel = base->next_phys();
+            sentinel->prev_phys = base;
+            sentinel->bits = 0;
+
+            free_bytes = 0;
+            used_bytes = 0;
+            block_count = 1;
+            free_block_count = 0;
+            allocation_count = 0;
+            insert_free(base);
+        }
+
+        uint8*        mptr;
+        size_t        alloced_size;
+        size_t        zone_size;
+        zone_control* ctl;
+        zone_block*   base;     // the first block
+        zone_block*   sentinel; // the end marker
+        size_t        free_bytes;
+        size_t        used_bytes;
+        size_t        block_count;
+        size_t        free_block_count;
+        size_t        allocation_count;
+        size_t        peak_used_bytes = 0;
+    }; // struct zone_allocator::impl
+
+
+    zone_allocator::zone_allocator(size_t zone_size)
+        : m_impl(zone_size)
+    {
+        TAV_ASSERT(zone_size == math::align_up(zone_size, k_align));
     }
 
-    void clear()
+    zone_allocator::~zone_allocator()
     {
-        base = new (zone_chunk::align(mptr)) zone_chunk(zone_size);
-        pivot = base;
+        if (m_impl->allocation_count) {
+            ::logger.warning("Called an allocator destructor with active allocations {} - possible memory leak", m_impl->allocation_count);
+        }
     }
 
-    uint8_t*                   mptr;
-    size_t                     alloced_size;
-    size_t                     zone_size;
-    zone_chunk*                base; // the first chunk
-    zone_chunk*                pivot;
-    unordered_map<void*, bool> allocation_info;
-}; // struct zone_allocator::impl
+    void* zone_allocator::allocate(size_t size, size_t align, const char* tag)
+    {
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to allocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
 
+        TAV_UNUSED(tag);
 
-zone_allocator::zone_allocator(size_t zone_size)
-    : m_impl(zone_size)
-{
-    TAV_ASSERT(zone_size == zone_chunk::align(zone_size));
-}
+        // Running out of zone space is left to the caller to handle
+        auto* block = m_impl->allocate_block(size, align);
+        if (!block) {
+            return nullptr;
+        }
 
-zone_allocator::~zone_allocator()
-{
-    clear();
-}
+        m_impl->on_allocate(block);
+        std::memset(block->memptr(), 0, block->size());
+        return block->memptr();
+    }
 
-void* zone_allocator::allocate(size_t size, size_t align, const char* tag)
-{
-    TAV_UNUSED(align);
-    TAV_UNUSED(tag);
+    void* zone_allocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
+    {
+        if (!math::is_power_of_two(align)) {
+            ::logger.error("Invalid alignment ({}) provided to reallocate; must be a power of two", align);
+            TAV_DEBUG_BREAK();
+            return nullptr;
+        }
 
-    auto* chunk = m_impl->allocate_chunk(size);
-    TAV_ASSERT(chunk);
+        // handle realloc semantics explicitly
+        if (ptr == nullptr) {
+            return allocate(new_size, align, tag);
+        }
 
-    auto* p = static_cast<void*>(chunk->memptr());
-    auto& map = m_impl->allocation_info;
-    if (auto it = map.find(p); it != map.end()) {
-        if (it->second) {
-            TAV_ASSERT(false);
-        } else {
-            it->second = true;
+        if (new_size == 0) {
+            deallocate(ptr);
+            return nullptr;
+        }
+
+        auto* block = zone_block::from(ptr);
+        if (!m_impl->is_valid(block) || block->is_free()) {
+            ::logger.error("Attempt to reallocate an unknown or freed pointer {}", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+            return nullptr;
         }
-    } else {
-        map[p] = true;
+
+        const auto old_size = block->size();
+        const auto size = std::max(math::align_up(new_size, k_align), k_align);
+
+        // Grow into a free right neighbour if it is big enough
+        if (size > old_size) {
+            auto* next = block->next_phys();
+            if (next->is_free() && old_size + sizeof(zone_block) + next->size() >= size) {
+                m_impl->remove_free(next);
+                block->set_size(old_size + sizeof(zone_block) + next->size());
+                block->next_phys()->prev_phys = block;
+                --m_impl->block_count;
+            }
+        }
+
+        if (block->size() >= size) {
+            m_impl->split(block, size);
+            m_impl->used_bytes = m_impl->used_bytes - old_size + block->size();
+            m_impl->peak_used_bytes = std::max(m_impl->peak_used_bytes, m_impl->used_bytes);
+            if (block->size() > old_size) {
+                std::memset(block->memptr() + old_size, 0, block->size() - old_size);
+            }
+            return ptr;
+        }
+
+        void* new_ptr = allocate(new_size, align, tag);
+        if (!new_ptr) {
+            return nullptr;
+        }
+        std::memcpy(new_ptr, ptr, old_size);
+        deallocate(ptr);
+        return new_ptr;
     }
 
-    return chunk->memptr();
-}
+    void zone_allocator::deallocate(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
 
-void* zone_allocator::reallocate(void* ptr, size_t new_size, size_t align, const char* tag)
-{
-    TAV_UNUSED(ptr);
-    TAV_UNUSED(new_size);
-    TAV_UNUSED(align);
-    TAV_UNUSED(tag);
-    TAV_UNREACHABLE();
-}
-
-void zone_allocator::deallocate(void* ptr)
-{
-    auto* chunk = reinterpret_cast<zone_chunk*>(reinterpret_cast<uint8*>(ptr) - sizeof(zone_chunk));
+        auto* block = zone_block::from(ptr);
+        if (!m_impl->is_valid(block)) {
+            ::logger.error("Attempt to free an unknown pointer {}", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+            return;
+        }
 
-    auto& map = m_impl->allocation_info;
-    if (auto it = map.find(ptr); it != map.end()) {
-        if (it->second) {
-            it->second = false;
-        } else {
-            TAV_ASSERT(false);
+        if (block->is_free()) {
+            ::logger.error("Double free detected for pointer {}", fmt::ptr(ptr));
+            TAV_DEBUG_BREAK();
+            return;
         }
-    } else {
-        TAV_ASSERT(false);
+
+        m_impl->on_deallocate(block);
+        m_impl->insert_free(m_impl->merge(block));
+    }
+
+    void zone_allocator::clear()
+    {
+        m_impl->clear();
     }
 
-    m_impl->free_chunk(chunk);
-}
+    zone_allocator_metrics zone_allocator::metrics() const noexcept
+    {
+        const auto& im = *m_impl;
+
+        zone_allocator_metrics m;
+        m.zone_size = im.zone_size;
+        m.used_bytes = im.used_bytes;
+        m.free_bytes = im.free_bytes;
+        m.block_count = im.block_count;
+        m.free_block_count = im.free_block_count;
+        m.allocation_count = im.allocation_count;
+        m.peak_used_bytes = im.peak_used_bytes;
+
+        // The largest block lives in the highest non-empty list
+        if (im.ctl->fl_bitmap) {
+            const auto fl = math::highest_set_bit(im.ctl->fl_bitmap);
+            const auto sl = math::highest_set_bit(im.ctl->sl_bitmap[fl]);
+            for (auto* block = im.ctl->blocks[fl][sl]; block; block = block->next_free) {
+                m.largest_free_block = std::max(m.largest_free_block, block->size());
+            }
+        }
 
-void zone_allocator::clear()
-{
-    m_impl->clear();
-}
+        return m;
+    }
+
+} // namespace tavros::core
@@ -7,6 +7,39 @@
 namespace tavros::core
 {
 
+    /**
+     * @brief Snapshot of the usage and fragmentation of a @ref zone_allocator.
+     */
+    struct zone_allocator_metrics
+    {
+        size_t zone_size = 0;          ///< Usable bytes in the zone.
+        size_t used_bytes = 0;         ///< Bytes in allocated blocks, headers included.
+        size_t free_bytes = 0;         ///< Bytes available in free blocks, headers excluded.
+        size_t largest_free_block = 0; ///< Largest single allocation that would currently succeed.
+        size_t block_count = 0;        ///< Number of blocks, free and allocated.
+        size_t free_block_count = 0;   ///< Number of free blocks.
+        size_t allocation_count = 0;   ///< Number of allocated blocks.
+        size_t peak_used_bytes = 0;    ///< Largest value used_bytes has reached.
+
+        /**
+         * @brief Returns the share of free memory not usable by a single allocation, in [0, 1].
+         */
+        [[nodiscard]] double fragmentation() const noexcept
+        {
+            return free_bytes ? 1.0 - static_cast<double>(largest_free_block) / static_cast<double>(free_bytes) : 0.0;
+        }
+    };
+
+    /**
+     * @brief A general-purpose allocator over a single fixed-size memory zone.
+     *
+     * Free blocks are kept in segregated free lists indexed by a two-level bitmap (TLSF),
+     * so finding a fitting block takes constant time regardless of how fragmented the zone is.
+     * Every block carries a boundary tag with its size and a link to its physical neighbour,
+     * which lets a freed block be merged with free neighbours in constant time as well.
+     *
+     * Memory returned by @ref allocate() is zeroed.
+     */
     class zone_allocator final : public allocator
     {
     public:
@@ -18,9 +51,14 @@ namespace tavros::core
         void  deallocate(void* ptr) override;
         void  clear() override;
 
+        /**
+         * @brief Returns the current usage and fragmentation of the zone.
+         */
+        [[nodiscard]] zone_allocator_metrics metrics() const noexcept;
+
     private:
         struct impl;
-        static constexpr size_t              impl_size = TAV_DEBUG ? pointer_size * 15 : pointer_size * 13;
+        static constexpr size_t              impl_size = pointer_size * 12;
         pimpl<impl, impl_size, pointer_size> m_impl;
     }; // class zone_allocator
 
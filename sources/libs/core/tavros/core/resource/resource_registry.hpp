@@ -2,7 +2,8 @@
 
 
 #include <tavros/core/containers/vector.hpp>
-#include <tavros/core/containers/unordered_map.hpp>
+#include <tavros/core/containers/flat_hash_map.hpp>
+#include <tavros/core/memory/chunk_pool.hpp>
 #include <tavros/core/ref_counted.hpp>
 #include <tavros/core/memory/memory.hpp>
 #include <tavros/core/fixed_string.hpp>
@@ -32,7 +33,8 @@ namespace tavros::core
             short_string              name;
         };
 
-        using storage_type = unordered_map<hash_type, entry_type>;
+        /// Entries live in a pool so that references stay valid while the lookup table grows.
+        using storage_type = flat_hash_map<hash_type, entry_type*>;
         using iterator = storage_type::iterator;
         using const_iterator = storage_type::const_iterator;
 
@@ -50,7 +52,10 @@ namespace tavros::core
     public:
         resource_registry() noexcept = default;
 
-        ~resource_registry() noexcept = default;
+        ~resource_registry() noexcept
+        {
+            clear();
+        }
 
         void set_placeholder(resource_type* placeholder) noexcept
         {
@@ -72,23 +77,25 @@ namespace tavros::core
             const auto h = make_hash(name);
             auto       it = m_resources.find(h);
             if (it != m_resources.end()) {
-                it->second.rc.increment();
-                return {ref_type{&it->second}, false};
+                it->second->rc.increment();
+                return {ref_type{it->second}, false};
             }
 
-            auto [inserted_it, inserted] = m_resources.emplace(
-                h,
-                entry_type{
-                    .owner = nullptr,
-                    .ptr = m_placeholder,
-                    .rc = {},
-                    .hash = h,
-                    .status = resource_status::unloaded,
-                    .name = short_string(name)
-                }
-            );
-            TAV_ASSERT(inserted);
-            return {ref_type{&inserted_it->second}, true};
+            auto* block = m_entries.allocate_block();
+            if (!block) {
+                throw std::bad_alloc();
+            }
+
+            auto* entry = new (block) entry_type{
+                .owner = nullptr,
+                .ptr = m_placeholder,
+                .rc = {},
+                .hash = h,
+                .status = resource_status::unloaded,
+                .name = short_string(name)
+            };
+            m_resources.emplace(h, entry);
+            return {ref_type{entry}, true};
         }
 
         /**
@@ -107,7 +114,7 @@ namespace tavros::core
                     continue; // could've been erased already
                 }
 
-                entry_type& entry = it->second;
+                entry_type& entry = *it->second;
 
                 switch (t.kind) {
                 case transition_kind::set_ready:
@@ -126,6 +133,7 @@ namespace tavros::core
 
                 case transition_kind::release:
                     if (entry.rc.decrement()) {
+                        destroy_entry(it->second);
                         m_resources.erase(it);
                     }
                     break;
@@ -184,7 +192,7 @@ namespace tavros::core
             const auto h = make_hash(name);
             auto       it = m_resources.find(h);
             if (it != m_resources.end()) {
-                return ref_type(&it->second);
+                return ref_type(it->second);
             }
             return {};
         }
@@ -229,6 +237,9 @@ namespace tavros::core
          */
         void clear() noexcept
         {
+            for (auto& [hash, entry] : m_resources) {
+                destroy_entry(entry);
+            }
             m_resources.clear();
         }
 
@@ -284,9 +295,16 @@ namespace tavros::core
             unique_ptr<resource_type> data; // only used for set_ready
         };
 
+        void destroy_entry(entry_type* entry) noexcept
+        {
+            entry->~entry_type();
+            m_entries.deallocate_block(entry);
+        }
+
     private:
-        resource_type* m_placeholder = nullptr;
-        storage_type   m_resources;
+        resource_type*         m_placeholder = nullptr;
+        storage_type           m_resources;
+        chunk_pool<entry_type> m_entries;
 
         core::vector<pending_transition> m_pending_transitions;
     };
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <tavros/core/types.hpp>
+#include <tavros/core/noncopyable.hpp>
+
+#include <memory>
+#include <type_traits>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Interface for running a batch of independent tasks, possibly in parallel.
+     *
+     * An executor runs a batch of tasks numbered [0, task_count) and returns once every task
+     * has finished. The calling thread may take part in the work. Tasks of a batch must not
+     * depend on each other; their order and the thread running each task are unspecified.
+     *
+     * Implementations decide how the tasks are spread across threads: a thread pool, a job
+     * system of the host application, or the calling thread only.
+     */
+    class executor : noncopyable
+    {
+    public:
+        /**
+         * @brief Task entry point.
+         *
+         * @param context Opaque pointer passed to @ref run().
+         * @param index Index of the task in [0, task_count).
+         */
+        using task_fn = void (*)(void* context, size_t index);
+
+    public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~executor() = default;
+
+        /**
+         * @brief Returns the number of threads that can run tasks at the same time, at least 1.
+         *
+         * Used by callers to choose how finely to split their work.
+         */
+        [[nodiscard]] virtual size_t concurrency() const noexcept = 0;
+
+        /**
+         * @brief Runs @p task for every index in [0, @p task_count) and waits for all of them.
+         *
+         * If a task throws, the remaining tasks still run and the first exception is
+         * rethrown to the caller once the batch is finished.
+         *
+         * @param task_count Number of tasks in the batch.
+         * @param task Task entry point.
+         * @param context Opaque pointer passed to every call of @p task.
+         */
+        virtual void run(size_t task_count, task_fn task, void* context) = 0;
+
+        /**
+         * @brief Runs @p func(index) for every index in [0, @p task_count) and waits for all of them.
+         *
+         * @param task_count Number of tasks in the batch.
+         * @param func Callable matching @c void(size_t). Invoked concurrently from several threads.
+         */
+        template<class Func>
+            requires std::is_invocable_v<Func&, size_t>
+        void run(size_t task_count, Func&& func)
+        {
+            run(
+                task_count,
+                [](void* context, size_t index) {
+                    (*static_cast<std::remove_reference_t<Func>*>(context))(index);
+                },
+                const_cast<void*>(static_cast<const void*>(std::addressof(func)))
+            );
+        }
+    };
+
+} // namespace tavros::core
@@ -0,0 +1,178 @@
+#include <tavros/core/thread/thread_pool.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+namespace
+{
+    tavros::core::logger logger("thread_pool");
+
+    // Pool whose batch the current thread is working on, used to run nested batches inline
+    thread_local const tavros::core::thread_pool* t_current_pool = nullptr;
+
+    void run_inline(size_t task_count, tavros::core::executor::task_fn task, void* context)
+    {
+        std::exception_ptr error;
+        for (size_t i = 0; i < task_count; ++i) {
+            try {
+                task(context, i);
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+} // namespace
+
+namespace tavros::core
+{
+
+    thread_pool::thread_pool(size_t worker_count)
+    {
+        m_workers.reserve(worker_count);
+        try {
+            for (size_t i = 0; i < worker_count; ++i) {
+                m_workers.emplace_back([this] { worker_loop(); });
+            }
+        } catch (...) {
+            ::logger.error("Failed to start worker thread {} of {}", m_workers.size() + 1, worker_count);
+            {
+                std::lock_guard lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (auto& w : m_workers) {
+                w.join();
+            }
+            throw;
+        }
+    }
+
+    thread_pool::~thread_pool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& w : m_workers) {
+            w.join();
+        }
+    }
+
+    size_t thread_pool::concurrency() const noexcept
+    {
+        return m_workers.size() + 1;
+    }
+
+    void thread_pool::run(size_t task_count, task_fn task, void* context)
+    {
+        TAV_ASSERT(task);
+        if (task_count == 0) {
+            return;
+        }
+
+        if (m_workers.empty() || task_count == 1 || t_current_pool == this) {
+            run_inline(task_count, task, context);
+            return;
+        }
+
+        std::lock_guard run_lock(m_run_mutex);
+
+        batch b;
+        b.task = task;
+        b.context = context;
+        b.count = task_count;
+        b.remaining.store(task_count, std::memory_order_relaxed);
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_batch = &b;
+            ++m_epoch;
+        }
+        m_wake.notify_all();
+
+        const auto* prev_pool = t_current_pool;
+        t_current_pool = this;
+        work_on(b);
+        t_current_pool = prev_pool;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_done.wait(lock, [&] { return b.remaining.load(std::memory_order_acquire) == 0 && m_active == 0; });
+            m_batch = nullptr;
+        }
+
+        if (b.error) {
+            std::rethrow_exception(b.error);
+        }
+    }
+
+    size_t thread_pool::worker_count() const noexcept
+    {
+        return m_workers.size();
+    }
+
+    size_t thread_pool::default_worker_count() noexcept
+    {
+        const size_t hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+    void thread_pool::worker_loop()
+    {
+        t_current_pool = this;
+        uint64 seen_epoch = 0;
+
+        for (;;) {
+            batch* b = nullptr;
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_stop || (m_batch && m_epoch != seen_epoch); });
+                if (m_stop) {
+                    return;
+                }
+                seen_epoch = m_epoch;
+                b = m_batch;
+                ++m_active;
+            }
+
+            work_on(*b);
+
+            {
+                std::lock_guard lock(m_mutex);
+                --m_active;
+            }
+            m_done.notify_all();
+        }
+    }
+
+    void thread_pool::work_on(batch& b)
+    {
+        for (;;) {
+            const size_t index = b.next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= b.count) {
+                return;
+            }
+
+            try {
+                b.task(b.context, index);
+            } catch (...) {
+                std::lock_guard lock(m_mutex);
+                if (!b.error) {
+                    b.error = std::current_exception();
+                }
+            }
+
+            if (b.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard lock(m_mutex);
+                m_done.notify_all();
+            }
+        }
+    }
+
+} // namespace tavros::core
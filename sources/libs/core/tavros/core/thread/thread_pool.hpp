@@ -0,0 +1,90 @@
+#pragma once
+
+#include <tavros/core/thread/executor.hpp>
+#include <tavros/core/containers/vector.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace tavros::core
+{
+
+    /**
+     * @brief Executor backed by a fixed set of worker threads.
+     *
+     * Workers sleep until a batch is submitted with @ref run(). The workers and the calling
+     * thread then take task indices from a shared atomic counter, so tasks of different
+     * length balance themselves across threads without a per-task queue or allocation.
+     *
+     * Only one batch runs at a time; concurrent calls to @ref run() from other threads wait
+     * for the current batch. A call to @ref run() from inside a task runs the nested batch
+     * on the calling thread, so nested parallel loops do not deadlock.
+     *
+     * A pool with zero workers runs every batch on the calling thread.
+     */
+    class thread_pool final : public executor
+    {
+    public:
+        /**
+         * @brief Starts the worker threads.
+         *
+         * @param worker_count Number of worker threads. The calling thread also works while
+         *        waiting in @ref run(), so @c hardware_concurrency() - 1 keeps every core busy.
+         */
+        explicit thread_pool(size_t worker_count = default_worker_count());
+
+        /**
+         * @brief Stops and joins the worker threads.
+         */
+        ~thread_pool() override;
+
+        /**
+         * @brief Returns the number of workers plus the calling thread.
+         */
+        [[nodiscard]] size_t concurrency() const noexcept override;
+
+        using executor::run;
+
+        void run(size_t task_count, task_fn task, void* context) override;
+
+        /**
+         * @brief Returns the number of worker threads.
+         */
+        [[nodiscard]] size_t worker_count() const noexcept;
+
+        /**
+         * @brief Returns @c hardware_concurrency() - 1, or 0 on a single-core machine.
+         */
+        [[nodiscard]] static size_t default_worker_count() noexcept;
+
+    private:
+        struct batch
+        {
+            task_fn            task = nullptr;
+            void*              context = nullptr;
+            size_t             count = 0;
+            std::atomic_size_t next = 0;      ///< Next task index to take.
+            std::atomic_size_t remaining = 0; ///< Tasks not finished yet.
+            std::exception_ptr error;         ///< First exception thrown by a task, guarded by m_mutex.
+        };
+
+        void worker_loop();
+        void work_on(batch& b);
+
+    private:
+        vector<std::thread> m_workers;
+
+        std::mutex              m_run_mutex;       ///< Serializes batches.
+        std::mutex              m_mutex;           ///< Guards the fields below.
+        std::condition_variable m_wake;            ///< Signals workers about a new batch or stop.
+        std::condition_variable m_done;            ///< Signals the caller that the batch is finished.
+        batch*                  m_batch = nullptr; ///< Batch being run, nullptr between batches.
+        uint64                  m_epoch = 0;       ///< Incremented for every batch.
+        size_t                  m_active = 0;      ///< Workers currently inside the batch.
+        bool                    m_stop = false;
+    };
+
+} // namespace tavros::core
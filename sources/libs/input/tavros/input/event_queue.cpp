@@ -1,7 +1,14 @@
 #include <tavros/input/event_queue.hpp>
 
+#include <tavros/core/debug/assert.hpp>
 #include <tavros/core/logger/logger.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <thread>
+#include <utility>
+
 namespace
 {
     tavros::core::logger logger("event_queue");
@@ -10,37 +17,114 @@ namespace
 namespace tavros::input
 {
 
-    event_queue::event_queue() noexcept
-        : m_front(m_buffer_a.data(), m_buffer_a.data())
-        , m_back(m_buffer_b.data(), m_buffer_b.data())
+    event_queue::event_queue(size_t capacity, size_t max_capacity)
+        : m_max_capacity(std::max(capacity, max_capacity))
     {
+        TAV_ASSERT(capacity > 0);
+        for (auto& b : m_buffers) {
+            b.events.resize(capacity);
+            b.capacity = capacity;
+        }
     }
 
-    event_queue::~event_queue() noexcept = default;
+    event_queue::~event_queue() noexcept
+    {
+        for (auto& b : m_buffers) {
+            auto* node = b.overflow.exchange(nullptr, std::memory_order_acquire);
+            while (node) {
+                delete std::exchange(node, node->next);
+            }
+        }
+    }
 
-    void event_queue::push_event(const event_args& e)
+    void event_queue::push_event(const event_args& e) noexcept
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        const uint64 state = m_state.fetch_add(1, std::memory_order_acquire);
+        auto&        b = m_buffers[(state & k_buffer_bit) ? 1 : 0];
+        const uint64 slot = state & ~k_buffer_bit;
 
-        size_t count = static_cast<size_t>(m_back.end - m_back.begin);
-        if (count < k_max_events) {
-            *m_back.end++ = e;
+        if (slot < b.capacity) {
+            b.events[slot] = e;
+        } else if (auto* node = new (std::nothrow) overflow_node{e, slot, nullptr}) {
+            node->next = b.overflow.load(std::memory_order_relaxed);
+            while (!b.overflow.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            }
         } else {
-            ::logger.warning("Event queue overflow - call swap_queues() to flush events");
+            ::logger.error("Out of memory in the overflow list, input event dropped");
         }
+
+        b.published.fetch_add(1, std::memory_order_release);
     }
 
     void event_queue::swap_queues()
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        std::swap(m_front, m_back);
-        m_back.end = m_back.begin;
+        // The front buffer becomes the back one; its previous content is no longer needed
+        auto& next = m_buffers[m_front];
+        next.published.store(0, std::memory_order_relaxed);
+
+        const uint64 old_state = m_state.exchange(m_front ? k_buffer_bit : 0, std::memory_order_acq_rel);
+        const size_t back = (old_state & k_buffer_bit) ? 1 : 0;
+        const uint64 reserved = old_state & ~k_buffer_bit;
+        auto&        b = m_buffers[back];
+
+        // Producers that reserved a slot before the exchange may still be writing
+        while (b.published.load(std::memory_order_acquire) != reserved) {
+            std::this_thread::yield();
+        }
+
+        m_front = back;
+        m_front_size = static_cast<size_t>(std::min<uint64>(reserved, b.capacity));
+        if (reserved > b.capacity) {
+            merge_overflow(b, static_cast<size_t>(reserved));
+        }
     }
 
     event_args_queue_view event_queue::front_queue() const
     {
-        size_t size = static_cast<size_t>(m_front.end - m_front.begin);
-        return event_args_queue_view(m_front.begin, size);
+        return event_args_queue_view(m_buffers[m_front].events.data(), m_front_size);
+    }
+
+    size_t event_queue::capacity() const noexcept
+    {
+        const uint64 state = m_state.load(std::memory_order_relaxed);
+        return m_buffers[(state & k_buffer_bit) ? 1 : 0].capacity;
+    }
+
+    size_t event_queue::max_capacity() const noexcept
+    {
+        return m_max_capacity;
+    }
+
+    void event_queue::merge_overflow(buffer& b, size_t reserved)
+    {
+        core::vector<overflow_node*> nodes;
+        for (auto* node = b.overflow.exchange(nullptr, std::memory_order_acquire); node; node = node->next) {
+            nodes.push_back(node);
+        }
+
+        // Nodes are linked latest first, but concurrent producers may link out of slot order
+        std::sort(nodes.begin(), nodes.end(), [](const overflow_node* l, const overflow_node* r) { return l->slot < r->slot; });
+
+        ::logger.warning("Event queue overflow: {} events past capacity {}", nodes.size(), b.capacity);
+        grow(b, reserved);
+
+        if (b.events.size() < m_front_size + nodes.size()) {
+            b.events.resize(m_front_size + nodes.size());
+        }
+        for (auto* node : nodes) {
+            b.events[m_front_size++] = node->event;
+            delete node;
+        }
+    }
+
+    void event_queue::grow(buffer& b, size_t required)
+    {
+        const size_t new_capacity = std::min(std::bit_ceil(required), m_max_capacity);
+        if (new_capacity > b.capacity) {
+            b.events.resize(std::max(b.events.size(), new_capacity));
+            b.capacity = new_capacity;
+            ::logger.info("Event buffer grown to {} events", new_capacity);
+        }
     }
 
 } // namespace tavros::input
@@ -1,32 +1,52 @@
 #pragma once
 
-#include <tavros/core/containers/fixed_vector.hpp>
+#include <tavros/core/containers/vector.hpp>
 #include <tavros/core/noncopyable.hpp>
 #include <tavros/input/event_args.hpp>
-#include <mutex>
+
+#include <atomic>
 
 namespace tavros::input
 {
 
     /**
-     * @brief Double-buffered event queue for storing and processing input events.
+     * @brief Double-buffered multi-producer event queue for storing and processing input events.
+     *
+     * Any number of threads push events into the back buffer while a single consumer thread
+     * swaps the buffers once per frame and reads the front buffer.
      *
-     * This class collects input events pushed from different sources and provides
-     * a stable view of events for the current frame. It maintains two internal
-     * buffers and swaps them each frame to safely accumulate and process events
-     * without synchronization issues.
+     * Features and design choices:
+     * - Pushing takes no lock:
+     *   - A producer reserves a slot with one atomic increment of a word that also holds the
+     *     index of the back buffer, writes the event and publishes it with a second increment.
+     *   - @ref swap_queues() switches the back buffer with a single atomic exchange, so a
+     *     push either lands in the old or in the new back buffer, never in between.
+     * - A full back buffer does not drop events:
+     *   - Events past the capacity go into an overflow list that is linked lock-free.
+     *   - On swap, overflow events are appended to the front buffer in push order and the
+     *     buffer grows, up to @ref max_capacity(), so the overflow is not hit again.
+     * Notes:
+     * - @ref swap_queues() and @ref front_queue() must be called from the consumer thread only.
+     * - The view returned by @ref front_queue() stays valid until the next swap.
      */
     class event_queue : tavros::core::noncopyable
     {
     public:
-        /// Maximum number of events stored in one buffer.
-        static constexpr size_t k_max_events = 1024;
+        /// Default number of events a buffer holds before events go to the overflow list.
+        static constexpr size_t k_default_capacity = 1024;
+
+        /// Default limit for buffer growth.
+        static constexpr size_t k_default_max_capacity = 64 * 1024;
 
     public:
         /**
          * @brief Constructs an empty event queue.
+         *
+         * @param capacity Initial number of events per buffer.
+         * @param max_capacity Limit for buffer growth. Events past the capacity are still kept,
+         *        but through the slower overflow list.
          */
-        event_queue() noexcept;
+        explicit event_queue(size_t capacity = k_default_capacity, size_t max_capacity = k_default_max_capacity);
 
         /**
          * @brief Destroy event queue.
@@ -36,12 +56,13 @@ namespace tavros::input
         /**
          * @brief Pushes a new event into the back buffer.
          *
-         * Thread-safe method that stores the event in the back buffer.
-         * If the buffer is full, the event is silently discarded.
+         * Thread-safe and lock-free. While the back buffer has room the call is wait-free;
+         * past the capacity the event is allocated in the overflow list. The event is dropped
+         * only if that allocation fails.
          *
          * @param e The event to add.
          */
-        void push_event(const event_args& e);
+        void push_event(const event_args& e) noexcept;
 
         /**
          * @brief Swaps the front and back event buffers.
@@ -49,6 +70,7 @@ namespace tavros::input
          * This method is typically called once per frame.
          * After swapping, the previously accumulated events become
          * the active (front) queue, ready for processing.
+         * Waits for pushes that reserved a slot in the old back buffer but did not finish yet.
          */
         void swap_queues();
 
@@ -62,20 +84,43 @@ namespace tavros::input
          */
         event_args_queue_view front_queue() const;
 
+        /**
+         * @brief Returns the current number of events the back buffer holds before overflowing.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns the limit for buffer growth.
+         */
+        [[nodiscard]] size_t max_capacity() const noexcept;
+
     private:
-        core::fixed_vector<event_args, k_max_events> m_buffer_a{};
-        core::fixed_vector<event_args, k_max_events> m_buffer_b{};
+        struct overflow_node
+        {
+            event_args     event;
+            uint64         slot = 0; ///< Reserved slot, used to restore push order.
+            overflow_node* next = nullptr;
+        };
 
-        struct queue_data
+        struct buffer
         {
-            event_args* begin = nullptr;
-            event_args* end = nullptr;
+            core::vector<event_args>    events;            ///< Storage, at least capacity elements.
+            size_t                      capacity = 0;      ///< Slots usable by producers.
+            std::atomic<uint64>         published{0};      ///< Finished pushes, both in-buffer and overflow.
+            std::atomic<overflow_node*> overflow{nullptr}; ///< Overflow events, latest first.
         };
 
-        queue_data m_front;
-        queue_data m_back;
+        void merge_overflow(buffer& b, size_t reserved);
+        void grow(buffer& b, size_t required);
+
+    private:
+        static constexpr uint64 k_buffer_bit = uint64{1} << 63;
 
-        std::mutex m_mutex;
+        buffer              m_buffers[2];
+        std::atomic<uint64> m_state{0};       ///< Back buffer index in the top bit, reserved slots in the rest.
+        size_t              m_front = 1;      ///< Index of the front buffer.
+        size_t              m_front_size = 0; ///< Number of events in the front buffer.
+        size_t              m_max_capacity = 0;
     };
 
 } // namespace tavros::input
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <tavros/core/debug/assert.hpp>
+#include <tavros/renderer/gpu_stream_buffer.hpp>
+#include <tavros/renderer/rhi/command_queue.hpp>
+
+#include <type_traits>
+
+namespace tavros::renderer
+{
+
+    /**
+     * @brief Packs draw arguments into a streaming buffer and issues them as multi-draw-indirect calls.
+     *
+     * Arguments are written straight into persistently mapped memory of a gpu_stream_buffer
+     * created with rhi::buffer_usage::indirect, so thousands of draws sharing one pipeline
+     * and one set of bindings cost a single command.
+     *
+     * Typical usage:
+     * - begin() once per frame after the stream buffer has been reset
+     * - push() one record per object, submit() whenever bindings change or the batch is full
+     *
+     * @tparam Args rhi::draw_indirect_args or rhi::draw_indexed_indirect_args.
+     *
+     * @note Records are read by the GPU when the queue is executed, the stream buffer must not
+     *       be reset until the frame that used them has finished.
+     * @note Not thread-safe.
+     */
+    template<class Args>
+    class gpu_indirect_batch
+    {
+        static_assert(
+            std::is_same_v<Args, rhi::draw_indirect_args> || std::is_same_v<Args, rhi::draw_indexed_indirect_args>,
+            "gpu_indirect_batch expects draw_indirect_args or draw_indexed_indirect_args"
+        );
+
+    public:
+        /** @brief Constructs an empty batch, call begin() before use. */
+        gpu_indirect_batch() noexcept = default;
+
+        /** @brief Default destructor. */
+        ~gpu_indirect_batch() noexcept = default;
+
+        /**
+         * @brief Allocates room for @p capacity records from the stream buffer.
+         *
+         * @param stream   Stream buffer created with rhi::buffer_usage::indirect.
+         * @param capacity Maximum number of records in the batch.
+         * @return         @c false if the stream buffer has no room left.
+         */
+        bool begin(gpu_stream_buffer& stream, uint32 capacity) noexcept
+        {
+            m_view = stream.can_slice<Args>(capacity) ? stream.slice<Args>(capacity) : gpu_buffer_view<Args>{};
+            m_size = 0;
+            m_submitted = 0;
+            return m_view.gpu_buffer().valid();
+        }
+
+        /**
+         * @brief Appends one draw record.
+         *
+         * @return @c false if the batch is full, the record is dropped.
+         */
+        bool push(const Args& args) noexcept
+        {
+            if (full()) {
+                return false;
+            }
+            m_view.data()[m_size++] = args;
+            return true;
+        }
+
+        /**
+         * @brief Returns the number of records pushed since begin().
+         */
+        [[nodiscard]] uint32 size() const noexcept
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the maximum number of records.
+         */
+        [[nodiscard]] uint32 capacity() const noexcept
+        {
+            return static_cast<uint32>(m_view.data().size());
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        [[nodiscard]] bool full() const noexcept
+        {
+            return m_size == capacity();
+        }
+
+        /**
+         * @brief Describes the records pushed since the last submit().
+         */
+        [[nodiscard]] rhi::draw_indirect_info info() const noexcept
+        {
+            rhi::draw_indirect_info info;
+            info.buffer = m_view.gpu_buffer();
+            info.offset = m_view.offset_bytes() + static_cast<size_t>(m_submitted) * sizeof(Args);
+            info.draw_count = m_size - m_submitted;
+            info.stride = sizeof(Args);
+            return info;
+        }
+
+        /**
+         * @brief Issues the records pushed since the last submit() as one indirect draw.
+         *
+         * Does nothing if no new records were pushed. The queue must be inside a render pass
+         * with the pipeline and resources of the batch bound.
+         */
+        void submit(rhi::command_queue& queue)
+        {
+            if (m_size == m_submitted) {
+                return;
+            }
+
+            if constexpr (std::is_same_v<Args, rhi::draw_indexed_indirect_args>) {
+                queue.draw_indexed_indirect(info());
+            } else {
+                queue.draw_indirect(info());
+            }
+            m_submitted = m_size;
+        }
+
+    private:
+        gpu_buffer_view<Args> m_view;
+        uint32                m_size = 0;
+        uint32                m_submitted = 0;
+    };
+
+    using gpu_draw_batch = gpu_indirect_batch<rhi::draw_indirect_args>;
+    using gpu_indexed_draw_batch = gpu_indirect_batch<rhi::draw_indexed_indirect_args>;
+
+} // namespace tavros::renderer
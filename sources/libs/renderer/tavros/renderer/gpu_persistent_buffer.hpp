@@ -91,8 +91,7 @@ namespace tavros::renderer
         template<class T>
         [[nodiscard]] gpu_buffer_view<T> slice(size_t count) noexcept
         {
-            const size_t align = alignof(T) > 256 ? alignof(T) : 256;
-            const size_t offset = tavros::math::align_up(m_cursor, align); // TODO: fixit. tavros::math::align_up(m_cursor + m_data.begin(), alignof(T))
+            const size_t offset = slice_offset<T>();
             const size_t size_bytes = sizeof(T) * count;
 
             TAV_ASSERT(offset + size_bytes <= m_data.size());
@@ -105,6 +104,15 @@ namespace tavros::renderer
             return gpu_buffer_view<T>{m_buffer, offset, core::buffer_span<T>{begin, count}};
         }
 
+        /**
+         * @brief Returns @c true if slice<T>(count) fits in the remaining space, alignment included.
+         */
+        template<class T>
+        [[nodiscard]] bool can_slice(size_t count) const noexcept
+        {
+            return slice_offset<T>() + sizeof(T) * count <= m_data.size();
+        }
+
         /**
          * @brief Returns the total buffer capacity in bytes.
          */
@@ -174,6 +182,14 @@ namespace tavros::renderer
             m_cursor = 0;
         }
 
+    private:
+        template<class T>
+        size_t slice_offset() const noexcept
+        {
+            const size_t align = alignof(T) > 256 ? alignof(T) : 256;
+            return tavros::math::align_up(m_cursor, align); // TODO: fixit. tavros::math::align_up(m_cursor + m_data.begin(), alignof(T))
+        }
+
     private:
         rhi::graphics_device*    m_gdevice = nullptr;
         rhi::buffer_handle       m_buffer;
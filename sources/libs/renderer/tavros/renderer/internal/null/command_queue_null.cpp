@@ -0,0 +1,736 @@
+#include <tavros/renderer/internal/null/command_queue_null.hpp>
+
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/math/functions/basic_math.hpp>
+#include <tavros/renderer/rhi/string_utils.hpp>
+
+#include <cstring>
+
+namespace
+{
+    tavros::core::logger logger("command_queue_null");
+
+    size_t index_size(tavros::renderer::rhi::index_buffer_format format) noexcept
+    {
+        return format == tavros::renderer::rhi::index_buffer_format::u16 ? 2 : 4;
+    }
+} // namespace
+
+namespace tavros::renderer::rhi
+{
+
+    command_queue_null::command_queue_null(graphics_device_null* device, null_device_statistics& stats) noexcept
+        : m_device(device)
+        , m_stats(&stats)
+    {
+    }
+
+    void command_queue_null::bind_pipeline(pipeline_handle pipeline)
+    {
+        auto* p = m_device->find(pipeline);
+        if (!p) {
+            ::logger.error("Failed to bind pipeline {}: not found", pipeline);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (p->is_compute && m_current_framebuffer) {
+            ::logger.error("Failed to bind compute pipeline {}: render pass {} is active", pipeline, m_current_framebuffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        m_current_pipeline = pipeline;
+        ++m_stats->pipeline_binds;
+    }
+
+    void command_queue_null::bind_vertex_buffers(core::buffer_view<bind_buffer_info> buffers)
+    {
+        auto* p = m_device->find(m_current_pipeline);
+        if (!p) {
+            ::logger.error("Failed to bind vertex buffers: no pipeline is bound");
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (buffers.size() != p->info.bindings.size()) {
+            ::logger.error(
+                "Failed to bind vertex buffers: buffers size {} mismatch with pipeline bindings size {}",
+                fmt::styled_param(buffers.size()),
+                fmt::styled_param(p->info.bindings.size())
+            );
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        for (auto& buf : buffers) {
+            auto* b = m_device->find(buf.buffer);
+            if (!b) {
+                ::logger.error("Failed to bind vertex buffers: buffer {} not found", buf.buffer);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (b->info.usage != buffer_usage::vertex) {
+                ::logger.error("Failed to bind vertex buffers: buffer {} not an vertex buffer", buf.buffer);
+                ++m_stats->validation_errors;
+                return;
+            }
+        }
+
+        m_stats->buffer_binds += buffers.size();
+    }
+
+    void command_queue_null::bind_index_buffer(const bind_index_buffer_info& info)
+    {
+        auto* b = m_device->find(info.buffer);
+        if (!b) {
+            ::logger.error("Failed to bind index buffer: buffer {} not found", info.buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (b->info.usage != buffer_usage::index) {
+            ::logger.error("Failed to bind index buffer: buffer {} not an index buffer", info.buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        m_current_index_buffer = info.buffer;
+        m_current_index_buffer_format = info.format;
+        ++m_stats->buffer_binds;
+    }
+
+    void command_queue_null::bind_shader_buffers(core::buffer_view<buffer_binding> buffers)
+    {
+        for (uint32 i = 0; i < buffers.size(); ++i) {
+            auto& buf = buffers[i];
+
+            auto* b = m_device->find(buf.buffer);
+            if (!b) {
+                ::logger.error("Failed to bind shader buffer {}: buffer not found", buf.buffer);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (b->info.usage != buffer_usage::constant && b->info.usage != buffer_usage::storage && b->info.usage != buffer_usage::indirect) {
+                ::logger.error(
+                    "Failed to bind shader binding: buffer {} binding {} has invalid usage (expected `constant`, `storage` or `indirect`, got {})",
+                    buf.buffer,
+                    fmt::styled_param(i),
+                    b->info.usage
+                );
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (static_cast<size_t>(buf.offset) + buf.size > b->info.size) {
+                ::logger.error(
+                    "Failed to bind shader buffer {}: offset {} + size {} exceeds buffer size {}",
+                    buf.buffer,
+                    fmt::styled_param(buf.offset),
+                    fmt::styled_param(buf.size),
+                    fmt::styled_param(b->info.size)
+                );
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            ++m_stats->buffer_binds;
+        }
+    }
+
+    void command_queue_null::bind_shader_textures(core::buffer_view<texture_binding> textures)
+    {
+        for (auto& bind : textures) {
+            auto* t = m_device->find(bind.texture);
+            if (!t) {
+                ::logger.error("Failed to bind shader texture {}: texture not found", bind.texture);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (!t->info.usage.has_flag(texture_usage::sampled)) {
+                ::logger.error("Failed to bind shader texture {}: texture is not sampled", bind.texture);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (!m_device->find(bind.sampler)) {
+                ::logger.error("Failed to bind shader texture {}: sampler {} not found", bind.texture, bind.sampler);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            ++m_stats->texture_binds;
+        }
+    }
+
+    void command_queue_null::bind_storage_images(core::buffer_view<image_binding> images)
+    {
+        for (auto& bind : images) {
+            auto* t = m_device->find(bind.texture);
+            if (!t) {
+                ::logger.error("Failed to bind storage image {}: texture not found", bind.texture);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (!t->info.usage.has_flag(texture_usage::storage)) {
+                ::logger.error("Failed to bind storage image {}: texture is not a storage texture", bind.texture);
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            if (bind.mip_level >= t->info.mip_levels) {
+                ::logger.error(
+                    "Failed to bind storage image {}: mip level {} exceeds mip levels {}",
+                    bind.texture,
+                    fmt::styled_param(bind.mip_level),
+                    fmt::styled_param(t->info.mip_levels)
+                );
+                ++m_stats->validation_errors;
+                return;
+            }
+
+            ++m_stats->image_binds;
+        }
+    }
+
+    void command_queue_null::begin_rendering(framebuffer_handle framebuffer)
+    {
+        if (m_current_framebuffer) {
+            ::logger.error("Failed to begin rendering {}: previous rendering {} not ended", framebuffer, m_current_framebuffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (!m_device->find(framebuffer)) {
+            ::logger.error("Failed to begin rendering {}: framebuffer not found", framebuffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        m_current_framebuffer = framebuffer;
+        ++m_stats->render_passes;
+    }
+
+    void command_queue_null::end_rendering()
+    {
+        if (!m_current_framebuffer) {
+            ::logger.error("Failed to end rendering: not started");
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        // Pipelines are bound per pass
+        m_current_framebuffer = {};
+        m_current_pipeline = {};
+    }
+
+    void command_queue_null::set_viewport(const viewport_info& viewport)
+    {
+        if (viewport.width < 0 || viewport.height < 0) {
+            ::logger.error("Failed to set viewport: negative size {}x{}", viewport.width, viewport.height);
+            ++m_stats->validation_errors;
+        }
+    }
+
+    void command_queue_null::set_scissor(const scissor_info& scissor)
+    {
+        if (!m_current_framebuffer) {
+            ::logger.error("Failed to set scissor: no framebuffer is bound");
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (scissor.width < 0 || scissor.height < 0) {
+            ::logger.error("Failed to set scissor: negative size {}x{}", scissor.width, scissor.height);
+            ++m_stats->validation_errors;
+        }
+    }
+
+    bool command_queue_null::can_draw(const char* what, uint32 instance_count)
+    {
+        if (!m_current_framebuffer) {
+            ::logger.error("Failed to {}: no framebuffer is bound", what);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        if (!m_current_pipeline) {
+            ::logger.error("Failed to {}: no pipeline is bound", what);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        auto* p = m_device->find(m_current_pipeline);
+        if (!p) {
+            ::logger.error("Failed to {}: pipeline {} not found", what, m_current_pipeline);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        if (p->is_compute) {
+            ::logger.error("Failed to {}: pipeline {} is a compute pipeline", what, m_current_pipeline);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        if (instance_count == 0) {
+            ::logger.warning("Failed to {}: instance count {} must be at least 1", what, fmt::styled_param(instance_count));
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        return true;
+    }
+
+    void command_queue_null::draw(uint32 vertex_count, uint32 first_vertex, uint32 instance_count, uint32 first_instance)
+    {
+        TAV_UNUSED(first_vertex);
+        TAV_UNUSED(first_instance);
+
+        if (!can_draw("draw", instance_count)) {
+            return;
+        }
+
+        ++m_stats->draws;
+        m_stats->vertices += static_cast<uint64>(vertex_count) * instance_count;
+        m_stats->instances += instance_count;
+    }
+
+    void command_queue_null::draw_indexed(uint32 index_count, uint32 first_index, uint32 vertex_offset, uint32 instance_count, uint32 first_instance)
+    {
+        TAV_UNUSED(vertex_offset);
+        TAV_UNUSED(first_instance);
+
+        if (!can_draw("draw indexed", instance_count)) {
+            return;
+        }
+
+        auto* b = m_device->find(m_current_index_buffer);
+        if (!b) {
+            ::logger.error("Failed to draw indexed: no index buffer is bound");
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        const size_t end = (static_cast<size_t>(first_index) + index_count) * index_size(m_current_index_buffer_format);
+        if (end > b->info.size) {
+            ::logger.error(
+                "Failed to draw indexed: indices [{}, {}) exceed index buffer {} of size {}",
+                fmt::styled_param(first_index),
+                fmt::styled_param(first_index + index_count),
+                m_current_index_buffer,
+                fmt::styled_param(b->info.size)
+            );
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        ++m_stats->draws;
+        m_stats->vertices += static_cast<uint64>(index_count) * instance_count;
+        m_stats->instances += instance_count;
+    }
+
+    void command_queue_null::draw_indirect(const draw_indirect_info& info)
+    {
+        uint32 draw_count = 0;
+        auto*  records = indirect_records("draw indirect", info, sizeof(draw_indirect_args), draw_count);
+        if (!records) {
+            return;
+        }
+
+        const size_t stride = info.stride != 0 ? info.stride : sizeof(draw_indirect_args);
+        for (uint32 i = 0; i < draw_count; ++i) {
+            draw_indirect_args args;
+            std::memcpy(&args, records + i * stride, sizeof(args));
+
+            ++m_stats->draws;
+            m_stats->vertices += static_cast<uint64>(args.vertex_count) * args.instance_count;
+            m_stats->instances += args.instance_count;
+        }
+        ++m_stats->indirect_draws;
+    }
+
+    void command_queue_null::draw_indexed_indirect(const draw_indirect_info& info)
+    {
+        uint32 draw_count = 0;
+        auto*  records = indirect_records("draw indexed indirect", info, sizeof(draw_indexed_indirect_args), draw_count);
+        if (!records) {
+            return;
+        }
+
+        auto* b = m_device->find(m_current_index_buffer);
+        if (!b) {
+            ::logger.error("Failed to draw indexed indirect: no index buffer is bound");
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        const size_t stride = info.stride != 0 ? info.stride : sizeof(draw_indexed_indirect_args);
+        for (uint32 i = 0; i < draw_count; ++i) {
+            draw_indexed_indirect_args args;
+            std::memcpy(&args, records + i * stride, sizeof(args));
+
+            // Records are written by the application or by shaders, each one is checked on its own
+            const size_t end = (static_cast<size_t>(args.first_index) + args.index_count) * index_size(m_current_index_buffer_format);
+            if (end > b->info.size) {
+                ::logger.error(
+                    "Failed to draw indexed indirect: record {} indices [{}, {}) exceed index buffer {} of size {}",
+                    fmt::styled_param(i),
+                    fmt::styled_param(args.first_index),
+                    fmt::styled_param(static_cast<size_t>(args.first_index) + args.index_count),
+                    m_current_index_buffer,
+                    fmt::styled_param(b->info.size)
+                );
+                ++m_stats->validation_errors;
+                continue;
+            }
+
+            ++m_stats->draws;
+            m_stats->vertices += static_cast<uint64>(args.index_count) * args.instance_count;
+            m_stats->instances += args.instance_count;
+        }
+        ++m_stats->indirect_draws;
+    }
+
+    void command_queue_null::dispatch(uint32 group_count_x, uint32 group_count_y, uint32 group_count_z)
+    {
+        if (!can_dispatch("dispatch")) {
+            return;
+        }
+
+        ++m_stats->dispatches;
+        m_stats->work_groups += static_cast<uint64>(group_count_x) * group_count_y * group_count_z;
+    }
+
+    void command_queue_null::dispatch_indirect(buffer_handle buffer, size_t offset)
+    {
+        if (!can_dispatch("dispatch indirect")) {
+            return;
+        }
+
+        auto* b = m_device->find(buffer);
+        if (!b) {
+            ::logger.error("Failed to dispatch indirect: buffer {} not found", buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (b->info.usage != buffer_usage::indirect) {
+            ::logger.error("Failed to dispatch indirect: buffer {} has invalid usage (expected `indirect`, got {})", buffer, b->info.usage);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (offset % 4 != 0 || offset + sizeof(dispatch_indirect_args) > b->info.size) {
+            ::logger.error("Failed to dispatch indirect: offset {} is misaligned or out of range of buffer {}", fmt::styled_param(offset), buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        dispatch_indirect_args args;
+        std::memcpy(&args, b->memory.data() + offset, sizeof(args));
+
+        ++m_stats->dispatches;
+        m_stats->work_groups += static_cast<uint64>(args.group_count_x) * args.group_count_y * args.group_count_z;
+    }
+
+    void command_queue_null::memory_barrier(core::flags<barrier_scope> scope)
+    {
+        if (scope.bits() == 0) {
+            ::logger.warning("Failed to insert memory barrier: scope is empty");
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        ++m_stats->barriers;
+    }
+
+    bool command_queue_null::can_dispatch(const char* what)
+    {
+        if (m_current_framebuffer) {
+            ::logger.error("Failed to {}: render pass {} is active", what, m_current_framebuffer);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        auto* p = m_device->find(m_current_pipeline);
+        if (!p || !p->is_compute) {
+            ::logger.error("Failed to {}: no compute pipeline is bound", what);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        return true;
+    }
+
+    const uint8* command_queue_null::indirect_records(const char* what, const draw_indirect_info& info, size_t args_size, uint32& draw_count)
+    {
+        // The instance count comes from the records, only the pass state is checked here
+        if (!can_draw(what, 1)) {
+            return nullptr;
+        }
+
+        auto* b = m_device->find(info.buffer);
+        if (!b) {
+            ::logger.error("Failed to {}: buffer {} not found", what, info.buffer);
+            ++m_stats->validation_errors;
+            return nullptr;
+        }
+
+        if (b->info.usage != buffer_usage::indirect) {
+            ::logger.error("Failed to {}: buffer {} has invalid usage (expected `indirect`, got {})", what, info.buffer, b->info.usage);
+            ++m_stats->validation_errors;
+            return nullptr;
+        }
+
+        if (info.offset % 4 != 0 || info.stride % 4 != 0 || (info.stride != 0 && info.stride < args_size)) {
+            ::logger.error(
+                "Failed to {}: offset {} and stride {} must be multiples of 4, stride must be 0 or at least {}",
+                what,
+                fmt::styled_param(info.offset),
+                fmt::styled_param(info.stride),
+                fmt::styled_param(args_size)
+            );
+            ++m_stats->validation_errors;
+            return nullptr;
+        }
+
+        draw_count = info.draw_count;
+        if (draw_count == 0) {
+            return nullptr;
+        }
+
+        const size_t stride = info.stride != 0 ? info.stride : args_size;
+        if (info.offset + (draw_count - 1) * stride + args_size > b->info.size) {
+            ::logger.error(
+                "Failed to {}: {} draws at offset {} exceed buffer {} size {}",
+                what,
+                fmt::styled_param(draw_count),
+                fmt::styled_param(info.offset),
+                info.buffer,
+                fmt::styled_param(b->info.size)
+            );
+            ++m_stats->validation_errors;
+            return nullptr;
+        }
+
+        if (info.count_buffer.valid()) {
+            auto* cb = m_device->find(info.count_buffer);
+            if (!cb || cb->info.usage != buffer_usage::indirect) {
+                ::logger.error("Failed to {}: count buffer {} not found or not an indirect buffer", what, info.count_buffer);
+                ++m_stats->validation_errors;
+                return nullptr;
+            }
+
+            if (info.count_offset % 4 != 0 || info.count_offset + sizeof(uint32) > cb->info.size) {
+                ::logger.error("Failed to {}: count offset {} is misaligned or out of range", what, fmt::styled_param(info.count_offset));
+                ++m_stats->validation_errors;
+                return nullptr;
+            }
+
+            // Like the native count draws, the stored count is clamped to the draw count
+            uint32 count = 0;
+            std::memcpy(&count, cb->memory.data() + info.count_offset, sizeof(count));
+            if (count < draw_count) {
+                draw_count = count;
+            }
+        }
+
+        return b->memory.data() + info.offset;
+    }
+
+    void command_queue_null::signal_fence(fence_handle fence)
+    {
+        auto* f = m_device->find(fence);
+        if (!f) {
+            ::logger.error("Failed to signal fence {}: fence not found", fence);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        f->is_signaled = true;
+    }
+
+    void command_queue_null::wait_for_fence(fence_handle fence)
+    {
+        auto* f = m_device->find(fence);
+        if (!f) {
+            ::logger.error("Failed to wait for fence {}: fence not found", fence);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        // Waiting on a fence nobody signaled would hang a real device
+        if (!f->is_signaled) {
+            ::logger.error("Failed to wait for fence {}: fence is not signaled", fence);
+            ++m_stats->validation_errors;
+        }
+    }
+
+    void command_queue_null::copy_buffer(buffer_handle src_buffer, buffer_handle dst_buffer, size_t size, size_t src_offset, size_t dst_offset)
+    {
+        auto* src = m_device->find(src_buffer);
+        if (!src) {
+            ::logger.error("Failed to copy buffer {}: source buffer not found", src_buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        auto* dst = m_device->find(dst_buffer);
+        if (!dst) {
+            ::logger.error("Failed to copy buffer {}: destination buffer not found", dst_buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (dst_offset + size > dst->info.size) {
+            ::logger.error(
+                "Failed to copy buffer {}: destination buffer overflowed, offset {} + size {} exceeds buffer size {}",
+                dst_buffer,
+                fmt::styled_param(dst_offset),
+                fmt::styled_param(size),
+                fmt::styled_param(dst->info.size)
+            );
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (src_offset + size > src->info.size) {
+            ::logger.error(
+                "Failed to copy buffer {}: source buffer overflowed, offset {} + size {} exceeds buffer size {}",
+                src_buffer,
+                fmt::styled_param(src_offset),
+                fmt::styled_param(size),
+                fmt::styled_param(src->info.size)
+            );
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        // Same access rules as the OpenGL backend
+        if (dst->info.access != buffer_access::gpu_only) {
+            ::logger.error("Failed to copy buffer {}: destination buffer has invalid access {}", dst_buffer, dst->info.access);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (src->info.access != buffer_access::cpu_to_gpu && src->info.access != buffer_access::gpu_only) {
+            ::logger.error("Failed to copy buffer {}: source buffer has invalid access {}", src_buffer, src->info.access);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        std::memmove(dst->memory.data() + dst_offset, src->memory.data() + src_offset, size);
+        ++m_stats->copies;
+        m_stats->copied_bytes += size;
+    }
+
+    bool command_queue_null::check_texture_copy(const char* what, buffer_handle buffer, texture_handle texture, const texture_copy_region& region)
+    {
+        auto* b = m_device->find(buffer);
+        if (!b) {
+            ::logger.error("Failed to {}: buffer {} not found", what, buffer);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        auto* t = m_device->find(texture);
+        if (!t) {
+            ::logger.error("Failed to {}: texture {} not found", what, texture);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        auto& tinfo = t->info;
+        if (region.mip_level >= tinfo.mip_levels) {
+            ::logger.error("Failed to {}: mip_level ({}) exceeds mip levels ({})", what, region.mip_level, tinfo.mip_levels);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        if (region.width == 0 || region.height == 0) {
+            ::logger.error("Failed to {}: region dimensions are invalid (width={}, height={})", what, region.width, region.height);
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        auto max_w = math::mip_side(tinfo.width, region.mip_level);
+        auto max_h = math::mip_side(tinfo.height, region.mip_level);
+        if (region.x_offset + region.width > max_w || region.y_offset + region.height > max_h) {
+            ::logger.error(
+                "Failed to {}: region (x_offset={}, y_offset={}, width={}, height={}) exceeds mip level {} size ({}x{})",
+                what, region.x_offset, region.y_offset, region.width, region.height, region.mip_level, max_w, max_h
+            );
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        if (region.buffer_offset > b->info.size) {
+            ::logger.error("Failed to {}: buffer offset {} exceeds buffer size {}", what, fmt::styled_param(region.buffer_offset), fmt::styled_param(b->info.size));
+            ++m_stats->validation_errors;
+            return false;
+        }
+
+        return true;
+    }
+
+    void command_queue_null::copy_buffer_to_texture(buffer_handle src_buffer, texture_handle dst_texture, const texture_copy_region& region)
+    {
+        if (!check_texture_copy("copy buffer to texture", src_buffer, dst_texture, region)) {
+            return;
+        }
+
+        auto* b = m_device->find(src_buffer);
+        if (b->info.usage != buffer_usage::stage || b->info.access != buffer_access::cpu_to_gpu) {
+            ::logger.error("Failed to copy buffer {} to texture {}: source buffer must be a `cpu_to_gpu` stage buffer", src_buffer, dst_texture);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (!m_device->find(dst_texture)->info.usage.has_flag(texture_usage::transfer_destination)) {
+            ::logger.error("Failed to copy buffer {} to texture {}: destination texture does not have `transfer_destination` usage flag", src_buffer, dst_texture);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        ++m_stats->copies;
+    }
+
+    void command_queue_null::copy_texture_to_buffer(texture_handle src_texture, buffer_handle dst_buffer, const texture_copy_region& region)
+    {
+        if (!check_texture_copy("copy texture to buffer", dst_buffer, src_texture, region)) {
+            return;
+        }
+
+        auto* b = m_device->find(dst_buffer);
+        if (b->info.usage != buffer_usage::stage || b->info.access != buffer_access::gpu_to_cpu) {
+            ::logger.error("Failed to copy texture {} to buffer {}: destination buffer must be a `gpu_to_cpu` stage buffer", src_texture, dst_buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        if (!m_device->find(src_texture)->info.usage.has_flag(texture_usage::transfer_source)) {
+            ::logger.error("Failed to copy texture {} to buffer {}: source texture does not have `transfer_source` usage flag", src_texture, dst_buffer);
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        ++m_stats->copies;
+    }
+
+    void command_queue_null::push_constant(const void* constants, size_t size)
+    {
+        if (!constants || size == 0 || size > k_max_push_constant_buffer_size_bytes) {
+            ::logger.error("Failed to push constant: size {} must be in range [1, {}]", fmt::styled_param(size), fmt::styled_param(k_max_push_constant_buffer_size_bytes));
+            ++m_stats->validation_errors;
+            return;
+        }
+
+        m_stats->push_constant_bytes += size;
+    }
+
+} // namespace tavros::renderer::rhi
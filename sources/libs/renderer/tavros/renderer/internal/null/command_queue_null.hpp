@@ -0,0 +1,90 @@
+#pragma once
+
+#include <tavros/renderer/rhi/command_queue.hpp>
+#include <tavros/renderer/internal/null/graphics_device_null.hpp>
+
+namespace tavros::renderer::rhi
+{
+
+    /**
+     * @brief Executes commands for @ref graphics_device_null.
+     *
+     * Checks every command against the device resources and the current pass state, performs
+     * buffer copies on the CPU memory and updates the device statistics. Compute shaders are
+     * not run, dispatches are only validated and counted.
+     */
+    class command_queue_null final : public command_queue
+    {
+    public:
+        command_queue_null(graphics_device_null* device, null_device_statistics& stats) noexcept;
+
+        ~command_queue_null() override = default;
+
+        void bind_pipeline(pipeline_handle pipeline) override;
+
+        void bind_vertex_buffers(core::buffer_view<bind_buffer_info> buffers) override;
+
+        void bind_index_buffer(const bind_index_buffer_info& info) override;
+
+        void bind_shader_buffers(core::buffer_view<buffer_binding> buffers) override;
+
+        void bind_shader_textures(core::buffer_view<texture_binding> textures) override;
+
+        void bind_storage_images(core::buffer_view<image_binding> images) override;
+
+        void begin_rendering(framebuffer_handle framebuffer) override;
+
+        void end_rendering() override;
+
+        void set_viewport(const viewport_info& viewport) override;
+
+        void set_scissor(const scissor_info& scissor) override;
+
+        void draw(uint32 vertex_count, uint32 first_vertex = 0, uint32 instance_count = 1, uint32 first_instance = 0) override;
+
+        void draw_indexed(uint32 index_count, uint32 first_index = 0, uint32 vertex_offset = 0, uint32 instance_count = 1, uint32 first_instance = 0) override;
+
+        void draw_indirect(const draw_indirect_info& info) override;
+
+        void draw_indexed_indirect(const draw_indirect_info& info) override;
+
+        void dispatch(uint32 group_count_x, uint32 group_count_y = 1, uint32 group_count_z = 1) override;
+
+        void dispatch_indirect(buffer_handle buffer, size_t offset = 0) override;
+
+        void memory_barrier(core::flags<barrier_scope> scope) override;
+
+        void signal_fence(fence_handle fence) override;
+
+        void wait_for_fence(fence_handle fence) override;
+
+        void copy_buffer(buffer_handle src_buffer, buffer_handle dst_buffer, size_t size, size_t src_offset = 0, size_t dst_offset = 0) override;
+
+        void copy_buffer_to_texture(buffer_handle src_buffer, texture_handle dst_texture, const texture_copy_region& region) override;
+
+        void copy_texture_to_buffer(texture_handle src_texture, buffer_handle dst_buffer, const texture_copy_region& region) override;
+
+        void push_constant(const void* constants, size_t size) override;
+
+    private:
+        // Checks the state shared by draw() and draw_indexed()
+        bool can_draw(const char* what, uint32 instance_count);
+
+        // Validates an indirect draw, returns its first argument record and the number of draws to execute
+        const uint8* indirect_records(const char* what, const draw_indirect_info& info, size_t args_size, uint32& draw_count);
+
+        // Checks the state shared by dispatch() and dispatch_indirect()
+        bool can_dispatch(const char* what);
+
+        bool check_texture_copy(const char* what, buffer_handle buffer, texture_handle texture, const texture_copy_region& region);
+
+    private:
+        graphics_device_null*   m_device = nullptr;
+        null_device_statistics* m_stats = nullptr;
+        pipeline_handle         m_current_pipeline;
+        framebuffer_handle      m_current_framebuffer;
+        buffer_handle           m_current_index_buffer;
+        index_buffer_format     m_current_index_buffer_format = index_buffer_format::u16;
+    };
+
+} // namespace tavros::renderer::rhi
@@ -0,0 +1,62 @@
+#include <tavros/renderer/internal/null/frame_composer_null.hpp>
+
+#include <tavros/renderer/internal/null/graphics_device_null.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+namespace
+{
+    tavros::core::logger logger("frame_composer_null");
+}
+
+namespace tavros::renderer::rhi
+{
+
+    frame_composer_null::frame_composer_null(graphics_device_null* device, null_device_statistics& stats, const frame_composer_create_info& info)
+        : m_device(device)
+        , m_stats(&stats)
+        , m_info(info)
+    {
+        m_backbuffer = m_device->create_default_framebuffer(info.width, info.height);
+        ::logger.debug("Frame composer framebuffer {} created", m_backbuffer);
+    }
+
+    frame_composer_null::~frame_composer_null()
+    {
+        m_device->destroy_default_framebuffer(m_backbuffer);
+        ::logger.debug("Frame composer framebuffer {} destroyed", m_backbuffer);
+    }
+
+    void frame_composer_null::resize(uint32 width, uint32 height)
+    {
+        m_info.width = width > 0 ? width : 1;
+        m_info.height = height > 0 ? height : 1;
+
+        if (auto* fb = m_device->find(m_backbuffer)) {
+            fb->info.width = m_info.width;
+            fb->info.height = m_info.height;
+        } else {
+            ::logger.error("Cannot find frame composer framebuffer {}", m_backbuffer);
+        }
+    }
+
+    uint32 frame_composer_null::width() const noexcept
+    {
+        return m_info.width;
+    }
+
+    uint32 frame_composer_null::height() const noexcept
+    {
+        return m_info.height;
+    }
+
+    framebuffer_handle frame_composer_null::backbuffer() const noexcept
+    {
+        return m_backbuffer;
+    }
+
+    void frame_composer_null::present()
+    {
+        ++m_stats->frames;
+    }
+
+} // namespace tavros::renderer::rhi
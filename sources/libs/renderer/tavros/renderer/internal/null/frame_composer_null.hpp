@@ -0,0 +1,34 @@
+#pragma once
+
+#include <tavros/renderer/rhi/frame_composer.hpp>
+
+namespace tavros::renderer::rhi
+{
+    class graphics_device_null;
+    struct null_device_statistics;
+
+    class frame_composer_null : public frame_composer
+    {
+    public:
+        frame_composer_null(graphics_device_null* device, null_device_statistics& stats, const frame_composer_create_info& info);
+
+        ~frame_composer_null() override;
+
+        void resize(uint32 width, uint32 height) override;
+
+        uint32 width() const noexcept override;
+
+        uint32 height() const noexcept override;
+
+        framebuffer_handle backbuffer() const noexcept override;
+
+        void present() override;
+
+    private:
+        graphics_device_null*      m_device;
+        null_device_statistics*    m_stats;
+        frame_composer_create_info m_info;
+        framebuffer_handle         m_backbuffer;
+    };
+
+} // namespace tavros::renderer::rhi
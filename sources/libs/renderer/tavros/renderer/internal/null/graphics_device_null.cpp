@@ -0,0 +1,579 @@
+#include <tavros/renderer/internal/null/graphics_device_null.hpp>
+
+#include <tavros/renderer/internal/null/command_queue_null.hpp>
+#include <tavros/renderer/internal/null/frame_composer_null.hpp>
+#include <tavros/renderer/rhi/string_utils.hpp>
+#include <tavros/core/logger/logger.hpp>
+
+#include <bit>
+
+namespace
+{
+    tavros::core::logger logger("graphics_device_null");
+
+    using namespace tavros::renderer::rhi;
+
+    // Shaders are not compiled, only the kind of the program is known
+    class null_shader_reflect final : public shader_reflect
+    {
+    public:
+        explicit null_shader_reflect(bool is_compute) noexcept
+        {
+            m_compute.is_compute = is_compute;
+        }
+
+        tavros::core::buffer_view<vertex_attribute_reflect> vertex_attributes() const noexcept override
+        {
+            return {};
+        }
+
+        tavros::core::buffer_view<shader_resource_reflect> shader_resources() const noexcept override
+        {
+            return {};
+        }
+
+        tavros::core::buffer_view<constant_block_reflect> constant_blocks() const noexcept override
+        {
+            return {};
+        }
+
+        tavros::core::buffer_view<member_reflect> constant_block_members(size_t constant_block_index) const noexcept override
+        {
+            TAV_UNUSED(constant_block_index);
+            return {};
+        }
+
+        tavros::core::buffer_view<storage_block_reflect> storage_blocks() const noexcept override
+        {
+            return {};
+        }
+
+        tavros::core::buffer_view<output_reflect> outputs() const noexcept override
+        {
+            return {};
+        }
+
+        const compute_reflect& compute() const noexcept override
+        {
+            return m_compute;
+        }
+
+    private:
+        compute_reflect m_compute;
+    };
+
+    // Pools resolve a null handle to the first slot, so null handles are rejected here
+    template<class Pool, class Handle>
+    auto* find_in(Pool& pool, Handle handle) noexcept
+    {
+        return handle.valid() ? pool.find(handle) : nullptr;
+    }
+
+    template<class Pool, class Handle>
+    bool erase_in(Pool& pool, Handle handle) noexcept
+    {
+        return handle.valid() && pool.erase(handle);
+    }
+} // namespace
+
+namespace tavros::renderer::rhi
+{
+
+    graphics_device_null::graphics_device_null()
+    {
+        m_null_queue = core::make_unique<command_queue_null>(this, m_stats);
+        ::logger.debug("graphics_device_null created");
+    }
+
+    graphics_device_null::~graphics_device_null()
+    {
+        m_recorders.clear();
+        m_null_queue = nullptr;
+
+        // Composers release their backbuffers, so they go first
+        m_composers.clear();
+
+        const size_t leaked = m_samplers.size() + m_shaders.size() + m_textures.size() + m_pipelines.size() + m_framebuffers.size() + m_buffers.size() + m_fences.size();
+        if (leaked != 0) {
+            ::logger.warning("graphics_device_null destroyed with {} live resources", fmt::styled_param(leaked));
+        }
+        ::logger.debug("graphics_device_null destroyed");
+    }
+
+    frame_composer_handle graphics_device_null::create_frame_composer(const frame_composer_create_info& info)
+    {
+        if (info.width == 0 || info.height == 0) {
+            ::logger.error("Failed to create frame composer: invalid size {}x{}", info.width, info.height);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        auto composer = core::make_unique<frame_composer_null>(this, m_stats, info);
+        auto h = m_composers.push(null_composer{info, std::move(composer)});
+        ++m_stats.resources_created;
+        ::logger.debug("Frame composer {} created", h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_frame_composer(frame_composer_handle composer)
+    {
+        if (::erase_in(m_composers, composer)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Frame composer {} destroyed", composer);
+        } else {
+            ::logger.error("Failed to destroy frame composer {}: not found", composer);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    frame_composer* graphics_device_null::get_frame_composer_ptr(frame_composer_handle composer)
+    {
+        if (auto* fc = ::find_in(m_composers, composer)) {
+            return fc->composer_ptr.get();
+        }
+        ::logger.error("Failed to get frame composer {}: not found", composer);
+        return nullptr;
+    }
+
+    command_queue* graphics_device_null::create_command_queue()
+    {
+        return m_recorders.acquire();
+    }
+
+    void graphics_device_null::submit_command_queue(command_queue* queue)
+    {
+        auto* recorder = m_recorders.find(queue);
+
+        if (!recorder) {
+            if (m_recorders.owns(queue)) {
+                ::logger.error("Failed to submit command queue: queue was already submitted");
+            } else {
+                ::logger.error("Failed to submit command queue: queue was not created by this device");
+            }
+            ++m_stats.validation_errors;
+            return;
+        }
+
+        if (m_dump_commands) {
+            dump(recorder->stream());
+        }
+
+        replay(recorder->stream(), *m_null_queue);
+        ++m_stats.submits;
+        m_stats.commands += recorder->stream().size();
+
+        m_recorders.release(recorder);
+    }
+
+    void graphics_device_null::dump(const command_stream& stream) const
+    {
+        ::logger.info("Submit {}: {} commands, {} bytes", fmt::styled_param(m_stats.submits), fmt::styled_param(stream.size()), fmt::styled_param(stream.size_bytes()));
+
+        size_t index = 0;
+        for (const auto cmd : stream) {
+            switch (cmd.type()) {
+            case command_type::draw: {
+                const auto& c = cmd.as<commands::draw>();
+                ::logger.info("  {:>5} {} vertices {} first {} instances {}", index, cmd.type(), c.vertex_count, c.first_vertex, c.instance_count);
+                break;
+            }
+            case command_type::draw_indexed: {
+                const auto& c = cmd.as<commands::draw_indexed>();
+                ::logger.info("  {:>5} {} indices {} first {} instances {}", index, cmd.type(), c.index_count, c.first_index, c.instance_count);
+                break;
+            }
+            case command_type::dispatch: {
+                const auto& c = cmd.as<commands::dispatch>();
+                ::logger.info("  {:>5} {} groups {}x{}x{}", index, cmd.type(), c.group_count_x, c.group_count_y, c.group_count_z);
+                break;
+            }
+            case command_type::bind_pipeline:
+                ::logger.info("  {:>5} {} {}", index, cmd.type(), cmd.as<commands::bind_pipeline>().pipeline);
+                break;
+            case command_type::begin_rendering:
+                ::logger.info("  {:>5} {} {}", index, cmd.type(), cmd.as<commands::begin_rendering>().framebuffer);
+                break;
+            case command_type::copy_buffer: {
+                const auto& c = cmd.as<commands::copy_buffer>();
+                ::logger.info("  {:>5} {} {} -> {} size {}", index, cmd.type(), c.src_buffer, c.dst_buffer, c.size);
+                break;
+            }
+            default:
+                ::logger.info("  {:>5} {}", index, cmd.type());
+                break;
+            }
+            ++index;
+        }
+    }
+
+    shader_handle graphics_device_null::create_shader(const shader_create_info& info)
+    {
+        const bool is_compute = !info.compute_shader_source.empty();
+        if (is_compute && (!info.vertex_shader_source.empty() || !info.fragment_shader_source.empty())) {
+            ::logger.error("Failed to create shader: compute source can't be combined with vertex or fragment sources");
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        if (!is_compute && (info.vertex_shader_source.empty() || info.fragment_shader_source.empty())) {
+            ::logger.error("Failed to create shader: vertex and fragment sources are required");
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        auto h = m_shaders.push(null_shader{core::make_unique<null_shader_reflect>(is_compute)});
+        ++m_stats.resources_created;
+        ::logger.debug("Shader {} created", h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_shader(shader_handle shader)
+    {
+        if (::erase_in(m_shaders, shader)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Shader {} destroyed", shader);
+        } else {
+            ::logger.error("Failed to destroy shader {}: not found", shader);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    const shader_reflect* graphics_device_null::get_shader_reflect_ptr(shader_handle shader) const noexcept
+    {
+        if (auto* s = ::find_in(m_shaders, shader)) {
+            return s->reflect.get();
+        }
+        return nullptr;
+    }
+
+    sampler_handle graphics_device_null::create_sampler(const sampler_create_info& info)
+    {
+        auto h = m_samplers.push(null_sampler{info});
+        ++m_stats.resources_created;
+        ::logger.debug("Sampler {} created", h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_sampler(sampler_handle handle)
+    {
+        if (::erase_in(m_samplers, handle)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Sampler {} destroyed", handle);
+        } else {
+            ::logger.error("Failed to destroy sampler {}: not found", handle);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    texture_handle graphics_device_null::create_texture(const texture_create_info& info)
+    {
+        if (info.width == 0 || info.height == 0 || info.depth == 0) {
+            ::logger.error("Failed to create texture: invalid size {}x{}x{}", info.width, info.height, info.depth);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        if (info.mip_levels == 0 || info.array_layers == 0) {
+            ::logger.error("Failed to create texture: mip levels {} and array layers {} must be at least 1", info.mip_levels, info.array_layers);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        if (!std::has_single_bit(info.sample_count)) {
+            ::logger.error("Failed to create texture: sample count {} must be a power of two", info.sample_count);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        auto h = m_textures.push(null_texture{info});
+        ++m_stats.resources_created;
+        ::logger.debug("Texture ({}) {} created", info.type, h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_texture(texture_handle handle)
+    {
+        if (::erase_in(m_textures, handle)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Texture {} destroyed", handle);
+        } else {
+            ::logger.error("Failed to destroy texture {}: not found", handle);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    pipeline_handle graphics_device_null::create_pipeline(const pipeline_create_info& info)
+    {
+        auto* sh = ::find_in(m_shaders, info.shader_program);
+        if (!sh) {
+            ::logger.error("Failed to create pipeline: shader {} not found", info.shader_program);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        if (sh->reflect->compute().is_compute) {
+            ::logger.error("Failed to create pipeline: shader {} is a compute shader, use create_compute_pipeline()", info.shader_program);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        auto h = m_pipelines.push(null_pipeline{info});
+        ++m_stats.resources_created;
+        ::logger.debug("Pipeline {} created", h);
+        return h;
+    }
+
+    pipeline_handle graphics_device_null::create_compute_pipeline(const compute_pipeline_create_info& info)
+    {
+        auto* sh = ::find_in(m_shaders, info.shader_program);
+        if (!sh) {
+            ::logger.error("Failed to create compute pipeline: shader {} not found", info.shader_program);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        if (!sh->reflect->compute().is_compute) {
+            ::logger.error("Failed to create compute pipeline: shader {} is not a compute shader", info.shader_program);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        pipeline_create_info pipeline_info;
+        pipeline_info.shader_program = info.shader_program;
+
+        auto h = m_pipelines.push(null_pipeline{pipeline_info, true});
+        ++m_stats.resources_created;
+        ::logger.debug("Compute pipeline {} created", h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_pipeline(pipeline_handle pipeline)
+    {
+        if (::erase_in(m_pipelines, pipeline)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Pipeline {} destroyed", pipeline);
+        } else {
+            ::logger.error("Failed to destroy pipeline {}: not found", pipeline);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    framebuffer_handle graphics_device_null::create_framebuffer(const framebuffer_create_info& info)
+    {
+        if (info.width == 0 || info.height == 0) {
+            ::logger.error("Failed to create framebuffer: invalid size {}x{}", info.width, info.height);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        for (const auto& attachment : info.color_attachments) {
+            auto* t = ::find_in(m_textures, attachment.target);
+            if (!t) {
+                ::logger.error("Failed to create framebuffer: color attachment {} not found", attachment.target);
+                ++m_stats.validation_errors;
+                return {};
+            }
+
+            if (!t->info.usage.has_flag(texture_usage::render_target)) {
+                ::logger.error("Failed to create framebuffer: color attachment {} is not a render target", attachment.target);
+                ++m_stats.validation_errors;
+                return {};
+            }
+
+            if (t->info.width != info.width || t->info.height != info.height) {
+                ::logger.error("Failed to create framebuffer: color attachment {} size {}x{} mismatch with {}x{}", attachment.target, t->info.width, t->info.height, info.width, info.height);
+                ++m_stats.validation_errors;
+                return {};
+            }
+        }
+
+        auto h = m_framebuffers.push(null_framebuffer{info, false});
+        ++m_stats.resources_created;
+        ::logger.debug("Framebuffer {} created", h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_framebuffer(framebuffer_handle framebuffer)
+    {
+        auto* fb = ::find_in(m_framebuffers, framebuffer);
+        if (!fb) {
+            ::logger.error("Failed to destroy framebuffer {}: not found", framebuffer);
+            ++m_stats.validation_errors;
+            return;
+        }
+
+        if (fb->is_default) {
+            ::logger.error("Failed to destroy framebuffer {}: framebuffer is owned by a frame composer", framebuffer);
+            ++m_stats.validation_errors;
+            return;
+        }
+
+        ::erase_in(m_framebuffers, framebuffer);
+        ++m_stats.resources_destroyed;
+        ::logger.debug("Framebuffer {} destroyed", framebuffer);
+    }
+
+    framebuffer_handle graphics_device_null::create_default_framebuffer(uint32 width, uint32 height)
+    {
+        null_framebuffer fb;
+        fb.info.width = width;
+        fb.info.height = height;
+        fb.info.color_attachments.push_back({texture_handle{}, texture_handle{}, load_op::clear, store_op::store, {0.0f, 0.0f, 0.0f, 0.0f}});
+        fb.is_default = true;
+        return m_framebuffers.push(std::move(fb));
+    }
+
+    void graphics_device_null::destroy_default_framebuffer(framebuffer_handle framebuffer) noexcept
+    {
+        ::erase_in(m_framebuffers, framebuffer);
+    }
+
+    buffer_handle graphics_device_null::create_buffer(const buffer_create_info& info)
+    {
+        if (info.size == 0) {
+            ::logger.error("Buffer creation: ({}) of size 0 is not allowed", info.usage);
+            ++m_stats.validation_errors;
+            return {};
+        }
+
+        null_buffer b;
+        b.info = info;
+        b.memory.resize(info.size);
+        auto h = m_buffers.push(std::move(b));
+        ++m_stats.resources_created;
+        ::logger.debug("Buffer ({}) {} created", info.usage, h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_buffer(buffer_handle buffer)
+    {
+        if (::erase_in(m_buffers, buffer)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Buffer {} destroyed", buffer);
+        } else {
+            ::logger.error("Failed to destroy buffer {}: not found", buffer);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    fence_handle graphics_device_null::create_fence()
+    {
+        auto h = m_fences.push(null_fence{});
+        ++m_stats.resources_created;
+        ::logger.debug("Fence {} created", h);
+        return h;
+    }
+
+    void graphics_device_null::destroy_fence(fence_handle fence)
+    {
+        if (::erase_in(m_fences, fence)) {
+            ++m_stats.resources_destroyed;
+            ::logger.debug("Fence {} destroyed", fence);
+        } else {
+            ::logger.error("Failed to destroy fence {}: not found", fence);
+            ++m_stats.validation_errors;
+        }
+    }
+
+    bool graphics_device_null::is_fence_signaled(fence_handle fence)
+    {
+        if (auto* f = ::find_in(m_fences, fence)) {
+            return f->is_signaled;
+        }
+        ::logger.error("Failed to check fence {}: fence not found", fence);
+        ++m_stats.validation_errors;
+        return false;
+    }
+
+    bool graphics_device_null::client_wait_for_fence(fence_handle fence, uint64 timeout_ns)
+    {
+        TAV_UNUSED(timeout_ns);
+
+        // Submitted work is already complete, an unsignaled fence will never be signaled
+        return is_fence_signaled(fence);
+    }
+
+    core::buffer_span<uint8> graphics_device_null::map_buffer(buffer_handle buffer, size_t offset, size_t size)
+    {
+        auto* b = ::find_in(m_buffers, buffer);
+        if (!b) {
+            ::logger.error("Failed to map buffer {}: buffer not found", buffer);
+            ++m_stats.validation_errors;
+            return nullptr;
+        }
+
+        if (offset + size > b->info.size) {
+            ::logger.error(
+                "Failed to map buffer {}: offset {} + size {} exceeds buffer size {}",
+                buffer,
+                fmt::styled_param(offset),
+                fmt::styled_param(size),
+                fmt::styled_param(b->info.size)
+            );
+            ++m_stats.validation_errors;
+            return nullptr;
+        }
+
+        if (offset > 0 && size == 0) {
+            ::logger.error("Failed to map buffer {}: offset {} is set but size {} is not set", buffer, fmt::styled_param(offset), fmt::styled_param(size));
+            ++m_stats.validation_errors;
+            return nullptr;
+        }
+
+        if (!(b->info.access == buffer_access::cpu_to_gpu || b->info.access == buffer_access::gpu_to_cpu)) {
+            ::logger.error("Failed to map buffer {}: buffer has invalid access {}", buffer, b->info.access);
+            ++m_stats.validation_errors;
+            return nullptr;
+        }
+
+        if (size == 0) {
+            size = b->info.size;
+        }
+
+        b->is_mapped = true;
+        return core::buffer_span<uint8>(b->memory.data() + offset, size);
+    }
+
+    void graphics_device_null::unmap_buffer(buffer_handle buffer)
+    {
+        auto* b = ::find_in(m_buffers, buffer);
+        if (!b) {
+            ::logger.error("Failed to unmap buffer {}: buffer not found", buffer);
+            ++m_stats.validation_errors;
+            return;
+        }
+
+        b->is_mapped = false;
+    }
+
+    null_sampler* graphics_device_null::find(sampler_handle handle) noexcept
+    {
+        return ::find_in(m_samplers, handle);
+    }
+
+    null_texture* graphics_device_null::find(texture_handle handle) noexcept
+    {
+        return ::find_in(m_textures, handle);
+    }
+
+    null_pipeline* graphics_device_null::find(pipeline_handle handle) noexcept
+    {
+        return ::find_in(m_pipelines, handle);
+    }
+
+    null_framebuffer* graphics_device_null::find(framebuffer_handle handle) noexcept
+    {
+        return ::find_in(m_framebuffers, handle);
+    }
+
+    null_buffer* graphics_device_null::find(buffer_handle handle) noexcept
+    {
+        return ::find_in(m_buffers, handle);
+    }
+
+    null_fence* graphics_device_null::find(fence_handle handle) noexcept
+    {
+        return ::find_in(m_fences, handle);
+    }
+
+} // namespace tavros::renderer::rhi
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <tavros/renderer/rhi/graphics_device.hpp>
+#include <tavros/renderer/rhi/frame_composer.hpp>
+#include <tavros/renderer/rhi/recording_queue_pool.hpp>
+#include <tavros/renderer/rhi/shader_reflect.hpp>
+#include <tavros/core/resource/object_pool.hpp>
+#include <tavros/core/containers/vector.hpp>
+
+
+namespace tavros::renderer::rhi
+{
+
+    /**
+     * @brief Counters collected by @ref graphics_device_null.
+     *
+     * Command counters are incremented when submitted queues are executed, not while recording.
+     */
+    struct null_device_statistics
+    {
+        uint64 frames = 0;                ///< Number of presented frames
+        uint64 submits = 0;               ///< Number of submitted command queues
+        uint64 commands = 0;              ///< Number of executed commands
+        uint64 render_passes = 0;         ///< Number of begin_rendering() calls
+        uint64 pipeline_binds = 0;        ///< Number of bind_pipeline() calls
+        uint64 buffer_binds = 0;          ///< Number of bound vertex, index and shader buffers
+        uint64 texture_binds = 0;         ///< Number of bound shader textures
+        uint64 draws = 0;                 ///< Number of executed draws, indirect records included
+        uint64 indirect_draws = 0;        ///< Number of draw_indirect() and draw_indexed_indirect() calls
+        uint64 dispatches = 0;            ///< Number of executed dispatch() and dispatch_indirect() calls
+        uint64 work_groups = 0;           ///< Number of dispatched work groups
+        uint64 image_binds = 0;           ///< Number of bound storage images
+        uint64 barriers = 0;              ///< Number of memory_barrier() calls
+        uint64 vertices = 0;              ///< Vertices and indices drawn, multiplied by the instance count
+        uint64 instances = 0;             ///< Number of drawn instances
+        uint64 push_constant_bytes = 0;   ///< Bytes pushed with push_constant()
+        uint64 copies = 0;                ///< Number of buffer and texture copies
+        uint64 copied_bytes = 0;          ///< Bytes copied between buffers and textures
+        uint64 validation_errors = 0;     ///< Number of rejected commands and resource calls
+        uint64 resources_created = 0;     ///< Number of created resources of any kind
+        uint64 resources_destroyed = 0;   ///< Number of destroyed resources of any kind
+    };
+
+    struct null_composer
+    {
+        frame_composer_create_info       info;
+        core::unique_ptr<frame_composer> composer_ptr;
+    };
+
+    struct null_sampler
+    {
+        sampler_create_info info;
+    };
+
+    struct null_texture
+    {
+        texture_create_info info;
+    };
+
+    struct null_pipeline
+    {
+        pipeline_create_info info;
+        bool                 is_compute = false;
+    };
+
+    struct null_framebuffer
+    {
+        framebuffer_create_info info;
+        bool                    is_default = false;
+    };
+
+    struct null_buffer
+    {
+        buffer_create_info  info;
+        core::vector<uint8> memory;
+        bool                is_mapped = false;
+    };
+
+    struct null_shader
+    {
+        core::unique_ptr<shader_reflect> reflect;
+    };
+
+    struct null_fence
+    {
+        bool is_signaled = false;
+    };
+
+    /**
+     * @brief Graphics device that needs no GPU and no window.
+     *
+     * Resources live in handle pools like on a real device, buffers are backed by CPU memory
+     * so mapping, writing and buffer to buffer copies behave as expected. Submitted queues are
+     * executed by a command queue that validates every command against the current state and
+     * counts it in @ref statistics(). Shaders are not compiled, their reflection is empty.
+     *
+     * Intended for tests and CPU-side benchmarks of everything built on top of the RHI.
+     *
+     * Notes:
+     * - Everything completes on submit, fences are signaled as soon as their command is executed.
+     * - Validation failures are logged as errors and counted, the command is skipped.
+     * - With @ref set_command_dump() enabled every submitted command is logged.
+     */
+    class graphics_device_null final : public graphics_device
+    {
+    public:
+        graphics_device_null();
+        ~graphics_device_null() override;
+
+        frame_composer_handle create_frame_composer(const frame_composer_create_info& info) override;
+        void                  destroy_frame_composer(frame_composer_handle composer) override;
+        frame_composer*       get_frame_composer_ptr(frame_composer_handle composer) override;
+
+        command_queue* create_command_queue() override;
+        void           submit_command_queue(command_queue* queue) override;
+
+        shader_handle         create_shader(const shader_create_info& info) override;
+        void                  destroy_shader(shader_handle shader) override;
+        const shader_reflect* get_shader_reflect_ptr(shader_handle shader) const noexcept override;
+
+        sampler_handle create_sampler(const sampler_create_info& info) override;
+        void           destroy_sampler(sampler_handle handle) override;
+
+        texture_handle create_texture(const texture_create_info& info) override;
+        void           destroy_texture(texture_handle handle) override;
+
+        pipeline_handle create_pipeline(const pipeline_create_info& info) override;
+        pipeline_handle create_compute_pipeline(const compute_pipeline_create_info& info) override;
+        void            destroy_pipeline(pipeline_handle pipeline) override;
+
+        framebuffer_handle create_framebuffer(const framebuffer_create_info& info) override;
+        void               destroy_framebuffer(framebuffer_handle framebuffer) override;
+
+        buffer_handle create_buffer(const buffer_create_info& info) override;
+        void          destroy_buffer(buffer_handle buffer) override;
+
+        fence_handle create_fence() override;
+        void         destroy_fence(fence_handle fence) override;
+        bool         is_fence_signaled(fence_handle fence) override;
+        bool         client_wait_for_fence(fence_handle fence, uint64 timeout_ns = std::numeric_limits<uint64>::max()) override;
+
+        core::buffer_span<uint8> map_buffer(buffer_handle buffer, size_t offset = 0, size_t size = 0) override;
+        void                     unmap_buffer(buffer_handle buffer) override;
+
+        /**
+         * @brief Returns the counters collected since creation or the last reset.
+         */
+        [[nodiscard]] const null_device_statistics& statistics() const noexcept
+        {
+            return m_stats;
+        }
+
+        /**
+         * @brief Resets all counters to zero.
+         */
+        void reset_statistics() noexcept
+        {
+            m_stats = {};
+        }
+
+        /**
+         * @brief Enables logging of every submitted command.
+         */
+        void set_command_dump(bool enabled) noexcept
+        {
+            m_dump_commands = enabled;
+        }
+
+        /**
+         * @brief Creates the framebuffer standing for the backbuffer of a frame composer.
+         */
+        framebuffer_handle create_default_framebuffer(uint32 width, uint32 height);
+
+        /**
+         * @brief Destroys a framebuffer created by create_default_framebuffer().
+         */
+        void destroy_default_framebuffer(framebuffer_handle framebuffer) noexcept;
+
+        null_sampler*     find(sampler_handle handle) noexcept;
+        null_texture*     find(texture_handle handle) noexcept;
+        null_pipeline*    find(pipeline_handle handle) noexcept;
+        null_framebuffer* find(framebuffer_handle handle) noexcept;
+        null_buffer*      find(buffer_handle handle) noexcept;
+        null_fence*       find(fence_handle handle) noexcept;
+
+    private:
+        void dump(const command_stream& stream) const;
+
+    private:
+        core::object_pool<null_composer, frame_composer_tag> m_composers;
+        core::object_pool<null_sampler, sampler_tag>         m_samplers;
+        core::object_pool<null_shader, shader_tag>           m_shaders;
+        core::object_pool<null_texture, texture_tag>         m_textures;
+        core::object_pool<null_pipeline, pipeline_tag>       m_pipelines;
+        core::object_pool<null_framebuffer, framebuffer_tag> m_framebuffers;
+        core::object_pool<null_buffer, buffer_tag>           m_buffers;
+        core::object_pool<null_fence, fence_tag>             m_fences;
+
+        null_device_statistics m_stats;
+        bool                   m_dump_commands = false;
+
+        // Executes submitted streams
+        core::unique_ptr<command_queue> m_null_queue;
+
+        // Queues handed out by create_command_queue(), reused after submit
+        recording_queue_pool m_recorders;
+    };
+
+} // namespace tavros::renderer::rhi
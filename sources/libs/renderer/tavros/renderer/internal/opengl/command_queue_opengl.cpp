@@ -51,6 +51,7 @@ namespace tavros::renderer::rhi
 
     command_queue_opengl::command_queue_opengl(graphics_device_opengl* device)
         : m_device(device)
+        , m_state(device->get_state_cache())
     {
         ::logger.debug("command_queue_opengl created");
 
@@ -78,8 +79,18 @@ namespace tavros::renderer::rhi
         auto* p = m_device->get_resources()->find(pipeline);
         if (!p) {
             ::logger.error("Failed to bind pipeline {}: not found", pipeline);
-            GL_CALL(glUseProgram(0));
-            GL_CALL(glBindVertexArray(0));
+            m_state->use_program(0);
+            m_state->bind_vertex_array(0);
+            return;
+        }
+
+        if (p->is_compute) {
+            if (m_current_framebuffer) {
+                ::logger.error("Failed to bind compute pipeline {}: render pass {} is active", pipeline, m_current_framebuffer);
+                return;
+            }
+            m_current_pipeline = pipeline;
+            m_state->use_program(p->cached_prog_obj);
             return;
         }
 
@@ -88,8 +99,8 @@ namespace tavros::renderer::rhi
         const auto* fb = m_device->get_resources()->find(m_current_framebuffer);
         if (!fb) {
             ::logger.error("Failed to bind pipeline {}: framebuffer {} not found", pipeline, m_current_framebuffer);
-            GL_CALL(glUseProgram(0));
-            GL_CALL(glBindVertexArray(0));
+            m_state->use_program(0);
+            m_state->bind_vertex_array(0);
             return;
         }
 
@@ -102,8 +113,8 @@ namespace tavros::renderer::rhi
                 fmt::styled_param(fb_info.color_attachments.size()),
                 fmt::styled_param(info.color_attachments.size())
             );
-            GL_CALL(glUseProgram(0));
-            GL_CALL(glBindVertexArray(0));
+            m_state->use_program(0);
+            m_state->bind_vertex_array(0);
             return;
         }
 
@@ -117,9 +128,9 @@ namespace tavros::renderer::rhi
 
             if (cl.format == pixel_format::none) {
                 // Disable blending for attachment
-                GL_CALL(glBlendFunci(gl_attachment_index, GL_ONE, GL_ZERO));
-                GL_CALL(glBlendEquationi(gl_attachment_index, GL_FUNC_ADD));
-                GL_CALL(glColorMaski(gl_attachment_index, GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE));
+                m_state->blend_func_separate(gl_attachment_index, GL_ONE, GL_ZERO, GL_ONE, GL_ZERO);
+                m_state->blend_equation_separate(gl_attachment_index, GL_FUNC_ADD, GL_FUNC_ADD);
+                m_state->color_mask(gl_attachment_index, GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
                 continue;
             }
 
@@ -132,8 +143,8 @@ namespace tavros::renderer::rhi
                     fmt::styled_param(to_string(cl.format)),
                     fmt::styled_param(to_string(ca_fmt))
                 );
-                GL_CALL(glUseProgram(0));
-                GL_CALL(glBindVertexArray(0));
+                m_state->use_program(0);
+                m_state->bind_vertex_array(0);
                 return;
             }
 
@@ -147,14 +158,14 @@ namespace tavros::renderer::rhi
                 auto alpha_blend_op = to_gl_blend_op(bs.alpha_blend_op);
 
                 // Enable blending for i attachment
-                GL_CALL(glEnablei(GL_BLEND, gl_attachment_index));
-                GL_CALL(glBlendFuncSeparatei(gl_attachment_index, src_color_factor, dst_color_factor, src_alpha_factor, dst_alpha_factor));
-                GL_CALL(glBlendEquationSeparatei(gl_attachment_index, color_blend_op, alpha_blend_op));
+                m_state->set_blend_enabled(gl_attachment_index, true);
+                m_state->blend_func_separate(gl_attachment_index, src_color_factor, dst_color_factor, src_alpha_factor, dst_alpha_factor);
+                m_state->blend_equation_separate(gl_attachment_index, color_blend_op, alpha_blend_op);
             } else {
                 // Disable blending for i attachment
-                GL_CALL(glDisablei(GL_BLEND, gl_attachment_index));
-                GL_CALL(glBlendFunci(gl_attachment_index, GL_ONE, GL_ZERO));
-                GL_CALL(glBlendEquationi(gl_attachment_index, GL_FUNC_ADD));
+                m_state->set_blend_enabled(gl_attachment_index, false);
+                m_state->blend_func_separate(gl_attachment_index, GL_ONE, GL_ZERO, GL_ONE, GL_ZERO);
+                m_state->blend_equation_separate(gl_attachment_index, GL_FUNC_ADD, GL_FUNC_ADD);
             }
 
             // Enable color mask
@@ -162,13 +173,13 @@ namespace tavros::renderer::rhi
             auto g_color_enabled = to_gl_bool(cl.mask.has_flag(color_mask::green));
             auto b_color_enabled = to_gl_bool(cl.mask.has_flag(color_mask::blue));
             auto a_color_enabled = to_gl_bool(cl.mask.has_flag(color_mask::alpha));
-            GL_CALL(glColorMaski(gl_attachment_index, r_color_enabled, g_color_enabled, b_color_enabled, a_color_enabled));
+            m_state->color_mask(gl_attachment_index, r_color_enabled, g_color_enabled, b_color_enabled, a_color_enabled);
         }
 
         if (info.depth_stencil_attachment.format == pixel_format::none) {
             // Disable depth test and stencil test
-            GL_CALL(glDisable(GL_DEPTH_TEST));
-            GL_CALL(glDisable(GL_STENCIL_TEST));
+            m_state->set_enabled(GL_DEPTH_TEST, false);
+            m_state->set_enabled(GL_STENCIL_TEST, false);
         } else {
             if (fb->depth_stencil_attachment_format != info.depth_stencil_attachment.format) {
                 ::logger.error(
@@ -177,114 +188,114 @@ namespace tavros::renderer::rhi
                     fmt::styled_param(to_string(fb->depth_stencil_attachment_format)),
                     fmt::styled_param(to_string(info.depth_stencil_attachment.format))
                 );
-                GL_CALL(glUseProgram(0));
-                GL_CALL(glBindVertexArray(0));
+                m_state->use_program(0);
+                m_state->bind_vertex_array(0);
                 return;
             }
 
             // depth test
             if (info.depth_stencil_attachment.depth_test_enable) {
-                GL_CALL(glEnable(GL_DEPTH_TEST));
+                m_state->set_enabled(GL_DEPTH_TEST, true);
 
                 // depth write
                 auto depth_write = to_gl_bool(info.depth_stencil_attachment.depth_write_enable);
-                GL_CALL(glDepthMask(depth_write));
+                m_state->depth_mask(depth_write);
 
                 // depth compare func
                 auto depth_compare = to_gl_compare_func(info.depth_stencil_attachment.depth_compare);
-                GL_CALL(glDepthFunc(depth_compare));
+                m_state->depth_func(depth_compare);
             } else {
-                GL_CALL(glDisable(GL_DEPTH_TEST));
+                m_state->set_enabled(GL_DEPTH_TEST, false);
             }
 
             // stencil test
             if (info.depth_stencil_attachment.stencil_test_enable) {
-                GL_CALL(glEnable(GL_STENCIL_TEST));
+                m_state->set_enabled(GL_STENCIL_TEST, true);
 
                 // stencil front
-                GL_CALL(glStencilFuncSeparate(
+                m_state->stencil_func(
                     GL_FRONT,
                     to_gl_compare_func(info.depth_stencil_attachment.stencil_front.compare),
                     info.depth_stencil_attachment.stencil_front.reference_value,
                     info.depth_stencil_attachment.stencil_front.read_mask
-                ));
-                GL_CALL(glStencilOpSeparate(
+                );
+                m_state->stencil_op(
                     GL_FRONT,
                     to_gl_stencil_op(info.depth_stencil_attachment.stencil_front.stencil_fail_op),
                     to_gl_stencil_op(info.depth_stencil_attachment.stencil_front.depth_fail_op),
                     to_gl_stencil_op(info.depth_stencil_attachment.stencil_front.pass_op)
-                ));
-                GL_CALL(glStencilMaskSeparate(GL_FRONT, info.depth_stencil_attachment.stencil_front.write_mask));
+                );
+                m_state->stencil_mask(GL_FRONT, info.depth_stencil_attachment.stencil_front.write_mask);
 
                 // stencil back
-                GL_CALL(glStencilFuncSeparate(
+                m_state->stencil_func(
                     GL_BACK,
                     to_gl_compare_func(info.depth_stencil_attachment.stencil_back.compare),
                     info.depth_stencil_attachment.stencil_back.reference_value,
                     info.depth_stencil_attachment.stencil_back.read_mask
-                ));
-                GL_CALL(glStencilOpSeparate(
+                );
+                m_state->stencil_op(
                     GL_BACK,
                     to_gl_stencil_op(info.depth_stencil_attachment.stencil_back.stencil_fail_op),
                     to_gl_stencil_op(info.depth_stencil_attachment.stencil_back.depth_fail_op),
                     to_gl_stencil_op(info.depth_stencil_attachment.stencil_back.pass_op)
-                ));
-                GL_CALL(glStencilMaskSeparate(GL_BACK, info.depth_stencil_attachment.stencil_back.write_mask));
+                );
+                m_state->stencil_mask(GL_BACK, info.depth_stencil_attachment.stencil_back.write_mask);
             } else {
-                GL_CALL(glDisable(GL_STENCIL_TEST));
+                m_state->set_enabled(GL_STENCIL_TEST, false);
             }
         }
 
         // rasterizer state
         // cull face
         if (info.rasterizer.cull == cull_face::off) {
-            GL_CALL(glDisable(GL_CULL_FACE));
+            m_state->set_enabled(GL_CULL_FACE, false);
         } else {
-            GL_CALL(glEnable(GL_CULL_FACE));
-            GL_CALL(glCullFace(to_gl_cull_face(info.rasterizer.cull)));
+            m_state->set_enabled(GL_CULL_FACE, true);
+            m_state->cull_face(to_gl_cull_face(info.rasterizer.cull));
         }
 
         // front face
-        GL_CALL(glFrontFace(to_gl_face(info.rasterizer.face)));
+        m_state->front_face(to_gl_face(info.rasterizer.face));
 
         // polygon mode
-        GL_CALL(glPolygonMode(GL_FRONT_AND_BACK, to_gl_polygon_mode(info.rasterizer.polygon)));
+        m_state->polygon_mode(to_gl_polygon_mode(info.rasterizer.polygon));
 
         // depth clamp
         if (info.rasterizer.depth_clamp_enable) {
-            GL_CALL(glEnable(GL_DEPTH_CLAMP));
-            GL_CALL(glDepthRange(info.rasterizer.depth_clamp_near, info.rasterizer.depth_clamp_far));
+            m_state->set_enabled(GL_DEPTH_CLAMP, true);
+            m_state->depth_range(info.rasterizer.depth_clamp_near, info.rasterizer.depth_clamp_far);
         } else {
-            GL_CALL(glDisable(GL_DEPTH_CLAMP));
+            m_state->set_enabled(GL_DEPTH_CLAMP, false);
         }
 
         // depth bias
         auto gl_polygon_offset = to_gl_polygon_offset(info.rasterizer.polygon);
         if (info.rasterizer.depth_bias_enable) {
-            GL_CALL(glEnable(gl_polygon_offset));
-            GL_CALL(glPolygonOffset(info.rasterizer.depth_bias_factor, info.rasterizer.depth_bias));
+            m_state->set_enabled(gl_polygon_offset, true);
+            m_state->polygon_offset(info.rasterizer.depth_bias_factor, info.rasterizer.depth_bias);
         } else {
-            GL_CALL(glDisable(gl_polygon_offset));
+            m_state->set_enabled(gl_polygon_offset, false);
         }
 
         // Scissor test
         if (info.rasterizer.scissor_enable) {
-            GL_CALL(glEnable(GL_SCISSOR_TEST));
+            m_state->set_enabled(GL_SCISSOR_TEST, true);
         } else {
-            GL_CALL(glDisable(GL_SCISSOR_TEST));
+            m_state->set_enabled(GL_SCISSOR_TEST, false);
         }
 
         // multisample state
         if (info.multisample.sample_shading_enabled) {
-            GL_CALL(glEnable(GL_SAMPLE_SHADING));
-            GL_CALL(glMinSampleShading(info.multisample.min_sample_shading));
+            m_state->set_enabled(GL_SAMPLE_SHADING, true);
+            m_state->min_sample_shading(info.multisample.min_sample_shading);
         } else {
-            GL_CALL(glDisable(GL_SAMPLE_SHADING));
+            m_state->set_enabled(GL_SAMPLE_SHADING, false);
         }
 
-        GL_CALL(glUseProgram(p->cached_prog_obj));
+        m_state->use_program(p->cached_prog_obj);
         auto vao = p->vao_obj != 0 ? p->vao_obj : m_empty_vao;
-        GL_CALL(glBindVertexArray(vao));
+        m_state->bind_vertex_array(vao);
     }
 
     void command_queue_opengl::bind_vertex_buffers(core::buffer_view<bind_buffer_info> buffers)
@@ -363,7 +374,7 @@ namespace tavros::renderer::rhi
         m_current_index_buffer = info.buffer;
         m_current_index_buffer_format = info.format;
 
-        GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, b->buffer_obj));
+        m_state->bind_element_buffer(b->buffer_obj);
     }
 
     void command_queue_opengl::bind_shader_buffers(core::buffer_view<buffer_binding> buffers)
@@ -373,11 +384,9 @@ namespace tavros::renderer::rhi
             auto& buf = buffers[i];
 
             if (auto* b = m_device->get_resources()->find(buf.buffer)) {
-                TAV_ASSERT(b->gl_target == GL_UNIFORM_BUFFER || b->gl_target == GL_SHADER_STORAGE_BUFFER);
-
-                if (b->info.usage != buffer_usage::constant && b->info.usage != buffer_usage::storage) {
+                if (b->info.usage != buffer_usage::constant && b->info.usage != buffer_usage::storage && b->info.usage != buffer_usage::indirect) {
                     ::logger.error(
-                        "Failed to bind shader binding: buffer {} binding {} has invalid usage (expected `constant` or `storage`, got {})",
+                        "Failed to bind shader binding: buffer {} binding {} has invalid usage (expected `constant`, `storage` or `indirect`, got {})",
                         buf.buffer,
                         fmt::styled_param(i),
                         b->info.usage
@@ -385,19 +394,17 @@ namespace tavros::renderer::rhi
                     return;
                 }
 
-                if (buf.size == 0) {
-                    // Bind the entire buffer
-                    GL_CALL(glBindBufferBase(b->gl_target, buf.binding, b->buffer_obj));
-                } else {
-                    // Bind a range of the buffer (subbuffer)
-                    GL_CALL(glBindBufferRange(
-                        b->gl_target,
-                        buf.binding,
-                        b->buffer_obj,
-                        static_cast<GLintptr>(buf.offset),
-                        static_cast<GLsizeiptr>(buf.size)
-                    ));
-                }
+                // Indirect buffers are written by compute shaders as storage buffers
+                auto gl_target = b->info.usage == buffer_usage::constant ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER;
+
+                // Size 0 binds the entire buffer
+                m_state->bind_buffer_range(
+                    gl_target,
+                    buf.binding,
+                    b->buffer_obj,
+                    static_cast<GLintptr>(buf.offset),
+                    static_cast<GLsizeiptr>(buf.size)
+                );
             } else {
                 ::logger.error("Failed to bind shader buffer {}: buffer not found", buf.buffer);
                 return;
@@ -417,8 +424,7 @@ namespace tavros::renderer::rhi
                     ::logger.error("Failed to bind shader texture {}: texture is not sampled", bind.texture);
                     return;
                 }
-                GL_CALL(glActiveTexture(GL_TEXTURE0 + bind.binding));
-                GL_CALL(glBindTexture(t->target, t->texture_obj));
+                m_state->bind_texture(bind.binding, t->target, t->texture_obj);
             } else {
                 ::logger.error("Failed to bind shader texture {}: texture not found", bind.texture);
                 return;
@@ -426,7 +432,7 @@ namespace tavros::renderer::rhi
 
             // Bind sampler
             if (auto* s = m_device->get_resources()->find(bind.sampler)) {
-                GL_CALL(glBindSampler(bind.binding, s->sampler_obj));
+                m_state->bind_sampler(bind.binding, s->sampler_obj);
             } else {
                 ::logger.error("Failed to bind shader texture {}: sampler {} not found", bind.texture, bind.sampler);
                 return;
@@ -434,6 +440,45 @@ namespace tavros::renderer::rhi
         }
     }
 
+    void command_queue_opengl::bind_storage_images(core::buffer_view<image_binding> images)
+    {
+        for (uint32 i = 0; i < images.size(); ++i) {
+            auto& bind = images[i];
+
+            auto* t = m_device->get_resources()->find(bind.texture);
+            if (!t) {
+                ::logger.error("Failed to bind storage image {}: texture not found", bind.texture);
+                return;
+            }
+
+            if (!t->info.usage.has_flag(texture_usage::storage) || t->texture_obj == 0) {
+                ::logger.error("Failed to bind storage image {}: texture is not a storage texture", bind.texture);
+                return;
+            }
+
+            if (bind.mip_level >= t->info.mip_levels) {
+                ::logger.error(
+                    "Failed to bind storage image {}: mip level {} exceeds mip levels {}",
+                    bind.texture,
+                    fmt::styled_param(bind.mip_level),
+                    fmt::styled_param(t->info.mip_levels)
+                );
+                return;
+            }
+
+            // Arrays, cubemaps and 3D textures bind all layers of the level
+            auto gl_layered = to_gl_bool(t->info.type != texture_type::texture_2d || t->info.array_layers > 1);
+            m_state->bind_image_texture(
+                bind.binding,
+                t->texture_obj,
+                static_cast<GLint>(bind.mip_level),
+                gl_layered,
+                to_gl_image_access(bind.access),
+                static_cast<GLenum>(to_gl_pixel_format(t->info.format).internal_format)
+            );
+        }
+    }
+
     void command_queue_opengl::begin_rendering(framebuffer_handle framebuffer)
     {
         if (m_current_framebuffer) {
@@ -464,7 +509,7 @@ namespace tavros::renderer::rhi
             const auto& ca = fb->info.color_attachments[0];
             if (ca.load == load_op::clear) {
                 clear_mask |= GL_COLOR_BUFFER_BIT;
-                GL_CALL(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+                m_state->color_mask_all(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
                 GL_CALL(glClearColor(ca.clear_value[0], ca.clear_value[1], ca.clear_value[2], ca.clear_value[3]));
             }
 
@@ -473,14 +518,13 @@ namespace tavros::renderer::rhi
                 // Clear for depth buffer
                 if (dsa.depth_load == load_op::clear) {
                     clear_mask |= GL_DEPTH_BUFFER_BIT;
-                    GL_CALL(glDepthMask(GL_TRUE));
+                    m_state->depth_mask(GL_TRUE);
                     GL_CALL(glClearDepth(dsa.depth_clear_value));
                 }
                 // Clear for stencil buffer
                 if (dsa.stencil_load == load_op::clear) {
                     clear_mask |= GL_STENCIL_BUFFER_BIT;
-                    GL_CALL(glStencilMaskSeparate(GL_FRONT, static_cast<GLuint>(0xffffffff)));
-                    GL_CALL(glStencilMaskSeparate(GL_BACK, static_cast<GLuint>(0xffffffff)));
+                    m_state->stencil_mask(GL_FRONT_AND_BACK, static_cast<GLuint>(0xffffffff));
                     GL_CALL(glClearStencil(dsa.stencil_clear_value));
                 }
             }
@@ -507,8 +551,8 @@ namespace tavros::renderer::rhi
         {
             auto w = static_cast<GLsizei>(fb->info.width);
             auto h = static_cast<GLsizei>(fb->info.height);
-            GL_CALL(glViewport(0, 0, w, h));
-            GL_CALL(glScissor(0, 0, w, h));
+            m_state->viewport(0, 0, w, h);
+            m_state->scissor(0, 0, w, h);
         }
 
         // Allpy load operations to the color attachments and depth/stencil attachment (only clear)
@@ -519,7 +563,7 @@ namespace tavros::renderer::rhi
             // Apply load operation (only clear)
             // Any other load operation doesn't need to be applied
             if (load_op::clear == ca.load) {
-                GL_CALL(glColorMaski(i, GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+                m_state->color_mask(i, GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
                 GL_CALL(glClearBufferfv(GL_COLOR, i, ca.clear_value));
             }
         }
@@ -529,14 +573,13 @@ namespace tavros::renderer::rhi
         if (dsa.target) {
             // Apply load operation to depth component
             if (load_op::clear == dsa.depth_load) {
-                GL_CALL(glDepthMask(GL_TRUE));
+                m_state->depth_mask(GL_TRUE);
                 GL_CALL(glClearBufferfv(GL_DEPTH, 0, &dsa.depth_clear_value));
             }
 
             // Apply load operation to stencil component
             if (load_op::clear == dsa.stencil_load) {
-                GL_CALL(glStencilMaskSeparate(GL_FRONT, 0xffffffff));
-                GL_CALL(glStencilMaskSeparate(GL_BACK, 0xffffffff));
+                m_state->stencil_mask(GL_FRONT_AND_BACK, 0xffffffff);
                 GL_CALL(glClearBufferiv(GL_STENCIL, 0, &dsa.stencil_clear_value));
             }
         }
@@ -562,8 +605,9 @@ namespace tavros::renderer::rhi
             TAV_ASSERT(fb->info.color_attachments[0].store != store_op::resolve);
 
             GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
-            GL_CALL(glBindVertexArray(0));
+            m_state->bind_vertex_array(0);
             m_current_framebuffer = {};
+            m_current_pipeline = {};
 
             return;
         }
@@ -625,8 +669,9 @@ namespace tavros::renderer::rhi
         auto need_resolve = depth_stencil_blit_mask != 0 || blit_data.size() > 0;
         if (!need_resolve) {
             GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
-            GL_CALL(glBindVertexArray(0));
+            m_state->bind_vertex_array(0);
             m_current_framebuffer = {};
+            m_current_pipeline = {};
             return;
         }
 
@@ -691,8 +736,9 @@ namespace tavros::renderer::rhi
         GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, 0));
 
         GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
-        GL_CALL(glBindVertexArray(0));
+        m_state->bind_vertex_array(0);
         m_current_framebuffer = {};
+        m_current_pipeline = {};
     }
 
     void command_queue_opengl::set_viewport(const viewport_info& viewport)
@@ -703,7 +749,7 @@ namespace tavros::renderer::rhi
         auto y = static_cast<GLint>(viewport.top);
         auto w = static_cast<GLsizei>(viewport.width);
         auto h = static_cast<GLsizei>(viewport.height);
-        GL_CALL(glViewport(x, y, w, h));
+        m_state->viewport(x, y, w, h);
     }
 
     void command_queue_opengl::set_scissor(const scissor_info& scissor)
@@ -720,7 +766,7 @@ namespace tavros::renderer::rhi
         auto h = static_cast<GLsizei>(scissor.height);
         auto x = static_cast<GLint>(scissor.left);
         auto y = static_cast<GLint>(fb->info.height) - static_cast<GLint>(scissor.top) - static_cast<GLint>(h);
-        GL_CALL(glScissor(x, y, w, h));
+        m_state->scissor(x, y, w, h);
     }
 
     void command_queue_opengl::draw(uint32 vertex_count, uint32 first_vertex, uint32 instance_count, uint32 first_instance)
@@ -735,6 +781,11 @@ namespace tavros::renderer::rhi
             return;
         }
 
+        if (p->is_compute) {
+            ::logger.error("Failed to draw: pipeline {} is a compute pipeline", m_current_pipeline);
+            return;
+        }
+
         auto gl_topology = to_gl_topology(p->info.topology);
         auto gl_first_vertex = static_cast<GLint>(first_vertex);
         auto gl_vertex_count = static_cast<GLsizei>(vertex_count);
@@ -776,6 +827,11 @@ namespace tavros::renderer::rhi
             return;
         }
 
+        if (p->is_compute) {
+            ::logger.error("Failed to draw indexed: pipeline {} is a compute pipeline", m_current_pipeline);
+            return;
+        }
+
         auto  gl_index_format = to_gl_index_format(m_current_index_buffer_format);
         auto  gl_topology = to_gl_topology(p->info.topology);
         auto* gl_index_offset = reinterpret_cast<const void*>(static_cast<size_t>(first_index * gl_index_format.size));
@@ -807,6 +863,221 @@ namespace tavros::renderer::rhi
         }
     }
 
+    void command_queue_opengl::draw_indirect(const draw_indirect_info& info)
+    {
+        auto* p = prepare_indirect_draw(info, sizeof(draw_indirect_args), "draw indirect");
+        if (!p) {
+            return;
+        }
+
+        auto  gl_topology = to_gl_topology(p->info.topology);
+        auto* gl_offset = reinterpret_cast<const void*>(info.offset);
+        auto  gl_draw_count = static_cast<GLsizei>(info.draw_count);
+        auto  gl_stride = static_cast<GLsizei>(info.stride);
+
+        if (info.count_buffer.valid()) {
+            GL_CALL(glMultiDrawArraysIndirectCount(
+                gl_topology,
+                gl_offset,
+                static_cast<GLintptr>(info.count_offset),
+                gl_draw_count,
+                gl_stride
+            ));
+        } else {
+            GL_CALL(glMultiDrawArraysIndirect(
+                gl_topology,
+                gl_offset,
+                gl_draw_count,
+                gl_stride
+            ));
+        }
+    }
+
+    void command_queue_opengl::draw_indexed_indirect(const draw_indirect_info& info)
+    {
+        if (!m_current_index_buffer) {
+            ::logger.error("Failed to draw indexed indirect: no index buffer is bound");
+            return;
+        }
+
+        auto* p = prepare_indirect_draw(info, sizeof(draw_indexed_indirect_args), "draw indexed indirect");
+        if (!p) {
+            return;
+        }
+
+        auto  gl_index_format = to_gl_index_format(m_current_index_buffer_format);
+        auto  gl_topology = to_gl_topology(p->info.topology);
+        auto* gl_offset = reinterpret_cast<const void*>(info.offset);
+        auto  gl_draw_count = static_cast<GLsizei>(info.draw_count);
+        auto  gl_stride = static_cast<GLsizei>(info.stride);
+
+        if (info.count_buffer.valid()) {
+            GL_CALL(glMultiDrawElementsIndirectCount(
+                gl_topology,
+                gl_index_format.type,
+                gl_offset,
+                static_cast<GLintptr>(info.count_offset),
+                gl_draw_count,
+                gl_stride
+            ));
+        } else {
+            GL_CALL(glMultiDrawElementsIndirect(
+                gl_topology,
+                gl_index_format.type,
+                gl_offset,
+                gl_draw_count,
+                gl_stride
+            ));
+        }
+    }
+
+    void command_queue_opengl::dispatch(uint32 group_count_x, uint32 group_count_y, uint32 group_count_z)
+    {
+        if (group_count_x == 0 || group_count_y == 0 || group_count_z == 0) {
+            return;
+        }
+
+        if (!can_dispatch("dispatch")) {
+            return;
+        }
+
+        GL_CALL(glDispatchCompute(group_count_x, group_count_y, group_count_z));
+    }
+
+    void command_queue_opengl::dispatch_indirect(buffer_handle buffer, size_t offset)
+    {
+        if (!can_dispatch("dispatch indirect")) {
+            return;
+        }
+
+        auto* b = m_device->get_resources()->find(buffer);
+        if (!b) {
+            ::logger.error("Failed to dispatch indirect: buffer {} not found", buffer);
+            return;
+        }
+
+        if (b->info.usage != buffer_usage::indirect) {
+            ::logger.error("Failed to dispatch indirect: buffer {} has invalid usage (expected `indirect`, got {})", buffer, b->info.usage);
+            return;
+        }
+
+        if (offset % 4 != 0 || offset + sizeof(dispatch_indirect_args) > b->info.size) {
+            ::logger.error("Failed to dispatch indirect: offset {} is misaligned or out of range of buffer {}", fmt::styled_param(offset), buffer);
+            return;
+        }
+
+        m_state->bind_dispatch_indirect_buffer(b->buffer_obj);
+        GL_CALL(glDispatchComputeIndirect(static_cast<GLintptr>(offset)));
+    }
+
+    void command_queue_opengl::memory_barrier(core::flags<barrier_scope> scope)
+    {
+        auto gl_barriers = to_gl_barrier_bits(scope);
+        if (gl_barriers == 0) {
+            return;
+        }
+
+        GL_CALL(glMemoryBarrier(gl_barriers));
+    }
+
+    bool command_queue_opengl::can_dispatch(const char* what)
+    {
+        if (m_current_framebuffer) {
+            ::logger.error("Failed to {}: render pass {} is active", what, m_current_framebuffer);
+            return false;
+        }
+
+        auto* p = m_device->get_resources()->find(m_current_pipeline);
+        if (!p || !p->is_compute) {
+            ::logger.error("Failed to {}: no compute pipeline is bound", what);
+            return false;
+        }
+
+        return true;
+    }
+
+    gl_pipeline* command_queue_opengl::prepare_indirect_draw(const draw_indirect_info& info, size_t args_size, const char* what)
+    {
+        if (info.draw_count == 0) {
+            return nullptr;
+        }
+
+        auto* p = m_device->get_resources()->find(m_current_pipeline);
+        if (!p) {
+            if (!m_current_pipeline) {
+                ::logger.error("Failed to {}: no pipeline is bound", what);
+            } else {
+                ::logger.error("Failed to {}: pipeline {} not found", what, m_current_pipeline);
+            }
+            return nullptr;
+        }
+
+        if (p->is_compute) {
+            ::logger.error("Failed to {}: pipeline {} is a compute pipeline", what, m_current_pipeline);
+            return nullptr;
+        }
+
+        auto* b = m_device->get_resources()->find(info.buffer);
+        if (!b) {
+            ::logger.error("Failed to {}: buffer {} not found", what, info.buffer);
+            return nullptr;
+        }
+
+        if (b->info.usage != buffer_usage::indirect) {
+            ::logger.error("Failed to {}: buffer {} has invalid usage (expected `indirect`, got {})", what, info.buffer, b->info.usage);
+            return nullptr;
+        }
+
+        if (info.offset % 4 != 0 || info.stride % 4 != 0 || (info.stride != 0 && info.stride < args_size)) {
+            ::logger.error(
+                "Failed to {}: offset {} and stride {} must be multiples of 4, stride must be 0 or at least {}",
+                what,
+                fmt::styled_param(info.offset),
+                fmt::styled_param(info.stride),
+                fmt::styled_param(args_size)
+            );
+            return nullptr;
+        }
+
+        const size_t stride = info.stride != 0 ? info.stride : args_size;
+        const size_t end = info.offset + (info.draw_count - 1) * stride + args_size;
+        if (end > b->info.size) {
+            ::logger.error(
+                "Failed to {}: {} draws at offset {} exceed buffer {} size {}",
+                what,
+                fmt::styled_param(info.draw_count),
+                fmt::styled_param(info.offset),
+                info.buffer,
+                fmt::styled_param(b->info.size)
+            );
+            return nullptr;
+        }
+
+        if (info.count_buffer.valid()) {
+            auto* cb = m_device->get_resources()->find(info.count_buffer);
+            if (!cb || cb->info.usage != buffer_usage::indirect) {
+                ::logger.error("Failed to {}: count buffer {} not found or not an indirect buffer", what, info.count_buffer);
+                return nullptr;
+            }
+
+            if (info.count_offset % 4 != 0 || info.count_offset + sizeof(uint32) > cb->info.size) {
+                ::logger.error("Failed to {}: count offset {} is misaligned or out of range", what, fmt::styled_param(info.count_offset));
+                return nullptr;
+            }
+
+            // The count variants are core since GL 4.6
+            if (!glad_glMultiDrawArraysIndirectCount || !glad_glMultiDrawElementsIndirectCount) {
+                ::logger.error("Failed to {}: draw count buffers are not supported by the context", what);
+                return nullptr;
+            }
+
+            m_state->bind_parameter_buffer(cb->buffer_obj);
+        }
+
+        m_state->bind_draw_indirect_buffer(b->buffer_obj);
+        return p;
+    }
+
     void command_queue_opengl::signal_fence(fence_handle fence)
     {
         auto* f = m_device->get_resources()->find(fence);
@@ -1035,7 +1306,7 @@ namespace tavros::renderer::rhi
         }
 
         GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, b->buffer_obj));
-        GL_CALL(glBindTexture(tex->target, tex->texture_obj));
+        m_state->bind_texture(0, tex->target, tex->texture_obj);
 
         auto row_length_in_pixels = static_cast<GLint>(region.buffer_row_length);
         GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length_in_pixels));
@@ -1122,7 +1393,7 @@ namespace tavros::renderer::rhi
         GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
         GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
 
-        GL_CALL(glBindTexture(tex->target, 0));
+        m_state->bind_texture(0, tex->target, 0);
         GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
     }
 
@@ -1195,7 +1466,7 @@ namespace tavros::renderer::rhi
         }
 
         GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, b->buffer_obj));
-        GL_CALL(glBindTexture(tex->target, tex->texture_obj));
+        m_state->bind_texture(0, tex->target, tex->texture_obj);
 
         GL_CALL(glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(region.buffer_row_length)));
         GL_CALL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
@@ -1298,7 +1569,7 @@ namespace tavros::renderer::rhi
         GL_CALL(glPixelStorei(GL_PACK_ALIGNMENT, 4));
         GL_CALL(glPixelStorei(GL_PACK_ROW_LENGTH, 0));
 
-        GL_CALL(glBindTexture(tex->target, 0));
+        m_state->bind_texture(0, tex->target, 0);
         GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
     }
 
@@ -1323,13 +1594,13 @@ namespace tavros::renderer::rhi
         // copy data
         std::memcpy(pc.mapped + offset, constants, size);
 
-        GL_CALL(glBindBufferRange(
+        m_state->bind_buffer_range(
             GL_UNIFORM_BUFFER,
             k_constant_buffer_index,
             pc.buffer,
             static_cast<GLintptr>(offset),
             static_cast<GLsizeiptr>(aligned_size)
-        ));
+        );
     }
 
     void command_queue_opengl::init_push_constant_buffer()
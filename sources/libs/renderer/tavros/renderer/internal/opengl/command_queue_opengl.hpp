@@ -23,6 +23,8 @@ namespace tavros::renderer::rhi
 
         void bind_shader_textures(core::buffer_view<texture_binding> textures) override;
 
+        void bind_storage_images(core::buffer_view<image_binding> images) override;
+
         void begin_rendering(framebuffer_handle framebuffer) override;
 
         void end_rendering() override;
@@ -35,6 +37,16 @@ namespace tavros::renderer::rhi
 
         void draw_indexed(uint32 index_count, uint32 first_index = 0, uint32 vertex_offset = 0, uint32 instance_count = 1, uint32 first_instance = 0) override;
 
+        void draw_indirect(const draw_indirect_info& info) override;
+
+        void draw_indexed_indirect(const draw_indirect_info& info) override;
+
+        void dispatch(uint32 group_count_x, uint32 group_count_y = 1, uint32 group_count_z = 1) override;
+
+        void dispatch_indirect(buffer_handle buffer, size_t offset = 0) override;
+
+        void memory_barrier(core::flags<barrier_scope> scope) override;
+
         void signal_fence(fence_handle fence) override;
 
         void wait_for_fence(fence_handle fence) override;
@@ -48,12 +60,17 @@ namespace tavros::renderer::rhi
         void push_constant(const void* constants, size_t size) override;
 
     private:
+        gl_pipeline* prepare_indirect_draw(const draw_indirect_info& info, size_t args_size, const char* what);
+
+        bool can_dispatch(const char* what);
+
         void init_push_constant_buffer();
 
         void destroy_push_constant_buffer();
 
     private:
         graphics_device_opengl* m_device = nullptr;
+        gl_state_cache*         m_state = nullptr;
         pipeline_handle         m_current_pipeline;
         framebuffer_handle      m_current_framebuffer;
         buffer_handle           m_current_index_buffer;
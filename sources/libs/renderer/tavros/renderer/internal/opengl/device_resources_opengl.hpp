@@ -46,6 +46,7 @@ namespace tavros::renderer::rhi
         gl_program_handle    program_h = {};
         GLuint               cached_prog_obj = 0; // same as program_h->prog_obj
         GLuint               vao_obj = 0;
+        bool                 is_compute = false;
     };
 
     struct gl_framebuffer
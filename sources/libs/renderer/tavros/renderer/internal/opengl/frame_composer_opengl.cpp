@@ -122,6 +122,7 @@ namespace tavros::renderer::rhi
     void frame_composer_opengl::present()
     {
         m_context->swap_buffers();
+        m_device->get_state_cache()->end_frame();
     }
 
 } // namespace tavros::renderer::rhi
@@ -0,0 +1,520 @@
+#include <tavros/renderer/internal/opengl/gl_state_cache.hpp>
+
+#include <tavros/renderer/internal/opengl/gl_check.hpp>
+
+#include <limits>
+#include <utility>
+
+namespace
+{
+    constexpr GLint k_unknown_int = std::numeric_limits<GLint>::min();
+
+    // Index in the tracked caps array, or the array size for caps that are not tracked
+    size_t cap_slot(GLenum cap) noexcept
+    {
+        switch (cap) {
+        case GL_DEPTH_TEST:
+            return 0;
+        case GL_STENCIL_TEST:
+            return 1;
+        case GL_CULL_FACE:
+            return 2;
+        case GL_DEPTH_CLAMP:
+            return 3;
+        case GL_POLYGON_OFFSET_FILL:
+            return 4;
+        case GL_POLYGON_OFFSET_LINE:
+            return 5;
+        case GL_POLYGON_OFFSET_POINT:
+            return 6;
+        case GL_SCISSOR_TEST:
+            return 7;
+        case GL_SAMPLE_SHADING:
+            return 8;
+        default:
+            return 9;
+        }
+    }
+
+    // Returns the first and one past the last stencil face touched by a GL face enum
+    std::pair<size_t, size_t> stencil_faces(GLenum face) noexcept
+    {
+        if (face == GL_FRONT) {
+            return {0, 1};
+        }
+        if (face == GL_BACK) {
+            return {1, 2};
+        }
+        return {0, 2};
+    }
+
+    GLuint pack_color_mask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) noexcept
+    {
+        return (r ? 1u : 0u) | (g ? 2u : 0u) | (b ? 4u : 0u) | (a ? 8u : 0u);
+    }
+} // namespace
+
+namespace tavros::renderer::rhi
+{
+
+    gl_state_cache::gl_state_cache() noexcept
+    {
+        invalidate();
+    }
+
+    void gl_state_cache::invalidate() noexcept
+    {
+        constexpr auto nan_f = std::numeric_limits<GLfloat>::quiet_NaN();
+        constexpr auto nan_d = std::numeric_limits<GLdouble>::quiet_NaN();
+
+        for (auto& cap : m_caps) {
+            cap = -1;
+        }
+        for (auto& b : m_blend) {
+            b = {-1, k_unknown, k_unknown, k_unknown, k_unknown, k_unknown, k_unknown, k_unknown};
+        }
+        for (auto& s : m_stencil) {
+            s = {k_unknown, 0, k_unknown_mask, k_unknown, k_unknown, k_unknown, k_unknown_mask};
+        }
+
+        m_depth_mask = k_unknown;
+        m_depth_func = k_unknown;
+        m_depth_range[0] = m_depth_range[1] = nan_d;
+        m_cull_face = k_unknown;
+        m_front_face = k_unknown;
+        m_polygon_mode = k_unknown;
+        m_polygon_offset[0] = m_polygon_offset[1] = nan_f;
+        m_min_sample_shading = nan_f;
+        m_viewport[0] = k_unknown_int;
+        m_scissor[0] = k_unknown_int;
+
+        m_program = k_unknown;
+        m_vao = k_unknown;
+        m_element_buffer = k_unknown;
+        m_draw_indirect_buffer = k_unknown;
+        m_parameter_buffer = k_unknown;
+        m_dispatch_indirect_buffer = k_unknown;
+
+        for (auto& b : m_uniform_buffers) {
+            b = {k_unknown, 0, 0};
+        }
+        for (auto& b : m_storage_buffers) {
+            b = {k_unknown, 0, 0};
+        }
+        for (auto& t : m_texture_units) {
+            t = {k_unknown, k_unknown, k_unknown};
+        }
+        for (auto& i : m_image_units) {
+            i = {k_unknown, 0, GL_FALSE, k_unknown, k_unknown};
+        }
+        m_active_unit = k_unknown;
+    }
+
+    void gl_state_cache::end_frame() noexcept
+    {
+        m_last_frame_stats = m_frame_stats;
+        m_frame_stats = {};
+    }
+
+    void gl_state_cache::set_enabled(GLenum cap, bool enabled)
+    {
+        const auto slot = cap_slot(cap);
+        const auto value = enabled ? 1 : 0;
+        if (slot < k_cap_count) {
+            if (!changed(m_caps[slot] != value)) {
+                return;
+            }
+            m_caps[slot] = value;
+        } else {
+            changed(true);
+        }
+
+        if (enabled) {
+            GL_CALL(glEnable(cap));
+        } else {
+            GL_CALL(glDisable(cap));
+        }
+    }
+
+    void gl_state_cache::set_blend_enabled(GLuint index, bool enabled)
+    {
+        const auto value = enabled ? 1 : 0;
+        if (index < k_max_color_attachments) {
+            if (!changed(m_blend[index].enabled != value)) {
+                return;
+            }
+            m_blend[index].enabled = value;
+        } else {
+            changed(true);
+        }
+
+        if (enabled) {
+            GL_CALL(glEnablei(GL_BLEND, index));
+        } else {
+            GL_CALL(glDisablei(GL_BLEND, index));
+        }
+    }
+
+    void gl_state_cache::blend_func_separate(GLuint index, GLenum src_color, GLenum dst_color, GLenum src_alpha, GLenum dst_alpha)
+    {
+        if (index < k_max_color_attachments) {
+            auto& b = m_blend[index];
+            if (!changed(b.src_color != src_color || b.dst_color != dst_color || b.src_alpha != src_alpha || b.dst_alpha != dst_alpha)) {
+                return;
+            }
+            b.src_color = src_color;
+            b.dst_color = dst_color;
+            b.src_alpha = src_alpha;
+            b.dst_alpha = dst_alpha;
+        } else {
+            changed(true);
+        }
+
+        GL_CALL(glBlendFuncSeparatei(index, src_color, dst_color, src_alpha, dst_alpha));
+    }
+
+    void gl_state_cache::blend_equation_separate(GLuint index, GLenum color_op, GLenum alpha_op)
+    {
+        if (index < k_max_color_attachments) {
+            auto& b = m_blend[index];
+            if (!changed(b.color_op != color_op || b.alpha_op != alpha_op)) {
+                return;
+            }
+            b.color_op = color_op;
+            b.alpha_op = alpha_op;
+        } else {
+            changed(true);
+        }
+
+        GL_CALL(glBlendEquationSeparatei(index, color_op, alpha_op));
+    }
+
+    void gl_state_cache::color_mask(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+    {
+        const auto mask = pack_color_mask(r, g, b, a);
+        if (index < k_max_color_attachments) {
+            if (!changed(m_blend[index].mask != mask)) {
+                return;
+            }
+            m_blend[index].mask = mask;
+        } else {
+            changed(true);
+        }
+
+        GL_CALL(glColorMaski(index, r, g, b, a));
+    }
+
+    void gl_state_cache::color_mask_all(GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+    {
+        const auto mask = pack_color_mask(r, g, b, a);
+        bool       differs = false;
+        for (auto& bs : m_blend) {
+            differs |= bs.mask != mask;
+        }
+        if (!changed(differs)) {
+            return;
+        }
+        for (auto& bs : m_blend) {
+            bs.mask = mask;
+        }
+
+        GL_CALL(glColorMask(r, g, b, a));
+    }
+
+    void gl_state_cache::depth_mask(GLboolean enabled)
+    {
+        if (!changed(m_depth_mask != enabled)) {
+            return;
+        }
+        m_depth_mask = enabled;
+        GL_CALL(glDepthMask(enabled));
+    }
+
+    void gl_state_cache::depth_func(GLenum func)
+    {
+        if (!changed(m_depth_func != func)) {
+            return;
+        }
+        m_depth_func = func;
+        GL_CALL(glDepthFunc(func));
+    }
+
+    void gl_state_cache::depth_range(GLdouble near_val, GLdouble far_val)
+    {
+        if (!changed(!(m_depth_range[0] == near_val && m_depth_range[1] == far_val))) {
+            return;
+        }
+        m_depth_range[0] = near_val;
+        m_depth_range[1] = far_val;
+        GL_CALL(glDepthRange(near_val, far_val));
+    }
+
+    void gl_state_cache::stencil_func(GLenum face, GLenum func, GLint ref, GLuint mask)
+    {
+        const auto [first, last] = stencil_faces(face);
+        bool differs = false;
+        for (auto i = first; i < last; ++i) {
+            const auto& s = m_stencil[i];
+            differs |= s.func != func || s.ref != ref || s.read_mask != mask;
+        }
+        if (!changed(differs)) {
+            return;
+        }
+        for (auto i = first; i < last; ++i) {
+            m_stencil[i].func = func;
+            m_stencil[i].ref = ref;
+            m_stencil[i].read_mask = mask;
+        }
+
+        GL_CALL(glStencilFuncSeparate(face, func, ref, mask));
+    }
+
+    void gl_state_cache::stencil_op(GLenum face, GLenum stencil_fail, GLenum depth_fail, GLenum pass)
+    {
+        const auto [first, last] = stencil_faces(face);
+        bool differs = false;
+        for (auto i = first; i < last; ++i) {
+            const auto& s = m_stencil[i];
+            differs |= s.stencil_fail != stencil_fail || s.depth_fail != depth_fail || s.pass != pass;
+        }
+        if (!changed(differs)) {
+            return;
+        }
+        for (auto i = first; i < last; ++i) {
+            m_stencil[i].stencil_fail = stencil_fail;
+            m_stencil[i].depth_fail = depth_fail;
+            m_stencil[i].pass = pass;
+        }
+
+        GL_CALL(glStencilOpSeparate(face, stencil_fail, depth_fail, pass));
+    }
+
+    void gl_state_cache::stencil_mask(GLenum face, GLuint mask)
+    {
+        const auto [first, last] = stencil_faces(face);
+        bool differs = false;
+        for (auto i = first; i < last; ++i) {
+            differs |= m_stencil[i].write_mask != mask;
+        }
+        if (!changed(differs)) {
+            return;
+        }
+        for (auto i = first; i < last; ++i) {
+            m_stencil[i].write_mask = mask;
+        }
+
+        GL_CALL(glStencilMaskSeparate(face, mask));
+    }
+
+    void gl_state_cache::cull_face(GLenum face)
+    {
+        if (!changed(m_cull_face != face)) {
+            return;
+        }
+        m_cull_face = face;
+        GL_CALL(glCullFace(face));
+    }
+
+    void gl_state_cache::front_face(GLenum face)
+    {
+        if (!changed(m_front_face != face)) {
+            return;
+        }
+        m_front_face = face;
+        GL_CALL(glFrontFace(face));
+    }
+
+    void gl_state_cache::polygon_mode(GLenum mode)
+    {
+        if (!changed(m_polygon_mode != mode)) {
+            return;
+        }
+        m_polygon_mode = mode;
+        GL_CALL(glPolygonMode(GL_FRONT_AND_BACK, mode));
+    }
+
+    void gl_state_cache::polygon_offset(GLfloat factor, GLfloat units)
+    {
+        if (!changed(!(m_polygon_offset[0] == factor && m_polygon_offset[1] == units))) {
+            return;
+        }
+        m_polygon_offset[0] = factor;
+        m_polygon_offset[1] = units;
+        GL_CALL(glPolygonOffset(factor, units));
+    }
+
+    void gl_state_cache::min_sample_shading(GLfloat value)
+    {
+        if (!changed(!(m_min_sample_shading == value))) {
+            return;
+        }
+        m_min_sample_shading = value;
+        GL_CALL(glMinSampleShading(value));
+    }
+
+    void gl_state_cache::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        auto& v = m_viewport;
+        if (!changed(v[0] != x || v[1] != y || v[2] != width || v[3] != height)) {
+            return;
+        }
+        v[0] = x;
+        v[1] = y;
+        v[2] = width;
+        v[3] = height;
+        GL_CALL(glViewport(x, y, width, height));
+    }
+
+    void gl_state_cache::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        auto& s = m_scissor;
+        if (!changed(s[0] != x || s[1] != y || s[2] != width || s[3] != height)) {
+            return;
+        }
+        s[0] = x;
+        s[1] = y;
+        s[2] = width;
+        s[3] = height;
+        GL_CALL(glScissor(x, y, width, height));
+    }
+
+    void gl_state_cache::use_program(GLuint program)
+    {
+        if (!changed(m_program != program)) {
+            return;
+        }
+        m_program = program;
+        GL_CALL(glUseProgram(program));
+    }
+
+    void gl_state_cache::bind_vertex_array(GLuint vao)
+    {
+        if (!changed(m_vao != vao)) {
+            return;
+        }
+        m_vao = vao;
+        // The element buffer binding is part of the vertex array state
+        m_element_buffer = k_unknown;
+        GL_CALL(glBindVertexArray(vao));
+    }
+
+    void gl_state_cache::bind_element_buffer(GLuint buffer)
+    {
+        if (!changed(m_element_buffer != buffer)) {
+            return;
+        }
+        m_element_buffer = buffer;
+        GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer));
+    }
+
+    void gl_state_cache::bind_draw_indirect_buffer(GLuint buffer)
+    {
+        if (!changed(m_draw_indirect_buffer != buffer)) {
+            return;
+        }
+        m_draw_indirect_buffer = buffer;
+        GL_CALL(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer));
+    }
+
+    void gl_state_cache::bind_parameter_buffer(GLuint buffer)
+    {
+        if (!changed(m_parameter_buffer != buffer)) {
+            return;
+        }
+        m_parameter_buffer = buffer;
+        GL_CALL(glBindBuffer(GL_PARAMETER_BUFFER, buffer));
+    }
+
+    void gl_state_cache::bind_dispatch_indirect_buffer(GLuint buffer)
+    {
+        if (!changed(m_dispatch_indirect_buffer != buffer)) {
+            return;
+        }
+        m_dispatch_indirect_buffer = buffer;
+        GL_CALL(glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, buffer));
+    }
+
+    void gl_state_cache::bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        buffer_range* slots = nullptr;
+        if (target == GL_UNIFORM_BUFFER) {
+            slots = m_uniform_buffers;
+        } else if (target == GL_SHADER_STORAGE_BUFFER) {
+            slots = m_storage_buffers;
+        }
+
+        if (slots && index < k_max_shader_buffers) {
+            auto& r = slots[index];
+            if (!changed(r.buffer != buffer || r.offset != offset || r.size != size)) {
+                return;
+            }
+            r = {buffer, offset, size};
+        } else {
+            changed(true);
+        }
+
+        if (size == 0) {
+            GL_CALL(glBindBufferBase(target, index, buffer));
+        } else {
+            GL_CALL(glBindBufferRange(target, index, buffer, offset, size));
+        }
+    }
+
+    void gl_state_cache::bind_texture(GLuint unit, GLenum target, GLuint texture)
+    {
+        if (unit < k_max_shader_textures) {
+            auto& t = m_texture_units[unit];
+            if (!changed(t.target != target || t.texture != texture)) {
+                return;
+            }
+            t.target = target;
+            t.texture = texture;
+        } else {
+            changed(true);
+        }
+
+        active_texture(unit);
+        GL_CALL(glBindTexture(target, texture));
+    }
+
+    void gl_state_cache::bind_sampler(GLuint unit, GLuint sampler)
+    {
+        if (unit < k_max_shader_textures) {
+            auto& t = m_texture_units[unit];
+            if (!changed(t.sampler != sampler)) {
+                return;
+            }
+            t.sampler = sampler;
+        } else {
+            changed(true);
+        }
+
+        GL_CALL(glBindSampler(unit, sampler));
+    }
+
+    void gl_state_cache::bind_image_texture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLenum access, GLenum format)
+    {
+        if (unit < k_max_storage_images) {
+            auto& i = m_image_units[unit];
+            const bool same = i.texture == texture && i.level == level && i.layered == layered && i.access == access && i.format == format;
+            if (!changed(!same)) {
+                return;
+            }
+            i = {texture, level, layered, access, format};
+        } else {
+            changed(true);
+        }
+
+        GL_CALL(glBindImageTexture(unit, texture, level, layered, 0, access, format));
+    }
+
+    void gl_state_cache::active_texture(GLuint unit)
+    {
+        if (!changed(m_active_unit != unit)) {
+            return;
+        }
+        m_active_unit = unit;
+        GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
+    }
+
+} // namespace tavros::renderer::rhi
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <tavros/core/types.hpp>
+#include <tavros/renderer/rhi/limits.hpp>
+
+#include <glad/glad.h>
+
+namespace tavros::renderer::rhi
+{
+
+    /**
+     * @brief Number of GL state calls issued and skipped by @ref gl_state_cache.
+     */
+    struct gl_state_statistics
+    {
+        uint64 emitted = 0;  ///< Calls passed to the driver
+        uint64 filtered = 0; ///< Calls dropped because the state was already set
+    };
+
+    /**
+     * @brief Shadow copy of the GL context state touched by the command queue.
+     *
+     * Every setter compares the requested value with the last one it applied and calls
+     * the driver only when they differ. Covers blend, depth, stencil and rasterizer state,
+     * the bound program, vertex array and indirect buffers, indexed uniform and storage buffer ranges,
+     * texture units, samplers and image units, viewport and scissor.
+     *
+     * Notes:
+     * - The cache starts out unknown, the first call of every setter is always emitted.
+     * - Code that changes the same state with raw GL calls must call @ref invalidate(),
+     *   so does code that deletes GL objects, because their names can be reused.
+     * - Bindings past the tracked slot ranges are always emitted.
+     */
+    class gl_state_cache
+    {
+    public:
+        gl_state_cache() noexcept;
+
+        /**
+         * @brief Forgets everything, the next call of every setter is emitted.
+         */
+        void invalidate() noexcept;
+
+        /**
+         * @brief Closes the current frame, its counters become @ref last_frame_statistics().
+         */
+        void end_frame() noexcept;
+
+        [[nodiscard]] const gl_state_statistics& frame_statistics() const noexcept
+        {
+            return m_frame_stats;
+        }
+
+        [[nodiscard]] const gl_state_statistics& last_frame_statistics() const noexcept
+        {
+            return m_last_frame_stats;
+        }
+
+        void set_enabled(GLenum cap, bool enabled);
+        void set_blend_enabled(GLuint index, bool enabled);
+        void blend_func_separate(GLuint index, GLenum src_color, GLenum dst_color, GLenum src_alpha, GLenum dst_alpha);
+        void blend_equation_separate(GLuint index, GLenum color_op, GLenum alpha_op);
+        void color_mask(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+        void color_mask_all(GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+
+        void depth_mask(GLboolean enabled);
+        void depth_func(GLenum func);
+        void depth_range(GLdouble near_val, GLdouble far_val);
+        void stencil_func(GLenum face, GLenum func, GLint ref, GLuint mask);
+        void stencil_op(GLenum face, GLenum stencil_fail, GLenum depth_fail, GLenum pass);
+        void stencil_mask(GLenum face, GLuint mask);
+
+        void cull_face(GLenum face);
+        void front_face(GLenum face);
+        void polygon_mode(GLenum mode);
+        void polygon_offset(GLfloat factor, GLfloat units);
+        void min_sample_shading(GLfloat value);
+        void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+        void scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+        void use_program(GLuint program);
+        void bind_vertex_array(GLuint vao);
+        void bind_element_buffer(GLuint buffer);
+        void bind_draw_indirect_buffer(GLuint buffer);
+        void bind_parameter_buffer(GLuint buffer);
+        void bind_dispatch_indirect_buffer(GLuint buffer);
+
+        /**
+         * @brief Binds a range of a uniform or storage buffer, @p size 0 binds the whole buffer.
+         */
+        void bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+        void bind_texture(GLuint unit, GLenum target, GLuint texture);
+        void bind_sampler(GLuint unit, GLuint sampler);
+        void bind_image_texture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLenum access, GLenum format);
+
+    private:
+        bool changed(bool differs) noexcept
+        {
+            if (differs) {
+                ++m_frame_stats.emitted;
+            } else {
+                ++m_frame_stats.filtered;
+            }
+            return differs;
+        }
+
+        void active_texture(GLuint unit);
+
+    private:
+        static constexpr GLuint k_unknown = ~GLuint(0);
+        static constexpr uint64 k_unknown_mask = ~uint64(0);
+        static constexpr size_t k_cap_count = 9;
+
+        struct blend_state
+        {
+            GLint  enabled;
+            GLenum src_color;
+            GLenum dst_color;
+            GLenum src_alpha;
+            GLenum dst_alpha;
+            GLenum color_op;
+            GLenum alpha_op;
+            GLuint mask; // rgba bits
+        };
+
+        // Masks are widened so that 0xffffffff does not collide with the unknown value
+        struct stencil_state
+        {
+            GLenum func;
+            GLint  ref;
+            uint64 read_mask;
+            GLenum stencil_fail;
+            GLenum depth_fail;
+            GLenum pass;
+            uint64 write_mask;
+        };
+
+        struct buffer_range
+        {
+            GLuint     buffer;
+            GLintptr   offset;
+            GLsizeiptr size;
+        };
+
+        struct texture_unit
+        {
+            GLenum target;
+            GLuint texture;
+            GLuint sampler;
+        };
+
+        struct image_unit
+        {
+            GLuint    texture;
+            GLint     level;
+            GLboolean layered;
+            GLenum    access;
+            GLenum    format;
+        };
+
+        GLint         m_caps[k_cap_count];
+        blend_state   m_blend[k_max_color_attachments];
+        stencil_state m_stencil[2]; // front, back
+
+        GLuint   m_depth_mask;
+        GLenum   m_depth_func;
+        GLdouble m_depth_range[2];
+        GLenum   m_cull_face;
+        GLenum   m_front_face;
+        GLenum   m_polygon_mode;
+        GLfloat  m_polygon_offset[2];
+        GLfloat  m_min_sample_shading;
+        GLint    m_viewport[4];
+        GLint    m_scissor[4];
+
+        GLuint m_program;
+        GLuint m_vao;
+        GLuint m_element_buffer;
+        GLuint m_draw_indirect_buffer;
+        GLuint m_parameter_buffer;
+        GLuint m_dispatch_indirect_buffer;
+
+        buffer_range m_uniform_buffers[k_max_shader_buffers];
+        buffer_range m_storage_buffers[k_max_shader_buffers];
+        texture_unit m_texture_units[k_max_shader_textures];
+        image_unit   m_image_units[k_max_storage_images];
+        GLuint       m_active_unit;
+
+        gl_state_statistics m_frame_stats;
+        gl_state_statistics m_last_frame_stats;
+    };
+
+} // namespace tavros::renderer::rhi
@@ -13,6 +13,8 @@
 
 #include <tavros/renderer/rhi/string_utils.hpp>
 
+#include <initializer_list>
+
 using namespace tavros::renderer::rhi;
 
 namespace
@@ -46,7 +48,7 @@ namespace
         return shader;
     }
 
-    GLuint link_program(GLuint vert_shader, GLuint frag_shader)
+    GLuint link_program(std::initializer_list<GLuint> shaders)
     {
         auto failed = false;
 
@@ -56,8 +58,9 @@ namespace
             return 0;
         }
 
-        GL_CALL(glAttachShader(program, vert_shader));
-        GL_CALL(glAttachShader(program, frag_shader));
+        for (auto shader : shaders) {
+            GL_CALL(glAttachShader(program, shader));
+        }
         GL_CALL(glLinkProgram(program));
 
         // check link status
@@ -80,8 +83,9 @@ namespace
             failed = true;
         }
 
-        GL_CALL(glDetachShader(program, vert_shader));
-        GL_CALL(glDetachShader(program, frag_shader));
+        for (auto shader : shaders) {
+            GL_CALL(glDetachShader(program, shader));
+        }
 
         if (failed) {
             GL_CALL(glDeleteProgram(program));
@@ -196,6 +200,7 @@ namespace tavros::renderer::rhi
         if (auto* p = m_resources.find(handle)) {
             if (p->rc.decrement()) {
                 GL_CALL(glDeleteProgram(p->prog_obj));
+                m_state.invalidate();
                 m_resources.remove(handle);
                 ::logger.debug("Program {} deleted", handle);
             }
@@ -232,7 +237,8 @@ namespace tavros::renderer::rhi
 
         destroy_for<fence_handle>(m_resources, [this](auto h) { destroy_fence(h); });
 
-        m_temp_queue = nullptr;
+        m_gl_queue = nullptr;
+        m_recorders.clear();
 
         // Should be removed in last turn because swapchain owns the OpenGL context
         destroy_for<frame_composer_handle>(m_resources, [this](auto h) { destroy_frame_composer(h); });
@@ -273,12 +279,15 @@ namespace tavros::renderer::rhi
 
         init_limits();
 
-        if (!m_temp_queue) {
-            m_temp_queue = core::make_unique<command_queue_opengl>(this);
+        if (!m_gl_queue) {
+            m_gl_queue = core::make_unique<command_queue_opengl>(this);
         }
 
         GL_CALL(glEnable(GL_PROGRAM_POINT_SIZE));
 
+        // The new context may have become current, nothing is known about its state
+        m_state.invalidate();
+
         auto h = m_resources.create(gl_composer{info, std::move(composer)});
         ::logger.debug("Frame composer {} created", h);
         return h;
@@ -306,33 +315,72 @@ namespace tavros::renderer::rhi
 
     command_queue* graphics_device_opengl::create_command_queue()
     {
-        return m_temp_queue.get();
+        return m_recorders.acquire();
     }
 
     void graphics_device_opengl::submit_command_queue(command_queue* queue)
     {
-        TAV_UNUSED(queue);
+        auto* recorder = m_recorders.find(queue);
+
+        if (!recorder) {
+            if (m_recorders.owns(queue)) {
+                ::logger.error("Failed to submit command queue: queue was already submitted");
+            } else {
+                ::logger.error("Failed to submit command queue: queue was not created by this device");
+            }
+            return;
+        }
+
+        if (m_gl_queue) {
+            replay(recorder->stream(), *m_gl_queue);
+        } else {
+            ::logger.error("Failed to submit command queue: no frame composer created, {} commands dropped", recorder->stream().size());
+        }
+
+        m_recorders.release(recorder);
     }
 
     shader_handle graphics_device_opengl::create_shader(const shader_create_info& info)
     {
-        auto deleter = [](GLuint o) { if (o != 0) {GL_CALL(glDeleteShader(o));} };
-        auto vso_owner = core::make_scoped_owner(compile_shader_module(info.vertex_shader_source, GL_VERTEX_SHADER), deleter);
-        auto fso_owner = core::make_scoped_owner(compile_shader_module(info.fragment_shader_source, GL_FRAGMENT_SHADER), deleter);
+        const bool is_compute = !info.compute_shader_source.empty();
+        if (is_compute && (!info.vertex_shader_source.empty() || !info.fragment_shader_source.empty())) {
+            ::logger.error("Failed to create shader: compute source can't be combined with vertex or fragment sources");
+            return {};
+        }
 
-        if (vso_owner.get() == 0 || fso_owner.get() == 0) {
-            ::logger.error("Failed to create shader: compilation failed");
+        // Compute shaders are core since GL 4.3
+        if (is_compute && !glad_glDispatchCompute) {
+            ::logger.error("Failed to create shader: compute shaders are not supported by the context");
             return {};
         }
 
-        auto prog = link_program(vso_owner.get(), fso_owner.get());
+        auto   deleter = [](GLuint o) { if (o != 0) {GL_CALL(glDeleteShader(o));} };
+        GLuint prog = 0;
+        if (is_compute) {
+            auto cso_owner = core::make_scoped_owner(compile_shader_module(info.compute_shader_source, GL_COMPUTE_SHADER), deleter);
+            if (cso_owner.get() == 0) {
+                ::logger.error("Failed to create shader: compilation failed");
+                return {};
+            }
+
+            prog = link_program({cso_owner.get()});
+        } else {
+            auto vso_owner = core::make_scoped_owner(compile_shader_module(info.vertex_shader_source, GL_VERTEX_SHADER), deleter);
+            auto fso_owner = core::make_scoped_owner(compile_shader_module(info.fragment_shader_source, GL_FRAGMENT_SHADER), deleter);
+            if (vso_owner.get() == 0 || fso_owner.get() == 0) {
+                ::logger.error("Failed to create shader: compilation failed");
+                return {};
+            }
+
+            prog = link_program({vso_owner.get(), fso_owner.get()});
+        }
+
         if (prog == 0) {
             ::logger.error("Failed to create shader: failed to link program");
             return {};
         }
 
-        const bool is_compute = false;
-        auto       reflect = core::make_unique<gl_shader_program_reflect>(prog, is_compute);
+        auto reflect = core::make_unique<gl_shader_program_reflect>(prog, is_compute);
         if (!reflect->is_valid()) {
             ::logger.error("Failed to create shader: conventions are violated");
             GL_CALL(glDeleteProgram(prog));
@@ -420,6 +468,7 @@ namespace tavros::renderer::rhi
     {
         if (auto* s = m_resources.find(sampler)) {
             GL_CALL(glDeleteSamplers(1, &s->sampler_obj));
+            m_state.invalidate();
             m_resources.remove(sampler);
             ::logger.debug("Sampler {} destroyed", sampler);
         } else {
@@ -623,7 +672,8 @@ namespace tavros::renderer::rhi
             info.usage.has_flag(texture_usage::render_target)
             && info.type == texture_type::texture_2d
             && info.array_layers == 1
-            && !info.usage.has_flag(texture_usage::sampled);
+            && !info.usage.has_flag(texture_usage::sampled)
+            && !info.usage.has_flag(texture_usage::storage);
 
         if (need_create_renderbuffer) {
             // Create a renderbuffer instead of a texture (OpenGL works faster with renderbuffer objects)
@@ -703,7 +753,7 @@ namespace tavros::renderer::rhi
             GL_CALL(glGenTextures(1, &tex));
 
             // Bind texture
-            GL_CALL(glBindTexture(gl_target, tex));
+            m_state.bind_texture(0, gl_target, tex);
 
             switch (gl_target) {
             case GL_TEXTURE_2D_MULTISAMPLE:
@@ -830,7 +880,7 @@ namespace tavros::renderer::rhi
             GL_CALL(glTexParameteri(gl_target, GL_TEXTURE_BASE_LEVEL, 0));
             GL_CALL(glTexParameteri(gl_target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mip_levels - 1)));
 
-            GL_CALL(glBindTexture(gl_target, 0));
+            m_state.bind_texture(0, gl_target, 0);
 
             auto h = m_resources.create(gl_texture{info, tex, gl_target, 0, info.mip_levels});
             ::logger.debug("Texture ({}) {} created", info.type, h);
@@ -851,6 +901,9 @@ namespace tavros::renderer::rhi
                 GL_CALL(glDeleteRenderbuffers(1, &tex->renderbuffer_obj));
             }
 
+            // Names of deleted objects are reused, cached bindings may refer to them
+            m_state.invalidate();
+
             m_resources.remove(texture);
             if (is_texture) {
                 ::logger.debug("Texture ({}) {} destroyed", tex->info.type, texture);
@@ -876,6 +929,11 @@ namespace tavros::renderer::rhi
             return {};
         }
 
+        if (sh->reflect->compute().is_compute) {
+            ::logger.error("Failed to create pipeline: shader {} is a compute shader, use create_compute_pipeline()", info.shader_program);
+            return {};
+        }
+
         // Validate attributes
 
         // Map attributes to location index, for fast search
@@ -992,7 +1050,7 @@ namespace tavros::renderer::rhi
                 return {};
             }
 
-            GL_CALL(glBindVertexArray(vao));
+            m_state.bind_vertex_array(vao);
 
             // Setup attribute bindings
             for (auto attrib_i = 0; attrib_i < info.bindings.size(); ++attrib_i) {
@@ -1016,7 +1074,7 @@ namespace tavros::renderer::rhi
                 GL_CALL(glVertexBindingDivisor(attrib_i, binding.instance_divisor));
             }
 
-            GL_CALL(glBindVertexArray(0));
+            m_state.bind_vertex_array(0);
         }
 
         p->rc.increment();
@@ -1026,12 +1084,41 @@ namespace tavros::renderer::rhi
         return h;
     }
 
+    pipeline_handle graphics_device_opengl::create_compute_pipeline(const compute_pipeline_create_info& info)
+    {
+        auto* sh = m_resources.find(info.shader_program);
+        if (!sh) {
+            ::logger.error("Failed to create compute pipeline: shader {} not found", info.shader_program);
+            return {};
+        }
+
+        auto* p = m_resources.find(sh->program_h);
+        if (!p) {
+            ::logger.error("Failed to create compute pipeline: program {} not found", sh->program_h);
+            return {};
+        }
+
+        if (!sh->reflect->compute().is_compute) {
+            ::logger.error("Failed to create compute pipeline: shader {} is not a compute shader", info.shader_program);
+            return {};
+        }
+
+        pipeline_create_info pipeline_info;
+        pipeline_info.shader_program = info.shader_program;
+
+        p->rc.increment();
+        auto h = m_resources.create(gl_pipeline{pipeline_info, sh->program_h, p->prog_obj, 0, true});
+        ::logger.debug("Compute pipeline {} created", h);
+        return h;
+    }
+
     void graphics_device_opengl::destroy_pipeline(pipeline_handle handle)
     {
         if (auto* sh = m_resources.find(handle)) {
             release_program(sh->program_h);
             if (0 != sh->vao_obj) {
                 GL_CALL(glDeleteVertexArrays(1, &sh->vao_obj));
+                m_state.invalidate();
             }
             m_resources.remove(handle);
             ::logger.debug("Pipeline {} destroyed", handle);
@@ -1652,6 +1739,28 @@ namespace tavros::renderer::rhi
             }
             break;
 
+        case buffer_usage::indirect:
+
+            switch (info.access) {
+            case buffer_access::cpu_to_gpu:
+                gl_target = GL_DRAW_INDIRECT_BUFFER;
+                gl_usage = GL_DYNAMIC_DRAW;
+                gl_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                break;
+            case buffer_access::gpu_only:
+                gl_target = GL_DRAW_INDIRECT_BUFFER;
+                gl_usage = GL_STREAM_COPY;
+                gl_flags = GL_CLIENT_STORAGE_BIT;
+                break;
+            case buffer_access::gpu_to_cpu:
+                ::logger.error("Failed to create buffer: {} can't be {}", info.usage, info.access);
+                return {};
+            default:
+                TAV_UNREACHABLE();
+                break;
+            }
+            break;
+
         default:
             TAV_UNREACHABLE();
             break;
@@ -1682,6 +1791,7 @@ namespace tavros::renderer::rhi
     {
         if (auto* b = m_resources.find(buffer)) {
             GL_CALL(glDeleteBuffers(1, &b->buffer_obj));
+            m_state.invalidate();
             m_resources.remove(buffer);
             ::logger.debug("Buffer ({}) {} destroyed", b->info.usage, buffer);
         } else {
@@ -1819,4 +1929,9 @@ namespace tavros::renderer::rhi
         return &m_resources;
     }
 
+    gl_state_cache* graphics_device_opengl::get_state_cache()
+    {
+        return &m_state;
+    }
+
 } // namespace tavros::renderer::rhi
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <tavros/renderer/rhi/graphics_device.hpp>
+#include <tavros/renderer/rhi/recording_queue_pool.hpp>
 #include <tavros/renderer/internal/opengl/device_resources_opengl.hpp>
+#include <tavros/renderer/internal/opengl/gl_state_cache.hpp>
+
 
 namespace tavros::renderer::rhi
 {
@@ -33,6 +36,7 @@ namespace tavros::renderer::rhi
         void           destroy_texture(texture_handle handle) override;
 
         pipeline_handle create_pipeline(const pipeline_create_info& info) override;
+        pipeline_handle create_compute_pipeline(const compute_pipeline_create_info& info) override;
         void            destroy_pipeline(pipeline_handle pipeline) override;
 
         framebuffer_handle create_framebuffer(const framebuffer_create_info& info) override;
@@ -51,6 +55,8 @@ namespace tavros::renderer::rhi
 
         device_resources_opengl* get_resources();
 
+        gl_state_cache* get_state_cache();
+
     private:
         void init_limits();
 
@@ -84,7 +90,14 @@ namespace tavros::renderer::rhi
         device_resources_opengl m_resources;
         gl_limits               m_limits;
 
-        core::unique_ptr<command_queue> m_temp_queue;
+        // Shadow of the context state, filters redundant state calls
+        gl_state_cache m_state;
+
+        // Executes commands immediately, recorded queues are replayed into it on submit
+        core::unique_ptr<command_queue> m_gl_queue;
+
+        // Queues handed out by create_command_queue(), reused after submit
+        recording_queue_pool m_recorders;
     };
 
 } // namespace tavros::renderer::rhi
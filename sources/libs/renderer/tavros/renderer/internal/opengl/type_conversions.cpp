@@ -870,4 +870,48 @@ namespace tavros::renderer::rhi
         }
     }
 
+    GLenum to_gl_image_access(image_access access) noexcept
+    {
+        switch (access) {
+        case image_access::read_only:
+            return GL_READ_ONLY;
+        case image_access::write_only:
+            return GL_WRITE_ONLY;
+        case image_access::read_write:
+            return GL_READ_WRITE;
+        default:
+            TAV_UNREACHABLE();
+        }
+    }
+
+    GLbitfield to_gl_barrier_bits(core::flags<barrier_scope> scope) noexcept
+    {
+        GLbitfield bits = 0;
+        if (scope.has_flag(barrier_scope::storage_buffer)) {
+            bits |= GL_SHADER_STORAGE_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::storage_image)) {
+            bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::indirect_args)) {
+            bits |= GL_COMMAND_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::vertex_input)) {
+            bits |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::constant)) {
+            bits |= GL_UNIFORM_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::texture_fetch)) {
+            bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::transfer)) {
+            bits |= GL_BUFFER_UPDATE_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT;
+        }
+        if (scope.has_flag(barrier_scope::host_read)) {
+            bits |= GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT;
+        }
+        return bits;
+    }
+
 } // namespace tavros::renderer::rhi
@@ -121,4 +121,8 @@ namespace tavros::renderer::rhi
 
     pixel_format_info to_pixel_format_info(pixel_format fmt) noexcept;
 
+    GLenum to_gl_image_access(image_access access) noexcept;
+
+    GLbitfield to_gl_barrier_bits(core::flags<barrier_scope> scope) noexcept;
+
 } // namespace tavros::renderer::rhi
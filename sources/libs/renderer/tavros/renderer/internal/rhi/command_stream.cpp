@@ -0,0 +1,104 @@
+#include <tavros/renderer/rhi/command_stream.hpp>
+
+#include <tavros/renderer/rhi/command_queue.hpp>
+#include <tavros/core/debug/unreachable.hpp>
+
+namespace tavros::renderer::rhi
+{
+
+    void replay(const command_stream& stream, command_queue& queue)
+    {
+        for (const auto cmd : stream) {
+            switch (cmd.type()) {
+            case command_type::bind_pipeline:
+                queue.bind_pipeline(cmd.as<commands::bind_pipeline>().pipeline);
+                break;
+            case command_type::bind_vertex_buffers:
+                queue.bind_vertex_buffers(cmd.items<commands::bind_vertex_buffers>());
+                break;
+            case command_type::bind_index_buffer:
+                queue.bind_index_buffer(cmd.as<commands::bind_index_buffer>().info);
+                break;
+            case command_type::bind_shader_buffers:
+                queue.bind_shader_buffers(cmd.items<commands::bind_shader_buffers>());
+                break;
+            case command_type::bind_shader_textures:
+                queue.bind_shader_textures(cmd.items<commands::bind_shader_textures>());
+                break;
+            case command_type::bind_storage_images:
+                queue.bind_storage_images(cmd.items<commands::bind_storage_images>());
+                break;
+            case command_type::begin_rendering:
+                queue.begin_rendering(cmd.as<commands::begin_rendering>().framebuffer);
+                break;
+            case command_type::end_rendering:
+                queue.end_rendering();
+                break;
+            case command_type::set_viewport:
+                queue.set_viewport(cmd.as<commands::set_viewport>().viewport);
+                break;
+            case command_type::set_scissor:
+                queue.set_scissor(cmd.as<commands::set_scissor>().scissor);
+                break;
+            case command_type::draw: {
+                const auto& c = cmd.as<commands::draw>();
+                queue.draw(c.vertex_count, c.first_vertex, c.instance_count, c.first_instance);
+                break;
+            }
+            case command_type::draw_indexed: {
+                const auto& c = cmd.as<commands::draw_indexed>();
+                queue.draw_indexed(c.index_count, c.first_index, c.vertex_offset, c.instance_count, c.first_instance);
+                break;
+            }
+            case command_type::draw_indirect:
+                queue.draw_indirect(cmd.as<commands::draw_indirect>().info);
+                break;
+            case command_type::draw_indexed_indirect:
+                queue.draw_indexed_indirect(cmd.as<commands::draw_indexed_indirect>().info);
+                break;
+            case command_type::dispatch: {
+                const auto& c = cmd.as<commands::dispatch>();
+                queue.dispatch(c.group_count_x, c.group_count_y, c.group_count_z);
+                break;
+            }
+            case command_type::dispatch_indirect: {
+                const auto& c = cmd.as<commands::dispatch_indirect>();
+                queue.dispatch_indirect(c.buffer, c.offset);
+                break;
+            }
+            case command_type::memory_barrier:
+                queue.memory_barrier(cmd.as<commands::memory_barrier>().scope);
+                break;
+            case command_type::signal_fence:
+                queue.signal_fence(cmd.as<commands::signal_fence>().fence);
+                break;
+            case command_type::wait_for_fence:
+                queue.wait_for_fence(cmd.as<commands::wait_for_fence>().fence);
+                break;
+            case command_type::copy_buffer: {
+                const auto& c = cmd.as<commands::copy_buffer>();
+                queue.copy_buffer(c.src_buffer, c.dst_buffer, c.size, c.src_offset, c.dst_offset);
+                break;
+            }
+            case command_type::copy_buffer_to_texture: {
+                const auto& c = cmd.as<commands::copy_buffer_to_texture>();
+                queue.copy_buffer_to_texture(c.src_buffer, c.dst_texture, c.region);
+                break;
+            }
+            case command_type::copy_texture_to_buffer: {
+                const auto& c = cmd.as<commands::copy_texture_to_buffer>();
+                queue.copy_texture_to_buffer(c.src_texture, c.dst_buffer, c.region);
+                break;
+            }
+            case command_type::push_constant: {
+                const auto data = cmd.items<commands::push_constant>();
+                queue.push_constant(data.data(), data.size());
+                break;
+            }
+            default:
+                TAV_UNREACHABLE();
+            }
+        }
+    }
+
+} // namespace tavros::renderer::rhi
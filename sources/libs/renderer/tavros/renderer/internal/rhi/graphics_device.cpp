@@ -4,6 +4,7 @@
 #include <tavros/core/debug/unreachable.hpp>
 
 #include <tavros/renderer/internal/opengl/graphics_device_opengl.hpp>
+#include <tavros/renderer/internal/null/graphics_device_null.hpp>
 #include <tavros/renderer/rhi/string_utils.hpp>
 
 namespace
@@ -19,6 +20,8 @@ namespace tavros::renderer::rhi
         switch (backend) {
         case render_backend_type::opengl:
             return core::make_unique<graphics_device_opengl>();
+        case render_backend_type::null:
+            return core::make_unique<graphics_device_null>();
         default:
             break;
         }
@@ -0,0 +1,124 @@
+#include <tavros/renderer/rhi/recording_command_queue.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+
+namespace tavros::renderer::rhi
+{
+
+    void recording_command_queue::bind_pipeline(pipeline_handle pipeline)
+    {
+        m_stream.append(commands::bind_pipeline{pipeline});
+    }
+
+    void recording_command_queue::bind_vertex_buffers(core::buffer_view<bind_buffer_info> buffers)
+    {
+        m_stream.append(commands::bind_vertex_buffers{}, buffers);
+    }
+
+    void recording_command_queue::bind_index_buffer(const bind_index_buffer_info& info)
+    {
+        m_stream.append(commands::bind_index_buffer{info});
+    }
+
+    void recording_command_queue::bind_shader_buffers(core::buffer_view<buffer_binding> buffers)
+    {
+        m_stream.append(commands::bind_shader_buffers{}, buffers);
+    }
+
+    void recording_command_queue::bind_shader_textures(core::buffer_view<texture_binding> textures)
+    {
+        m_stream.append(commands::bind_shader_textures{}, textures);
+    }
+
+    void recording_command_queue::bind_storage_images(core::buffer_view<image_binding> images)
+    {
+        m_stream.append(commands::bind_storage_images{}, images);
+    }
+
+    void recording_command_queue::begin_rendering(framebuffer_handle framebuffer)
+    {
+        m_stream.append(commands::begin_rendering{framebuffer});
+    }
+
+    void recording_command_queue::end_rendering()
+    {
+        m_stream.append(commands::end_rendering{});
+    }
+
+    void recording_command_queue::set_viewport(const viewport_info& viewport)
+    {
+        m_stream.append(commands::set_viewport{viewport});
+    }
+
+    void recording_command_queue::set_scissor(const scissor_info& scissor)
+    {
+        m_stream.append(commands::set_scissor{scissor});
+    }
+
+    void recording_command_queue::draw(uint32 vertex_count, uint32 first_vertex, uint32 instance_count, uint32 first_instance)
+    {
+        m_stream.append(commands::draw{vertex_count, first_vertex, instance_count, first_instance});
+    }
+
+    void recording_command_queue::draw_indexed(uint32 index_count, uint32 first_index, uint32 vertex_offset, uint32 instance_count, uint32 first_instance)
+    {
+        m_stream.append(commands::draw_indexed{index_count, first_index, vertex_offset, instance_count, first_instance});
+    }
+
+    void recording_command_queue::draw_indirect(const draw_indirect_info& info)
+    {
+        m_stream.append(commands::draw_indirect{info});
+    }
+
+    void recording_command_queue::draw_indexed_indirect(const draw_indirect_info& info)
+    {
+        m_stream.append(commands::draw_indexed_indirect{info});
+    }
+
+    void recording_command_queue::dispatch(uint32 group_count_x, uint32 group_count_y, uint32 group_count_z)
+    {
+        m_stream.append(commands::dispatch{group_count_x, group_count_y, group_count_z});
+    }
+
+    void recording_command_queue::dispatch_indirect(buffer_handle buffer, size_t offset)
+    {
+        m_stream.append(commands::dispatch_indirect{buffer, offset});
+    }
+
+    void recording_command_queue::memory_barrier(core::flags<barrier_scope> scope)
+    {
+        m_stream.append(commands::memory_barrier{scope});
+    }
+
+    void recording_command_queue::signal_fence(fence_handle fence)
+    {
+        m_stream.append(commands::signal_fence{fence});
+    }
+
+    void recording_command_queue::wait_for_fence(fence_handle fence)
+    {
+        m_stream.append(commands::wait_for_fence{fence});
+    }
+
+    void recording_command_queue::copy_buffer(buffer_handle src_buffer, buffer_handle dst_buffer, size_t size, size_t src_offset, size_t dst_offset)
+    {
+        m_stream.append(commands::copy_buffer{src_buffer, dst_buffer, size, src_offset, dst_offset});
+    }
+
+    void recording_command_queue::copy_buffer_to_texture(buffer_handle src_buffer, texture_handle dst_texture, const texture_copy_region& region)
+    {
+        m_stream.append(commands::copy_buffer_to_texture{src_buffer, dst_texture, region});
+    }
+
+    void recording_command_queue::copy_texture_to_buffer(texture_handle src_texture, buffer_handle dst_buffer, const texture_copy_region& region)
+    {
+        m_stream.append(commands::copy_texture_to_buffer{src_texture, dst_buffer, region});
+    }
+
+    void recording_command_queue::push_constant(const void* constants, size_t size)
+    {
+        TAV_ASSERT(size <= k_max_push_constant_buffer_size_bytes);
+        m_stream.append(commands::push_constant{}, core::buffer_view<uint8>(static_cast<const uint8*>(constants), size));
+    }
+
+} // namespace tavros::renderer::rhi
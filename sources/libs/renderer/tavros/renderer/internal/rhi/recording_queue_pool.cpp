@@ -0,0 +1,70 @@
+#include <tavros/renderer/rhi/recording_queue_pool.hpp>
+
+#include <tavros/core/debug/assert.hpp>
+
+namespace tavros::renderer::rhi
+{
+
+    recording_command_queue* recording_queue_pool::acquire()
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_free_entries.empty()) {
+            m_entries.push_back({core::make_unique<recording_command_queue>(), true});
+            return m_entries.back().queue.get();
+        }
+
+        auto& e = m_entries[m_free_entries.back()];
+        m_free_entries.pop_back();
+        e.acquired = true;
+        return e.queue.get();
+    }
+
+    recording_command_queue* recording_queue_pool::find(command_queue* queue) noexcept
+    {
+        std::lock_guard lock(m_mutex);
+        auto            index = index_of(queue);
+        if (index == m_entries.size() || !m_entries[index].acquired) {
+            return nullptr;
+        }
+        return m_entries[index].queue.get();
+    }
+
+    bool recording_queue_pool::owns(command_queue* queue) const noexcept
+    {
+        std::lock_guard lock(m_mutex);
+        return index_of(queue) != m_entries.size();
+    }
+
+    void recording_queue_pool::release(recording_command_queue* queue)
+    {
+        TAV_ASSERT(queue);
+
+        std::lock_guard lock(m_mutex);
+        auto            index = index_of(queue);
+        if (index == m_entries.size() || !m_entries[index].acquired) {
+            return;
+        }
+
+        queue->reset();
+        m_entries[index].acquired = false;
+        m_free_entries.push_back(index);
+    }
+
+    void recording_queue_pool::clear() noexcept
+    {
+        std::lock_guard lock(m_mutex);
+        m_free_entries.clear();
+        m_entries.clear();
+    }
+
+    size_t recording_queue_pool::index_of(const command_queue* queue) const noexcept
+    {
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if (m_entries[i].queue.get() == queue) {
+                return i;
+            }
+        }
+        return m_entries.size();
+    }
+
+} // namespace tavros::renderer::rhi
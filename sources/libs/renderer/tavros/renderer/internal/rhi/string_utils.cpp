@@ -31,6 +31,7 @@ namespace tavros::renderer::rhi
     enum class render_backend_type : uint8;
     enum class load_op : uint8;
     enum class store_op : uint8;
+    enum class command_type : uint8;
 
     core::string_view to_string(buffer_usage val) noexcept
     {
@@ -45,6 +46,8 @@ namespace tavros::renderer::rhi
             return "constant";
         case buffer_usage::storage:
             return "storage";
+        case buffer_usage::indirect:
+            return "indirect";
         }
         TAV_UNREACHABLE();
     }
@@ -459,6 +462,42 @@ namespace tavros::renderer::rhi
         TAV_UNREACHABLE();
     }
 
+    core::string_view to_string(image_access val) noexcept
+    {
+        switch (val) {
+        case image_access::read_only:
+            return "read_only";
+        case image_access::write_only:
+            return "write_only";
+        case image_access::read_write:
+            return "read_write";
+        }
+        TAV_UNREACHABLE();
+    }
+
+    core::string_view to_string(barrier_scope val) noexcept
+    {
+        switch (val) {
+        case barrier_scope::storage_buffer:
+            return "storage_buffer";
+        case barrier_scope::storage_image:
+            return "storage_image";
+        case barrier_scope::indirect_args:
+            return "indirect_args";
+        case barrier_scope::vertex_input:
+            return "vertex_input";
+        case barrier_scope::constant:
+            return "constant";
+        case barrier_scope::texture_fetch:
+            return "texture_fetch";
+        case barrier_scope::transfer:
+            return "transfer";
+        case barrier_scope::host_read:
+            return "host_read";
+        }
+        TAV_UNREACHABLE();
+    }
+
     core::string_view to_string(filter_mode val) noexcept
     {
         switch (val) {
@@ -507,6 +546,8 @@ namespace tavros::renderer::rhi
             return "directx12";
         case render_backend_type::metal:
             return "metal";
+        case render_backend_type::null:
+            return "null";
         }
         TAV_UNREACHABLE();
     }
@@ -624,6 +665,59 @@ namespace tavros::renderer::rhi
         TAV_UNREACHABLE();
     }
 
+    core::string_view to_string(command_type val) noexcept
+    {
+        switch (val) {
+        case command_type::bind_pipeline:
+            return "bind_pipeline";
+        case command_type::bind_vertex_buffers:
+            return "bind_vertex_buffers";
+        case command_type::bind_index_buffer:
+            return "bind_index_buffer";
+        case command_type::bind_shader_buffers:
+            return "bind_shader_buffers";
+        case command_type::bind_shader_textures:
+            return "bind_shader_textures";
+        case command_type::bind_storage_images:
+            return "bind_storage_images";
+        case command_type::begin_rendering:
+            return "begin_rendering";
+        case command_type::end_rendering:
+            return "end_rendering";
+        case command_type::set_viewport:
+            return "set_viewport";
+        case command_type::set_scissor:
+            return "set_scissor";
+        case command_type::draw:
+            return "draw";
+        case command_type::draw_indexed:
+            return "draw_indexed";
+        case command_type::draw_indirect:
+            return "draw_indirect";
+        case command_type::draw_indexed_indirect:
+            return "draw_indexed_indirect";
+        case command_type::dispatch:
+            return "dispatch";
+        case command_type::dispatch_indirect:
+            return "dispatch_indirect";
+        case command_type::memory_barrier:
+            return "memory_barrier";
+        case command_type::signal_fence:
+            return "signal_fence";
+        case command_type::wait_for_fence:
+            return "wait_for_fence";
+        case command_type::copy_buffer:
+            return "copy_buffer";
+        case command_type::copy_buffer_to_texture:
+            return "copy_buffer_to_texture";
+        case command_type::copy_texture_to_buffer:
+            return "copy_texture_to_buffer";
+        case command_type::push_constant:
+            return "push_constant";
+        }
+        TAV_UNREACHABLE();
+    }
+
     pixel_format combine_depth_stencil_formats(pixel_format df, pixel_format sf) noexcept
     {
         TAV_ASSERT(df == pixel_format::depth24 || df == pixel_format::depth32f || df == pixel_format::none);
@@ -98,8 +98,9 @@ namespace tavros::renderer
 
     void render_system::end_frame() noexcept
     {
-        m_renderer2d->end_frame();
+        // Uploads requested during the frame are executed before the draws using them
         m_rm->end_frame();
+        m_renderer2d->end_frame();
         ++m_frame_number;
         m_composer->present();
     }
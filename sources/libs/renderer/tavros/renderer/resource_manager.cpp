@@ -213,6 +213,7 @@ namespace tavros::renderer
 
     void resource_manager::end_frame() noexcept
     {
+        m_upctx.flush();
     }
 
     void resource_manager::set_material_load_params(core::buffer_view<material::vertex_attribute> vert_attribs, uint32 msaa, rhi::pixel_format ds_format) noexcept
@@ -252,9 +253,9 @@ namespace tavros::renderer
                 logger.flush(ds);
             }
 
-            core::dynamic_buffer<uint8> font_data;
+            assets::asset_blob font_data;
             try {
-                font_data = m_am->read_binary(desc.path());
+                font_data = m_am->map_binary(desc.path());
             } catch (const core::file_error& e) {
                 logger.error("Failed to open font '{}'", desc.path());
                 m_fnt_reg.publish_failed(slot.first);
@@ -299,8 +300,8 @@ namespace tavros::renderer
             assets::image im;
             try {
                 auto im_fmt = to_im_format(desc.load_params().pixel_format);
-                auto data = m_am->read_binary(desc.load_params().path);
-                im = assets::image::decode(data, im_fmt, true);
+                auto data = m_am->map_binary(desc.load_params().path);
+                im = assets::image::decode(data.view(), im_fmt, true);
             } catch (const core::file_error& e) {
                 logger.error("Failed to open image '{}'", desc.load_params().path);
                 return slot.first;
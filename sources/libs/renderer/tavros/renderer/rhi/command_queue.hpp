@@ -85,6 +85,17 @@ namespace tavros::renderer::rhi
          */
         virtual void bind_shader_textures(core::buffer_view<texture_binding> textures) = 0;
 
+        /**
+         * @brief Binds one or more texture mip levels as storage images.
+         *
+         * Storage images are read and written by shaders with image load and store operations,
+         * the textures must be created with `texture_usage::storage`. Writes become visible to
+         * later commands only after a @ref memory_barrier() with the matching scope.
+         *
+         * @param images Array of image bindings.
+         */
+        virtual void bind_storage_images(core::buffer_view<image_binding> images) = 0;
+
         /**
          * @brief Begin a render pass.
          *
@@ -154,6 +165,58 @@ namespace tavros::renderer::rhi
          */
         virtual void draw_indexed(uint32 index_count, uint32 first_index = 0, uint32 vertex_offset = 0, uint32 instance_count = 1, uint32 first_instance = 0) = 0;
 
+        /**
+         * @brief Issue a batch of non-indexed draws whose arguments are read from a GPU buffer.
+         *
+         * Each record in `info.buffer` is a @ref draw_indirect_args. When `info.count_buffer` is set,
+         * the number of draws is read from it and clamped to `info.draw_count`, so the whole batch
+         * can be produced on the GPU. Must be called within a render pass.
+         *
+         * @param info Location, number and stride of the argument records.
+         */
+        virtual void draw_indirect(const draw_indirect_info& info) = 0;
+
+        /**
+         * @brief Issue a batch of indexed draws whose arguments are read from a GPU buffer.
+         *
+         * Same as @ref draw_indirect, but each record is a @ref draw_indexed_indirect_args
+         * and indices are fetched from the bound index buffer. Must be called within a render pass.
+         *
+         * @param info Location, number and stride of the argument records.
+         */
+        virtual void draw_indexed_indirect(const draw_indirect_info& info) = 0;
+
+        /**
+         * @brief Launch work groups of the bound compute pipeline.
+         *
+         * Must be called outside of a render pass. Shader buffers, storage images and push constants
+         * bound before the call are visible to the compute shader.
+         *
+         * @param group_count_x Number of work groups in X dimension.
+         * @param group_count_y Number of work groups in Y dimension (default = 1).
+         * @param group_count_z Number of work groups in Z dimension (default = 1).
+         */
+        virtual void dispatch(uint32 group_count_x, uint32 group_count_y = 1, uint32 group_count_z = 1) = 0;
+
+        /**
+         * @brief Launch work groups of the bound compute pipeline, the group counts are read from a GPU buffer.
+         *
+         * @param buffer Buffer with `buffer_usage::indirect` holding a @ref dispatch_indirect_args record.
+         * @param offset Byte offset of the record, must be a multiple of 4.
+         */
+        virtual void dispatch_indirect(buffer_handle buffer, size_t offset = 0) = 0;
+
+        /**
+         * @brief Makes shader writes of previous commands visible to later commands.
+         *
+         * Storage buffer and storage image writes are not ordered with later reads. A barrier
+         * is required between a dispatch and any command that consumes its results, e.g. before
+         * drawing with arguments produced by a culling shader use `barrier_scope::indirect_args`.
+         *
+         * @param scope How the written data is going to be read.
+         */
+        virtual void memory_barrier(core::flags<barrier_scope> scope) = 0;
+
         /**
          * @brief Signal a fence from the GPU, marking it as completed when reached in the command queue.
          *
@@ -0,0 +1,443 @@
+#pragma once
+
+#include <tavros/renderer/rhi/handle.hpp>
+#include <tavros/renderer/rhi/enums.hpp>
+#include <tavros/renderer/rhi/structs.hpp>
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/core/memory/buffer_view.hpp>
+#include <tavros/core/debug/assert.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace tavros::renderer::rhi
+{
+
+    class command_queue;
+
+    /**
+     * @brief Command payloads, one per @ref command_type.
+     *
+     * Commands taking an array of bindings (or raw bytes) store the element count in the
+     * payload; the elements follow the payload in the stream, see @ref command_stream::command::items().
+     */
+    namespace commands
+    {
+        struct bind_pipeline
+        {
+            static constexpr auto k_type = command_type::bind_pipeline;
+            pipeline_handle       pipeline;
+        };
+
+        struct bind_vertex_buffers
+        {
+            static constexpr auto k_type = command_type::bind_vertex_buffers;
+            using item_type = bind_buffer_info;
+            uint32 count = 0;
+        };
+
+        struct bind_index_buffer
+        {
+            static constexpr auto  k_type = command_type::bind_index_buffer;
+            bind_index_buffer_info info;
+        };
+
+        struct bind_shader_buffers
+        {
+            static constexpr auto k_type = command_type::bind_shader_buffers;
+            using item_type = buffer_binding;
+            uint32 count = 0;
+        };
+
+        struct bind_shader_textures
+        {
+            static constexpr auto k_type = command_type::bind_shader_textures;
+            using item_type = texture_binding;
+            uint32 count = 0;
+        };
+
+        struct bind_storage_images
+        {
+            static constexpr auto k_type = command_type::bind_storage_images;
+            using item_type = image_binding;
+            uint32 count = 0;
+        };
+
+        struct begin_rendering
+        {
+            static constexpr auto k_type = command_type::begin_rendering;
+            framebuffer_handle    framebuffer;
+        };
+
+        struct end_rendering
+        {
+            static constexpr auto k_type = command_type::end_rendering;
+        };
+
+        struct set_viewport
+        {
+            static constexpr auto k_type = command_type::set_viewport;
+            viewport_info         viewport;
+        };
+
+        struct set_scissor
+        {
+            static constexpr auto k_type = command_type::set_scissor;
+            scissor_info          scissor;
+        };
+
+        struct draw
+        {
+            static constexpr auto k_type = command_type::draw;
+            uint32                vertex_count = 0;
+            uint32                first_vertex = 0;
+            uint32                instance_count = 1;
+            uint32                first_instance = 0;
+        };
+
+        struct draw_indexed
+        {
+            static constexpr auto k_type = command_type::draw_indexed;
+            uint32                index_count = 0;
+            uint32                first_index = 0;
+            uint32                vertex_offset = 0;
+            uint32                instance_count = 1;
+            uint32                first_instance = 0;
+        };
+
+        struct draw_indirect
+        {
+            static constexpr auto k_type = command_type::draw_indirect;
+            draw_indirect_info    info;
+        };
+
+        struct draw_indexed_indirect
+        {
+            static constexpr auto k_type = command_type::draw_indexed_indirect;
+            draw_indirect_info    info;
+        };
+
+        struct dispatch
+        {
+            static constexpr auto k_type = command_type::dispatch;
+            uint32                group_count_x = 1;
+            uint32                group_count_y = 1;
+            uint32                group_count_z = 1;
+        };
+
+        struct dispatch_indirect
+        {
+            static constexpr auto k_type = command_type::dispatch_indirect;
+            buffer_handle         buffer;
+            size_t                offset = 0;
+        };
+
+        struct memory_barrier
+        {
+            static constexpr auto      k_type = command_type::memory_barrier;
+            core::flags<barrier_scope> scope;
+        };
+
+        struct signal_fence
+        {
+            static constexpr auto k_type = command_type::signal_fence;
+            fence_handle          fence;
+        };
+
+        struct wait_for_fence
+        {
+            static constexpr auto k_type = command_type::wait_for_fence;
+            fence_handle          fence;
+        };
+
+        struct copy_buffer
+        {
+            static constexpr auto k_type = command_type::copy_buffer;
+            buffer_handle         src_buffer;
+            buffer_handle         dst_buffer;
+            size_t                size = 0;
+            size_t                src_offset = 0;
+            size_t                dst_offset = 0;
+        };
+
+        struct copy_buffer_to_texture
+        {
+            static constexpr auto k_type = command_type::copy_buffer_to_texture;
+            buffer_handle         src_buffer;
+            texture_handle        dst_texture;
+            texture_copy_region   region;
+        };
+
+        struct copy_texture_to_buffer
+        {
+            static constexpr auto k_type = command_type::copy_texture_to_buffer;
+            texture_handle        src_texture;
+            buffer_handle         dst_buffer;
+            texture_copy_region   region;
+        };
+
+        struct push_constant
+        {
+            static constexpr auto k_type = command_type::push_constant;
+            using item_type = uint8;
+            uint32 count = 0;
+        };
+    } // namespace commands
+
+    /**
+     * @brief Linear buffer of recorded GPU commands.
+     *
+     * Commands are packed one after another into a single byte array: a small header, the
+     * payload from @ref commands and the trailing array items if any. Recording copies
+     * everything it needs, so the caller's arrays and push constant data may be released
+     * right after the call; and it touches no device state, so streams can be recorded on any
+     * thread and replayed later on the thread owning the device.
+     *
+     * Features and design choices:
+     * - One allocation for the whole stream; @ref clear() keeps the capacity, so a stream
+     *   reused every frame stops allocating once it has grown to the frame size.
+     * - Commands are read back in order with @ref begin() / @ref end(), without a GPU
+     *   context, which makes recorded frames easy to inspect in tests and tools.
+     * - @ref replay() feeds the commands to any @ref command_queue implementation.
+     */
+    class command_stream
+    {
+    public:
+        /**
+         * @brief Precedes every command in the stream.
+         */
+        struct header
+        {
+            command_type type;
+            /// Size of the command in bytes, including this header and the trailing items
+            uint32 size = 0;
+        };
+
+        /// Every command starts at a multiple of this many bytes.
+        static constexpr size_t k_alignment = 8;
+
+        /**
+         * @brief A command read from the stream.
+         */
+        class command
+        {
+        public:
+            explicit command(const header* h) noexcept
+                : m_header(h)
+            {
+            }
+
+            /**
+             * @brief Returns the type of the command.
+             */
+            [[nodiscard]] command_type type() const noexcept
+            {
+                return m_header->type;
+            }
+
+            /**
+             * @brief Returns the payload, @p Command must match @ref type().
+             */
+            template<class Command>
+            [[nodiscard]] const Command& as() const noexcept
+            {
+                TAV_ASSERT(type() == Command::k_type);
+                return *reinterpret_cast<const Command*>(payload_of<Command>());
+            }
+
+            /**
+             * @brief Returns the items following the payload of an array command.
+             */
+            template<class Command>
+            [[nodiscard]] core::buffer_view<typename Command::item_type> items() const noexcept
+            {
+                using item = typename Command::item_type;
+                const auto* data = payload_of<Command>() + items_offset<Command>();
+                return {reinterpret_cast<const item*>(data), as<Command>().count};
+            }
+
+        private:
+            template<class Command>
+            const uint8* payload_of() const noexcept
+            {
+                return reinterpret_cast<const uint8*>(m_header) + k_payload_offset;
+            }
+
+        private:
+            const header* m_header;
+        };
+
+        /**
+         * @brief Forward iterator over the commands of a stream.
+         */
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = command;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = command;
+
+            const_iterator() noexcept = default;
+
+            explicit const_iterator(const uint8* p) noexcept
+                : m_ptr(p)
+            {
+            }
+
+            command operator*() const noexcept
+            {
+                return command(reinterpret_cast<const header*>(m_ptr));
+            }
+
+            const_iterator& operator++() noexcept
+            {
+                m_ptr += reinterpret_cast<const header*>(m_ptr)->size;
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            bool operator==(const const_iterator& other) const noexcept = default;
+
+        private:
+            const uint8* m_ptr = nullptr;
+        };
+
+    public:
+        command_stream() noexcept = default;
+
+        /**
+         * @brief Appends a command without trailing items.
+         */
+        template<class Command>
+        void append(const Command& cmd)
+        {
+            static_assert(std::is_trivially_copyable_v<Command>, "commands are copied as raw bytes");
+            static_assert(alignof(Command) <= k_alignment, "command payload is over-aligned");
+
+            uint8* p = allocate(Command::k_type, k_payload_offset + sizeof(Command));
+            std::memcpy(p + k_payload_offset, &cmd, sizeof(Command));
+        }
+
+        /**
+         * @brief Appends an array command, the count of @p cmd is set from @p items.
+         */
+        template<class Command>
+        void append(Command cmd, core::buffer_view<typename Command::item_type> items)
+        {
+            using item = typename Command::item_type;
+            static_assert(std::is_trivially_copyable_v<item>, "command items are copied as raw bytes");
+            static_assert(alignof(item) <= k_alignment, "command item is over-aligned");
+
+            cmd.count = static_cast<uint32>(items.size());
+            const size_t items_at = k_payload_offset + items_offset<Command>();
+            uint8*       p = allocate(Command::k_type, items_at + items.size() * sizeof(item));
+            std::memcpy(p + k_payload_offset, &cmd, sizeof(Command));
+            if (!items.empty()) {
+                std::memcpy(p + items_at, items.data(), items.size() * sizeof(item));
+            }
+        }
+
+        /**
+         * @brief Removes all commands, the memory is kept for the next recording.
+         */
+        void clear() noexcept
+        {
+            m_data.clear();
+            m_count = 0;
+        }
+
+        /**
+         * @brief Returns the number of commands.
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_count;
+        }
+
+        /**
+         * @brief Returns true if the stream has no commands.
+         */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_count == 0;
+        }
+
+        /**
+         * @brief Returns the number of bytes used by the recorded commands.
+         */
+        [[nodiscard]] size_t size_bytes() const noexcept
+        {
+            return m_data.size();
+        }
+
+        /**
+         * @brief Returns the number of bytes the stream can hold without allocating.
+         */
+        [[nodiscard]] size_t capacity_bytes() const noexcept
+        {
+            return m_data.capacity();
+        }
+
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            return const_iterator(m_data.data());
+        }
+
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return const_iterator(m_data.data() + m_data.size());
+        }
+
+    private:
+        static constexpr size_t align_up(size_t size) noexcept
+        {
+            return (size + k_alignment - 1) & ~(k_alignment - 1);
+        }
+
+        // The header is padded so that payloads start aligned
+        static constexpr size_t k_payload_offset = (sizeof(header) + k_alignment - 1) & ~(k_alignment - 1);
+
+        template<class Command>
+        static constexpr size_t items_offset() noexcept
+        {
+            return align_up(sizeof(Command));
+        }
+
+        // Reserves an aligned command of `size` bytes with its header filled in
+        uint8* allocate(command_type type, size_t size)
+        {
+            const size_t offset = m_data.size();
+            const size_t aligned = align_up(size);
+            if (offset + aligned > m_data.capacity()) {
+                m_data.reserve(std::max(offset + aligned, m_data.capacity() * 2));
+            }
+            m_data.resize(offset + aligned);
+
+            uint8*       p = m_data.data() + offset;
+            const header h{type, static_cast<uint32>(aligned)};
+            std::memcpy(p, &h, sizeof(h));
+            ++m_count;
+            return p;
+        }
+
+    private:
+        core::vector<uint8> m_data;
+        size_t              m_count = 0;
+    };
+
+    /**
+     * @brief Issues every command of @p stream to @p queue, in recording order.
+     */
+    void replay(const command_stream& stream, command_queue& queue);
+
+} // namespace tavros::renderer::rhi
@@ -15,6 +15,7 @@ namespace tavros::renderer::rhi
         vertex,   /// Buffer used for vertex attribute data
         constant, /// Buffer used for constant (read-only) shader data
         storage,  /// Buffer used for read-write shader data
+        indirect, /// Buffer used for indirect draw arguments and draw counts
     };
 
     /**
@@ -320,6 +321,32 @@ namespace tavros::renderer::rhi
         resolve_destination = 0x80,  /// Texture can be used as the destination of a resolve operation (must be non-multisampled)
     };
 
+    /**
+     * Specifies how a shader accesses a storage image
+     */
+    enum class image_access : uint8
+    {
+        read_only,  /// Image is only loaded from
+        write_only, /// Image is only stored to
+        read_write, /// Image is loaded from and stored to
+    };
+
+    /**
+     * Specifies which later reads must see the results of shader writes made before a memory barrier.
+     * Multiple flags can be combined using bitwise OR.
+     */
+    enum class barrier_scope : uint8
+    {
+        storage_buffer = 0x01, /// Storage buffer reads and writes in shaders
+        storage_image = 0x02,  /// Storage image loads and stores in shaders
+        indirect_args = 0x04,  /// Draw and dispatch arguments read from indirect buffers
+        vertex_input = 0x08,   /// Vertex and index buffer fetches
+        constant = 0x10,       /// Constant buffer reads in shaders
+        texture_fetch = 0x20,  /// Texture sampling in shaders
+        transfer = 0x40,       /// Buffer and texture copies
+        host_read = 0x80,      /// CPU reads through mapped buffers
+    };
+
     /**
      * Defines the filtering method for magnification and minification.
      */
@@ -358,6 +385,7 @@ namespace tavros::renderer::rhi
         vulkan,    /// Vulkan backend (not implemented yet)
         directx12, /// DirectX 12 backend (not implemented yet)
         metal,     /// Metal backend (not implemented yet)
+        null,      /// Headless backend without a GPU, validates and counts commands
     };
 
     /**
@@ -447,4 +475,34 @@ namespace tavros::renderer::rhi
         iimage_buffer,     /// Signed integer buffer image
     };
 
+    /**
+     * Identifies a command recorded into a command_stream, one per command_queue method
+     */
+    enum class command_type : uint8
+    {
+        bind_pipeline,          /// command_queue::bind_pipeline
+        bind_vertex_buffers,    /// command_queue::bind_vertex_buffers
+        bind_index_buffer,      /// command_queue::bind_index_buffer
+        bind_shader_buffers,    /// command_queue::bind_shader_buffers
+        bind_shader_textures,   /// command_queue::bind_shader_textures
+        bind_storage_images,    /// command_queue::bind_storage_images
+        begin_rendering,        /// command_queue::begin_rendering
+        end_rendering,          /// command_queue::end_rendering
+        set_viewport,           /// command_queue::set_viewport
+        set_scissor,            /// command_queue::set_scissor
+        draw,                   /// command_queue::draw
+        draw_indexed,           /// command_queue::draw_indexed
+        draw_indirect,          /// command_queue::draw_indirect
+        draw_indexed_indirect,  /// command_queue::draw_indexed_indirect
+        dispatch,               /// command_queue::dispatch
+        dispatch_indirect,      /// command_queue::dispatch_indirect
+        memory_barrier,         /// command_queue::memory_barrier
+        signal_fence,           /// command_queue::signal_fence
+        wait_for_fence,         /// command_queue::wait_for_fence
+        copy_buffer,            /// command_queue::copy_buffer
+        copy_buffer_to_texture, /// command_queue::copy_buffer_to_texture
+        copy_texture_to_buffer, /// command_queue::copy_texture_to_buffer
+        push_constant,          /// command_queue::push_constant
+    };
+
 } // namespace tavros::renderer::rhi
@@ -62,7 +62,8 @@ namespace tavros::renderer::rhi
          * @brief Create a new command queue for the current frame.
          *
          * Command queues created by this method are used to record rendering or compute commands.
-         * The lifetime of the command queue is tied to the current frame.
+         * Recording does not touch the device, so this method may be called, and the queue filled,
+         * on any thread. The queue stays valid until it is submitted.
          *
          * @return command_queue* Pointer to a new command queue object, or nullptr if no resources are available.
          */
@@ -72,9 +73,10 @@ namespace tavros::renderer::rhi
          * @brief Submit a completed command queue for execution.
          *
          * This method indicates that the command queue has finished recording
-         * and is ready to be executed by the GPU.
+         * and is ready to be executed by the GPU. Queues execute in submission order,
+         * this must be called on the thread owning the device.
          *
-         * @param queue Pointer to the command queue to submit.
+         * @param queue Pointer to the command queue to submit, it must not be used afterwards.
          */
         virtual void submit_command_queue(command_queue* queue) = 0;
 
@@ -139,6 +141,17 @@ namespace tavros::renderer::rhi
          */
         virtual pipeline_handle create_pipeline(const pipeline_create_info& info) = 0;
 
+        /**
+         * @brief Create a compute pipeline.
+         *
+         * Compute pipelines share the handle type with graphics pipelines and are destroyed with
+         * destroy_pipeline(). They are bound outside of render passes and used by dispatch commands.
+         *
+         * @param info Pipeline creation parameters.
+         * @return Handle to the created pipeline.
+         */
+        virtual pipeline_handle create_compute_pipeline(const compute_pipeline_create_info& info) = 0;
+
         /**
          * @brief Destroy a previously created pipeline.
          *
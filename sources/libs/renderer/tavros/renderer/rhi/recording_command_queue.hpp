@@ -0,0 +1,95 @@
+#pragma once
+
+#include <tavros/renderer/rhi/command_queue.hpp>
+#include <tavros/renderer/rhi/command_stream.hpp>
+
+namespace tavros::renderer::rhi
+{
+
+    /**
+     * @brief Command queue that records commands into a @ref command_stream.
+     *
+     * Nothing is executed and no device is touched while recording, so queues of this type
+     * can be filled on worker threads. The device executes the stream on submit by replaying
+     * it into its immediate queue, see @ref replay().
+     *
+     * Notes:
+     * - Array arguments and push constant data are copied into the stream.
+     * - @ref reset() clears the stream but keeps its memory, queues are meant to be reused.
+     */
+    class recording_command_queue final : public command_queue
+    {
+    public:
+        recording_command_queue() noexcept = default;
+
+        ~recording_command_queue() override = default;
+
+        void bind_pipeline(pipeline_handle pipeline) override;
+
+        void bind_vertex_buffers(core::buffer_view<bind_buffer_info> buffers) override;
+
+        void bind_index_buffer(const bind_index_buffer_info& info) override;
+
+        void bind_shader_buffers(core::buffer_view<buffer_binding> buffers) override;
+
+        void bind_shader_textures(core::buffer_view<texture_binding> textures) override;
+
+        void bind_storage_images(core::buffer_view<image_binding> images) override;
+
+        void begin_rendering(framebuffer_handle framebuffer) override;
+
+        void end_rendering() override;
+
+        void set_viewport(const viewport_info& viewport) override;
+
+        void set_scissor(const scissor_info& scissor) override;
+
+        void draw(uint32 vertex_count, uint32 first_vertex = 0, uint32 instance_count = 1, uint32 first_instance = 0) override;
+
+        void draw_indexed(uint32 index_count, uint32 first_index = 0, uint32 vertex_offset = 0, uint32 instance_count = 1, uint32 first_instance = 0) override;
+
+        void draw_indirect(const draw_indirect_info& info) override;
+
+        void draw_indexed_indirect(const draw_indirect_info& info) override;
+
+        void dispatch(uint32 group_count_x, uint32 group_count_y = 1, uint32 group_count_z = 1) override;
+
+        void dispatch_indirect(buffer_handle buffer, size_t offset = 0) override;
+
+        void memory_barrier(core::flags<barrier_scope> scope) override;
+
+        void signal_fence(fence_handle fence) override;
+
+        void wait_for_fence(fence_handle fence) override;
+
+        void copy_buffer(buffer_handle src_buffer, buffer_handle dst_buffer, size_t size, size_t src_offset = 0, size_t dst_offset = 0) override;
+
+        void copy_buffer_to_texture(buffer_handle src_buffer, texture_handle dst_texture, const texture_copy_region& region) override;
+
+        void copy_texture_to_buffer(texture_handle src_texture, buffer_handle dst_buffer, const texture_copy_region& region) override;
+
+        void push_constant(const void* constants, size_t size) override;
+
+        using command_queue::push_constant;
+
+        /**
+         * @brief Returns the commands recorded since the last reset.
+         */
+        [[nodiscard]] const command_stream& stream() const noexcept
+        {
+            return m_stream;
+        }
+
+        /**
+         * @brief Discards the recorded commands, keeping the memory for the next recording.
+         */
+        void reset() noexcept
+        {
+            m_stream.clear();
+        }
+
+    private:
+        command_stream m_stream;
+    };
+
+} // namespace tavros::renderer::rhi
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <tavros/core/noncopyable.hpp>
+#include <tavros/core/nonmovable.hpp>
+#include <tavros/core/memory/memory.hpp>
+#include <tavros/core/containers/vector.hpp>
+#include <tavros/renderer/rhi/recording_command_queue.hpp>
+
+#include <mutex>
+
+namespace tavros::renderer::rhi
+{
+
+    /**
+     * @brief Owns the @ref recording_command_queue objects handed out by a device.
+     *
+     * Devices return queues from this pool in create_command_queue() and give them back on
+     * submit, so a queue and its stream memory are reused frame after frame. Queues are only
+     * destroyed with the pool.
+     *
+     * @note Thread-safe.
+     */
+    class recording_queue_pool final : core::noncopyable, core::nonmovable
+    {
+    public:
+        recording_queue_pool() noexcept = default;
+
+        ~recording_queue_pool() noexcept = default;
+
+        /**
+         * @brief Returns an empty queue, reusing a released one when available.
+         */
+        recording_command_queue* acquire();
+
+        /**
+         * @brief Returns the queue behind @p queue if it was acquired from this pool and not released yet.
+         *
+         * @return The queue, or nullptr if @p queue does not belong to the pool or is already released.
+         */
+        [[nodiscard]] recording_command_queue* find(command_queue* queue) noexcept;
+
+        /**
+         * @brief Checks whether @p queue was created by this pool, whether it is handed out or not.
+         */
+        [[nodiscard]] bool owns(command_queue* queue) const noexcept;
+
+        /**
+         * @brief Clears the stream of @p queue and makes it available to @ref acquire().
+         *
+         * Queues that are already released are ignored, so a queue is never handed out twice.
+         *
+         * @param queue Queue previously returned by @ref acquire() or @ref find().
+         */
+        void release(recording_command_queue* queue);
+
+        /**
+         * @brief Destroys all queues, including the ones still handed out.
+         */
+        void clear() noexcept;
+
+    private:
+        struct entry
+        {
+            core::unique_ptr<recording_command_queue> queue;
+            bool                                      acquired = false;
+        };
+
+        // Returns the index of the entry holding queue, or m_entries.size()
+        size_t index_of(const command_queue* queue) const noexcept;
+
+        mutable std::mutex   m_mutex;
+        core::vector<entry>  m_entries;
+        core::vector<size_t> m_free_entries;
+    }; // class recording_queue_pool
+
+} // namespace tavros::renderer::rhi
@@ -24,6 +24,8 @@ namespace tavros::renderer::rhi
     core::string_view to_string(pixel_format val) noexcept;
     core::string_view to_string(texture_type val) noexcept;
     core::string_view to_string(texture_usage val) noexcept;
+    core::string_view to_string(image_access val) noexcept;
+    core::string_view to_string(barrier_scope val) noexcept;
     core::string_view to_string(filter_mode val) noexcept;
     core::string_view to_string(mipmap_filter_mode val) noexcept;
     core::string_view to_string(wrap_mode val) noexcept;
@@ -31,6 +33,7 @@ namespace tavros::renderer::rhi
     core::string_view to_string(load_op val) noexcept;
     core::string_view to_string(store_op val) noexcept;
     core::string_view to_string(shader_resource_type val) noexcept;
+    core::string_view to_string(command_type val) noexcept;
 
     pixel_format combine_depth_stencil_formats(pixel_format df, pixel_format sf) noexcept;
 
@@ -67,6 +67,116 @@ namespace tavros::renderer::rhi
         uint32 binding = 0;
     };
 
+    /**
+     * @brief Arguments of one non-indexed draw, as read by the GPU from an indirect buffer.
+     * The layout matches the native indirect command, the struct can be written to a mapped buffer as is.
+     */
+    struct draw_indirect_args
+    {
+        /// Number of vertices to draw
+        uint32 vertex_count = 0;
+
+        /// Number of instances to draw
+        uint32 instance_count = 1;
+
+        /// Index of the first vertex to draw
+        uint32 first_vertex = 0;
+
+        /// Index of the first instance
+        uint32 first_instance = 0;
+    };
+
+    /**
+     * @brief Arguments of one indexed draw, as read by the GPU from an indirect buffer.
+     * The layout matches the native indirect command, the struct can be written to a mapped buffer as is.
+     */
+    struct draw_indexed_indirect_args
+    {
+        /// Number of indices to draw
+        uint32 index_count = 0;
+
+        /// Number of instances to draw
+        uint32 instance_count = 1;
+
+        /// Index of the first index to draw
+        uint32 first_index = 0;
+
+        /// Value added to each index before fetching the vertex
+        int32 vertex_offset = 0;
+
+        /// Index of the first instance
+        uint32 first_instance = 0;
+    };
+
+    /**
+     * @brief Number of work groups of one dispatch, as read by the GPU from an indirect buffer.
+     */
+    struct dispatch_indirect_args
+    {
+        /// Number of work groups in X dimension
+        uint32 group_count_x = 1;
+
+        /// Number of work groups in Y dimension
+        uint32 group_count_y = 1;
+
+        /// Number of work groups in Z dimension
+        uint32 group_count_z = 1;
+    };
+
+    static_assert(sizeof(draw_indirect_args) == 16);
+    static_assert(sizeof(draw_indexed_indirect_args) == 20);
+    static_assert(sizeof(dispatch_indirect_args) == 12);
+
+    /**
+     * @brief Describes a binding of a texture mip level as a storage image.
+     */
+    struct image_binding
+    {
+        /// Handle to a texture created with `texture_usage::storage`
+        texture_handle texture;
+
+        /// Mip level to bind, all layers of the level are bound
+        uint32 mip_level = 0;
+
+        /// How the shader accesses the image
+        image_access access = image_access::read_write;
+
+        /// Image unit in the shader (matches `layout(binding=X)`)
+        uint32 binding = 0;
+    };
+
+    constexpr core::flags<barrier_scope> operator|(barrier_scope lhs, barrier_scope rhs) noexcept
+    {
+        return core::flags<barrier_scope>(lhs) | core::flags<barrier_scope>(rhs);
+    }
+
+    constexpr core::flags<barrier_scope> k_all_barrier_scopes = /// Makes shader writes visible to every later access
+        core::flags<barrier_scope>(static_cast<uint8>(0xff));
+
+    /**
+     * @brief Describes a run of indirect draws issued with a single call.
+     */
+    struct draw_indirect_info
+    {
+        /// Buffer with `buffer_usage::indirect` holding the draw arguments
+        buffer_handle buffer;
+
+        /// Byte offset of the first arguments record, must be a multiple of 4
+        size_t offset = 0;
+
+        /// Number of draws, the upper bound of the draw count if `count_buffer` is set
+        uint32 draw_count = 1;
+
+        /// Distance in bytes between arguments records (0 means tightly packed)
+        uint32 stride = 0;
+
+        /// Optional buffer with `buffer_usage::indirect` holding the actual number of draws as uint32
+        buffer_handle count_buffer = {};
+
+        /// Byte offset of the draw count in `count_buffer`, must be a multiple of 4
+        size_t count_offset = 0;
+    };
+
     /**
      * @brief Defines the region of the framebuffer used for rasterization.
      */
@@ -413,6 +523,9 @@ namespace tavros::renderer::rhi
 
         /// Fragment shader source.
         core::string_view fragment_shader_source;
+
+        /// Compute shader source. If set, the program is a compute program and the other sources must be empty.
+        core::string_view compute_shader_source = {};
     };
 
 
@@ -775,4 +888,13 @@ namespace tavros::renderer::rhi
         multisample_state multisample;
     };
 
+    /**
+     * @brief Describes a compute pipeline.
+     */
+    struct compute_pipeline_create_info
+    {
+        /// Shader program created from a compute shader source
+        shader_handle shader_program;
+    };
+
 } // namespace tavros::renderer::rhi
@@ -1,5 +1,6 @@
 #include <tavros/renderer/text/font/font_atlas.hpp>
 
+#include <tavros/core/containers/small_vector.hpp>
 #include <tavros/core/math/bitops.hpp>
 #include <tavros/core/logger/logger.hpp>
 
@@ -65,7 +66,7 @@ namespace tavros::renderer
         }
 
         // Init rects
-        core::vector<stbrp_rect> rects;
+        core::small_vector<stbrp_rect, 256> rects;
         rects.reserve(total_glyphs);
 
         int32 id = 0;
@@ -62,7 +62,7 @@ namespace tavros::renderer
         stbtt_fontinfo info;
     };
 
-    truetype_font::truetype_font(font_atlas* atlas, core::dynamic_buffer<uint8> font_data, core::buffer_view<font_desc::codepoint_range> codepoint_ranges)
+    truetype_font::truetype_font(font_atlas* atlas, assets::asset_blob font_data, core::buffer_view<font_desc::codepoint_range> codepoint_ranges)
         : font()
         , m_font_data(std::move(font_data))
         , m_scale(0.0f)
@@ -70,7 +70,8 @@ namespace tavros::renderer
     {
         m_impl = core::make_unique<impl>();
 
-        if (stbtt_InitFont(&m_impl->info, m_font_data.data(), 0) == 0) {
+        // stb_truetype takes a mutable pointer but only reads the data
+        if (stbtt_InitFont(&m_impl->info, const_cast<uint8*>(m_font_data.data()), 0) == 0) {
             throw core::format_error(core::format_error_tag::invalid_data, "Failed to init font data");
         }
 
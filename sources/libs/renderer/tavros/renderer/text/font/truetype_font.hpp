@@ -1,6 +1,6 @@
 #pragma once
 
-#include <tavros/core/memory/dynamic_buffer.hpp>
+#include <tavros/assets/asset_blob.hpp>
 #include <tavros/core/memory/memory.hpp>
 #include <tavros/renderer/text/font/font.hpp>
 #include <tavros/renderer/text/font/font_desc.hpp>
@@ -34,10 +34,10 @@ namespace tavros::renderer
          * which is always available for rendering.
          *
          * @param atlas             Font atlas
-         * @param font_data         Raw font file stored in a dynamic buffer.
+         * @param font_data         Raw font file, mapped or loaded by the asset manager.
          * @param codepoint_ranges  List of Unicode ranges to load glyphs from.
          */
-        truetype_font(font_atlas* atlas, core::dynamic_buffer<uint8> font_data, core::buffer_view<font_desc::codepoint_range> codepoint_ranges);
+        truetype_font(font_atlas* atlas, assets::asset_blob font_data, core::buffer_view<font_desc::codepoint_range> codepoint_ranges);
 
         /**
          * @brief Destroys the font object.
@@ -52,9 +52,9 @@ namespace tavros::renderer
         float get_kerning_internal(char32 cp1, char32 cp2) const noexcept override;
 
     private:
-        core::dynamic_buffer<uint8> m_font_data;
-        float                       m_scale;
-        font_atlas*                 m_atlas = nullptr;
+        assets::asset_blob m_font_data;
+        float              m_scale;
+        font_atlas*        m_atlas = nullptr;
 
         // Internal implementation details (stb_truetype state).
         struct impl;
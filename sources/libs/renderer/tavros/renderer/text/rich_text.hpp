@@ -21,7 +21,7 @@ namespace tavros::renderer
     };
 
     /// Text archetype containing glyph data and layout information.
-    using text_archetype = core::basic_archetype<glyph_c, atlas_rect_t, rect_layout_c, position2d_c, glyph_style_c>;
+    using text_archetype = core::archetype<glyph_c, atlas_rect_t, rect_layout_c, position2d_c, glyph_style_c>;
 
     /**
      * @brief Rich text container with formatting and layout support.
@@ -1,6 +1,7 @@
 #include <tavros/tef/loader.hpp>
 
 #include <tavros/core/containers/fixed_vector.hpp>
+#include <tavros/core/containers/flat_hash_set.hpp>
 #include <tavros/core/logger/logger.hpp>
 #include <tavros/core/debug/unreachable.hpp>
 #include <tavros/core/utils/string_hash.hpp>
@@ -33,7 +34,7 @@ namespace
     }
 
 
-    using path_set = tavros::core::unordered_set<tavros::core::string, tavros::core::string_hash, tavros::core::string_equal>;
+    using path_set = tavros::core::flat_hash_set<tavros::core::string, tavros::core::string_hash, tavros::core::string_equal>;
     using inheritance_t = tavros::core::vector<tavros::tef::parse_result::inherit_proto_t>;
 
 
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <tavros/core/memory/memory.hpp>
-#include <tavros/core/containers/unordered_set.hpp>
 #include <tavros/core/string.hpp>
 #include <tavros/core/string_view.hpp>
 #include <tavros/core/logger/diagnostics.hpp>
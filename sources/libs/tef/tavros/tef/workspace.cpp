@@ -137,7 +137,7 @@ namespace tavros::tef
 
     node* workspace::alloc_node()
     {
-        auto* ptr = m_pool->allocate();
+        auto* ptr = m_pool->allocate_block();
         if (!ptr) {
             throw std::bad_alloc();
         }
@@ -177,7 +177,7 @@ namespace tavros::tef
 
                 auto* owner = to_free->m_owner;
                 to_free->~node();
-                owner->m_pool->deallocate(to_free);
+                owner->m_pool->deallocate_block(to_free);
             }
         }
     }
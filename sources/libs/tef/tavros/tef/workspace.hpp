@@ -1,6 +1,6 @@
 #pragma once
 
-#include <tavros/core/memory/fixed_pool_allocator.hpp>
+#include <tavros/core/memory/chunk_pool.hpp>
 #include <tavros/core/memory/memory.hpp>
 
 #include <tavros/tef/node.hpp>
@@ -25,17 +25,14 @@ namespace tavros::tef
         friend class node;
 
     public:
-        /// @brief Number of nodes the internal pool can hold.
-        static constexpr size_t k_pool_capacity = 1024 * 32;
-
         /// @brief Maximum supported nesting depth.
         static constexpr size_t k_max_nesting_level = 64;
 
         /// @brief Maximum supported prototype inheritance depth.
         static constexpr size_t k_max_proto_depth = 32;
 
-        /// @brief Internal node pool type.
-        using pool_type = core::fixed_pool_allocator<node, k_pool_capacity>;
+        /// @brief Internal node pool type, grows with the number of nodes.
+        using pool_type = core::chunk_pool<node>;
 
     public:
         /**
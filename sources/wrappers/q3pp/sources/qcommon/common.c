@@ -502,13 +502,23 @@ int32 Com_HashKey(char* string, int32 maxlen)
 */
 
 #include <memory>
-#include <tavros/core/memory/mallocator.hpp>
+#include <tavros/core/memory/thread_caching_allocator.hpp>
+#include <tavros/core/memory/tracking_allocator.hpp>
 
+#if TAV_DEBUG
+// Declared first so that it outlives the tracking decorator
+std::unique_ptr<tavros::core::allocator> zallocator_upstream;
+#endif
 std::unique_ptr<tavros::core::allocator> zallocator;
 
 static void Z_Init()
 {
-    zallocator = std::make_unique<tavros::core::mallocator>();
+#if TAV_DEBUG
+    zallocator_upstream = std::make_unique<tavros::core::thread_caching_allocator>();
+    zallocator = std::make_unique<tavros::core::tracking_allocator>(*zallocator_upstream);
+#else
+    zallocator = std::make_unique<tavros::core::thread_caching_allocator>();
+#endif
 }
 
 void* Z_TagMalloc(int32 size, const char* tag)
@@ -523,7 +533,9 @@ void Z_Free(void* ptr)
 
 void* Z_Malloc(int32 size)
 {
-    return Z_TagMalloc(size, "general");
+    void* buf = Z_TagMalloc(size, "general");
+    Com_Memset(buf, 0, size);
+    return buf;
 }
 
 /*
@@ -537,7 +549,7 @@ CopyString
 char* CopyString(const char* in)
 {
     char* out;
-    out = (char*) Z_Malloc(strlen(in) + 1);
+    out = (char*) Z_TagMalloc(strlen(in) + 1, "string");
     strcpy(out, in);
     return out;
 }
@@ -548,10 +560,18 @@ char* CopyString(const char* in)
 ==============================================================================
 */
 
-std::unique_ptr<tavros::core::allocator> hallocator_marked;
-std::unique_ptr<tavros::core::allocator> hallocator_other;
-tavros::core::allocator*                 hallocator = nullptr;
-std::unique_ptr<tavros::core::allocator> hallocator_temp;
+#include <tavros/core/memory/double_ended_linear_allocator.hpp>
+#include <tavros/core/memory/linear_allocator.hpp>
+
+#define DEF_COMHUNKMEGS           128
+#define MIN_COMHUNKMEGS           56
+#define MIN_DEDICATED_COMHUNKMEGS 1
+#define HUNK_TEMP_MEGS            32
+
+std::unique_ptr<tavros::core::double_ended_linear_allocator> hallocator;
+std::unique_ptr<tavros::core::linear_allocator>              hallocator_temp;
+tavros::core::double_ended_linear_allocator::marker          hunk_mark;
+bool                                                         hunk_mark_set = false;
 
 /*
 =================
@@ -560,10 +580,22 @@ Com_InitHunkMemory
 */
 static void Com_InitHunkMemory()
 {
-    hallocator_marked = std::make_unique<tavros::core::mallocator>();
-    hallocator_other = std::make_unique<tavros::core::mallocator>();
-    hallocator_temp = std::make_unique<tavros::core::mallocator>();
-    hallocator = hallocator_marked.get();
+    cvar_t* cv = Cvar_Get("com_hunkMegs", va("%i", DEF_COMHUNKMEGS), CVAR_LATCH | CVAR_ARCHIVE);
+
+    int32 megs = cv->integer;
+    if (com_dedicated && com_dedicated->integer) {
+        megs = std::max(megs, MIN_DEDICATED_COMHUNKMEGS);
+    } else {
+        megs = std::max(megs, MIN_COMHUNKMEGS);
+    }
+
+    hallocator = std::make_unique<tavros::core::double_ended_linear_allocator>(static_cast<size_t>(megs) * 1_mib);
+    hallocator_temp = std::make_unique<tavros::core::linear_allocator>(HUNK_TEMP_MEGS * 1_mib);
+    hunk_mark_set = false;
+
+    if (hallocator->capacity() == 0) {
+        Com_Error(ERR_FATAL, "Hunk data failed to allocate %i megs", megs);
+    }
 }
 
 /*
@@ -575,7 +607,8 @@ The server calls this after the level and game VM have been loaded
 */
 void Hunk_SetMark()
 {
-    hallocator = hallocator_other.get();
+    hunk_mark = hallocator->mark();
+    hunk_mark_set = true;
 }
 
 /*
@@ -587,7 +620,11 @@ The client calls this before starting a vid_restart or snd_restart
 */
 void Hunk_ClearToMark()
 {
-    hallocator_other->clear();
+    if (hunk_mark_set) {
+        hallocator->rewind(hunk_mark);
+    } else {
+        hallocator->clear();
+    }
 }
 
 /*
@@ -597,7 +634,7 @@ Hunk_CheckMark
 */
 bool Hunk_CheckMark()
 {
-    return hallocator == hallocator_other.get();
+    return hunk_mark_set;
 }
 
 void CL_ShutdownCGame();
@@ -617,12 +654,11 @@ void Hunk_Clear()
     CL_ShutdownUI();
     SV_ShutdownGameProgs();
 
-    hallocator = hallocator_marked.get();
-    hallocator_marked->clear();
-    hallocator_other->clear();
+    hallocator->clear();
     hallocator_temp->clear();
+    hunk_mark_set = false;
 
-    logger.info("Hunk_Clear: reset the hunk ok");
+    logger.info("Hunk_Clear: reset the hunk ok, peak usage {} of {} bytes", hallocator->high_water_mark(), hallocator->capacity());
 }
 
 /*
@@ -642,18 +678,31 @@ void* Hunk_Alloc(int32 size, ha_pref preference)
     if (hallocator == nullptr) {
         Com_Error(ERR_FATAL, "Hunk_Alloc: Hunk memory system not initialized");
     }
-    return hallocator->allocate(size, 8);
+
+    void* buf = preference == h_low ? hallocator->allocate_low(size, 8) : hallocator->allocate_high(size, 8);
+    if (buf == nullptr) {
+        Com_Error(ERR_DROP, "Hunk_Alloc failed on %i", size);
+    }
+
+    Com_Memset(buf, 0, size);
+    return buf;
 }
 
 /*
 =================
 Hunk_AllocateTempMemory
+
+Temp memory is a stack: blocks freed in reverse order are popped immediately,
+and the whole arena is reclaimed once every block has been freed.
+Requests that do not fit fall back to the zone.
 =================
 */
 void* Hunk_AllocateTempMemory(int32 size)
 {
     if (hallocator_temp) {
-        return hallocator_temp->allocate(size, 8);
+        if (void* buf = hallocator_temp->allocate(size, 8)) {
+            return buf;
+        }
     }
     return zallocator->allocate(size, 8);
 }
@@ -665,7 +714,7 @@ Hunk_FreeTempMemory
 */
 void Hunk_FreeTempMemory(void* buf)
 {
-    if (hallocator_temp) {
+    if (hallocator_temp && hallocator_temp->owns(buf)) {
         return hallocator_temp->deallocate(buf);
     }
     zallocator->deallocate(buf);
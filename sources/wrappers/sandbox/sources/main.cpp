@@ -184,7 +184,7 @@ public:
 
         m_renderer->begin_frame();
 
-        auto* cbuf = m_renderer->get_graphics_device()->create_command_queue();
+        auto* cbuf = m_renderer->renderer2d()->command_queue();
         update_frame_data();
 
         m_uniform_buffer.reset();
@@ -282,7 +282,6 @@ public:
         cbuf->draw(4);
         cbuf->end_rendering();
 
-        m_renderer->get_graphics_device()->submit_command_queue(cbuf);
         m_renderer->end_frame();
         m_input_manager.end_frame();
 
@@ -673,6 +672,8 @@ int main()
     tavros::core::logger::add_consumer(
         [](auto, auto, auto msg) { std::printf("%s\n", msg.data()); }
     );
+    // Console output happens on the writer thread, so log bursts do not stall the render thread
+    tavros::core::logger::start_async();
 
     auto am = tavros::core::make_shared<tavros::assets::asset_manager>();
     am->mount<tavros::assets::filesystem_provider>(TAV_ASSETS_PATH, "");
@@ -8,7 +8,11 @@ namespace app
 
     render_app_base::render_app_base(tavros::core::string_view name)
         : tavros::system::window(name)
+        , m_capture(std::chrono::seconds(5))
     {
+        m_capture.set_spike_dump(std::chrono::milliseconds(100), "hitch");
+        tavros::profiler::add_sink(m_capture.sink());
+
         constexpr int32 initial_width = 1280 * 2;
         constexpr int32 initial_height = 720 * 2;
 
@@ -23,6 +27,7 @@ namespace app
     render_app_base::~render_app_base()
     {
         stop_render_thread();
+        tavros::profiler::shutdown();
     }
 
     void render_app_base::run_render_loop()
@@ -109,6 +114,11 @@ namespace app
 
     void render_app_base::on_key_down(tavros::system::key_event_args& e)
     {
+        if (e.key == tavros::input::keyboard_key::k_F12) {
+            tavros::profiler::flush();
+            m_capture.dump("capture.tavtrace");
+        }
+
         tavros::input::event_args a;
         a.type = tavros::input::event_type::key_down;
         a.time_us = e.event_time_us;
@@ -148,6 +158,7 @@ namespace app
             m_event_queue.swap_queues();
             auto events = m_event_queue.front_queue();
             render(events, elapsed);
+            m_capture.end_frame(elapsed);
         } while (m_running.load(std::memory_order_acquire));
 
         shutdown();
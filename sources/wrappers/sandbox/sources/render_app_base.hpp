@@ -1,5 +1,6 @@
 #pragma once
 
+#include <tavros/core/debug/rolling_capture.hpp>
 #include <tavros/input/event_queue.hpp>
 #include <tavros/system/window.hpp>
 #include <atomic>
@@ -45,7 +46,8 @@ namespace app
         void stop_render_thread();
 
     private:
-        tavros::input::event_queue m_event_queue;
+        tavros::input::event_queue        m_event_queue;
+        tavros::profiler::rolling_capture m_capture; // last seconds of profiler events, dumped on F12 or a hitch
 
         std::atomic<bool> m_running;
         std::thread       m_render_thread;
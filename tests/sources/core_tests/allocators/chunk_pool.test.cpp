@@ -0,0 +1,138 @@
+#include <common.test.hpp>
+
+#include <tavros/core/memory/chunk_pool.hpp>
+
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace tavros::core;
+
+namespace
+{
+    struct node_t
+    {
+        uint64 payload[6];
+    };
+} // namespace
+
+class chunk_pool_test : public unittest_scope
+{
+};
+
+TEST_F(chunk_pool_test, page_layout_is_consistent)
+{
+    using pool = chunk_pool<node_t>;
+
+    EXPECT_TRUE((pool::k_page_size & (pool::k_page_size - 1)) == 0);
+    EXPECT_GE(pool::k_blocks_per_page, 64u);
+    EXPECT_LE(pool::k_blocks_per_page, 512u);
+}
+
+TEST_F(chunk_pool_test, grows_by_pages)
+{
+    chunk_pool<node_t> pool;
+    std::set<node_t*>  ptrs;
+
+    const size_t n = chunk_pool<node_t>::k_blocks_per_page * 3 + 1;
+    for (size_t i = 0; i < n; ++i) {
+        auto* p = pool.allocate_block();
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(p) % alignof(node_t), 0u);
+        EXPECT_TRUE(ptrs.insert(p).second) << "Block returned twice";
+        EXPECT_TRUE(pool.owns(p));
+    }
+
+    EXPECT_EQ(pool.size(), n);
+    EXPECT_EQ(pool.page_count(), 4u);
+    EXPECT_EQ(pool.capacity(), 4 * chunk_pool<node_t>::k_blocks_per_page);
+
+    for (auto* p : ptrs) {
+        pool.deallocate_block(p);
+    }
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST_F(chunk_pool_test, empty_pages_are_released_past_the_limit)
+{
+    chunk_pool<node_t>   pool(2);
+    std::vector<node_t*> ptrs;
+
+    for (size_t i = 0; i < chunk_pool<node_t>::k_blocks_per_page * 5; ++i) {
+        ptrs.push_back(pool.allocate_block());
+    }
+    EXPECT_EQ(pool.page_count(), 5u);
+    EXPECT_EQ(pool.empty_page_count(), 0u);
+
+    for (auto* p : ptrs) {
+        pool.deallocate_block(p);
+    }
+    EXPECT_EQ(pool.page_count(), 2u);
+    EXPECT_EQ(pool.empty_page_count(), 2u);
+
+    // Kept pages are reused before new ones are added
+    ptrs.clear();
+    for (size_t i = 0; i < chunk_pool<node_t>::k_blocks_per_page * 2; ++i) {
+        ptrs.push_back(pool.allocate_block());
+    }
+    EXPECT_EQ(pool.page_count(), 2u);
+    EXPECT_EQ(pool.empty_page_count(), 0u);
+}
+
+TEST_F(chunk_pool_test, freed_block_is_reused)
+{
+    chunk_pool<node_t>   pool;
+    std::vector<node_t*> ptrs;
+    for (size_t i = 0; i < chunk_pool<node_t>::k_blocks_per_page * 2; ++i) {
+        ptrs.push_back(pool.allocate_block());
+    }
+
+    auto* victim = ptrs[7];
+    pool.deallocate_block(victim);
+    EXPECT_EQ(pool.allocate_block(), victim);
+    EXPECT_EQ(pool.page_count(), 2u);
+}
+
+TEST_F(chunk_pool_test, clear_releases_all_pages)
+{
+    chunk_pool<node_t> pool;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        (void) pool.allocate_block();
+    }
+    pool.clear();
+    EXPECT_EQ(pool.page_count(), 0u);
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_NE(pool.allocate_block(), nullptr);
+}
+
+TEST_F(chunk_pool_test, stress_random_allocate_deallocate)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    chunk_pool<node_t>   pool(4);
+    std::vector<node_t*> live;
+    std::mt19937         rng(31337);
+
+    for (size_t i = 0; i < 5000000; ++i) {
+        // Slowly swing the live set up and down to exercise page growth and release
+        const size_t target = (i / 500000) % 2 ? 2000 : 60000;
+        if (live.size() < target && (live.empty() || rng() % 4 != 0)) {
+            auto* p = pool.allocate_block();
+            ASSERT_NE(p, nullptr);
+            p->payload[0] = reinterpret_cast<uint64>(p);
+            live.push_back(p);
+        } else {
+            auto idx = rng() % live.size();
+            ASSERT_EQ(live[idx]->payload[0], reinterpret_cast<uint64>(live[idx]));
+            pool.deallocate_block(live[idx]);
+            live[idx] = live.back();
+            live.pop_back();
+        }
+        ASSERT_LE(pool.empty_page_count(), 4u);
+    }
+
+    EXPECT_EQ(pool.size(), live.size());
+}
@@ -0,0 +1,197 @@
+#include <common.test.hpp>
+
+#include <tavros/core/memory/linear_allocator.hpp>
+#include <tavros/core/memory/double_ended_linear_allocator.hpp>
+
+#include <cstring>
+
+using namespace tavros::core;
+
+class linear_allocator_test : public unittest_scope
+{
+};
+
+TEST_F(linear_allocator_test, allocate_respects_alignment)
+{
+    linear_allocator alc(4096);
+
+    for (size_t align = 1; align <= 256; align *= 2) {
+        void* p = alc.allocate(3, align);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(p) % align, 0u);
+        EXPECT_TRUE(alc.owns(p));
+    }
+}
+
+TEST_F(linear_allocator_test, allocate_returns_nullptr_when_exhausted)
+{
+    linear_allocator alc(256);
+
+    EXPECT_NE(alc.allocate(200, 8), nullptr);
+    EXPECT_EQ(alc.allocate(200, 8), nullptr);
+    EXPECT_NE(alc.allocate(16, 8), nullptr);
+}
+
+TEST_F(linear_allocator_test, blocks_are_contiguous)
+{
+    linear_allocator alc(1024);
+
+    auto* a = static_cast<uint8*>(alc.allocate(16, 16));
+    auto* b = static_cast<uint8*>(alc.allocate(16, 16));
+    EXPECT_EQ(a + 16, b);
+    EXPECT_GE(alc.size(), 32u);
+}
+
+TEST_F(linear_allocator_test, mark_and_rewind_works)
+{
+    linear_allocator alc(1024);
+
+    ASSERT_NE(alc.allocate(64, 8), nullptr);
+    auto m = alc.mark();
+    auto* p = alc.allocate(128, 8);
+    ASSERT_NE(p, nullptr);
+    EXPECT_GT(alc.size(), m.top);
+
+    alc.rewind(m);
+    EXPECT_EQ(alc.size(), m.top);
+    EXPECT_EQ(alc.allocate(128, 8), p);
+}
+
+TEST_F(linear_allocator_test, deallocate_resets_after_partial_rewind)
+{
+    linear_allocator alc(1024);
+
+    auto* first = alc.allocate(64, 8);
+    ASSERT_NE(first, nullptr);
+    auto m = alc.mark();
+    ASSERT_NE(alc.allocate(128, 8), nullptr);
+    ASSERT_NE(alc.allocate(128, 8), nullptr);
+
+    // Blocks above the marker are dropped, the one below it is still live
+    alc.rewind(m);
+    alc.deallocate(first);
+    EXPECT_EQ(alc.size(), 0u);
+    EXPECT_EQ(alc.allocate(256, 8), first);
+}
+
+TEST_F(linear_allocator_test, clear_resets_to_start)
+{
+    linear_allocator alc(1024);
+
+    auto* first = alc.allocate(100, 8);
+    alc.allocate(200, 8);
+    alc.clear();
+
+    EXPECT_EQ(alc.size(), 0u);
+    EXPECT_EQ(alc.allocate(100, 8), first);
+    EXPECT_GE(alc.high_water_mark(), 300u);
+}
+
+TEST_F(linear_allocator_test, deallocate_pops_last_block)
+{
+    linear_allocator alc(1024);
+
+    alc.allocate(64, 8);
+    auto before = alc.size();
+    auto* p = alc.allocate(64, 8);
+    alc.deallocate(p);
+    EXPECT_EQ(alc.size(), before);
+}
+
+TEST_F(linear_allocator_test, deallocate_all_resets)
+{
+    linear_allocator alc(1024);
+
+    auto* a = alc.allocate(64, 8);
+    auto* b = alc.allocate(64, 8);
+    alc.deallocate(a);
+    EXPECT_GT(alc.size(), 0u);
+    alc.deallocate(b);
+    EXPECT_EQ(alc.size(), 0u);
+}
+
+TEST_F(linear_allocator_test, reallocate_last_block_in_place)
+{
+    linear_allocator alc(1024);
+
+    auto* p = static_cast<uint8*>(alc.allocate(16, 8));
+    std::memset(p, 0xab, 16);
+    auto* q = static_cast<uint8*>(alc.reallocate(p, 256, 8));
+    EXPECT_EQ(p, q);
+    EXPECT_EQ(q[15], 0xab);
+}
+
+TEST_F(linear_allocator_test, reallocate_copies_when_not_last)
+{
+    linear_allocator alc(1024);
+
+    auto* p = static_cast<uint8*>(alc.allocate(16, 8));
+    std::memset(p, 0xcd, 16);
+    alc.allocate(16, 8);
+
+    auto* q = static_cast<uint8*>(alc.reallocate(p, 64, 8));
+    ASSERT_NE(q, nullptr);
+    EXPECT_NE(p, q);
+    for (size_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(q[i], 0xcd);
+    }
+}
+
+class double_ended_linear_allocator_test : public unittest_scope
+{
+};
+
+TEST_F(double_ended_linear_allocator_test, sides_grow_towards_each_other)
+{
+    double_ended_linear_allocator alc(1024);
+
+    auto* lo = static_cast<uint8*>(alc.allocate_low(100, 8));
+    auto* hi = static_cast<uint8*>(alc.allocate_high(100, 8));
+    ASSERT_NE(lo, nullptr);
+    ASSERT_NE(hi, nullptr);
+    EXPECT_LT(lo, hi);
+    EXPECT_EQ(reinterpret_cast<size_t>(hi) % 8, 0u);
+    EXPECT_GE(alc.low_size(), 100u);
+    EXPECT_GE(alc.high_size(), 100u);
+}
+
+TEST_F(double_ended_linear_allocator_test, sides_do_not_overlap)
+{
+    double_ended_linear_allocator alc(1024);
+
+    ASSERT_NE(alc.allocate_low(600, 8), nullptr);
+    EXPECT_EQ(alc.allocate_high(600, 8), nullptr);
+    EXPECT_NE(alc.allocate_high(400, 8), nullptr);
+    EXPECT_EQ(alc.allocate_low(64, 8), nullptr);
+}
+
+TEST_F(double_ended_linear_allocator_test, rewind_restores_both_sides)
+{
+    double_ended_linear_allocator alc(1024);
+
+    ASSERT_NE(alc.allocate_low(64, 8), nullptr);
+    ASSERT_NE(alc.allocate_high(64, 8), nullptr);
+    auto m = alc.mark();
+    auto before = alc.size();
+
+    ASSERT_NE(alc.allocate_low(128, 8), nullptr);
+    ASSERT_NE(alc.allocate_high(128, 8), nullptr);
+    EXPECT_GT(alc.size(), before);
+
+    alc.rewind(m);
+    EXPECT_EQ(alc.size(), before);
+
+    alc.clear();
+    EXPECT_EQ(alc.size(), 0u);
+}
+
+TEST_F(double_ended_linear_allocator_test, deallocate_pops_last_block_per_side)
+{
+    double_ended_linear_allocator alc(1024);
+
+    auto* lo = alc.allocate_low(64, 8);
+    auto* hi = alc.allocate_high(64, 8);
+    alc.deallocate(lo);
+    alc.deallocate(hi);
+    EXPECT_EQ(alc.size(), 0u);
+}
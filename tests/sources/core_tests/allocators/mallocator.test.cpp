@@ -0,0 +1,210 @@
+#include <common.test.hpp>
+
+#include <tavros/core/memory/mallocator.hpp>
+#include <tavros/core/memory/thread_caching_allocator.hpp>
+#include <tavros/core/memory/tracking_allocator.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace tavros::core;
+
+class mallocator_test : public unittest_scope
+{
+};
+
+TEST_F(mallocator_test, allocate_respects_alignment)
+{
+    mallocator alc;
+
+    for (size_t align = 1; align <= 4096; align *= 2) {
+        void* p = alc.allocate(24, align);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(p) % align, 0u);
+    }
+    EXPECT_EQ(alc.allocation_count(), 13u);
+    alc.clear();
+    EXPECT_EQ(alc.allocation_count(), 0u);
+}
+
+TEST_F(mallocator_test, counters_are_kept_per_tag)
+{
+    mallocator alc;
+
+    auto* a = alc.allocate(100, 8, "model");
+    auto* b = alc.allocate(50, 8, "model");
+    auto* c = alc.allocate(10, 8, "sound");
+    auto* d = alc.allocate(7, 8);
+
+    auto model = alc.stats("model");
+    EXPECT_EQ(model.allocated_bytes, 150u);
+    EXPECT_EQ(model.allocation_count, 2u);
+    EXPECT_EQ(alc.stats("sound").allocated_bytes, 10u);
+    EXPECT_EQ(alc.stats(nullptr).allocated_bytes, 7u);
+    EXPECT_EQ(alc.allocated_bytes(), 167u);
+
+    alc.deallocate(a);
+    model = alc.stats("model");
+    EXPECT_EQ(model.allocated_bytes, 50u);
+    EXPECT_EQ(model.peak_bytes, 150u);
+    EXPECT_EQ(model.total_allocations, 2u);
+
+    mallocator::tag_stats all[mallocator::k_max_tags];
+    EXPECT_EQ(alc.collect_stats(all), 3u);
+
+    alc.deallocate(b);
+    alc.deallocate(c);
+    alc.deallocate(d);
+    EXPECT_EQ(alc.allocated_bytes(), 0u);
+}
+
+TEST_F(mallocator_test, reallocate_preserves_contents)
+{
+    mallocator alc;
+
+    for (size_t align : {size_t{8}, size_t{64}}) {
+        auto* p = static_cast<uint8*>(alc.allocate(16, align, "buf"));
+        std::memset(p, 0x5a, 16);
+        auto* q = static_cast<uint8*>(alc.reallocate(p, 4096, align));
+        ASSERT_NE(q, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(q) % align, 0u);
+        for (size_t i = 0; i < 16; ++i) {
+            EXPECT_EQ(q[i], 0x5a);
+        }
+        EXPECT_EQ(alc.stats("buf").allocated_bytes, 4096u);
+        alc.deallocate(q);
+    }
+    EXPECT_EQ(alc.allocation_count(), 0u);
+}
+
+class tracking_allocator_test : public unittest_scope
+{
+};
+
+TEST_F(tracking_allocator_test, tracks_live_allocations)
+{
+    mallocator         upstream;
+    tracking_allocator alc(upstream);
+
+    auto* a = alc.allocate(32, 8, "a");
+    auto* b = alc.reallocate(alc.allocate(16, 8), 64, 8);
+    EXPECT_TRUE(alc.contains(a));
+    EXPECT_TRUE(alc.contains(b));
+    EXPECT_EQ(alc.allocation_count(), 2u);
+    EXPECT_EQ(alc.allocated_bytes(), 96u);
+
+    alc.deallocate(a);
+    EXPECT_FALSE(alc.contains(a));
+    alc.clear();
+    EXPECT_EQ(alc.allocation_count(), 0u);
+    EXPECT_EQ(upstream.allocation_count(), 0u);
+}
+
+TEST_F(tracking_allocator_test, released_history_is_bounded)
+{
+    mallocator         upstream;
+    tracking_allocator alc(upstream, 4);
+
+    for (size_t i = 0; i < 64; ++i) {
+        alc.deallocate(alc.allocate(16, 8));
+    }
+    EXPECT_EQ(alc.allocation_count(), 0u);
+    EXPECT_EQ(upstream.allocation_count(), 0u);
+}
+
+namespace
+{
+    struct trace_op
+    {
+        uint32 slot;
+        uint32 size; // 0 means free
+    };
+
+    // Mimics the zone traffic of a q3 level load: mostly small strings and
+    // structures, a few medium buffers and rare large ones, with interleaved frees
+    std::vector<trace_op> make_zone_trace(size_t n, size_t slots)
+    {
+        std::mt19937                          rng(20240501);
+        std::uniform_int_distribution<uint32> slot_dist(0, static_cast<uint32>(slots - 1));
+        std::uniform_int_distribution<int32>  bucket_dist(0, 99);
+        std::vector<trace_op>                 ops;
+        std::vector<bool>                     live(slots, false);
+
+        ops.reserve(n);
+        while (ops.size() < n) {
+            auto slot = slot_dist(rng);
+            if (live[slot]) {
+                ops.push_back({slot, 0});
+                live[slot] = false;
+                continue;
+            }
+
+            auto   bucket = bucket_dist(rng);
+            uint32 lo = 8, hi = 64;
+            if (bucket >= 99) {
+                lo = 4096, hi = 65536;
+            } else if (bucket >= 90) {
+                lo = 512, hi = 4096;
+            } else if (bucket >= 70) {
+                lo = 64, hi = 512;
+            }
+            ops.push_back({slot, std::uniform_int_distribution<uint32>(lo, hi)(rng)});
+            live[slot] = true;
+        }
+        return ops;
+    }
+
+    template<typename Alloc, typename Free>
+    double replay_ns_per_op(const std::vector<trace_op>& ops, size_t slots, Alloc&& alloc, Free&& dealloc)
+    {
+        std::vector<void*> ptrs(slots, nullptr);
+
+        timer t;
+        for (const auto& op : ops) {
+            if (op.size) {
+                ptrs[op.slot] = alloc(op.size);
+            } else {
+                dealloc(ptrs[op.slot]);
+                ptrs[op.slot] = nullptr;
+            }
+        }
+        for (auto* p : ptrs) {
+            if (p) {
+                dealloc(p);
+            }
+        }
+        return static_cast<double>(t.elapsed<std::chrono::nanoseconds>().count()) / static_cast<double>(ops.size());
+    }
+} // namespace
+
+TEST_F(mallocator_test, stress_zone_trace_throughput)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t k_slots = 8192;
+    const auto       ops = make_zone_trace(2'000'000, k_slots);
+
+    auto crt = replay_ns_per_op(ops, k_slots, [](size_t size) { return std::malloc(size); }, [](void* p) { std::free(p); });
+
+    mallocator lean;
+    auto       lean_ns = replay_ns_per_op(ops, k_slots, [&](size_t size) { return lean.allocate(size, 8, "general"); }, [&](void* p) { lean.deallocate(p); });
+
+    mallocator         upstream;
+    tracking_allocator tracking(upstream);
+    auto               tracking_ns = replay_ns_per_op(ops, k_slots, [&](size_t size) { return tracking.allocate(size, 8, "general"); }, [&](void* p) { tracking.deallocate(p); });
+
+    thread_caching_allocator cached;
+    auto                     cached_ns = replay_ns_per_op(ops, k_slots, [&](size_t size) { return cached.allocate(size, 8, "general"); }, [&](void* p) { cached.deallocate(p); });
+
+    std::printf("[ stress   ] zone trace, %zu ops: malloc %.1f ns/op, mallocator %.1f ns/op, tracking_allocator %.1f ns/op, thread_caching_allocator %.1f ns/op\n", ops.size(), crt, lean_ns, tracking_ns, cached_ns);
+
+    EXPECT_EQ(lean.allocation_count(), 0u);
+    EXPECT_EQ(upstream.allocation_count(), 0u);
+    EXPECT_EQ(cached.allocation_count(), 0u);
+}
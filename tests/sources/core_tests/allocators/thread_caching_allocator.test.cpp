@@ -0,0 +1,187 @@
+#include <common.test.hpp>
+
+#include <tavros/core/memory/thread_caching_allocator.hpp>
+
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace tavros::core;
+
+class thread_caching_allocator_test : public unittest_scope
+{
+};
+
+TEST_F(thread_caching_allocator_test, size_classes_cover_requests)
+{
+    EXPECT_EQ(thread_caching_allocator::size_class_size(1), 16u);
+    EXPECT_EQ(thread_caching_allocator::size_class_size(16), 16u);
+    EXPECT_EQ(thread_caching_allocator::size_class_size(17), 32u);
+    EXPECT_EQ(thread_caching_allocator::size_class_size(129), 160u);
+    EXPECT_EQ(thread_caching_allocator::size_class_size(257), 320u);
+    EXPECT_EQ(thread_caching_allocator::size_class_size(thread_caching_allocator::k_max_small_size), thread_caching_allocator::k_max_small_size);
+    EXPECT_EQ(thread_caching_allocator::size_class_size(thread_caching_allocator::k_max_small_size + 1), 0u);
+
+    for (size_t size = 1; size <= thread_caching_allocator::k_max_small_size; ++size) {
+        auto cs = thread_caching_allocator::size_class_size(size);
+        ASSERT_GE(cs, size);
+        ASSERT_LE(cs - size, cs / 4 + 16) << "size=" << size;
+    }
+}
+
+TEST_F(thread_caching_allocator_test, allocate_respects_alignment)
+{
+    thread_caching_allocator alc;
+
+    for (size_t size : {size_t{8}, size_t{100}, size_t{5000}, size_t{100000}}) {
+        for (size_t align = 1; align <= 4096; align *= 2) {
+            void* p = alc.allocate(size, align);
+            ASSERT_NE(p, nullptr);
+            EXPECT_EQ(reinterpret_cast<size_t>(p) % align, 0u) << "size=" << size << " align=" << align;
+            std::memset(p, 0xcc, size);
+            alc.deallocate(p);
+        }
+    }
+    EXPECT_EQ(alc.allocation_count(), 0u);
+}
+
+TEST_F(thread_caching_allocator_test, blocks_are_reused)
+{
+    thread_caching_allocator alc;
+
+    void* p = alc.allocate(40, 8);
+    alc.deallocate(p);
+    EXPECT_EQ(alc.allocate(40, 8), p);
+    alc.deallocate(p);
+}
+
+TEST_F(thread_caching_allocator_test, counters_are_kept_per_tag)
+{
+    thread_caching_allocator alc;
+
+    auto* a = alc.allocate(100, 8, "model");
+    auto* b = alc.allocate(20000, 8, "model");
+    auto* c = alc.allocate(10, 8, "sound");
+
+    auto model = alc.stats("model");
+    EXPECT_EQ(model.allocation_count, 2u);
+    EXPECT_EQ(model.allocated_bytes, thread_caching_allocator::size_class_size(100) + 20000u);
+    EXPECT_EQ(alc.stats("sound").allocated_bytes, 16u);
+    EXPECT_EQ(alc.stats("unknown").allocation_count, 0u);
+
+    thread_caching_allocator::tag_stats all[thread_caching_allocator::k_max_tags];
+    EXPECT_EQ(alc.collect_stats(all), 3u);
+
+    alc.deallocate(a);
+    alc.deallocate(b);
+    alc.deallocate(c);
+    EXPECT_EQ(alc.allocated_bytes(), 0u);
+    EXPECT_EQ(alc.stats("model").total_allocations, 2u);
+}
+
+TEST_F(thread_caching_allocator_test, reallocate_preserves_contents)
+{
+    thread_caching_allocator alc;
+
+    auto* p = static_cast<uint8*>(alc.allocate(20, 8));
+    std::memset(p, 0x5a, 20);
+    EXPECT_EQ(alc.reallocate(p, 30, 8), p);
+
+    auto* q = static_cast<uint8*>(alc.reallocate(p, 20000, 8));
+    ASSERT_NE(q, nullptr);
+    for (size_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(q[i], 0x5a);
+    }
+
+    auto* r = static_cast<uint8*>(alc.reallocate(q, 64, 8));
+    ASSERT_NE(r, nullptr);
+    EXPECT_EQ(r[19], 0x5a);
+    alc.deallocate(r);
+    EXPECT_EQ(alc.allocation_count(), 0u);
+}
+
+TEST_F(thread_caching_allocator_test, free_on_another_thread)
+{
+    thread_caching_allocator alc;
+    std::vector<void*>       ptrs;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        ptrs.push_back(alc.allocate(16 + i % 512, 8, "cross"));
+    }
+
+    std::thread([&] {
+        for (auto* p : ptrs) {
+            alc.deallocate(p);
+        }
+    }).join();
+
+    EXPECT_EQ(alc.stats("cross").allocation_count, 0u);
+    EXPECT_EQ(alc.allocated_bytes(), 0u);
+
+    // Blocks flushed by the exited thread are available again
+    auto reserved = alc.reserved_bytes();
+    for (size_t i = 0; i < 1000; ++i) {
+        ptrs[i] = alc.allocate(16 + i % 512, 8);
+    }
+    EXPECT_EQ(alc.reserved_bytes(), reserved);
+    for (auto* p : ptrs) {
+        alc.deallocate(p);
+    }
+}
+
+TEST_F(thread_caching_allocator_test, clear_releases_everything)
+{
+    thread_caching_allocator alc;
+
+    for (size_t i = 0; i < 100; ++i) {
+        (void) alc.allocate(i * 97 + 1, 8);
+    }
+    EXPECT_GT(alc.reserved_bytes(), 0u);
+
+    alc.clear();
+    EXPECT_EQ(alc.allocation_count(), 0u);
+    EXPECT_EQ(alc.reserved_bytes(), 0u);
+    EXPECT_NE(alc.allocate(32, 8), nullptr);
+}
+
+TEST_F(thread_caching_allocator_test, concurrent_allocate_deallocate)
+{
+    thread_caching_allocator alc;
+    constexpr size_t         k_threads = 4;
+    const size_t             iterations = g_stress_skip ? 20000 : 2000000;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < k_threads; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937                          rng(static_cast<uint32>(t));
+            std::uniform_int_distribution<size_t> size_dist(1, 2048);
+            std::vector<uint8*>                   live;
+
+            for (size_t i = 0; i < iterations; ++i) {
+                if (live.size() < 256 && (live.empty() || rng() % 2)) {
+                    auto  size = size_dist(rng);
+                    auto* p = static_cast<uint8*>(alc.allocate(size, 8, "worker"));
+                    p[0] = static_cast<uint8>(t);
+                    p[size - 1] = static_cast<uint8>(t);
+                    live.push_back(p);
+                } else {
+                    auto idx = rng() % live.size();
+                    EXPECT_EQ(live[idx][0], static_cast<uint8>(t));
+                    alc.deallocate(live[idx]);
+                    live[idx] = live.back();
+                    live.pop_back();
+                }
+            }
+            for (auto* p : live) {
+                alc.deallocate(p);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    EXPECT_EQ(alc.allocation_count(), 0u);
+    EXPECT_EQ(alc.stats("worker").total_allocations > 0, true);
+}
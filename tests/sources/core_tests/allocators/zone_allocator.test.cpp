@@ -0,0 +1,203 @@
+#include <common.test.hpp>
+
+#include <tavros/core/memory/zone_allocator.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace tavros::core;
+
+class zone_allocator_test : public unittest_scope
+{
+};
+
+TEST_F(zone_allocator_test, allocate_returns_zeroed_memory)
+{
+    zone_allocator alc(64_kib);
+
+    auto* p = static_cast<uint8*>(alc.allocate(100, 8));
+    ASSERT_NE(p, nullptr);
+    std::memset(p, 0xff, 100);
+    alc.deallocate(p);
+
+    auto* q = static_cast<uint8*>(alc.allocate(100, 8));
+    ASSERT_NE(q, nullptr);
+    for (size_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(q[i], 0);
+    }
+    alc.deallocate(q);
+}
+
+TEST_F(zone_allocator_test, allocate_respects_alignment)
+{
+    zone_allocator     alc(1_mib);
+    std::vector<void*> ptrs;
+
+    for (size_t align = 1; align <= 4096; align *= 2) {
+        void* p = alc.allocate(40, align);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(p) % align, 0u);
+        ptrs.push_back(p);
+    }
+    for (auto* p : ptrs) {
+        alc.deallocate(p);
+    }
+    EXPECT_EQ(alc.metrics().free_block_count, 1u);
+}
+
+TEST_F(zone_allocator_test, freed_neighbours_are_coalesced)
+{
+    zone_allocator alc(64_kib);
+    const auto     initial = alc.metrics();
+    EXPECT_EQ(initial.block_count, 1u);
+    EXPECT_EQ(initial.largest_free_block, initial.free_bytes);
+
+    void* a = alc.allocate(1000, 8);
+    void* b = alc.allocate(1000, 8);
+    void* c = alc.allocate(1000, 8);
+
+    alc.deallocate(a);
+    alc.deallocate(c);
+    auto m = alc.metrics();
+    EXPECT_EQ(m.allocation_count, 1u);
+    EXPECT_EQ(m.free_block_count, 2u);
+    EXPECT_GT(m.fragmentation(), 0.0);
+
+    alc.deallocate(b);
+    m = alc.metrics();
+    EXPECT_EQ(m.block_count, 1u);
+    EXPECT_EQ(m.free_bytes, initial.free_bytes);
+    EXPECT_EQ(m.largest_free_block, initial.free_bytes);
+    EXPECT_EQ(m.used_bytes, 0u);
+    EXPECT_GE(m.peak_used_bytes, 3000u);
+}
+
+TEST_F(zone_allocator_test, allocate_returns_nullptr_when_exhausted)
+{
+    zone_allocator alc(4_kib);
+
+    EXPECT_EQ(alc.allocate(8_kib, 8), nullptr);
+    void* p = alc.allocate(3_kib, 8);
+    EXPECT_NE(p, nullptr);
+    EXPECT_EQ(alc.allocate(2_kib, 8), nullptr);
+    alc.deallocate(p);
+}
+
+TEST_F(zone_allocator_test, reallocate_grows_in_place)
+{
+    zone_allocator alc(64_kib);
+
+    auto* p = static_cast<uint8*>(alc.allocate(64, 8));
+    std::memset(p, 0x5a, 64);
+    auto* q = static_cast<uint8*>(alc.reallocate(p, 4096, 8));
+    EXPECT_EQ(p, q);
+    EXPECT_EQ(q[63], 0x5a);
+    EXPECT_EQ(q[64], 0);
+
+    // A neighbour blocks the growth, the contents are moved
+    auto* blocker = alc.allocate(64, 8);
+    auto* r = static_cast<uint8*>(alc.reallocate(q, 8192, 8));
+    ASSERT_NE(r, nullptr);
+    EXPECT_NE(r, q);
+    EXPECT_EQ(r[0], 0x5a);
+
+    alc.deallocate(blocker);
+    alc.deallocate(r);
+    EXPECT_EQ(alc.metrics().block_count, 1u);
+}
+
+TEST_F(zone_allocator_test, clear_resets_the_zone)
+{
+    zone_allocator alc(64_kib);
+    const auto     initial = alc.metrics();
+
+    for (size_t i = 0; i < 20; ++i) {
+        (void) alc.allocate(i * 31 + 1, 8);
+    }
+    alc.clear();
+
+    const auto m = alc.metrics();
+    EXPECT_EQ(m.block_count, 1u);
+    EXPECT_EQ(m.free_bytes, initial.free_bytes);
+    EXPECT_EQ(m.allocation_count, 0u);
+}
+
+TEST_F(zone_allocator_test, random_allocate_deallocate_keeps_metrics_consistent)
+{
+    zone_allocator                         alc(4_mib);
+    std::mt19937                           rng(777);
+    std::uniform_int_distribution<size_t>  size_dist(1, 4096);
+    std::vector<std::pair<uint8*, size_t>> live;
+
+    const size_t iterations = g_stress_skip ? 20000 : 2000000;
+    for (size_t i = 0; i < iterations; ++i) {
+        if (live.size() < 500 && (live.empty() || rng() % 2)) {
+            auto  size = size_dist(rng);
+            auto* p = static_cast<uint8*>(alc.allocate(size, 8));
+            ASSERT_NE(p, nullptr);
+            p[0] = static_cast<uint8>(size);
+            p[size - 1] = static_cast<uint8>(size);
+            live.emplace_back(p, size);
+        } else {
+            auto idx = rng() % live.size();
+            auto [p, size] = live[idx];
+            ASSERT_EQ(p[0], static_cast<uint8>(size));
+            ASSERT_EQ(p[size - 1], static_cast<uint8>(size));
+            alc.deallocate(p);
+            live[idx] = live.back();
+            live.pop_back();
+        }
+    }
+
+    auto m = alc.metrics();
+    EXPECT_EQ(m.allocation_count, live.size());
+    EXPECT_EQ(m.block_count, m.allocation_count + m.free_block_count);
+    EXPECT_EQ(m.used_bytes + m.free_bytes + m.free_block_count * 32, m.zone_size);
+
+    for (auto [p, size] : live) {
+        alc.deallocate(p);
+    }
+    EXPECT_EQ(alc.metrics().block_count, 1u);
+}
+
+TEST_F(zone_allocator_test, stress_allocation_cost_stays_flat)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    zone_allocator                        alc(64_mib);
+    std::mt19937                          rng(4242);
+    std::uniform_int_distribution<size_t> size_dist(8, 512);
+    std::vector<void*>                    live(20000, nullptr);
+
+    // Fragment the zone, then measure rounds of small alloc/free cycles
+    for (auto& p : live) {
+        p = alc.allocate(size_dist(rng), 8);
+    }
+
+    constexpr size_t k_rounds = 5;
+    constexpr size_t k_ops = 1000000;
+    double           ns[k_rounds];
+    for (size_t r = 0; r < k_rounds; ++r) {
+        timer t;
+        for (size_t i = 0; i < k_ops; ++i) {
+            auto& p = live[rng() % live.size()];
+            alc.deallocate(p);
+            p = alc.allocate(size_dist(rng), 8);
+        }
+        ns[r] = static_cast<double>(t.elapsed<std::chrono::nanoseconds>().count()) / k_ops;
+
+        const auto m = alc.metrics();
+        std::printf("[ stress   ] round %zu: %.1f ns/cycle, free blocks %zu, fragmentation %.3f\n", r, ns[r], m.free_block_count, m.fragmentation());
+    }
+
+    EXPECT_LT(ns[k_rounds - 1], ns[0] * 2.0);
+
+    for (auto* p : live) {
+        alc.deallocate(p);
+    }
+}
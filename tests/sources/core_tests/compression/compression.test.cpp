@@ -0,0 +1,225 @@
+#include <common.test.hpp>
+
+#include <tavros/core/compression/block_compression.hpp>
+#include <tavros/core/thread/thread_pool.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace tavros::core;
+
+namespace
+{
+    class memory_reader final : public basic_stream_reader
+    {
+    public:
+        explicit memory_reader(const std::vector<uint8>& data)
+            : m_data(data)
+        {
+        }
+
+        size_t read(uint8* dst, size_t size) override
+        {
+            const size_t n = std::min(size, m_data.size() - m_pos);
+            std::memcpy(dst, m_data.data() + m_pos, n);
+            m_pos += n;
+            if (n < size) {
+                set_state(stream_state::eos);
+            }
+            return n;
+        }
+
+        bool seekable() const noexcept override
+        {
+            return true;
+        }
+
+        bool seek(ssize_t offset, seek_dir dir) noexcept override
+        {
+            TAV_ASSERT(dir == seek_dir::current);
+            TAV_UNUSED(dir);
+            m_pos = static_cast<size_t>(static_cast<ssize_t>(m_pos) + offset);
+            set_state(stream_state::good);
+            return true;
+        }
+
+    private:
+        const std::vector<uint8>& m_data;
+        size_t                    m_pos = 0;
+    };
+
+    class memory_writer final : public basic_stream_writer
+    {
+    public:
+        size_t write(const uint8* src, size_t size) override
+        {
+            data.insert(data.end(), src, src + size);
+            return size;
+        }
+
+        std::vector<uint8> data;
+    };
+
+    // Text-like data: words from a small vocabulary mixed with numbers
+    std::vector<uint8> make_data(size_t size, uint32 seed = 1)
+    {
+        static const char* words[] = {"mesh ", "texture ", "material ", "shader ", "vertex ", "index ", "normal "};
+
+        std::mt19937       rng(seed);
+        std::vector<uint8> data;
+        data.reserve(size + 16);
+        while (data.size() < size) {
+            const char* w = words[rng() % std::size(words)];
+            data.insert(data.end(), w, w + std::strlen(w));
+            const auto n = std::to_string(rng() % 10000);
+            data.insert(data.end(), n.begin(), n.end());
+            data.push_back('\n');
+        }
+        data.resize(size);
+        return data;
+    }
+
+    buffer_view<uint8> view_of(const std::vector<uint8>& v)
+    {
+        return buffer_view<uint8>(v.data(), v.size());
+    }
+} // namespace
+
+class compression_test : public unittest_scope
+{
+};
+
+TEST_F(compression_test, stream_round_trip_reuses_state)
+{
+    deflate_stream deflater(compression_level::fastest);
+    inflate_stream inflater;
+
+    for (size_t size : {0u, 1000u, 300'000u}) {
+        const auto data = make_data(size, static_cast<uint32>(size));
+
+        memory_reader source(data);
+        memory_writer packed;
+        const size_t  packed_size = deflater.compress(source, packed);
+        ASSERT_EQ(packed_size, packed.data.size());
+        if (size > 1000) {
+            EXPECT_LT(packed_size, size / 2);
+        }
+
+        memory_reader packed_source(packed.data);
+        memory_writer unpacked;
+        ASSERT_TRUE(inflater.uncompress(packed_source, unpacked));
+        EXPECT_EQ(unpacked.data, data);
+    }
+}
+
+TEST_F(compression_test, buffers_are_plain_zlib)
+{
+    const auto     data = make_data(50'000);
+    deflate_stream deflater(compression_level::best);
+
+    std::vector<uint8> packed(compress_bound(data.size()));
+    const size_t       packed_size = deflater.compress(view_of(data), buffer_span<uint8>(packed.data(), packed.size()));
+    ASSERT_GT(packed_size, 0u);
+
+    std::vector<uint8> unpacked(data.size());
+    EXPECT_TRUE(uncompress_data(buffer_view<uint8>(packed.data(), packed_size), buffer_span<uint8>(unpacked.data(), unpacked.size())));
+    EXPECT_EQ(unpacked, data);
+
+    // Output too small to compress into, and a size mismatch on the way back
+    EXPECT_EQ(deflater.compress(view_of(data), buffer_span<uint8>(packed.data(), 16)), 0u);
+    inflate_stream inflater;
+    EXPECT_FALSE(inflater.uncompress(buffer_view<uint8>(packed.data(), packed_size), buffer_span<uint8>(unpacked.data(), unpacked.size() - 1)));
+    EXPECT_TRUE(inflater.uncompress(buffer_view<uint8>(packed.data(), packed_size), buffer_span<uint8>(unpacked.data(), unpacked.size())));
+}
+
+TEST_F(compression_test, inflate_stream_gives_back_trailing_data)
+{
+    const auto     data = make_data(10'000);
+    deflate_stream deflater;
+
+    memory_reader source(data);
+    memory_writer packed;
+    ASSERT_GT(deflater.compress(source, packed), 0u);
+    packed.data.insert(packed.data.end(), {'T', 'A', 'I', 'L'});
+
+    memory_reader  packed_source(packed.data);
+    memory_writer  unpacked;
+    inflate_stream inflater;
+    ASSERT_TRUE(inflater.uncompress(packed_source, unpacked));
+    EXPECT_EQ(unpacked.data, data);
+    EXPECT_EQ(packed_source.read_as<uint32>(), static_cast<uint32>('T' | ('A' << 8) | ('I' << 16) | ('L' << 24)));
+
+    // Corrupted and truncated streams fail
+    packed.data[packed.data.size() / 2] ^= 0x55;
+    memory_reader corrupt(packed.data);
+    EXPECT_FALSE(inflater.uncompress(corrupt, unpacked));
+
+    packed.data.resize(packed.data.size() / 2);
+    memory_reader truncated(packed.data);
+    EXPECT_FALSE(inflater.uncompress(truncated, unpacked));
+}
+
+TEST_F(compression_test, blocks_round_trip_in_parallel)
+{
+    thread_pool pool(3);
+    const auto  data = make_data(100'000);
+
+    memory_writer packed;
+    const size_t  packed_size = compress_blocks(view_of(data), packed, pool, compression_level::balanced, 4096);
+    ASSERT_EQ(packed_size, packed.data.size());
+    EXPECT_LT(packed_size, data.size() / 2);
+    ASSERT_EQ(uncompressed_blocks_size(view_of(packed.data)), data.size());
+
+    std::vector<uint8> unpacked(data.size());
+    ASSERT_TRUE(uncompress_blocks(view_of(packed.data), buffer_span<uint8>(unpacked.data(), unpacked.size()), pool));
+    EXPECT_EQ(unpacked, data);
+
+    // Truncated container and a wrong output size
+    std::vector<uint8> cut(packed.data.begin(), packed.data.end() - 10);
+    EXPECT_FALSE(uncompress_blocks(view_of(cut), buffer_span<uint8>(unpacked.data(), unpacked.size()), pool));
+    EXPECT_FALSE(uncompress_blocks(view_of(packed.data), buffer_span<uint8>(unpacked.data(), unpacked.size() - 1), pool));
+    EXPECT_EQ(uncompressed_blocks_size(view_of(data)), 0u);
+
+    // Empty input is a header only
+    memory_writer empty;
+    EXPECT_EQ(compress_blocks(buffer_view<uint8>(), empty, pool), 16u);
+    EXPECT_TRUE(uncompress_blocks(view_of(empty.data), buffer_span<uint8>(), pool));
+}
+
+TEST_F(compression_test, stress_compression_throughput)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    const auto   data = make_data(32 * 1024 * 1024);
+    const double mb = static_cast<double>(data.size()) / (1024.0 * 1024.0);
+
+    for (auto level : {compression_level::fastest, compression_level::balanced, compression_level::best}) {
+        deflate_stream deflater(level);
+        memory_reader  source(data);
+        memory_writer  packed;
+        timer          tm;
+        const size_t   packed_size = deflater.compress(source, packed);
+        const double   s = tm.elapsed_seconds();
+        std::printf("[ stress   ] stream %-8s ratio %.3f, %.1f MB/s\n", to_string(level).data(), static_cast<double>(packed_size) / data.size(), mb / s);
+    }
+
+    thread_pool pool;
+    for (auto level : {compression_level::fastest, compression_level::balanced}) {
+        memory_writer packed;
+        timer         tm;
+        const size_t  packed_size = compress_blocks(view_of(data), packed, pool, level);
+        const double  s = tm.elapsed_seconds();
+
+        std::vector<uint8> unpacked(data.size());
+        tm.restart();
+        ASSERT_TRUE(uncompress_blocks(view_of(packed.data), buffer_span<uint8>(unpacked.data(), unpacked.size()), pool));
+        const double us = tm.elapsed_seconds();
+        std::printf("[ stress   ] blocks %-8s ratio %.3f, %.1f MB/s compress, %.1f MB/s uncompress on %zu threads\n", to_string(level).data(), static_cast<double>(packed_size) / data.size(), mb / s, mb / us, pool.concurrency());
+    }
+}
@@ -0,0 +1,115 @@
+#include <common.test.hpp>
+
+#include <tavros/core/containers/chunked_vector.hpp>
+#include <tavros/core/archetype.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace tavros::core;
+
+namespace
+{
+    struct position
+    {
+        float x = 0.0f;
+    };
+} // namespace
+
+class chunked_vector_test : public unittest_scope
+{
+};
+
+TEST_F(chunked_vector_test, growth_does_not_move_elements)
+{
+    chunked_vector<int, 16> v;
+    v.push_back(1);
+    const int* first = &v[0];
+
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(&v[0], first);
+    EXPECT_EQ(v.size(), 1001u);
+    EXPECT_EQ(v.capacity() % 16, 0u);
+    EXPECT_EQ(v[1000], 999);
+}
+
+TEST_F(chunked_vector_test, chunks_cover_all_elements)
+{
+    chunked_vector<int, 8> v;
+    for (int i = 0; i < 21; ++i) {
+        v.emplace_back(i);
+    }
+
+    ASSERT_EQ(v.chunk_count(), 3u);
+    EXPECT_EQ(v.chunk(0).size(), 8u);
+    EXPECT_EQ(v.chunk(2).size(), 5u);
+
+    int expected = 0;
+    for (size_t c = 0; c < v.chunk_count(); ++c) {
+        for (int x : v.chunk(c)) {
+            EXPECT_EQ(x, expected++);
+        }
+    }
+    EXPECT_EQ(expected, 21);
+}
+
+TEST_F(chunked_vector_test, iterators_work_with_algorithms)
+{
+    chunked_vector<int, 4> v;
+    for (int i = 10; i > 0; --i) {
+        v.push_back(i);
+    }
+
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.cbegin(), v.cend()));
+    EXPECT_EQ(v.end() - v.begin(), 10);
+    EXPECT_EQ(*v.rbegin(), 10);
+    EXPECT_THROW((void) v.at(10), std::out_of_range);
+}
+
+TEST_F(chunked_vector_test, resize_clear_and_shrink_manage_lifetimes)
+{
+    auto                                    token = std::make_shared<int>(0);
+    chunked_vector<std::shared_ptr<int>, 4> v;
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(token);
+    }
+    EXPECT_EQ(token.use_count(), 11);
+
+    v.resize(3);
+    EXPECT_EQ(token.use_count(), 4);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 4u);
+
+    auto moved = std::move(v);
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(moved.size(), 3u);
+
+    moved.clear();
+    EXPECT_EQ(token.use_count(), 1);
+    EXPECT_EQ(moved.capacity(), 4u);
+}
+
+TEST_F(chunked_vector_test, chunked_archetype_keeps_component_addresses)
+{
+    chunked_archetype<position, std::string> arch;
+    arch.emplace_back(position{1.0f}, std::string("first"));
+    const position*    pos = &arch.get<position>()[0];
+    const std::string* name = &arch.get<std::string>()[0];
+
+    for (int i = 0; i < 5000; ++i) {
+        arch.emplace_back(position{static_cast<float>(i)}, std::string());
+    }
+
+    EXPECT_EQ(&arch.get<position>()[0], pos);
+    EXPECT_EQ(&arch.get<std::string>()[0], name);
+    EXPECT_EQ(*name, "first");
+
+    float sum = 0.0f;
+    arch.view<const position>().each([&](const position& p) { sum += p.x; });
+    EXPECT_FLOAT_EQ(sum, 1.0f + 4999.0f * 5000.0f / 2.0f);
+}
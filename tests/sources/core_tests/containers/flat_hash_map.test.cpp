@@ -0,0 +1,241 @@
+#include <common.test.hpp>
+
+#include <tavros/core/containers/flat_hash_map.hpp>
+#include <tavros/core/containers/unordered_map.hpp>
+#include <tavros/core/utils/string_hash.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace tavros::core;
+
+class flat_hash_map_test : public unittest_scope
+{
+};
+
+TEST_F(flat_hash_map_test, insert_find_erase)
+{
+    flat_hash_map<uint64, uint64> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), map.end());
+
+    for (uint64 i = 0; i < 1000; ++i) {
+        auto [it, inserted] = map.insert({i, i * 3});
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(it->second, i * 3);
+    }
+    EXPECT_EQ(map.size(), 1000u);
+    EXPECT_FALSE(map.insert({5, 0}).second);
+    EXPECT_EQ(map.find(5)->second, 15u);
+
+    for (uint64 i = 0; i < 1000; i += 2) {
+        EXPECT_EQ(map.erase(i), 1u);
+    }
+    EXPECT_EQ(map.erase(0), 0u);
+    EXPECT_EQ(map.size(), 500u);
+
+    for (uint64 i = 0; i < 1000; ++i) {
+        EXPECT_EQ(map.contains(i), i % 2 == 1) << i;
+    }
+}
+
+TEST_F(flat_hash_map_test, operator_brackets_and_try_emplace)
+{
+    flat_hash_map<std::string, int> map;
+    map["one"] = 1;
+    map["two"] += 2;
+    EXPECT_EQ(map["one"], 1);
+    EXPECT_EQ(map["two"], 2);
+    EXPECT_EQ(map["three"], 0);
+
+    EXPECT_FALSE(map.try_emplace("one", 10).second);
+    EXPECT_EQ(map["one"], 1);
+    EXPECT_FALSE(map.insert_or_assign("one", 10).second);
+    EXPECT_EQ(map["one"], 10);
+    EXPECT_EQ(map.size(), 3u);
+}
+
+TEST_F(flat_hash_map_test, transparent_lookup_by_string_view)
+{
+    flat_hash_map<string, int, string_hash, string_equal> map;
+    map.try_emplace(string("textures/wall.png"), 7);
+
+    string_view key = "textures/wall.png";
+    EXPECT_TRUE(map.contains(key));
+    EXPECT_EQ(map.find(key)->second, 7);
+    EXPECT_EQ(map.count(string_view("missing")), 0u);
+    EXPECT_EQ(map.erase(key), 1u);
+    EXPECT_TRUE(map.empty());
+}
+
+TEST_F(flat_hash_map_test, iteration_visits_every_element_once)
+{
+    flat_hash_map<int, int> map;
+    for (int i = 0; i < 777; ++i) {
+        map[i] = i;
+    }
+
+    int64 sum = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(key, value);
+        sum += value;
+    }
+    EXPECT_EQ(sum, 777 * 776 / 2);
+
+    // Erasing while iterating neither skips nor revisits elements
+    size_t visited = 0;
+    for (auto it = map.begin(); it != map.end();) {
+        ++visited;
+        it = it->first % 3 == 0 ? map.erase(it) : std::next(it);
+    }
+    EXPECT_EQ(visited, 777u);
+    EXPECT_EQ(map.size(), 777u - 259u);
+}
+
+TEST_F(flat_hash_map_test, move_only_values_and_copies)
+{
+    flat_hash_map<int, std::unique_ptr<int>> owners;
+    for (int i = 0; i < 100; ++i) {
+        owners.try_emplace(i, std::make_unique<int>(i));
+    }
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(*owners.find(i)->second, i);
+    }
+
+    flat_hash_map<int, std::string> a{{1, "a"}, {2, "b"}};
+    auto                            b = a;
+    b[3] = "c";
+    EXPECT_EQ(a.size(), 2u);
+    EXPECT_EQ(b.size(), 3u);
+    EXPECT_EQ(b[1], "a");
+
+    auto c = std::move(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(c[3], "c");
+}
+
+TEST_F(flat_hash_map_test, reserve_and_clear_keep_capacity)
+{
+    flat_hash_map<uint64, int> map;
+    map.reserve(1000);
+    const auto capacity = map.capacity();
+    EXPECT_GE(capacity, 1000u);
+
+    for (uint64 i = 0; i < 1000; ++i) {
+        map[i * 4096] = 1;
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_LE(map.load_factor(), 0.8f);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST_F(flat_hash_map_test, random_operations_match_std)
+{
+    flat_hash_map<uint32, uint32> map;
+    unordered_map<uint32, uint32> ref;
+    std::mt19937                  rng(99);
+
+    for (size_t i = 0; i < 200000; ++i) {
+        const uint32 key = rng() % 5000;
+        switch (rng() % 3) {
+        case 0:
+            map[key] = static_cast<uint32>(i);
+            ref[key] = static_cast<uint32>(i);
+            break;
+        case 1:
+            ASSERT_EQ(map.erase(key), ref.erase(key));
+            break;
+        default: {
+            auto it = map.find(key);
+            auto rit = ref.find(key);
+            ASSERT_EQ(it == map.end(), rit == ref.end());
+            if (rit != ref.end()) {
+                ASSERT_EQ(it->second, rit->second);
+            }
+        }
+        }
+    }
+    EXPECT_EQ(map.size(), ref.size());
+}
+
+namespace
+{
+    template<class Map, class Key>
+    void run_benchmark(const char* name, const std::vector<Key>& keys, const std::vector<Key>& missing)
+    {
+        Map    map;
+        uint64 found = 0;
+
+        // Lookups in another order than inserts, so node-based maps don't get sequential node access
+        std::vector<Key> shuffled = keys;
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7));
+
+        auto report = [](const char* map_name, const char* op, timer& t, size_t n) {
+            auto ns = static_cast<double>(t.elapsed<std::chrono::nanoseconds>().count()) / static_cast<double>(n);
+            std::printf("[ stress   ] %-28s %-12s %6.1f ns/op\n", map_name, op, ns);
+        };
+
+        timer t;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            map.emplace(keys[i], i);
+        }
+        report(name, "insert", t, keys.size());
+
+        t.restart();
+        for (const auto& k : shuffled) {
+            found += map.find(k) != map.end();
+        }
+        report(name, "lookup-hit", t, keys.size());
+
+        t.restart();
+        for (const auto& k : missing) {
+            found += map.find(k) != map.end();
+        }
+        report(name, "lookup-miss", t, missing.size());
+
+        t.restart();
+        for (const auto& k : shuffled) {
+            found += map.erase(k);
+        }
+        report(name, "erase", t, keys.size());
+
+        EXPECT_EQ(found, keys.size() * 2);
+    }
+} // namespace
+
+TEST_F(flat_hash_map_test, stress_benchmark_against_std)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t k_count = 1000000;
+    std::mt19937_64  rng(2024);
+
+    std::vector<uint64> keys(k_count);
+    std::vector<uint64> missing(k_count);
+    for (size_t i = 0; i < k_count; ++i) {
+        keys[i] = rng() | 1;
+        missing[i] = rng() & ~uint64{1};
+    }
+    run_benchmark<unordered_map<uint64, size_t>>("unordered_map<uint64>", keys, missing);
+    run_benchmark<flat_hash_map<uint64, size_t>>("flat_hash_map<uint64>", keys, missing);
+
+    std::vector<string> names(k_count / 4);
+    std::vector<string> missing_names(k_count / 4);
+    for (size_t i = 0; i < names.size(); ++i) {
+        names[i] = "models/props/crate_" + std::to_string(i) + ".md3";
+        missing_names[i] = "textures/base/wall_" + std::to_string(i) + ".tga";
+    }
+    run_benchmark<unordered_map<string, size_t, string_hash, string_equal>>("unordered_map<string>", names, missing_names);
+    run_benchmark<flat_hash_map<string, size_t, string_hash, string_equal>>("flat_hash_map<string>", names, missing_names);
+}
@@ -0,0 +1,63 @@
+#include <common.test.hpp>
+
+#include <tavros/core/containers/flat_hash_set.hpp>
+#include <tavros/core/utils/string_hash.hpp>
+
+#include <random>
+#include <set>
+
+using namespace tavros::core;
+
+class flat_hash_set_test : public unittest_scope
+{
+};
+
+TEST_F(flat_hash_set_test, insert_contains_erase)
+{
+    flat_hash_set<int> set{1, 2, 3, 3};
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_FALSE(set.insert(2).second);
+    EXPECT_TRUE(set.insert(4).second);
+
+    EXPECT_TRUE(set.contains(4));
+    EXPECT_EQ(set.erase(1), 1u);
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_EQ(set.size(), 3u);
+}
+
+TEST_F(flat_hash_set_test, transparent_erase_by_string_view)
+{
+    flat_hash_set<string, string_hash, string_equal> paths;
+    paths.insert(string("maps/q3dm1.tef"));
+    paths.insert(string("maps/q3dm2.tef"));
+
+    EXPECT_EQ(paths.count(string_view("maps/q3dm1.tef")), 1u);
+    EXPECT_EQ(paths.erase(string_view("maps/q3dm1.tef")), 1u);
+    EXPECT_FALSE(paths.contains(string_view("maps/q3dm1.tef")));
+    EXPECT_TRUE(paths.contains(string_view("maps/q3dm2.tef")));
+}
+
+TEST_F(flat_hash_set_test, pointer_keys_with_colliding_low_bits)
+{
+    // Pointers to aligned blocks share their low bits, the table must still spread them
+    flat_hash_set<void*> set;
+    std::set<void*>      ref;
+    std::mt19937_64      rng(5);
+
+    for (size_t i = 0; i < 50000; ++i) {
+        auto* p = reinterpret_cast<void*>((rng() % 100000) * 4096);
+        if (rng() % 4 == 0) {
+            ASSERT_EQ(set.erase(p), ref.erase(p));
+        } else {
+            ASSERT_EQ(set.insert(p).second, ref.insert(p).second);
+        }
+    }
+    EXPECT_EQ(set.size(), ref.size());
+
+    size_t n = 0;
+    for (auto* p : set) {
+        ASSERT_TRUE(ref.contains(p));
+        ++n;
+    }
+    EXPECT_EQ(n, ref.size());
+}
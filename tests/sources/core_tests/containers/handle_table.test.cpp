@@ -0,0 +1,111 @@
+#include <common.test.hpp>
+
+#include <tavros/core/containers/handle_table.hpp>
+#include <tavros/core/archetype.hpp>
+
+#include <string>
+
+using namespace tavros::core;
+
+namespace
+{
+    struct row_tag : handle_type_registration<0x7e01>
+    {
+    };
+
+    struct health
+    {
+        int value = 0;
+    };
+
+    using row_table = handle_table<row_tag, chunked_archetype<health, std::string>>;
+} // namespace
+
+class handle_table_test : public unittest_scope
+{
+};
+
+TEST_F(handle_table_test, handles_survive_swap_and_pop)
+{
+    row_table t;
+    auto      a = t.emplace_back(health{1}, std::string("a"));
+    auto      b = t.emplace_back(health{2}, std::string("b"));
+    auto      c = t.emplace_back(health{3}, std::string("c"));
+
+    EXPECT_TRUE(t.erase(a));
+    EXPECT_EQ(t.size(), 2u);
+
+    // c was moved into the first row
+    EXPECT_EQ(t.index_of(c), 0u);
+    EXPECT_EQ(t.get<health>(c).value, 3);
+    EXPECT_EQ(t.get<std::string>(b), "b");
+    EXPECT_EQ(t.handle_at(0), c);
+    EXPECT_EQ(t.handle_at(1), b);
+}
+
+TEST_F(handle_table_test, stale_handles_are_rejected)
+{
+    row_table t;
+    auto      a = t.emplace_back(health{1}, std::string("a"));
+    EXPECT_TRUE(t.erase(a));
+    EXPECT_FALSE(t.is_valid(a));
+    EXPECT_FALSE(t.erase(a));
+
+    // The slot is reused with a new generation
+    auto b = t.emplace_back(health{2}, std::string("b"));
+    EXPECT_EQ(b.index(), a.index());
+    EXPECT_NE(b, a);
+    EXPECT_EQ(t.try_get<health>(a), nullptr);
+    ASSERT_NE(t.try_get<health>(b), nullptr);
+    EXPECT_EQ(t.try_get<health>(b)->value, 2);
+
+    EXPECT_FALSE(t.is_valid(row_table::handle_type()));
+}
+
+TEST_F(handle_table_test, clear_invalidates_all_handles)
+{
+    row_table                      t;
+    vector<row_table::handle_type> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(t.emplace_back(health{i}, std::string()));
+    }
+
+    t.clear();
+    EXPECT_TRUE(t.empty());
+    for (auto h : handles) {
+        EXPECT_FALSE(t.is_valid(h));
+    }
+
+    auto h = t.emplace_back(health{7}, std::string());
+    EXPECT_EQ(t.get<health>(h).value, 7);
+}
+
+TEST_F(handle_table_test, random_erase_keeps_mapping_consistent)
+{
+    row_table                      t;
+    vector<row_table::handle_type> live;
+    uint32                         seed = 12345;
+    auto                           next = [&] { return seed = seed * 1664525u + 1013904223u; };
+
+    for (int i = 0; i < 5000; ++i) {
+        if (live.empty() || next() % 3 != 0) {
+            live.push_back(t.emplace_back(health{i}, std::to_string(i)));
+        } else {
+            const size_t k = next() % live.size();
+            ASSERT_TRUE(t.erase(live[k]));
+            live[k] = live.back();
+            live.pop_back();
+        }
+    }
+
+    ASSERT_EQ(t.size(), live.size());
+    for (auto h : live) {
+        ASSERT_TRUE(t.is_valid(h));
+        EXPECT_EQ(t.handle_at(t.index_of(h)), h);
+        EXPECT_EQ(std::to_string(t.get<health>(h).value), t.get<std::string>(h));
+    }
+
+    int count = 0;
+    t.view<const health>().each([&](const health&) { ++count; });
+    EXPECT_EQ(static_cast<size_t>(count), live.size());
+}
@@ -0,0 +1,171 @@
+#include <common.test.hpp>
+
+#include <tavros/core/containers/small_vector.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace tavros::core;
+
+namespace
+{
+    class counting_allocator final : public allocator
+    {
+    public:
+        void* allocate(size_t size, size_t align, const char*) override
+        {
+            ++allocations;
+            return std::aligned_alloc(align, (size + align - 1) / align * align);
+        }
+
+        void* reallocate(void*, size_t, size_t, const char*) override
+        {
+            return nullptr;
+        }
+
+        void deallocate(void* ptr) override
+        {
+            ++deallocations;
+            std::free(ptr);
+        }
+
+        void clear() override
+        {
+        }
+
+        size_t allocations = 0;
+        size_t deallocations = 0;
+    };
+} // namespace
+
+class small_vector_test : public unittest_scope
+{
+};
+
+TEST_F(small_vector_test, stays_inline_up_to_n)
+{
+    counting_allocator   alc;
+    small_vector<int, 8> v(&alc);
+
+    for (int i = 0; i < 8; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 8u);
+    EXPECT_EQ(alc.allocations, 0u);
+
+    v.push_back(8);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(alc.allocations, 1u);
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(v[static_cast<size_t>(i)], i);
+    }
+
+    v.resize(4);
+    v.shrink_to_fit();
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(alc.deallocations, 1u);
+    EXPECT_EQ(v.back(), 3);
+}
+
+TEST_F(small_vector_test, push_back_of_own_element_survives_growth)
+{
+    small_vector<std::string, 2> v{"first", "second"};
+    v.push_back(v[0]);
+    v.emplace_back(v[1]);
+    ASSERT_EQ(v.size(), 4u);
+    EXPECT_EQ(v[2], "first");
+    EXPECT_EQ(v[3], "second");
+}
+
+TEST_F(small_vector_test, move_steals_heap_buffer_and_moves_inline_elements)
+{
+    counting_allocator alc;
+
+    small_vector<std::unique_ptr<int>, 2> a(&alc);
+    for (int i = 0; i < 5; ++i) {
+        a.push_back(std::make_unique<int>(i));
+    }
+    const auto* data = a.data();
+
+    small_vector<std::unique_ptr<int>, 2> b(std::move(a));
+    EXPECT_EQ(b.data(), data);
+    EXPECT_TRUE(a.empty());
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(b.get_allocator(), &alc);
+
+    small_vector<std::unique_ptr<int>, 2> c;
+    c.push_back(std::make_unique<int>(42));
+    small_vector<std::unique_ptr<int>, 2> d(std::move(c));
+    EXPECT_TRUE(d.is_inline());
+    EXPECT_EQ(*d[0], 42);
+
+    // Different allocators: the elements move into a buffer of the target allocator
+    small_vector<std::unique_ptr<int>, 2> e;
+    e = std::move(b);
+    EXPECT_NE(e.data(), data);
+    EXPECT_EQ(e.get_allocator(), nullptr);
+    EXPECT_EQ(*e[4], 4);
+    EXPECT_EQ(alc.allocations, alc.deallocations + 1);
+}
+
+TEST_F(small_vector_test, insert_and_erase)
+{
+    small_vector<int, 4> v{1, 2, 4, 5};
+    auto                 it = v.insert(v.begin() + 2, 3);
+    EXPECT_EQ(*it, 3);
+    ASSERT_EQ(v.size(), 5u);
+    for (size_t i = 0; i < v.size(); ++i) {
+        EXPECT_EQ(v[i], static_cast<int>(i + 1));
+    }
+
+    it = v.erase(v.begin(), v.begin() + 2);
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(v.size(), 3u);
+    v.erase(v.end() - 1);
+    EXPECT_EQ(v.back(), 4);
+    EXPECT_THROW((void) v.at(2), std::out_of_range);
+}
+
+TEST_F(small_vector_test, copies_are_independent)
+{
+    small_vector<std::string, 1> a{"x", "y", "z"};
+    auto                         b = a;
+    b[0] = "changed";
+    EXPECT_EQ(a[0], "x");
+
+    small_vector<std::string, 1> c(3, "w");
+    c = a;
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(c[2], "z");
+}
+
+#if TAV_DEBUG
+TEST_F(small_vector_test, spills_are_counted)
+{
+    struct tag
+    {
+        int v;
+    };
+    using vec = small_vector<tag, 3>;
+
+    {
+        vec v;
+        for (int i = 0; i < 3; ++i) {
+            v.push_back({i});
+        }
+    }
+    EXPECT_EQ(vec::stats().spill_count, 0u);
+
+    {
+        vec v;
+        for (int i = 0; i < 10; ++i) {
+            v.push_back({i});
+        }
+    }
+    EXPECT_EQ(vec::stats().spill_count, 1u);
+    EXPECT_EQ(vec::stats().peak_spill_size, 7u);
+}
+#endif
@@ -0,0 +1,135 @@
+#include <common.test.hpp>
+
+#include <tavros/core/debug/profiler.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace tavros;
+
+class profiler_test : public unittest_scope
+{
+protected:
+    void SetUp() override
+    {
+        unittest_scope::SetUp();
+#if !(TAV_PROFILER_ENABLED)
+        GTEST_SKIP() << "Profiler is disabled in this build, configure with TAV_ENABLE_PROFILER=ON";
+#endif
+    }
+
+    void TearDown() override
+    {
+        profiler::shutdown();
+        unittest_scope::TearDown();
+    }
+};
+
+TEST_F(profiler_test, events_reach_sinks_in_order)
+{
+    std::mutex                       mutex;
+    std::vector<profiler::perf_event> events;
+    profiler::add_sink([&](core::buffer_view<profiler::perf_event> batch) {
+        std::lock_guard lock(mutex);
+        events.insert(events.end(), batch.begin(), batch.end());
+    });
+
+    std::thread t([] {
+        TAV_PROFILE_THREAD_NAME("worker");
+        for (int i = 0; i < 100; ++i) {
+            TAV_PROFILE_SCOPE("zone");
+            TAV_PROFILE_COUNTER("value", i);
+        }
+    });
+    t.join();
+    profiler::flush();
+
+    std::lock_guard lock(mutex);
+    ASSERT_EQ(events.size(), 301u);
+    EXPECT_EQ(events[0].type, profiler::event_type::thread_name);
+    EXPECT_STREQ(events[0].tag, "worker");
+    for (size_t i = 1; i < events.size(); i += 3) {
+        EXPECT_EQ(events[i].type, profiler::event_type::zone_begin);
+        EXPECT_EQ(events[i + 1].type, profiler::event_type::counter);
+        EXPECT_EQ(events[i + 1].value, static_cast<double>(i / 3));
+        EXPECT_EQ(events[i + 2].type, profiler::event_type::zone_end);
+        EXPECT_LE(events[i].time_ns, events[i + 2].time_ns);
+    }
+}
+
+TEST_F(profiler_test, thread_name_is_sent_with_the_first_event)
+{
+    std::mutex                        mutex;
+    std::vector<profiler::perf_event> events;
+    profiler::add_sink([&](core::buffer_view<profiler::perf_event> batch) {
+        std::lock_guard lock(mutex);
+        events.insert(events.end(), batch.begin(), batch.end());
+    });
+
+    // Naming alone does not register the thread
+    std::thread idle([] { TAV_PROFILE_THREAD_NAME("idle"); });
+    idle.join();
+    std::thread busy([] {
+        TAV_PROFILE_THREAD_NAME("busy");
+        TAV_PROFILE_SCOPE("zone");
+    });
+    busy.join();
+    profiler::flush();
+
+    std::lock_guard lock(mutex);
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].type, profiler::event_type::thread_name);
+    EXPECT_STREQ(events[0].tag, "busy");
+    EXPECT_EQ(events[0].thread_id, events[1].thread_id);
+}
+
+TEST_F(profiler_test, full_buffer_drops_and_counts)
+{
+    std::atomic<size_t> received = 0;
+    std::atomic_bool    blocked = true;
+    profiler::add_sink([&](core::buffer_view<profiler::perf_event> batch) {
+        while (blocked) {
+            std::this_thread::yield();
+        }
+        received += batch.size();
+    });
+
+    const uint64 dropped_before = profiler::dropped_events();
+    std::thread  t([] {
+        for (size_t i = 0; i < profiler::k_thread_buffer_events * 4; ++i) {
+            TAV_PROFILE_COUNTER("c", i);
+        }
+    });
+    t.join();
+    blocked = false;
+    profiler::flush();
+
+    const uint64 dropped = profiler::dropped_events() - dropped_before;
+    EXPECT_GT(dropped, 0u);
+    EXPECT_EQ(received + dropped, profiler::k_thread_buffer_events * 4);
+}
+
+TEST_F(profiler_test, stress_record_overhead)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    std::atomic<size_t> received = 0;
+    profiler::add_sink([&](core::buffer_view<profiler::perf_event> batch) { received += batch.size(); });
+
+    constexpr size_t k_zones = 2000000;
+    core::timer      t;
+    for (size_t i = 0; i < k_zones; ++i) {
+        TAV_PROFILE_SCOPE("zone");
+    }
+    const double ns = static_cast<double>(t.elapsed<std::chrono::nanoseconds>().count()) / (k_zones * 2);
+    profiler::flush();
+
+    std::printf("[ stress   ] %.1f ns/event, %zu received, %llu dropped\n", ns, received.load(), static_cast<unsigned long long>(profiler::dropped_events()));
+}
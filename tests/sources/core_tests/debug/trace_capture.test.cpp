@@ -0,0 +1,196 @@
+#include <common.test.hpp>
+
+#include <tavros/core/debug/rolling_capture.hpp>
+#include <tavros/core/debug/trace_capture.hpp>
+#include <tavros/core/exception.hpp>
+#include <tavros/core/io/file_writer.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace tavros;
+using namespace std::chrono_literals;
+
+namespace
+{
+    profiler::perf_event make_event(profiler::event_type type, const char* tag, uint64 time_ns, uint64 thread_id = 42, double value = 0.0)
+    {
+        return profiler::perf_event{.tag = tag, .time_ns = time_ns, .thread_id = thread_id, .value = value, .type = type};
+    }
+
+    std::string read_text(const std::filesystem::path& path)
+    {
+        std::ifstream      file(path, std::ios::binary);
+        std::ostringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    size_t count_of(const std::string& text, const std::string& what)
+    {
+        size_t count = 0;
+        for (auto pos = text.find(what); pos != std::string::npos; pos = text.find(what, pos + what.size())) {
+            ++count;
+        }
+        return count;
+    }
+} // namespace
+
+class trace_capture_test : public unittest_scope
+{
+protected:
+    void SetUp() override
+    {
+        unittest_scope::SetUp();
+        dir = std::filesystem::temp_directory_path() / "tavros_trace_capture_test";
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::string path(const char* name) const
+    {
+        return (dir / name).string();
+    }
+
+    void write_capture(const std::string& file, const std::vector<profiler::perf_event>& events)
+    {
+        core::file_writer        out(file);
+        profiler::capture_writer writer(out);
+        writer.write(core::buffer_view<profiler::perf_event>(events.data(), events.size()));
+        ASSERT_TRUE(writer.good());
+    }
+
+    std::filesystem::path dir;
+};
+
+TEST_F(trace_capture_test, capture_is_compact_and_converts_to_chrome_trace)
+{
+    std::vector<profiler::perf_event> events;
+    events.push_back(make_event(profiler::event_type::thread_name, "Render \"main\"", 0));
+    for (uint64 i = 0; i < 1000; ++i) {
+        events.push_back(make_event(profiler::event_type::zone_begin, "frame", 1'000'000 + i * 16'000));
+        events.push_back(make_event(profiler::event_type::counter, "draw_calls", 1'000'100 + i * 16'000, 42, 12.5));
+        events.push_back(make_event(profiler::event_type::zone_end, "frame", 1'015'000 + i * 16'000));
+    }
+    write_capture(path("a.tavtrace"), events);
+
+    // Zone events take a few bytes each, counters add a double
+    EXPECT_LT(std::filesystem::file_size(path("a.tavtrace")), 2000 * 6 + 1000 * 14u);
+
+    const size_t count = profiler::convert_capture_to_chrome_trace(path("a.tavtrace"), path("a.json"));
+    EXPECT_EQ(count, events.size());
+
+    const auto json = read_text(path("a.json"));
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+    EXPECT_EQ(count_of(json, "\"args\":{\"name\":\"Render \\\"main\\\"\"}"), 1u);
+    EXPECT_EQ(count_of(json, "{\"name\":\"frame\",\"ph\":\"B\",\"pid\":1,\"tid\":1,\"ts\":1000.000}"), 1u);
+    EXPECT_EQ(count_of(json, "{\"name\":\"frame\",\"ph\":\"E\",\"pid\":1,\"tid\":1,\"ts\":16999.000}"), 1u);
+    EXPECT_EQ(count_of(json, "\"ph\":\"C\""), 1000u);
+    EXPECT_EQ(count_of(json, "\"args\":{\"value\":12.5}"), 1000u);
+}
+
+TEST_F(trace_capture_test, unmatched_zones_are_balanced)
+{
+    // Threads interleave in the capture, and each one starts in the middle of a zone
+    write_capture(path("b.tavtrace"), {
+        make_event(profiler::event_type::zone_end, "cut", 100, 1),
+        make_event(profiler::event_type::zone_begin, "outer", 200, 1),
+        make_event(profiler::event_type::zone_end, "cut", 150, 2),
+        make_event(profiler::event_type::zone_begin, "inner", 300, 1),
+        make_event(profiler::event_type::zone_end, "inner", 400, 1),
+        make_event(profiler::event_type::zone_begin, "open", 900, 2),
+    });
+
+    EXPECT_EQ(profiler::convert_capture_to_chrome_trace(path("b.tavtrace"), path("b.json")), 6u);
+
+    const auto json = read_text(path("b.json"));
+    EXPECT_EQ(count_of(json, "\"name\":\"cut\""), 0u);
+    EXPECT_EQ(count_of(json, "\"ph\":\"B\""), count_of(json, "\"ph\":\"E\""));
+    EXPECT_EQ(count_of(json, "{\"name\":\"outer\",\"ph\":\"E\",\"pid\":1,\"tid\":1,\"ts\":0.900}"), 1u);
+    EXPECT_EQ(count_of(json, "{\"name\":\"open\",\"ph\":\"E\",\"pid\":1,\"tid\":2,\"ts\":0.900}"), 1u);
+}
+
+TEST_F(trace_capture_test, malformed_capture_throws)
+{
+    {
+        std::ofstream file(path("bad.tavtrace"), std::ios::binary);
+        file << "not a capture file at all";
+    }
+    EXPECT_THROW(profiler::convert_capture_to_chrome_trace(path("bad.tavtrace"), path("bad.json")), core::file_error);
+
+    // A valid capture cut in the middle of a record
+    write_capture(path("cut.tavtrace"), {make_event(profiler::event_type::counter, "value", 100, 1, 1.0)});
+    std::filesystem::resize_file(path("cut.tavtrace"), std::filesystem::file_size(path("cut.tavtrace")) - 3);
+    EXPECT_THROW(profiler::convert_capture_to_chrome_trace(path("cut.tavtrace"), path("cut.json")), core::file_error);
+
+    EXPECT_THROW(profiler::convert_capture_to_chrome_trace(path("missing.tavtrace"), path("missing.json")), core::file_error);
+}
+
+TEST_F(trace_capture_test, rolling_capture_keeps_last_window)
+{
+    profiler::rolling_capture capture(1ms);
+    auto                      sink = capture.sink();
+
+    const profiler::perf_event name = make_event(profiler::event_type::thread_name, "worker", 0);
+    sink(core::buffer_view<profiler::perf_event>(&name, 1));
+
+    // 10 ms of events, 100 us apart
+    for (uint64 i = 0; i <= 100; ++i) {
+        const profiler::perf_event e = make_event(profiler::event_type::counter, "value", i * 100'000, 42, static_cast<double>(i));
+        sink(core::buffer_view<profiler::perf_event>(&e, 1));
+    }
+    EXPECT_EQ(capture.size(), 11u);
+
+    ASSERT_TRUE(capture.dump(path("window.tavtrace")));
+    EXPECT_EQ(profiler::convert_capture_to_chrome_trace(path("window.tavtrace"), path("window.json")), 12u);
+
+    const auto json = read_text(path("window.json"));
+    EXPECT_EQ(count_of(json, "\"args\":{\"name\":\"worker\"}"), 1u);
+    EXPECT_EQ(count_of(json, "\"args\":{\"value\":89}"), 0u);
+    EXPECT_EQ(count_of(json, "\"args\":{\"value\":90}"), 1u);
+    EXPECT_EQ(count_of(json, "\"args\":{\"value\":100}"), 1u);
+}
+
+TEST_F(trace_capture_test, rolling_capture_overwrites_oldest_when_full)
+{
+    profiler::rolling_capture capture(10s, 4);
+    auto                      sink = capture.sink();
+
+    std::vector<profiler::perf_event> events;
+    for (uint64 i = 0; i < 10; ++i) {
+        events.push_back(make_event(profiler::event_type::counter, "value", i, 42, static_cast<double>(i)));
+    }
+    sink(core::buffer_view<profiler::perf_event>(events.data(), events.size()));
+    EXPECT_EQ(capture.size(), 4u);
+
+    ASSERT_TRUE(capture.dump(path("full.tavtrace")));
+    EXPECT_EQ(profiler::convert_capture_to_chrome_trace(path("full.tavtrace"), path("full.json")), 4u);
+
+    const auto json = read_text(path("full.json"));
+    EXPECT_EQ(count_of(json, "\"args\":{\"value\":5}"), 0u);
+    for (int i = 6; i < 10; ++i) {
+        EXPECT_EQ(count_of(json, "\"args\":{\"value\":" + std::to_string(i) + "}"), 1u);
+    }
+}
+
+TEST_F(trace_capture_test, rolling_capture_dumps_on_frame_spike_once_per_window)
+{
+    profiler::rolling_capture capture(1h);
+    capture.set_spike_dump(20ms, path("hitch"));
+
+    EXPECT_FALSE(capture.end_frame(16ms));
+    EXPECT_TRUE(capture.end_frame(50ms));
+    EXPECT_FALSE(capture.end_frame(50ms));
+
+    EXPECT_TRUE(std::filesystem::exists(path("hitch_0.tavtrace")));
+    EXPECT_FALSE(std::filesystem::exists(path("hitch_1.tavtrace")));
+    EXPECT_EQ(profiler::convert_capture_to_chrome_trace(path("hitch_0.tavtrace"), path("hitch.json")), 0u);
+}
@@ -0,0 +1,136 @@
+#include <common.test.hpp>
+
+#include <tavros/core/archetype.hpp>
+#include <tavros/core/thread/thread_pool.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+
+using namespace tavros::core;
+
+namespace
+{
+    struct position
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    struct velocity
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    template<class Archetype>
+    void fill(Archetype& arch, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            arch.emplace_back(position{static_cast<float>(i), 0.0f}, velocity{1.0f, 2.0f});
+        }
+    }
+} // namespace
+
+class archetype_view_test : public unittest_scope
+{
+};
+
+TEST_F(archetype_view_test, each_block_covers_contiguous_columns_at_once)
+{
+    archetype<position, velocity> arch;
+    fill(arch, 1000);
+
+    size_t calls = 0;
+    arch.view<position, const velocity>().each_block([&](buffer_span<position> pos, buffer_view<velocity> vel) {
+        ++calls;
+        ASSERT_EQ(pos.size(), vel.size());
+        for (size_t i = 0; i < pos.size(); ++i) {
+            pos[i].x += vel[i].x;
+        }
+    });
+    EXPECT_EQ(calls, 1u);
+    EXPECT_FLOAT_EQ(arch.get<position>()[999].x, 1000.0f);
+}
+
+TEST_F(archetype_view_test, each_block_walks_the_chunks_of_a_chunked_archetype)
+{
+    chunked_archetype<position, velocity> arch;
+    fill(arch, 1000);
+
+    size_t rows = 0;
+    size_t calls = 0;
+    const auto& carch = arch;
+    carch.view<const position>().each_block([&](buffer_view<position> pos) {
+        EXPECT_EQ(pos[0].x, static_cast<float>(rows));
+        rows += pos.size();
+        ++calls;
+    });
+    EXPECT_EQ(rows, 1000u);
+    EXPECT_EQ(calls, arch.get<position>().chunk_count());
+
+    archetype<position> empty;
+    empty.view<position>().each_block([&](buffer_span<position>) { ADD_FAILURE(); });
+}
+
+TEST_F(archetype_view_test, parallel_each_visits_every_row_once)
+{
+    thread_pool                           pool(3);
+    chunked_archetype<position, velocity> arch;
+    fill(arch, 10007);
+
+    for (size_t grain : {0u, 1u, 64u, 100000u}) {
+        arch.view<position, const velocity>().parallel_each(pool, grain, [](position& p, const velocity& v) {
+            p.y += v.y;
+        });
+    }
+
+    for (const auto& p : arch.get<position>()) {
+        ASSERT_FLOAT_EQ(p.y, 8.0f);
+    }
+}
+
+TEST_F(archetype_view_test, stress_parallel_each_scales_with_workers)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t              k_rows = 4000000;
+    archetype<position, velocity> arch;
+    fill(arch, k_rows);
+    auto view = arch.view<position, const velocity>();
+
+    auto kernel = [](position& p, const velocity& v) {
+        for (int k = 0; k < 16; ++k) {
+            p.x = p.x * 0.999f + v.x;
+            p.y = p.y * 0.999f + v.y;
+        }
+    };
+
+    timer t;
+    view.each(kernel);
+    const double seq_ms = static_cast<double>(t.elapsed<std::chrono::microseconds>().count()) / 1000.0;
+
+    thread_pool pool;
+    t.restart();
+    view.parallel_each(pool, 0, kernel);
+    const double par_ms = static_cast<double>(t.elapsed<std::chrono::microseconds>().count()) / 1000.0;
+
+    t.restart();
+    view.each_block([](buffer_span<position> pos, buffer_view<velocity> vel) {
+        position*       p = pos.data();
+        const velocity* v = vel.data();
+        for (size_t i = 0; i < pos.size(); ++i) {
+            for (int k = 0; k < 16; ++k) {
+                p[i].x = p[i].x * 0.999f + v[i].x;
+                p[i].y = p[i].y * 0.999f + v[i].y;
+            }
+        }
+    });
+    const double block_ms = static_cast<double>(t.elapsed<std::chrono::microseconds>().count()) / 1000.0;
+
+    std::printf("[ stress   ] each: %.2f ms, parallel_each (%zu threads): %.2f ms, each_block: %.2f ms\n", seq_ms, pool.concurrency(), par_ms, block_ms);
+    if (pool.concurrency() > 1) {
+        EXPECT_LT(par_ms, seq_ms);
+    }
+}
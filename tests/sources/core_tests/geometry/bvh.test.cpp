@@ -0,0 +1,265 @@
+#include <common.test.hpp>
+
+#include <tavros/core/geometry/bvh.hpp>
+#include <tavros/core/thread/thread_pool.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace tavros::math;
+using namespace tavros::geometry;
+
+namespace
+{
+    std::mt19937 g_rng(9);
+
+    float random_float(float lo, float hi)
+    {
+        return std::uniform_real_distribution<float>(lo, hi)(g_rng);
+    }
+
+    std::vector<aabb3> random_boxes(size_t count, float range = 100.0f, float max_size = 4.0f)
+    {
+        std::vector<aabb3> boxes;
+        for (size_t i = 0; i < count; ++i) {
+            const vec3 c(random_float(-range, range), random_float(-range, range), random_float(-range, range));
+            const vec3 e(random_float(0.1f, max_size), random_float(0.1f, max_size), random_float(0.1f, max_size));
+            boxes.emplace_back(c - e, c + e);
+        }
+        return boxes;
+    }
+
+    template<class Query>
+    std::vector<uint32> collect(Query&& query)
+    {
+        std::vector<uint32> result;
+        query([&](uint32 index) {
+            result.push_back(index);
+            return true;
+        });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    template<class Pred>
+    std::vector<uint32> brute_force(const std::vector<aabb3>& boxes, Pred&& pred)
+    {
+        std::vector<uint32> result;
+        for (uint32 i = 0; i < boxes.size(); ++i) {
+            if (pred(boxes[i])) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    // Checks that nodes bound their children and that leaves cover every primitive once
+    void check_tree(const bvh& tree, const std::vector<aabb3>& boxes, uint32 max_leaf_size)
+    {
+        const auto nodes = tree.nodes();
+        const auto indices = tree.indices();
+        ASSERT_EQ(indices.size(), boxes.size());
+        ASSERT_LE(nodes.size(), 2 * boxes.size());
+
+        auto inside = [](const bvh::node& n, const vec3& min, const vec3& max) {
+            const aabb3 b(n.min, n.max);
+            return b.contains_point(min) && b.contains_point(max);
+        };
+
+        std::vector<uint32> seen(boxes.size(), 0);
+        for (const auto& n : nodes) {
+            if (n.is_leaf()) {
+                EXPECT_LE(n.count, max_leaf_size);
+                for (uint32 i = n.first; i < n.first + n.count; ++i) {
+                    ++seen[indices[i]];
+                    EXPECT_TRUE(inside(n, boxes[indices[i]].min, boxes[indices[i]].max));
+                }
+            } else {
+                ASSERT_LT(n.first + 1, nodes.size());
+                EXPECT_TRUE(inside(n, nodes[n.first].min, nodes[n.first].max));
+                EXPECT_TRUE(inside(n, nodes[n.first + 1].min, nodes[n.first + 1].max));
+            }
+        }
+        EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](uint32 c) { return c == 1; }));
+    }
+} // namespace
+
+class bvh_test : public unittest_scope
+{
+};
+
+TEST_F(bvh_test, box_and_frustum_queries_match_brute_force)
+{
+    const auto boxes = random_boxes(1000);
+    bvh        tree;
+    tree.build(boxes);
+    EXPECT_EQ(tree.size(), boxes.size());
+    check_tree(tree, boxes, bvh::k_default_leaf_size);
+
+    for (int q = 0; q < 20; ++q) {
+        const auto query = random_boxes(1, 100.0f, 30.0f)[0];
+        EXPECT_EQ(collect([&](auto&& f) { tree.query(query, f); }), brute_force(boxes, [&](const aabb3& b) { return intersects(b, query); }));
+    }
+
+    // Wide and narrow frustums, so that subtrees fully inside are taken too
+    for (float fov : {0.3f, 2.0f}) {
+        const auto view = make_look_at_dir(vec3(-120.0f, 0.0f, 0.0f), vec3(1.0f, 0.1f, 0.0f), vec3(0.0f, 0.0f, 1.0f));
+        const auto f = frustum::from_matrix(make_perspective(fov, 1.5f, 0.1f, 250.0f) * view);
+        const auto visible = collect([&](auto&& fn) { tree.query(f, fn); });
+        EXPECT_FALSE(visible.empty());
+        EXPECT_EQ(visible, brute_force(boxes, [&](const aabb3& b) { return f.contains_aabb(b); }));
+    }
+
+    bvh empty;
+    empty.build({});
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(collect([&](auto&& f) { empty.query(aabb3(vec3(-1.0f), vec3(1.0f)), f); }).empty());
+}
+
+TEST_F(bvh_test, ray_cast_finds_closest_hit)
+{
+    const auto boxes = random_boxes(1000, 50.0f, 3.0f);
+    bvh        tree;
+    tree.build(boxes);
+
+    for (int q = 0; q < 30; ++q) {
+        // Axis-aligned directions exercise the infinite inverse components
+        const vec3 dir = q % 3 == 0 ? vec3(1.0f, 0.0f, 0.0f) : normalize(vec3(1.0f, random_float(-0.3f, 0.3f), random_float(-0.3f, 0.3f)));
+        const ray3 ray(vec3(-80.0f, random_float(-20.0f, 20.0f), random_float(-20.0f, 20.0f)), dir);
+
+        float  expected = -1.0f;
+        uint32 expected_index = 0;
+        size_t expected_hits = 0;
+        for (uint32 i = 0; i < boxes.size(); ++i) {
+            const float t = intersect(ray, boxes[i]);
+            if (t >= 0.0f && t <= 200.0f) {
+                ++expected_hits;
+                if (expected < 0.0f || t < expected) {
+                    expected = t;
+                    expected_index = i;
+                }
+            }
+        }
+
+        size_t hits = 0;
+        tree.ray_cast(ray, 200.0f, [&](uint32, float) {
+            ++hits;
+            return 200.0f;
+        });
+        EXPECT_EQ(hits, expected_hits);
+
+        float  closest = -1.0f;
+        uint32 closest_index = 0;
+        tree.ray_cast(ray, 200.0f, [&](uint32 index, float t) {
+            closest = t;
+            closest_index = index;
+            return t;
+        });
+        EXPECT_FLOAT_EQ(closest, expected);
+        if (expected >= 0.0f) {
+            EXPECT_EQ(closest_index, expected_index);
+        }
+    }
+}
+
+TEST_F(bvh_test, parallel_build_matches_serial)
+{
+    // Clustered boxes plus duplicates, which have no split plane between them
+    auto boxes = random_boxes(6000, 300.0f, 2.0f);
+    for (int i = 0; i < 50; ++i) {
+        boxes.push_back(boxes[0]);
+    }
+
+    bvh serial;
+    serial.build(boxes, 2);
+    check_tree(serial, boxes, 2);
+
+    tavros::core::thread_pool pool(3);
+    bvh                       parallel;
+    parallel.build(boxes, pool, 2);
+    check_tree(parallel, boxes, 2);
+    EXPECT_EQ(parallel.nodes().size(), serial.nodes().size());
+
+    for (int q = 0; q < 20; ++q) {
+        const auto query = random_boxes(1, 300.0f, 40.0f)[0];
+        EXPECT_EQ(collect([&](auto&& f) { parallel.query(query, f); }), collect([&](auto&& f) { serial.query(query, f); }));
+    }
+    EXPECT_EQ(collect([&](auto&& f) { parallel.query(boxes[0], f); }).size(), collect([&](auto&& f) { serial.query(boxes[0], f); }).size());
+}
+
+TEST_F(bvh_test, query_pairs_reports_each_pair_once)
+{
+    const auto boxes = random_boxes(400, 40.0f, 3.0f);
+    bvh        tree;
+    tree.build(boxes);
+
+    std::vector<std::pair<uint32, uint32>> pairs;
+    tree.query_pairs([&](uint32 a, uint32 b) { pairs.emplace_back(a, b); });
+    std::sort(pairs.begin(), pairs.end());
+
+    std::vector<std::pair<uint32, uint32>> expected;
+    for (uint32 a = 0; a < boxes.size(); ++a) {
+        for (uint32 b = a + 1; b < boxes.size(); ++b) {
+            if (intersects(boxes[a], boxes[b])) {
+                expected.emplace_back(a, b);
+            }
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(pairs, expected);
+}
+
+TEST_F(bvh_test, stress_build_and_ray_cast)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t count = 200'000;
+    constexpr int    rays = 1000;
+
+    const auto boxes = random_boxes(count, 1000.0f, 3.0f);
+
+    tavros::core::timer tm;
+    bvh                 tree;
+    tree.build(boxes);
+    const double serial_s = tm.elapsed_seconds();
+
+    tavros::core::thread_pool pool;
+    tm.restart();
+    tree.build(boxes, pool);
+    const double parallel_s = tm.elapsed_seconds();
+
+    std::vector<ray3> queries;
+    for (int i = 0; i < rays; ++i) {
+        queries.emplace_back(vec3(random_float(-1000.0f, 1000.0f), -1100.0f, random_float(-1000.0f, 1000.0f)), normalize(vec3(random_float(-0.2f, 0.2f), 1.0f, random_float(-0.2f, 0.2f))));
+    }
+
+    tm.restart();
+    size_t tree_hits = 0;
+    for (const auto& ray : queries) {
+        float closest = -1.0f;
+        tree.ray_cast(ray, 5000.0f, [&](uint32, float t) { return closest = t; });
+        tree_hits += closest >= 0.0f ? 1 : 0;
+    }
+    const double tree_s = tm.elapsed_seconds();
+
+    tm.restart();
+    size_t brute_hits = 0;
+    for (int i = 0; i < 10; ++i) {
+        float closest = -1.0f;
+        for (const auto& box : boxes) {
+            const float t = intersect(queries[i], box);
+            if (t >= 0.0f && (closest < 0.0f || t < closest)) {
+                closest = t;
+            }
+        }
+        brute_hits += closest >= 0.0f ? 1 : 0;
+    }
+    const double brute_s = tm.elapsed_seconds();
+
+    std::printf("[ stress   ] bvh over %zu boxes: build %.1f ms, parallel build %.1f ms (%zu threads), closest hit %.2f us/ray (%zu hits), brute force %.1f us/ray (%zu hits)\n", count, serial_s * 1000.0, parallel_s * 1000.0, pool.concurrency(), tree_s * 1e6 / rays, tree_hits, brute_s * 1e6 / 10, brute_hits);
+}
@@ -0,0 +1,258 @@
+#include <common.test.hpp>
+
+#include <tavros/core/geometry/dynamic_aabb_tree.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace tavros::math;
+using namespace tavros::geometry;
+
+namespace
+{
+    using proxy_id = dynamic_aabb_tree::proxy_id;
+
+    std::mt19937 g_rng(5);
+
+    float random_float(float lo, float hi)
+    {
+        return std::uniform_real_distribution<float>(lo, hi)(g_rng);
+    }
+
+    aabb3 random_box(float range = 100.0f, float max_size = 4.0f)
+    {
+        const vec3 c(random_float(-range, range), random_float(-range, range), random_float(-range, range));
+        const vec3 e(random_float(0.1f, max_size), random_float(0.1f, max_size), random_float(0.1f, max_size));
+        return aabb3(c - e, c + e);
+    }
+
+    bool contains(const aabb3& outer, const aabb3& inner)
+    {
+        return outer.contains_point(inner.min) && outer.contains_point(inner.max);
+    }
+
+    template<class Query>
+    std::vector<proxy_id> collect(Query&& query)
+    {
+        std::vector<proxy_id> ids;
+        query([&](proxy_id id) {
+            ids.push_back(id);
+            return true;
+        });
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    template<class Pred>
+    std::vector<proxy_id> brute_force(const dynamic_aabb_tree& tree, const std::vector<proxy_id>& ids, Pred&& pred)
+    {
+        std::vector<proxy_id> result;
+        for (auto id : ids) {
+            if (pred(tree.fat_box(id))) {
+                result.push_back(id);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+} // namespace
+
+class dynamic_aabb_tree_test : public unittest_scope
+{
+};
+
+TEST_F(dynamic_aabb_tree_test, box_and_frustum_queries_match_brute_force)
+{
+    dynamic_aabb_tree     tree(0.5f);
+    std::vector<proxy_id> ids;
+    for (uint32 i = 0; i < 500; ++i) {
+        const auto box = random_box();
+        ids.push_back(tree.insert(box, i * 10));
+        EXPECT_TRUE(contains(tree.fat_box(ids.back()), box));
+    }
+    EXPECT_EQ(tree.size(), 500u);
+    EXPECT_EQ(tree.user_data(ids[7]), 70u);
+    EXPECT_LE(tree.height(), 2 * static_cast<int32>(std::log2(500.0)));
+
+    for (int q = 0; q < 20; ++q) {
+        const auto box = random_box(100.0f, 30.0f);
+        const auto found = collect([&](auto&& f) { tree.query(box, f); });
+        EXPECT_EQ(found, brute_force(tree, ids, [&](const aabb3& b) { return intersects(b, box); }));
+    }
+
+    const auto view = make_look_at_dir(vec3(0.0f), vec3(1.0f, 0.2f, 0.1f), vec3(0.0f, 0.0f, 1.0f));
+    const auto f = frustum::from_matrix(make_perspective(1.0f, 1.5f, 0.1f, 80.0f) * view);
+    const auto visible = collect([&](auto&& fn) { tree.query(f, fn); });
+    EXPECT_FALSE(visible.empty());
+    EXPECT_EQ(visible, brute_force(tree, ids, [&](const aabb3& b) { return f.contains_aabb(b); }));
+
+    // Stopping early
+    size_t calls = 0;
+    tree.query(aabb3(vec3(-200.0f), vec3(200.0f)), [&](proxy_id) { return ++calls < 3; });
+    EXPECT_EQ(calls, 3u);
+}
+
+TEST_F(dynamic_aabb_tree_test, move_and_remove_keep_tree_valid)
+{
+    dynamic_aabb_tree     tree(1.0f);
+    std::vector<proxy_id> ids;
+    std::vector<aabb3>    boxes;
+    for (int i = 0; i < 300; ++i) {
+        boxes.push_back(random_box());
+        ids.push_back(tree.insert(boxes.back()));
+    }
+
+    // Small moves stay inside the fat box
+    const vec3 small(0.5f, -0.5f, 0.25f);
+    EXPECT_FALSE(tree.move(ids[0], aabb3(boxes[0].min + small, boxes[0].max + small)));
+
+    // Large moves re-insert, the fat box reaches further along the displacement
+    const vec3 large(20.0f, 0.0f, 0.0f);
+    const aabb3 moved(boxes[1].min + large, boxes[1].max + large);
+    EXPECT_TRUE(tree.move(ids[1], moved, large));
+    EXPECT_TRUE(contains(tree.fat_box(ids[1]), moved));
+    EXPECT_TRUE(contains(tree.fat_box(ids[1]), aabb3(moved.min + large, moved.max + large)));
+
+    // Remove every other proxy, freed ids are reused
+    std::vector<proxy_id> kept;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (i % 2 == 0) {
+            tree.remove(ids[i]);
+        } else {
+            kept.push_back(ids[i]);
+        }
+    }
+    EXPECT_EQ(tree.size(), kept.size());
+    const proxy_id reused = tree.insert(random_box());
+    EXPECT_TRUE(std::find(ids.begin(), ids.end(), reused) != ids.end());
+    kept.push_back(reused);
+
+    for (int q = 0; q < 20; ++q) {
+        const auto box = random_box(100.0f, 30.0f);
+        const auto found = collect([&](auto&& f) { tree.query(box, f); });
+        EXPECT_EQ(found, brute_force(tree, kept, [&](const aabb3& b) { return intersects(b, box); }));
+    }
+
+    tree.clear();
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.height(), 0);
+    EXPECT_TRUE(collect([&](auto&& f) { tree.query(aabb3(vec3(-200.0f), vec3(200.0f)), f); }).empty());
+}
+
+TEST_F(dynamic_aabb_tree_test, ray_cast_finds_closest_hit)
+{
+    dynamic_aabb_tree     tree(0.0f);
+    std::vector<proxy_id> ids;
+    for (int i = 0; i < 400; ++i) {
+        ids.push_back(tree.insert(random_box(50.0f, 3.0f)));
+    }
+
+    for (int q = 0; q < 20; ++q) {
+        const ray3 ray(vec3(-80.0f, random_float(-20.0f, 20.0f), random_float(-20.0f, 20.0f)), normalize(vec3(1.0f, random_float(-0.3f, 0.3f), random_float(-0.3f, 0.3f))));
+
+        float    expected = -1.0f;
+        proxy_id expected_id = dynamic_aabb_tree::k_null_proxy;
+        size_t   expected_hits = 0;
+        for (auto id : ids) {
+            const float t = intersect(ray, tree.fat_box(id));
+            if (t >= 0.0f && t <= 200.0f) {
+                ++expected_hits;
+                if (expected < 0.0f || t < expected) {
+                    expected = t;
+                    expected_id = id;
+                }
+            }
+        }
+
+        // Without clipping every box along the ray is reported
+        size_t hits = 0;
+        tree.ray_cast(ray, 200.0f, [&](proxy_id, float) {
+            ++hits;
+            return 200.0f;
+        });
+        EXPECT_EQ(hits, expected_hits);
+
+        // Clipping the ray at each hit ends with the closest one
+        float    closest = -1.0f;
+        proxy_id closest_id = dynamic_aabb_tree::k_null_proxy;
+        tree.ray_cast(ray, 200.0f, [&](proxy_id id, float t) {
+            closest = t;
+            closest_id = id;
+            return t;
+        });
+        EXPECT_EQ(closest_id, expected_id);
+        EXPECT_FLOAT_EQ(closest, expected);
+    }
+}
+
+TEST_F(dynamic_aabb_tree_test, query_pairs_reports_each_pair_once)
+{
+    dynamic_aabb_tree     tree(0.2f);
+    std::vector<proxy_id> ids;
+    for (int i = 0; i < 300; ++i) {
+        ids.push_back(tree.insert(random_box(40.0f, 3.0f)));
+    }
+
+    std::vector<std::pair<proxy_id, proxy_id>> pairs;
+    tree.query_pairs([&](proxy_id a, proxy_id b) { pairs.emplace_back(a, b); });
+    std::sort(pairs.begin(), pairs.end());
+
+    std::vector<std::pair<proxy_id, proxy_id>> expected;
+    for (auto a : ids) {
+        for (auto b : ids) {
+            if (a < b && intersects(tree.fat_box(a), tree.fat_box(b))) {
+                expected.emplace_back(a, b);
+            }
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(pairs, expected);
+}
+
+TEST_F(dynamic_aabb_tree_test, stress_moving_objects)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr int    frames = 60;
+    constexpr size_t count = 20'000;
+
+    dynamic_aabb_tree     tree(0.5f);
+    std::vector<proxy_id> ids;
+    std::vector<aabb3>    boxes;
+    std::vector<vec3>     velocities;
+    for (size_t i = 0; i < count; ++i) {
+        boxes.push_back(random_box(500.0f, 2.0f));
+        velocities.emplace_back(random_float(-0.3f, 0.3f), random_float(-0.3f, 0.3f), random_float(-0.3f, 0.3f));
+        ids.push_back(tree.insert(boxes.back()));
+    }
+
+    tavros::core::timer tm;
+    size_t              reinserted = 0;
+    size_t              pairs = 0;
+    for (int f = 0; f < frames; ++f) {
+        for (size_t i = 0; i < count; ++i) {
+            boxes[i] = aabb3(boxes[i].min + velocities[i], boxes[i].max + velocities[i]);
+            reinserted += tree.move(ids[i], boxes[i], velocities[i]) ? 1 : 0;
+        }
+        tree.query_pairs([&](proxy_id, proxy_id) { ++pairs; });
+    }
+    const double tree_s = tm.elapsed_seconds();
+
+    tm.restart();
+    size_t brute_hits = 0;
+    for (size_t q = 0; q < 100; ++q) {
+        for (size_t i = 0; i < count; ++i) {
+            brute_hits += intersects(boxes[q], boxes[i]) ? 1 : 0;
+        }
+    }
+    const double brute_s = tm.elapsed_seconds();
+
+    std::printf("[ stress   ] %zu objects: move + pairs %.2f ms/frame (%zu re-inserts, %zu pairs), brute force box query %.1f us (%zu hits), height %d\n", count, tree_s * 1000.0 / frames, reinserted, pairs, brute_s * 1e6 / 100, brute_hits, tree.height());
+}
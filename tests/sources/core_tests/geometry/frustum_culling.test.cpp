@@ -0,0 +1,230 @@
+#include <common.test.hpp>
+
+#include <tavros/core/geometry/frustum_culling.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace tavros::math;
+using namespace tavros::geometry;
+using tavros::core::buffer_view;
+
+namespace
+{
+    // Objects scattered around a camera at the origin looking along +X
+    struct scene
+    {
+        std::vector<sphere> spheres;
+        std::vector<aabb3>  boxes;
+
+        std::vector<float> x, y, z, r;
+        std::vector<float> ex, ey, ez;
+
+        explicit scene(size_t count, uint32 seed = 3)
+        {
+            std::mt19937                          rng(seed);
+            std::uniform_real_distribution<float> pos(-200.0f, 200.0f);
+            std::uniform_real_distribution<float> size(0.1f, 10.0f);
+            for (size_t i = 0; i < count; ++i) {
+                const vec3 c(pos(rng), pos(rng), pos(rng));
+                const vec3 e(size(rng), size(rng), size(rng));
+                spheres.emplace_back(c, e.x);
+                boxes.emplace_back(c - e, c + e);
+                x.push_back(c.x);
+                y.push_back(c.y);
+                z.push_back(c.z);
+                r.push_back(e.x);
+                ex.push_back(e.x);
+                ey.push_back(e.y);
+                ez.push_back(e.z);
+            }
+        }
+
+        sphere_soa sphere_bounds() const
+        {
+            return {x, y, z, r};
+        }
+
+        aabb3_soa box_bounds() const
+        {
+            return {x, y, z, ex, ey, ez};
+        }
+    };
+
+    frustum make_frustum(const vec3& dir)
+    {
+        const auto view = make_look_at_dir(vec3(0.0f), dir, vec3(0.0f, 0.0f, 1.0f));
+        const auto proj = make_perspective(1.2f, 16.0f / 9.0f, 0.1f, 150.0f);
+        return frustum::from_matrix(proj * view);
+    }
+} // namespace
+
+class frustum_culling_test : public unittest_scope
+{
+};
+
+TEST_F(frustum_culling_test, matches_single_object_tests)
+{
+    const scene   sc(1003);
+    const frustum f = make_frustum(vec3(1.0f, 0.0f, 0.0f));
+
+    std::vector<uint32> visible(sc.spheres.size());
+    const size_t        sphere_count = frustum_cull(f, sc.sphere_bounds(), visible);
+    std::vector<uint32> expected;
+    for (uint32 i = 0; i < sc.spheres.size(); ++i) {
+        if (f.contains_sphere(sc.spheres[i])) {
+            expected.push_back(i);
+        }
+    }
+    ASSERT_GT(expected.size(), 0u);
+    EXPECT_LT(expected.size(), sc.spheres.size());
+    visible.resize(sphere_count);
+    EXPECT_EQ(visible, expected);
+
+    visible.resize(sc.boxes.size());
+    const size_t box_count = frustum_cull(f, sc.box_bounds(), visible);
+    expected.clear();
+    for (uint32 i = 0; i < sc.boxes.size(); ++i) {
+        if (f.contains_aabb(sc.boxes[i])) {
+            expected.push_back(i);
+        }
+    }
+    visible.resize(box_count);
+    EXPECT_EQ(visible, expected);
+}
+
+TEST_F(frustum_culling_test, counts_around_groups_of_four)
+{
+    // Groups of four take the wide loop, the rest the scalar tail. Every third sphere is off
+    // to the side, so each group mixes visible and rejected lanes.
+    const frustum f = make_frustum(vec3(1.0f, 0.0f, 0.0f));
+    for (size_t n : {0u, 1u, 3u, 4u, 5u, 8u, 9u, 17u}) {
+        // One leading element, so the views are not 16-byte aligned
+        std::vector<float>  x(n + 1), y(n + 1), z(n + 1), r(n + 1);
+        std::vector<uint32> expected;
+        for (size_t i = 0; i < n; ++i) {
+            const sphere s(vec3(5.0f + 8.0f * static_cast<float>(i), i % 3 == 2 ? 300.0f : 0.0f, 1.0f), 2.0f);
+            x[i + 1] = s.center.x;
+            y[i + 1] = s.center.y;
+            z[i + 1] = s.center.z;
+            r[i + 1] = s.radius;
+            if (f.contains_sphere(s)) {
+                expected.push_back(static_cast<uint32>(i));
+            }
+        }
+
+        const sphere_soa bounds{
+            buffer_view<float>(x.data() + 1, n),
+            buffer_view<float>(y.data() + 1, n),
+            buffer_view<float>(z.data() + 1, n),
+            buffer_view<float>(r.data() + 1, n),
+        };
+
+        // The second pass starts from the planes cached by the first
+        std::vector<uint8>  cache(n, k_no_rejecting_plane);
+        std::vector<uint32> visible(n);
+        for (int pass = 0; pass < 2; ++pass) {
+            const size_t count = frustum_cull(f, bounds, visible, cache);
+            EXPECT_EQ(std::vector<uint32>(visible.begin(), visible.begin() + count), expected) << n;
+        }
+
+        std::vector<uint64> mask(1);
+        EXPECT_EQ(frustum_cull_mask(f, bounds, mask, cache), expected.size()) << n;
+        for (size_t i = 0, v = 0; i < n; ++i) {
+            const bool listed = v < expected.size() && expected[v] == i;
+            EXPECT_EQ(((mask[0] >> i) & 1) != 0, listed) << n << " " << i;
+            v += listed ? 1 : 0;
+        }
+    }
+}
+
+TEST_F(frustum_culling_test, mask_matches_indices)
+{
+    const scene   sc(130);
+    const frustum f = make_frustum(vec3(0.0f, 1.0f, 0.2f));
+
+    std::vector<uint32> visible(sc.boxes.size());
+    const size_t        count = frustum_cull(f, sc.box_bounds(), visible);
+
+    // Stale bits must be cleared
+    std::vector<uint64> mask(3, ~uint64(0));
+    EXPECT_EQ(frustum_cull_mask(f, sc.box_bounds(), mask), count);
+    for (size_t i = 0, v = 0; i < sc.boxes.size(); ++i) {
+        const bool bit = (mask[i / 64] >> (i % 64)) & 1;
+        const bool listed = v < count && visible[v] == i;
+        EXPECT_EQ(bit, listed) << i;
+        v += listed ? 1 : 0;
+    }
+    EXPECT_EQ(mask[2] >> (130 % 64), 0u);
+}
+
+TEST_F(frustum_culling_test, plane_cache_keeps_results)
+{
+    const scene          sc(515);
+    std::vector<uint8>   cache(sc.spheres.size(), k_no_rejecting_plane);
+    std::vector<uint32>  cached(sc.spheres.size());
+    std::vector<uint32>  uncached(sc.spheres.size());
+    const vec3           dirs[] = {vec3(1.0f, 0.0f, 0.0f), vec3(1.0f, 0.1f, 0.0f), vec3(0.0f, -1.0f, 0.0f), vec3(0.0f, -1.0f, 0.0f)};
+
+    for (const auto& dir : dirs) {
+        const frustum f = make_frustum(dir);
+        const size_t  a = frustum_cull(f, sc.sphere_bounds(), cached, cache);
+        const size_t  b = frustum_cull(f, sc.sphere_bounds(), uncached);
+        ASSERT_EQ(a, b);
+        EXPECT_TRUE(std::equal(cached.begin(), cached.begin() + a, uncached.begin()));
+    }
+
+    // Every rejected object remembers a plane that rejects it
+    const frustum f = make_frustum(dirs[3]);
+    for (size_t i = 0; i < sc.spheres.size(); ++i) {
+        if (!f.contains_sphere(sc.spheres[i])) {
+            ASSERT_LT(cache[i], 6);
+            const auto& p = f.planes[cache[i]];
+            EXPECT_LT(dot(p.normal, sc.spheres[i].center) + p.distance, -sc.spheres[i].radius);
+        }
+    }
+}
+
+TEST_F(frustum_culling_test, stress_cull_spheres)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr int rounds = 100;
+    const scene   sc(50'000);
+    const frustum f = make_frustum(vec3(1.0f, 0.3f, 0.1f));
+
+    std::vector<uint32> visible(sc.spheres.size());
+    std::vector<uint8>  cache(sc.spheres.size(), k_no_rejecting_plane);
+
+    tavros::core::timer tm;
+    size_t              single = 0;
+    for (int r = 0; r < rounds; ++r) {
+        single = 0;
+        for (uint32 i = 0; i < sc.spheres.size(); ++i) {
+            if (f.contains_sphere(sc.spheres[i])) {
+                visible[single++] = i;
+            }
+        }
+    }
+    const double single_s = tm.elapsed_seconds();
+
+    tm.restart();
+    size_t batch = 0;
+    for (int r = 0; r < rounds; ++r) {
+        batch = frustum_cull(f, sc.sphere_bounds(), visible);
+    }
+    const double batch_s = tm.elapsed_seconds();
+
+    tm.restart();
+    for (int r = 0; r < rounds; ++r) {
+        batch = frustum_cull(f, sc.sphere_bounds(), visible, cache);
+    }
+    const double cached_s = tm.elapsed_seconds();
+
+    EXPECT_EQ(single, batch);
+    std::printf("[ stress   ] cull %zu spheres (%zu visible): single %.1f us, batch %.1f us, cached %.1f us\n", sc.spheres.size(), batch, single_s * 1e6 / rounds, batch_s * 1e6 / rounds, cached_s * 1e6 / rounds);
+}
@@ -0,0 +1,215 @@
+#include <common.test.hpp>
+
+#include <tavros/core/io/buffered_stream_reader.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tavros::core;
+
+namespace
+{
+    // Seekable reader over memory that counts calls of the virtual read
+    class memory_reader final : public basic_stream_reader
+    {
+    public:
+        explicit memory_reader(std::string data)
+            : m_data(std::move(data))
+        {
+        }
+
+        size_t read(uint8* dst, size_t size) override
+        {
+            ++calls;
+            const size_t n = std::min(size, m_data.size() - m_pos);
+            std::memcpy(dst, m_data.data() + m_pos, n);
+            m_pos += n;
+            if (n < size) {
+                set_state(stream_state::eos);
+            }
+            return n;
+        }
+
+        bool seekable() const noexcept override
+        {
+            return true;
+        }
+
+        bool seek(ssize_t offset, seek_dir dir) noexcept override
+        {
+            TAV_ASSERT(dir == seek_dir::begin);
+            TAV_UNUSED(dir);
+            m_pos = static_cast<size_t>(offset);
+            set_state(stream_state::good);
+            return true;
+        }
+
+        ssize_t tell() const noexcept override
+        {
+            return static_cast<ssize_t>(m_pos);
+        }
+
+        size_t size() const noexcept override
+        {
+            return m_data.size();
+        }
+
+        size_t calls = 0;
+
+    private:
+        std::string m_data;
+        size_t      m_pos = 0;
+    };
+
+    std::string make_records(uint32 count)
+    {
+        std::string data;
+        for (uint32 i = 0; i < count; ++i) {
+            data.append(reinterpret_cast<const char*>(&i), sizeof(i));
+            data += "name_" + std::to_string(i);
+            data += '\0';
+        }
+        return data;
+    }
+} // namespace
+
+class buffered_stream_reader_test : public unittest_scope
+{
+};
+
+TEST_F(buffered_stream_reader_test, small_reads_share_source_calls)
+{
+    memory_reader          source(make_records(1000));
+    buffered_stream_reader reader(source, 4096);
+
+    for (uint32 i = 0; i < 1000; ++i) {
+        ASSERT_EQ(reader.read_as<uint32>(), i);
+        ASSERT_EQ(reader.read_as_zstr(), "name_" + std::to_string(i));
+    }
+    EXPECT_TRUE(reader.good());
+    EXPECT_EQ(reader.tell(), static_cast<ssize_t>(source.size()));
+    EXPECT_LT(source.calls, source.size() / 4096 + 3);
+
+    EXPECT_EQ(reader.read_as<uint32>(), 0u);
+    EXPECT_TRUE(reader.eos());
+}
+
+TEST_F(buffered_stream_reader_test, read_span_and_large_reads)
+{
+    std::vector<uint32> values(1000);
+    for (uint32 i = 0; i < values.size(); ++i) {
+        values[i] = i * 3;
+    }
+    memory_reader          source(std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(uint32)));
+    buffered_stream_reader reader(source, 64);
+
+    uint32 first[4] = {};
+    EXPECT_EQ(reader.read_span(buffer_span<uint32>(first)), 4u);
+    EXPECT_EQ(first[3], 9u);
+
+    // Larger than the window, goes straight to the source
+    const size_t calls = source.calls;
+    auto         rest = reader.read_span_as<uint32>(990);
+    ASSERT_EQ(rest.capacity(), 990u);
+    EXPECT_EQ(rest[0], 12u);
+    EXPECT_EQ(rest[989], 993u * 3);
+    EXPECT_EQ(source.calls, calls + 1);
+
+    uint32 tail[8] = {};
+    EXPECT_EQ(reader.read_span(buffer_span<uint32>(tail)), 6u);
+    EXPECT_EQ(tail[5], 999u * 3);
+    EXPECT_TRUE(reader.eos());
+}
+
+TEST_F(buffered_stream_reader_test, strings_cross_window_boundaries)
+{
+    std::string data = "first string";
+    data += '\0';
+    data += "second";
+    data += '\0';
+    data += "too long for fixed";
+    data += '\0';
+    data += "unterminated";
+
+    memory_reader          source(data);
+    buffered_stream_reader reader(source, 5);
+
+    EXPECT_EQ(reader.read_as_zstr(), "first string");
+    EXPECT_EQ(reader.read_as_zstr<8>(), "second");
+    EXPECT_TRUE(reader.good());
+
+    EXPECT_EQ(reader.read_as_zstr<8>(), "too lon");
+    EXPECT_TRUE(reader.bad());
+
+    // A missing terminator is corrupt data, the same as for the base class
+    memory_reader          source2("unterminated");
+    buffered_stream_reader reader2(source2, 5);
+    EXPECT_EQ(reader2.read_as_zstr(), "unterminated");
+    EXPECT_TRUE(reader2.bad());
+}
+
+TEST_F(buffered_stream_reader_test, peek_and_seek)
+{
+    memory_reader          source("MAGIC0123456789abcdef");
+    buffered_stream_reader reader(source, 8);
+
+    const auto magic = reader.peek(5);
+    ASSERT_EQ(magic.size(), 5u);
+    EXPECT_EQ(std::memcmp(magic.data(), "MAGIC", 5), 0);
+    EXPECT_EQ(reader.tell(), 0);
+
+    // Within the window
+    const size_t calls = source.calls;
+    EXPECT_TRUE(reader.seek(5));
+    EXPECT_EQ(reader.read_as<char>(), '0');
+    EXPECT_EQ(source.calls, calls);
+
+    // Outside the window, then past the end and back
+    EXPECT_TRUE(reader.seek(-2, seek_dir::end));
+    EXPECT_EQ(reader.tell(), 19);
+    EXPECT_EQ(reader.peek(8).size(), 2u);
+    EXPECT_EQ(reader.read_as<uint32>(), 0u);
+    EXPECT_TRUE(reader.eos());
+
+    EXPECT_TRUE(reader.seek(-4, seek_dir::current));
+    EXPECT_TRUE(reader.good());
+    EXPECT_EQ(reader.read_as<char>(), 'c');
+    EXPECT_FALSE(reader.seek(-100, seek_dir::current));
+}
+
+TEST_F(buffered_stream_reader_test, stress_parse_records)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr uint32 k_records = 200'000;
+    const auto       data = make_records(k_records);
+
+    const auto parse = [](basic_stream_reader& reader, auto read_zstr) {
+        size_t total = 0;
+        for (uint32 i = 0; i < k_records; ++i) {
+            total += reader.read_as<uint32>();
+            total += read_zstr().size();
+        }
+        return total;
+    };
+
+    memory_reader plain_source(data);
+    timer         tm;
+    const size_t  plain_total = parse(plain_source, [&] { return plain_source.read_as_zstr(); });
+    const auto    plain_us = tm.elapsed<std::chrono::microseconds>().count();
+
+    memory_reader          buffered_source(data);
+    buffered_stream_reader reader(buffered_source);
+    tm.restart();
+    const size_t buffered_total = parse(reader, [&] { return reader.read_as_zstr(); });
+    const auto   buffered_us = tm.elapsed<std::chrono::microseconds>().count();
+
+    EXPECT_EQ(plain_total, buffered_total);
+    std::printf("[ stress   ] %u records: plain %lld us (%zu reads), buffered %lld us (%zu reads)\n", k_records, static_cast<long long>(plain_us), plain_source.calls, static_cast<long long>(buffered_us), buffered_source.calls);
+}
@@ -0,0 +1,90 @@
+#include <common.test.hpp>
+
+#include <tavros/core/exception.hpp>
+#include <tavros/core/io/mapped_file_reader.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace tavros::core;
+
+class mapped_file_reader_test : public unittest_scope
+{
+protected:
+    void SetUp() override
+    {
+        unittest_scope::SetUp();
+        dir = std::filesystem::temp_directory_path() / "tavros_mapped_file_reader_test";
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::string write_file(const char* name, const std::string& content)
+    {
+        const auto    path = (dir / name).string();
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        return path;
+    }
+
+    std::filesystem::path dir;
+};
+
+TEST_F(mapped_file_reader_test, view_exposes_whole_file)
+{
+    std::string content(100'000, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i * 7);
+    }
+    mapped_file_reader reader(write_file("a.bin", content));
+
+    const auto view = reader.view();
+    ASSERT_EQ(view.size(), content.size());
+    EXPECT_EQ(reader.size(), content.size());
+    EXPECT_EQ(std::memcmp(view.data(), content.data(), content.size()), 0);
+}
+
+TEST_F(mapped_file_reader_test, read_and_seek)
+{
+    mapped_file_reader reader(write_file("b.bin", "0123456789"));
+
+    uint8 buf[16] = {};
+    EXPECT_EQ(reader.read(buf, 4), 4u);
+    EXPECT_EQ(std::memcmp(buf, "0123", 4), 0);
+    EXPECT_EQ(reader.tell(), 4);
+
+    EXPECT_TRUE(reader.seek(-3, seek_dir::end));
+    EXPECT_EQ(reader.read(buf, 16), 3u);
+    EXPECT_EQ(std::memcmp(buf, "789", 3), 0);
+    EXPECT_TRUE(reader.eos());
+
+    EXPECT_FALSE(reader.seek(11));
+    EXPECT_TRUE(reader.seek(2));
+    EXPECT_TRUE(reader.good());
+    EXPECT_EQ(reader.read(buf, 2), 2u);
+    EXPECT_EQ(std::memcmp(buf, "23", 2), 0);
+}
+
+TEST_F(mapped_file_reader_test, empty_file_has_empty_view)
+{
+    mapped_file_reader reader(write_file("empty.bin", ""));
+
+    EXPECT_EQ(reader.size(), 0u);
+    EXPECT_TRUE(reader.view().empty());
+
+    uint8 buf[4];
+    EXPECT_EQ(reader.read(buf, 4), 0u);
+    EXPECT_TRUE(reader.eos());
+}
+
+TEST_F(mapped_file_reader_test, missing_file_throws)
+{
+    EXPECT_THROW(mapped_file_reader((dir / "missing.bin").string()), file_error);
+    EXPECT_THROW(mapped_file_reader(dir.string()), file_error);
+}
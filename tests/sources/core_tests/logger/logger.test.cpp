@@ -0,0 +1,227 @@
+#include <common.test.hpp>
+
+#include <tavros/core/logger/logger.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace tavros::core;
+
+namespace
+{
+    // Consumers cannot be removed, so one consumer is installed for the whole test binary
+    struct captured_log
+    {
+        std::mutex                                       mutex;
+        std::vector<std::pair<std::string, std::string>> messages; // tag, text after the prefix
+        std::atomic_bool                                 gate_closed = false;
+        std::atomic_bool                                 terminated = true;
+    };
+
+    captured_log g_captured;
+
+    void install_consumer()
+    {
+        static const bool installed = [] {
+            logger::add_consumer([](severity_level, string_view tag, string_view msg) {
+                if (!tag.starts_with("logger_test")) {
+                    return;
+                }
+                if (msg.data()[msg.size()] != '\0') {
+                    g_captured.terminated = false;
+                }
+                while (tag == "logger_test_gate" && g_captured.gate_closed.load()) {
+                    std::this_thread::yield();
+                }
+                if (tag == "logger_test_slow") {
+                    std::this_thread::sleep_for(std::chrono::microseconds(20)); // console-like I/O
+                }
+
+                // Strip the "[tavros|time|level][tag] " prefix
+                const auto text = msg.substr(msg.find("] ") + 2);
+                std::lock_guard lock(g_captured.mutex);
+                g_captured.messages.emplace_back(std::string(tag), std::string(text));
+            });
+            return true;
+        }();
+        TAV_UNUSED(installed);
+    }
+
+    std::vector<std::pair<std::string, std::string>> take_messages()
+    {
+        std::lock_guard lock(g_captured.mutex);
+        return std::exchange(g_captured.messages, {});
+    }
+} // namespace
+
+class logger_test : public unittest_scope
+{
+protected:
+    void SetUp() override
+    {
+        unittest_scope::SetUp();
+        install_consumer();
+        take_messages();
+    }
+
+    void TearDown() override
+    {
+        logger::stop_async();
+        logger::set_rate_limit(0);
+        g_captured.gate_closed = false;
+    }
+};
+
+TEST_F(logger_test, async_keeps_order_of_each_thread)
+{
+    logger::start_async(logger::overflow_policy::block, 64 * 1024);
+
+    constexpr int k_threads = 4;
+    constexpr int k_messages = 1000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t) {
+        threads.emplace_back([t] {
+            logger l("logger_test");
+            for (int i = 0; i < k_messages; ++i) {
+                l.info("{} {}", t, i);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    logger::drain();
+
+    const auto messages = take_messages();
+    ASSERT_EQ(messages.size(), static_cast<size_t>(k_threads * k_messages));
+
+    std::vector<int> next(k_threads, 0);
+    for (const auto& [tag, text] : messages) {
+        int t = -1;
+        int i = -1;
+        ASSERT_EQ(std::sscanf(text.c_str(), "%d %d", &t, &i), 2);
+        ASSERT_EQ(i, next[t]++);
+    }
+    EXPECT_TRUE(g_captured.terminated.load());
+}
+
+TEST_F(logger_test, async_passes_long_messages_intact)
+{
+    logger::start_async();
+
+    const std::string long_text(3000, 'x');
+    logger::print_info("logger_test", "{}|{}", long_text, "end");
+    logger::print_info("logger_test", "short");
+    logger::drain();
+
+    const auto messages = take_messages();
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0].second, long_text + "|end");
+    EXPECT_EQ(messages[1].second, "short");
+    EXPECT_TRUE(g_captured.terminated.load());
+}
+
+TEST_F(logger_test, full_queue_drops_and_reports)
+{
+    logger::start_async(logger::overflow_policy::drop, 16 * 1024);
+
+    // The writer stalls on the first message, so the queue fills up
+    g_captured.gate_closed = true;
+    logger::print_info("logger_test_gate", "gate");
+    for (int i = 0; i < 1000; ++i) {
+        logger::print_info("logger_test", "message {}", i);
+    }
+
+    const uint64 dropped = logger::dropped_messages();
+    EXPECT_GT(dropped, 0u);
+
+    g_captured.gate_closed = false;
+    logger::drain();
+
+    const auto messages = take_messages();
+    ASSERT_GT(messages.size(), 1u);
+    EXPECT_EQ(messages.size(), 1u + 1000u - dropped);
+    EXPECT_EQ(messages[0].second, "gate");
+    EXPECT_EQ(messages[1].second, "message 0");
+}
+
+TEST_F(logger_test, fatal_waits_for_consumers)
+{
+    logger::start_async();
+
+    for (int i = 0; i < 100; ++i) {
+        logger::print_info("logger_test", "message {}", i);
+    }
+    logger::print_fatal("logger_test", "fatal");
+
+    // No drain: the fatal message and everything before it already reached the consumer
+    const auto messages = take_messages();
+    ASSERT_EQ(messages.size(), 101u);
+    EXPECT_EQ(messages.back().second, "fatal");
+}
+
+TEST_F(logger_test, rate_limit_suppresses_storm)
+{
+    logger::set_rate_limit(10);
+
+    // Wait for the start of a second, so the storm does not cross a second boundary
+    while (std::chrono::steady_clock::now().time_since_epoch() % std::chrono::seconds(1) > std::chrono::milliseconds(500)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        logger::print_warning("logger_test_storm", "storm {}", i);
+    }
+    logger::print_fatal("logger_test_storm", "fatal is not limited");
+    logger::print_info("logger_test_other", "other tags are not affected");
+
+    auto messages = take_messages();
+    ASSERT_EQ(messages.size(), 12u);
+    EXPECT_EQ(messages[9].second, "storm 9");
+    EXPECT_EQ(messages[10].second, "fatal is not limited");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    logger::print_warning("logger_test_storm", "after storm");
+
+    messages = take_messages();
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0].second, "90 messages suppressed by the rate limit");
+    EXPECT_EQ(messages[1].second, "after storm");
+}
+
+TEST_F(logger_test, stress_async_producer_latency)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr int k_messages = 5000;
+
+    // Messages with this tag take the consumer as long as console output, which a synchronous caller waits for
+    const auto measure = [&](bool async) {
+        if (async) {
+            logger::start_async(logger::overflow_policy::block, 16 * 1024 * 1024);
+        }
+        timer tm;
+        for (int i = 0; i < k_messages; ++i) {
+            logger::print_info("logger_test_slow", "message {} with some payload {:.3f}", i, i * 0.5);
+        }
+        const auto producer_us = tm.elapsed<std::chrono::microseconds>().count();
+        logger::drain();
+        logger::stop_async();
+        take_messages();
+        return static_cast<double>(producer_us) * 1000.0 / k_messages;
+    };
+
+    const double sync_ns = measure(false);
+    const double async_ns = measure(true);
+    std::printf("[ stress   ] producer cost per message: sync %.1f ns, async %.1f ns\n", sync_ns, async_ns);
+}
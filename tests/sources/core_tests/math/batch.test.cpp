@@ -0,0 +1,286 @@
+#include <common.test.hpp>
+
+#include <tavros/core/math.hpp>
+#include <tavros/core/math/simd/float4.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace tavros::math;
+using tavros::core::buffer_span;
+using tavros::core::buffer_view;
+
+namespace
+{
+    std::mt19937 g_rng(11);
+
+    float random_float(float lo = -10.0f, float hi = 10.0f)
+    {
+        return std::uniform_real_distribution<float>(lo, hi)(g_rng);
+    }
+
+    template<class T>
+    std::vector<T> random_array(size_t size)
+    {
+        std::vector<T> v(size);
+        for (auto& e : v) {
+            for (size_t c = 0; c < sizeof(T) / sizeof(float); ++c) {
+                e.data()[c] = random_float();
+            }
+        }
+        return v;
+    }
+
+    mat4 random_mat4()
+    {
+        mat4 m;
+        for (size_t c = 0; c < 4; ++c) {
+            m[c] = vec4(random_float(-2.0f, 2.0f), random_float(-2.0f, 2.0f), random_float(-2.0f, 2.0f), random_float(-2.0f, 2.0f));
+        }
+        return m;
+    }
+
+    // Sizes around the 4-wide blocks, so both the wide loop and the tail are covered
+    constexpr size_t k_sizes[] = {0, 1, 3, 4, 7, 37};
+} // namespace
+
+class batch_test : public unittest_scope
+{
+};
+
+TEST_F(batch_test, transforms_match_single_values)
+{
+    const auto m = random_mat4();
+    for (size_t size : k_sizes) {
+        const auto points = random_array<vec3>(size);
+
+        std::vector<vec3> out(size);
+        transform_points(m, points, out);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_TRUE(almost_equal(out[i], (m * vec4(points[i], 1.0f)).xyz, 1e-4f));
+        }
+
+        transform_vectors(m, points, out);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_TRUE(almost_equal(out[i], (m * vec4(points[i], 0.0f)).xyz, 1e-4f));
+        }
+
+        const auto        points4 = random_array<vec4>(size);
+        std::vector<vec4> out4(size);
+        transform_points(m, points4, out4);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_TRUE(almost_equal(out4[i], m * points4[i], 1e-4f));
+        }
+    }
+}
+
+TEST_F(batch_test, soa_and_2d_transforms)
+{
+    const auto m = random_mat4();
+    const auto points = random_array<vec3>(37);
+
+    std::vector<float> x, y, z;
+    for (const auto& p : points) {
+        x.push_back(p.x);
+        y.push_back(p.y);
+        z.push_back(p.z);
+    }
+    std::vector<float> ox(x.size()), oy(x.size()), oz(x.size());
+    transform_points_soa(m, x, y, z, ox, oy, oz);
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_TRUE(almost_equal(vec3(ox[i], oy[i], oz[i]), (m * vec4(points[i], 1.0f)).xyz, 1e-4f));
+    }
+
+    // Rotation by 90 degrees, scale by 2 and translation by (10, 20)
+    const mat3 affine(0.0f, 2.0f, 0.0f, -2.0f, 0.0f, 0.0f, 10.0f, 20.0f, 1.0f);
+    for (size_t size : k_sizes) {
+        const auto        points2 = random_array<vec2>(size);
+        std::vector<vec2> out(size);
+        transform_points_2d(affine, points2, out);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_TRUE(almost_equal(out[i], vec2(10.0f - 2.0f * points2[i].y, 20.0f + 2.0f * points2[i].x), 1e-4f));
+        }
+    }
+}
+
+TEST_F(batch_test, normalize_and_dot)
+{
+    for (size_t size : k_sizes) {
+        auto a = random_array<vec3>(size);
+        auto b = random_array<vec3>(size);
+
+        std::vector<float> dots(size);
+        dot_many(a, b, dots);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_NEAR(dots[i], dot(a[i], b[i]), 1e-3f);
+        }
+
+        if (size > 2) {
+            a[2] = vec3(0.0f);
+        }
+        const auto expected = a;
+
+        // In place
+        normalize_many(a, a);
+        for (size_t i = 0; i < size; ++i) {
+            if (i == 2) {
+                EXPECT_TRUE(almost_equal(a[i], vec3(0.0f, 0.0f, 1.0f)));
+            } else {
+                EXPECT_TRUE(almost_equal(a[i], normalize(expected[i]), 1e-5f));
+            }
+        }
+    }
+}
+
+TEST_F(batch_test, simd_transposes_round_trip)
+{
+#if TAV_MATH_SIMD_ENABLED
+    using namespace tavros::math::simd;
+
+    float src[12];
+    for (int i = 0; i < 12; ++i) {
+        src[i] = static_cast<float>(i);
+    }
+
+    // Lane i holds element i, components are split across registers
+    float          lanes[4];
+    const float4x3 v3 = load3(src);
+    const float4   components3[] = {v3.x, v3.y, v3.z};
+    for (size_t c = 0; c < 3; ++c) {
+        store(lanes, components3[c]);
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_EQ(lanes[i], src[i * 3 + c]);
+        }
+    }
+
+    const float4x2 v2 = load2(src);
+    const float4   components2[] = {v2.x, v2.y};
+    for (size_t c = 0; c < 2; ++c) {
+        store(lanes, components2[c]);
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_EQ(lanes[i], src[i * 2 + c]);
+        }
+    }
+
+    float dst[12] = {};
+    store3(dst, v3);
+    EXPECT_TRUE(std::equal(dst, dst + 12, src));
+    std::fill(dst, dst + 12, -1.0f);
+    store2(dst, v2);
+    EXPECT_TRUE(std::equal(dst, dst + 8, src));
+    EXPECT_EQ(dst[8], -1.0f);
+#else
+    GTEST_SKIP() << "SIMD kernels are disabled in this build";
+#endif
+}
+
+TEST_F(batch_test, unaligned_arrays)
+{
+    // Views starting one element in are not 16-byte aligned, the wide loops must not assume it
+    const auto m = random_mat4();
+    const auto points = random_array<vec3>(38);
+    const auto view = buffer_view<vec3>(points.data() + 1, points.size() - 1);
+
+    std::vector<vec3> out(points.size());
+    transform_points(m, view, buffer_span<vec3>(out.data() + 1, view.size()));
+    for (size_t i = 0; i < view.size(); ++i) {
+        EXPECT_TRUE(almost_equal(out[i + 1], (m * vec4(view[i], 1.0f)).xyz, 1e-4f));
+    }
+
+    const auto        points2 = random_array<vec2>(38);
+    std::vector<vec2> out2(points2.size());
+    const mat3        affine(1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 3.0f, -4.0f, 1.0f);
+    transform_points_2d(affine, buffer_view<vec2>(points2.data() + 1, 37), buffer_span<vec2>(out2.data() + 1, 37));
+    for (size_t i = 1; i < points2.size(); ++i) {
+        EXPECT_TRUE(almost_equal(out2[i], points2[i] + vec2(3.0f, -4.0f), 1e-4f));
+    }
+
+    std::vector<float> x(38), y(38), z(38), ox(38), oy(38), oz(38);
+    for (size_t i = 0; i < points.size(); ++i) {
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+    transform_points_soa(
+        m,
+        buffer_view<float>(x.data() + 1, 37),
+        buffer_view<float>(y.data() + 1, 37),
+        buffer_view<float>(z.data() + 1, 37),
+        buffer_span<float>(ox.data() + 1, 37),
+        buffer_span<float>(oy.data() + 1, 37),
+        buffer_span<float>(oz.data() + 1, 37)
+    );
+    for (size_t i = 1; i < points.size(); ++i) {
+        EXPECT_TRUE(almost_equal(vec3(ox[i], oy[i], oz[i]), (m * vec4(points[i], 1.0f)).xyz, 1e-4f));
+    }
+}
+
+TEST_F(batch_test, lerp_many_blends_frames)
+{
+    for (size_t size : k_sizes) {
+        const auto        a = random_array<vec3>(size);
+        const auto        b = random_array<vec3>(size);
+        std::vector<vec3> out(size);
+        lerp_many(a, b, 0.25f, out);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_TRUE(almost_equal(out[i], lerp(a[i], b[i], 0.25f), 1e-4f));
+        }
+
+        const auto        a2 = random_array<vec2>(size);
+        const auto        b2 = random_array<vec2>(size);
+        std::vector<vec2> out2(size);
+        lerp_many(a2, b2, 0.75f, out2);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_TRUE(almost_equal(out2[i], lerp(a2[i], b2[i], 0.75f), 1e-4f));
+        }
+    }
+}
+
+TEST_F(batch_test, stress_transform_points)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t count = 1 << 16;
+    constexpr int    rounds = 64;
+
+    const auto        m = random_mat4();
+    const auto        points = random_array<vec3>(count);
+    std::vector<vec3> out(count);
+
+    tavros::core::timer tm;
+    for (int r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = (m * vec4(points[i], 1.0f)).xyz;
+        }
+    }
+    const double single_s = tm.elapsed_seconds();
+    float        checksum = out[count - 1].x;
+
+    tm.restart();
+    for (int r = 0; r < rounds; ++r) {
+        transform_points(m, points, out);
+    }
+    const double aos_s = tm.elapsed_seconds();
+    checksum += out[count - 1].x;
+
+    std::vector<float> x(count), y(count), z(count);
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+    std::vector<float> ox(count), oy(count), oz(count);
+    tm.restart();
+    for (int r = 0; r < rounds; ++r) {
+        transform_points_soa(m, x, y, z, ox, oy, oz);
+    }
+    const double soa_s = tm.elapsed_seconds();
+    checksum += ox[count - 1];
+
+    std::printf("[ stress   ] transform %zu points: single %.2f ms, aos %.2f ms, soa %.2f ms, checksum %f\n", count, single_s * 1000.0 / rounds, aos_s * 1000.0 / rounds, soa_s * 1000.0 / rounds, checksum);
+}
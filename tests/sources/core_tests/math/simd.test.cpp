@@ -0,0 +1,142 @@
+#include <common.test.hpp>
+
+#include <tavros/core/math.hpp>
+#include <tavros/core/math/simd/simd.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace tavros::math;
+
+namespace
+{
+    std::mt19937 g_rng(7);
+
+    float random_float(float lo = -2.0f, float hi = 2.0f)
+    {
+        return std::uniform_real_distribution<float>(lo, hi)(g_rng);
+    }
+
+    mat4 random_mat4()
+    {
+        mat4 m;
+        for (size_t c = 0; c < 4; ++c) {
+            m[c] = vec4(random_float(), random_float(), random_float(), random_float());
+        }
+        return m;
+    }
+
+    quat random_quat()
+    {
+        return normalize(quat(random_float(), random_float(), random_float(), random_float()));
+    }
+
+    // Well conditioned transform: rotation, scale and translation
+    mat4 random_transform()
+    {
+        const auto r = make_mat3(random_quat());
+        const auto s = vec3(random_float(0.5f, 2.0f), random_float(0.5f, 2.0f), random_float(0.5f, 2.0f));
+        mat4       m = mat4::identity();
+        for (size_t c = 0; c < 3; ++c) {
+            m[c] = vec4(r[c] * s[c], 0.0f);
+        }
+        m[3] = vec4(random_float(), random_float(), random_float(), 1.0f);
+        return m;
+    }
+} // namespace
+
+// Constant evaluation must keep working with the SIMD layer enabled
+static_assert((mat4(2.0f) * vec4(1.0f, 2.0f, 3.0f, 4.0f)).w == 8.0f);
+static_assert((quat::identity() * quat::identity()).w == 1.0f);
+
+class simd_test : public unittest_scope
+{
+};
+
+TEST_F(simd_test, kernels_are_built)
+{
+#if !(TAV_MATH_SIMD)
+    GTEST_SKIP() << "SIMD kernels are disabled in this build, configure with TAV_ENABLE_MATH_SIMD=ON";
+#elif TAV_ARCH_X64 || TAV_ARCH_ARM64
+    // Every 64-bit target has a backend, the tests below compare it with the scalar code
+    EXPECT_TRUE(TAV_MATH_SIMD_ENABLED);
+#endif
+}
+
+TEST_F(simd_test, mat4_products_match_scalar)
+{
+    for (int i = 0; i < 1000; ++i) {
+        const auto a = random_mat4();
+        const auto b = random_mat4();
+        const auto v = vec4(random_float(), random_float(), random_float(), random_float());
+        EXPECT_TRUE(almost_equal(a * b, scalar::mul(a, b), 1e-5f));
+        EXPECT_TRUE(almost_equal(a * v, scalar::mul(a, v), 1e-5f));
+    }
+}
+
+TEST_F(simd_test, mat4_inverse_matches_scalar)
+{
+    for (int i = 0; i < 1000; ++i) {
+        const auto m = random_transform();
+        const auto inv = inverse(m);
+        EXPECT_TRUE(almost_equal(inv, scalar::inverse(m), 1e-4f));
+        EXPECT_TRUE(almost_equal(m * inv, mat4::identity(), 1e-4f));
+    }
+}
+
+TEST_F(simd_test, quat_ops_match_scalar)
+{
+    for (int i = 0; i < 1000; ++i) {
+        const auto a = random_quat();
+        const auto b = random_quat();
+        EXPECT_TRUE(almost_equal(a * b, scalar::mul(a, b), 1e-5f));
+
+        const float coef = random_float(0.0f, 1.0f);
+        EXPECT_TRUE(almost_equal(slerp(a, b, coef), scalar::slerp(a, b, coef), 1e-4f));
+    }
+
+    // Nearly parallel and opposite quaternions take the special paths
+    const auto q = random_quat();
+    EXPECT_TRUE(almost_equal(slerp(q, q, 0.3f), scalar::slerp(q, q, 0.3f), 1e-5f));
+    EXPECT_TRUE(almost_equal(slerp(q, -q, 0.3f), scalar::slerp(q, -q, 0.3f), 1e-5f));
+}
+
+TEST_F(simd_test, stress_mat4_multiply)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t  count = 1 << 16;
+    std::vector<mat4> mats(count);
+    for (auto& m : mats) {
+        m = random_transform();
+    }
+
+    // Typical use: one view-projection matrix applied to every model matrix
+    const auto        view_proj = random_transform();
+    std::vector<mat4> out(count);
+    constexpr int     rounds = 64;
+
+    tavros::core::timer tm;
+    for (int r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = scalar::mul(view_proj, mats[i]);
+        }
+    }
+    const double scalar_s = tm.elapsed_seconds();
+    float        checksum = out[count - 1][0][0];
+
+    tm.restart();
+    for (int r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = view_proj * mats[i];
+        }
+    }
+    const double simd_s = tm.elapsed_seconds();
+    checksum += out[count - 1][0][0];
+
+    std::printf("[ stress   ] mat4 * mat4: scalar %.2f ms, operator %.2f ms (simd %s), checksum %f\n", scalar_s * 1000.0, simd_s * 1000.0, TAV_MATH_SIMD_ENABLED ? "on" : "off", checksum);
+}
@@ -0,0 +1,91 @@
+#include <common.test.hpp>
+
+#include <tavros/core/thread/thread_pool.hpp>
+
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace tavros::core;
+
+class thread_pool_test : public unittest_scope
+{
+};
+
+TEST_F(thread_pool_test, run_visits_every_index_once)
+{
+    thread_pool pool(3);
+    EXPECT_EQ(pool.concurrency(), 4u);
+
+    for (size_t n : {0u, 1u, 7u, 1000u}) {
+        std::vector<std::atomic_int> hits(n);
+        pool.run(n, [&](size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+        for (auto& h : hits) {
+            ASSERT_EQ(h.load(), 1);
+        }
+    }
+}
+
+TEST_F(thread_pool_test, tasks_run_on_several_threads)
+{
+    thread_pool pool(3);
+
+    std::mutex                  mutex;
+    std::set<std::thread::id>   ids;
+    std::atomic_int             arrived = 0;
+    pool.run(4, [&](size_t) {
+        {
+            std::lock_guard lock(mutex);
+            ids.insert(std::this_thread::get_id());
+        }
+        // Hold every task until all of them started, so each one runs on its own thread
+        arrived.fetch_add(1);
+        while (arrived.load() < 4) {
+            std::this_thread::yield();
+        }
+    });
+    EXPECT_EQ(ids.size(), 4u);
+}
+
+TEST_F(thread_pool_test, nested_run_executes_inline)
+{
+    thread_pool      pool(2);
+    std::atomic_int  total = 0;
+
+    pool.run(8, [&](size_t) {
+        pool.run(8, [&](size_t) { total.fetch_add(1); });
+    });
+    EXPECT_EQ(total.load(), 64);
+}
+
+TEST_F(thread_pool_test, first_exception_is_rethrown_after_the_batch)
+{
+    thread_pool     pool(2);
+    std::atomic_int done = 0;
+
+    EXPECT_THROW(pool.run(100, [&](size_t i) {
+        if (i == 10) {
+            throw std::runtime_error("task failed");
+        }
+        done.fetch_add(1);
+    }),
+                 std::runtime_error);
+    EXPECT_EQ(done.load(), 99);
+
+    // The pool stays usable
+    pool.run(10, [&](size_t) { done.fetch_add(1); });
+    EXPECT_EQ(done.load(), 109);
+}
+
+TEST_F(thread_pool_test, zero_workers_run_on_the_caller)
+{
+    thread_pool pool(0);
+    const auto  caller = std::this_thread::get_id();
+    bool        same_thread = true;
+
+    pool.run(16, [&](size_t) { same_thread = same_thread && std::this_thread::get_id() == caller; });
+    EXPECT_TRUE(same_thread);
+    EXPECT_EQ(pool.concurrency(), 1u);
+}
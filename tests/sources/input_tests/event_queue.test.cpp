@@ -0,0 +1,138 @@
+#include <common.test.hpp>
+
+#include <tavros/input/event_queue.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace tavros::input;
+
+namespace
+{
+    event_args make_event(uint64 producer, uint64 seq)
+    {
+        event_args e;
+        e.type = event_type::mouse_move;
+        e.time_us = seq;
+        e.key_char = static_cast<int32>(producer);
+        return e;
+    }
+} // namespace
+
+class event_queue_test : public unittest_scope
+{
+};
+
+TEST_F(event_queue_test, swap_publishes_pushed_events)
+{
+    event_queue q(8);
+    EXPECT_TRUE(q.front_queue().empty());
+
+    for (uint64 i = 0; i < 5; ++i) {
+        q.push_event(make_event(0, i));
+    }
+    EXPECT_TRUE(q.front_queue().empty());
+
+    q.swap_queues();
+    auto events = q.front_queue();
+    ASSERT_EQ(events.size(), 5u);
+    for (uint64 i = 0; i < 5; ++i) {
+        EXPECT_EQ(events[i].time_us, i);
+    }
+
+    q.swap_queues();
+    EXPECT_TRUE(q.front_queue().empty());
+}
+
+TEST_F(event_queue_test, overflow_keeps_events_in_order_and_grows)
+{
+    event_queue q(4, 64);
+
+    for (uint64 i = 0; i < 20; ++i) {
+        q.push_event(make_event(0, i));
+    }
+    q.swap_queues();
+
+    auto events = q.front_queue();
+    ASSERT_EQ(events.size(), 20u);
+    for (uint64 i = 0; i < 20; ++i) {
+        EXPECT_EQ(events[i].time_us, i);
+    }
+
+    // Both buffers grow once they have been consumed after an overflow
+    for (uint64 i = 0; i < 20; ++i) {
+        q.push_event(make_event(0, i));
+    }
+    q.swap_queues();
+    q.swap_queues();
+    EXPECT_EQ(q.capacity(), 32u);
+    EXPECT_EQ(q.max_capacity(), 64u);
+}
+
+TEST_F(event_queue_test, concurrent_producers_lose_no_events)
+{
+    constexpr uint64 k_producers = 4;
+    constexpr uint64 k_events = 20000;
+
+    event_queue              q(64, 1024);
+    std::atomic_bool         done = false;
+    std::vector<std::thread> producers;
+    for (uint64 p = 0; p < k_producers; ++p) {
+        producers.emplace_back([&q, p] {
+            for (uint64 i = 0; i < k_events; ++i) {
+                q.push_event(make_event(p, i));
+            }
+        });
+    }
+
+    std::vector<uint64> next(k_producers, 0);
+    auto                consume = [&] {
+        q.swap_queues();
+        for (const auto& e : q.front_queue()) {
+            auto& expected = next[static_cast<size_t>(e.key_char)];
+            ASSERT_EQ(e.time_us, expected); // per-producer order is preserved
+            ++expected;
+        }
+    };
+
+    std::thread watcher([&] {
+        for (auto& t : producers) {
+            t.join();
+        }
+        done = true;
+    });
+    while (!done) {
+        consume();
+    }
+    watcher.join();
+    consume();
+
+    for (uint64 p = 0; p < k_producers; ++p) {
+        EXPECT_EQ(next[p], k_events);
+    }
+}
+
+TEST_F(event_queue_test, stress_push_throughput)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr uint64 k_events = 8000; // one second of an 8 kHz mouse
+    constexpr size_t k_rounds = 1000;
+
+    event_queue         q;
+    tavros::core::timer t;
+    for (size_t r = 0; r < k_rounds; ++r) {
+        for (uint64 i = 0; i < k_events; ++i) {
+            q.push_event(make_event(0, i));
+        }
+        q.swap_queues();
+        ASSERT_EQ(q.front_queue().size(), k_events);
+    }
+    const double ns = static_cast<double>(t.elapsed<std::chrono::nanoseconds>().count()) / (k_events * k_rounds);
+    std::printf("[ stress   ] push + swap: %.1f ns/event, capacity %zu\n", ns, q.capacity());
+}
@@ -0,0 +1,429 @@
+#include <common.test.hpp>
+
+#include <tavros/renderer/rhi/recording_command_queue.hpp>
+#include <tavros/core/thread/thread_pool.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace tavros::renderer::rhi;
+
+namespace
+{
+    // Writes every call it receives as a line of text
+    class tracing_command_queue final : public command_queue
+    {
+    public:
+        void bind_pipeline(pipeline_handle pipeline) override
+        {
+            trace("bind_pipeline", pipeline.id);
+        }
+
+        void bind_vertex_buffers(tavros::core::buffer_view<bind_buffer_info> buffers) override
+        {
+            for (const auto& b : buffers) {
+                trace("bind_vertex_buffer", b.buffer.id, b.base_offset);
+            }
+        }
+
+        void bind_index_buffer(const bind_index_buffer_info& info) override
+        {
+            trace("bind_index_buffer", info.buffer.id, static_cast<uint64>(info.format));
+        }
+
+        void bind_shader_buffers(tavros::core::buffer_view<buffer_binding> buffers) override
+        {
+            for (const auto& b : buffers) {
+                trace("bind_shader_buffer", b.buffer.id, b.offset, b.size, b.binding);
+            }
+        }
+
+        void bind_shader_textures(tavros::core::buffer_view<texture_binding> textures) override
+        {
+            for (const auto& t : textures) {
+                trace("bind_shader_texture", t.texture.id, t.sampler.id, t.binding);
+            }
+        }
+
+        void bind_storage_images(tavros::core::buffer_view<image_binding> images) override
+        {
+            for (const auto& i : images) {
+                trace("bind_storage_image", i.texture.id, i.mip_level, static_cast<uint64>(i.access), i.binding);
+            }
+        }
+
+        void begin_rendering(framebuffer_handle framebuffer) override
+        {
+            trace("begin_rendering", framebuffer.id);
+        }
+
+        void end_rendering() override
+        {
+            trace("end_rendering");
+        }
+
+        void set_viewport(const viewport_info& viewport) override
+        {
+            trace("set_viewport", viewport.left, viewport.top, viewport.width, viewport.height);
+        }
+
+        void set_scissor(const scissor_info& scissor) override
+        {
+            trace("set_scissor", scissor.left, scissor.top, scissor.width, scissor.height);
+        }
+
+        void draw(uint32 vertex_count, uint32 first_vertex, uint32 instance_count, uint32 first_instance) override
+        {
+            trace("draw", vertex_count, first_vertex, instance_count, first_instance);
+        }
+
+        void draw_indexed(uint32 index_count, uint32 first_index, uint32 vertex_offset, uint32 instance_count, uint32 first_instance) override
+        {
+            trace("draw_indexed", index_count, first_index, vertex_offset, instance_count, first_instance);
+        }
+
+        void draw_indirect(const draw_indirect_info& info) override
+        {
+            trace("draw_indirect", info.buffer.id, info.offset, info.draw_count, info.stride);
+        }
+
+        void draw_indexed_indirect(const draw_indirect_info& info) override
+        {
+            trace("draw_indexed_indirect", info.buffer.id, info.offset, info.draw_count, info.stride);
+        }
+
+        void dispatch(uint32 group_count_x, uint32 group_count_y, uint32 group_count_z) override
+        {
+            trace("dispatch", group_count_x, group_count_y, group_count_z);
+        }
+
+        void dispatch_indirect(buffer_handle buffer, size_t offset) override
+        {
+            trace("dispatch_indirect", buffer.id, offset);
+        }
+
+        void memory_barrier(tavros::core::flags<barrier_scope> scope) override
+        {
+            trace("memory_barrier", static_cast<uint64>(scope.bits()));
+        }
+
+        void signal_fence(fence_handle fence) override
+        {
+            trace("signal_fence", fence.id);
+        }
+
+        void wait_for_fence(fence_handle fence) override
+        {
+            trace("wait_for_fence", fence.id);
+        }
+
+        void copy_buffer(buffer_handle src_buffer, buffer_handle dst_buffer, size_t size, size_t src_offset, size_t dst_offset) override
+        {
+            trace("copy_buffer", src_buffer.id, dst_buffer.id, size, src_offset, dst_offset);
+        }
+
+        void copy_buffer_to_texture(buffer_handle src_buffer, texture_handle dst_texture, const texture_copy_region& region) override
+        {
+            trace("copy_buffer_to_texture", src_buffer.id, dst_texture.id, region.buffer_offset, region.mip_level);
+        }
+
+        void copy_texture_to_buffer(texture_handle src_texture, buffer_handle dst_buffer, const texture_copy_region& region) override
+        {
+            trace("copy_texture_to_buffer", src_texture.id, dst_buffer.id, region.buffer_offset, region.mip_level);
+        }
+
+        void push_constant(const void* constants, size_t size) override
+        {
+            const auto* bytes = static_cast<const uint8*>(constants);
+            std::string line = "push_constant";
+            for (size_t i = 0; i < size; ++i) {
+                line += " " + std::to_string(bytes[i]);
+            }
+            calls.push_back(line);
+        }
+
+        std::vector<std::string> calls;
+
+    private:
+        template<class... Args>
+        void trace(const char* name, Args... args)
+        {
+            std::string line = name;
+            ((line += " " + std::to_string(args)), ...);
+            calls.push_back(line);
+        }
+    };
+
+    // Counts draws without looking at the arguments, for timing the replay itself
+    class counting_command_queue final : public command_queue
+    {
+    public:
+        void bind_pipeline(pipeline_handle) override
+        {
+        }
+        void bind_vertex_buffers(tavros::core::buffer_view<bind_buffer_info>) override
+        {
+        }
+        void bind_index_buffer(const bind_index_buffer_info&) override
+        {
+        }
+        void bind_shader_buffers(tavros::core::buffer_view<buffer_binding> buffers) override
+        {
+            bound += buffers.size();
+        }
+        void bind_shader_textures(tavros::core::buffer_view<texture_binding>) override
+        {
+        }
+        void bind_storage_images(tavros::core::buffer_view<image_binding>) override
+        {
+        }
+        void begin_rendering(framebuffer_handle) override
+        {
+        }
+        void end_rendering() override
+        {
+        }
+        void set_viewport(const viewport_info&) override
+        {
+        }
+        void set_scissor(const scissor_info&) override
+        {
+        }
+        void draw(uint32 vertex_count, uint32, uint32, uint32) override
+        {
+            vertices += vertex_count;
+        }
+        void draw_indexed(uint32, uint32, uint32, uint32, uint32) override
+        {
+        }
+        void draw_indirect(const draw_indirect_info&) override
+        {
+        }
+        void draw_indexed_indirect(const draw_indirect_info&) override
+        {
+        }
+        void dispatch(uint32, uint32, uint32) override
+        {
+        }
+        void dispatch_indirect(buffer_handle, size_t) override
+        {
+        }
+        void memory_barrier(tavros::core::flags<barrier_scope>) override
+        {
+        }
+        void signal_fence(fence_handle) override
+        {
+        }
+        void wait_for_fence(fence_handle) override
+        {
+        }
+        void copy_buffer(buffer_handle, buffer_handle, size_t, size_t, size_t) override
+        {
+        }
+        void copy_buffer_to_texture(buffer_handle, texture_handle, const texture_copy_region&) override
+        {
+        }
+        void copy_texture_to_buffer(texture_handle, buffer_handle, const texture_copy_region&) override
+        {
+        }
+        void push_constant(const void*, size_t) override
+        {
+        }
+
+        uint64 bound = 0;
+        uint64 vertices = 0;
+    };
+
+    buffer_handle buffer(uint32 index)
+    {
+        return buffer_handle(1, index);
+    }
+} // namespace
+
+class command_stream_test : public unittest_scope
+{
+};
+
+TEST_F(command_stream_test, records_commands_in_order)
+{
+    recording_command_queue queue;
+    queue.begin_rendering(framebuffer_handle(1, 2));
+    queue.set_viewport({0, 0, 640, 480});
+    queue.bind_pipeline(pipeline_handle(1, 7));
+
+    // Arrays are copied, the caller's storage may change right after the call
+    buffer_binding bindings[] = {{buffer(3), 0, 64, 0}, {buffer(4), 256, 128, 1}};
+    queue.bind_shader_buffers(bindings);
+    bindings[0].buffer = buffer(99);
+
+    queue.draw_indexed(36, 6, 0, 2);
+    queue.end_rendering();
+
+    const auto& stream = queue.stream();
+    ASSERT_EQ(stream.size(), 6u);
+    EXPECT_EQ(stream.size_bytes() % command_stream::k_alignment, 0u);
+
+    std::vector<command_type> types;
+    for (const auto cmd : stream) {
+        types.push_back(cmd.type());
+    }
+    const std::vector<command_type> expected = {
+        command_type::begin_rendering,
+        command_type::set_viewport,
+        command_type::bind_pipeline,
+        command_type::bind_shader_buffers,
+        command_type::draw_indexed,
+        command_type::end_rendering,
+    };
+    EXPECT_EQ(types, expected);
+
+    auto it = stream.begin();
+    EXPECT_EQ((*it).as<commands::begin_rendering>().framebuffer, framebuffer_handle(1, 2));
+    ++it;
+    EXPECT_EQ((*it).as<commands::set_viewport>().viewport.width, 640);
+    ++it;
+    EXPECT_EQ((*it).as<commands::bind_pipeline>().pipeline, pipeline_handle(1, 7));
+    ++it;
+    const auto items = (*it).items<commands::bind_shader_buffers>();
+    ASSERT_EQ(items.size(), 2u);
+    EXPECT_EQ(items[0].buffer, buffer(3));
+    EXPECT_EQ(items[1].offset, 256u);
+    EXPECT_EQ(items[1].binding, 1u);
+    ++it;
+    const auto& draw = (*it).as<commands::draw_indexed>();
+    EXPECT_EQ(draw.index_count, 36u);
+    EXPECT_EQ(draw.first_index, 6u);
+    EXPECT_EQ(draw.instance_count, 2u);
+    EXPECT_EQ(draw.first_instance, 0u);
+}
+
+TEST_F(command_stream_test, replay_issues_the_recorded_calls)
+{
+    recording_command_queue recorder;
+    tracing_command_queue   direct;
+
+    // Every command recorded into both queues, the replay must match the direct calls
+    auto record = [](command_queue& q) {
+        q.begin_rendering(framebuffer_handle(1, 1));
+        q.set_viewport({1, 2, 3, 4});
+        q.set_scissor({5, 6, 7, 8});
+        q.bind_pipeline(pipeline_handle(2, 5));
+        q.bind_vertex_buffers(bind_buffer_info{buffer(1), 16});
+        q.bind_index_buffer({buffer(2), index_buffer_format::u16});
+        q.bind_shader_buffers(buffer_binding{buffer(3), 32, 64, 2});
+        q.bind_shader_textures({});
+        const texture_binding textures[] = {{texture_handle(1, 8), sampler_handle(1, 9), 0}, {texture_handle(1, 10), sampler_handle(1, 9), 1}};
+        q.bind_shader_textures(textures);
+        q.push_constant(uint32(0x04030201));
+        q.draw(3);
+        q.draw_indexed(6, 0, 4, 1, 0);
+        q.end_rendering();
+        q.copy_buffer(buffer(1), buffer(2), 128, 8, 16);
+        texture_copy_region region;
+        region.buffer_offset = 512;
+        region.mip_level = 2;
+        q.copy_buffer_to_texture(buffer(5), texture_handle(1, 11), region);
+        q.copy_texture_to_buffer(texture_handle(1, 11), buffer(6), region);
+        q.signal_fence(fence_handle(1, 12));
+        q.wait_for_fence(fence_handle(1, 12));
+    };
+
+    record(recorder);
+    record(direct);
+    EXPECT_EQ(recorder.stream().size(), 18u);
+
+    tracing_command_queue replayed;
+    replay(recorder.stream(), replayed);
+    EXPECT_EQ(replayed.calls, direct.calls);
+
+    // Streams can be replayed more than once
+    tracing_command_queue again;
+    replay(recorder.stream(), again);
+    EXPECT_EQ(again.calls, direct.calls);
+}
+
+TEST_F(command_stream_test, push_constant_data_is_copied)
+{
+    recording_command_queue queue;
+
+    uint8 data[7] = {1, 2, 3, 4, 5, 6, 7};
+    queue.push_constant(data, sizeof(data));
+    data[0] = 100;
+    queue.push_constant(data, 1);
+
+    tracing_command_queue target;
+    replay(queue.stream(), target);
+    const std::vector<std::string> expected = {"push_constant 1 2 3 4 5 6 7", "push_constant 100"};
+    EXPECT_EQ(target.calls, expected);
+
+    // Odd sizes are padded, the next command stays aligned
+    for (const auto cmd : queue.stream()) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(&cmd.as<commands::push_constant>()) % command_stream::k_alignment, 0u);
+    }
+}
+
+TEST_F(command_stream_test, reset_keeps_memory)
+{
+    recording_command_queue queue;
+    for (uint32 i = 0; i < 1000; ++i) {
+        queue.draw(i);
+    }
+    const size_t capacity = queue.stream().capacity_bytes();
+    EXPECT_GE(capacity, queue.stream().size_bytes());
+
+    queue.reset();
+    EXPECT_TRUE(queue.stream().empty());
+    EXPECT_EQ(queue.stream().size_bytes(), 0u);
+    EXPECT_TRUE(queue.stream().begin() == queue.stream().end());
+
+    // The same frame recorded again does not grow the stream
+    for (uint32 i = 0; i < 1000; ++i) {
+        queue.draw(i);
+    }
+    EXPECT_EQ(queue.stream().capacity_bytes(), capacity);
+    EXPECT_EQ(queue.stream().size(), 1000u);
+}
+
+TEST_F(command_stream_test, stress_parallel_recording)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t queues = 8;
+    constexpr uint32 draws = 100'000;
+    constexpr int    frames = 10;
+
+    tavros::core::thread_pool            pool;
+    std::vector<recording_command_queue> recorders(queues);
+    counting_command_queue               target;
+
+    double record_s = 0.0;
+    double replay_s = 0.0;
+    for (int f = 0; f < frames; ++f) {
+        tavros::core::timer tm;
+        pool.run(queues, [&](size_t q) {
+            auto& queue = recorders[q];
+            queue.reset();
+            for (uint32 i = 0; i < draws; ++i) {
+                queue.bind_shader_buffers(buffer_binding{buffer(1), i * 256, 256, 1});
+                queue.draw(4);
+            }
+        });
+        record_s += tm.elapsed_seconds();
+
+        tm.restart();
+        for (const auto& queue : recorders) {
+            replay(queue.stream(), target);
+        }
+        replay_s += tm.elapsed_seconds();
+    }
+
+    EXPECT_EQ(target.bound, uint64(frames) * queues * draws);
+    EXPECT_EQ(target.vertices, uint64(frames) * queues * draws * 4);
+
+    const double commands = static_cast<double>(frames) * queues * draws * 2;
+    std::printf("[ stress   ] %zu queues x %u draws on %zu threads: record %.1f ns/command, replay %.1f ns/command, %zu bytes per queue\n", queues, draws, pool.concurrency(), record_s * 1e9 / commands, replay_s * 1e9 / commands, recorders[0].stream().size_bytes());
+}
@@ -0,0 +1,173 @@
+#include <renderer_tests/null_device.test.hpp>
+
+#include <tavros/renderer/rhi/string_utils.hpp>
+
+#include <cstring>
+
+using namespace tavros::renderer;
+using namespace tavros::renderer::rhi;
+
+namespace
+{
+    constexpr const char* k_compute_source = "layout(local_size_x = 64) in; void main() {}";
+
+    pipeline_handle make_compute_pipeline(graphics_device& device)
+    {
+        shader_create_info shader_info;
+        shader_info.compute_shader_source = k_compute_source;
+        return device.create_compute_pipeline({device.create_shader(shader_info)});
+    }
+} // namespace
+
+class compute_dispatch_test : public unittest_scope
+{
+};
+
+TEST_F(compute_dispatch_test, compute_and_graphics_shaders_are_not_interchangeable)
+{
+    graphics_device_null device;
+
+    shader_create_info mixed{"void main() {}", "void main() {}", k_compute_source};
+    EXPECT_FALSE(device.create_shader(mixed).valid());
+
+    shader_create_info compute_info;
+    compute_info.compute_shader_source = k_compute_source;
+    auto compute = device.create_shader(compute_info);
+    auto graphics = device.create_shader(shader_create_info{"void main() {}", "void main() {}"});
+    ASSERT_TRUE(compute.valid());
+    ASSERT_TRUE(graphics.valid());
+    EXPECT_TRUE(device.get_shader_reflect_ptr(compute)->compute().is_compute);
+    EXPECT_FALSE(device.get_shader_reflect_ptr(graphics)->compute().is_compute);
+
+    pipeline_create_info graphics_pipeline;
+    graphics_pipeline.shader_program = compute;
+    EXPECT_FALSE(device.create_pipeline(graphics_pipeline).valid());
+    EXPECT_FALSE(device.create_compute_pipeline({graphics}).valid());
+
+    // Compute pipelines are destroyed like any other pipeline
+    auto pipeline = device.create_compute_pipeline({compute});
+    ASSERT_TRUE(pipeline.valid());
+    device.destroy_pipeline(pipeline);
+
+    EXPECT_EQ(device.statistics().validation_errors, 3u);
+}
+
+TEST_F(compute_dispatch_test, dispatch_and_dispatch_indirect)
+{
+    graphics_device_null device;
+    auto                 pipeline = make_compute_pipeline(device);
+    auto                 particles = device.create_buffer({4096, buffer_usage::storage, buffer_access::gpu_only});
+    auto                 args = device.create_buffer({64, buffer_usage::indirect, buffer_access::cpu_to_gpu});
+
+    dispatch_indirect_args groups{4, 2, 1};
+    auto                   mapped = device.map_buffer(args);
+    std::memcpy(mapped.data() + 16, &groups, sizeof(groups));
+    device.unmap_buffer(args);
+
+    auto* queue = device.create_command_queue();
+    queue->bind_pipeline(pipeline);
+    queue->bind_shader_buffers(buffer_binding{particles, 0, 0, 0});
+    queue->bind_shader_buffers(buffer_binding{args, 0, 0, 1}); // indirect buffers can be written by shaders
+    queue->push_constant(uint32(64));
+    queue->dispatch(16);
+    queue->memory_barrier(barrier_scope::storage_buffer | barrier_scope::indirect_args);
+    queue->dispatch_indirect(args, 16);
+    device.submit_command_queue(queue);
+
+    const auto& stats = device.statistics();
+    EXPECT_EQ(stats.validation_errors, 0u);
+    EXPECT_EQ(stats.dispatches, 2u);
+    EXPECT_EQ(stats.work_groups, 16u + 8u);
+    EXPECT_EQ(stats.barriers, 1u);
+    EXPECT_EQ(stats.buffer_binds, 2u);
+}
+
+TEST_F(compute_dispatch_test, invalid_dispatches_are_rejected)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 compute = make_compute_pipeline(device);
+    auto                 graphics = make_pipeline(device);
+    auto                 storage = device.create_buffer({64, buffer_usage::storage, buffer_access::cpu_to_gpu});
+    auto                 args = device.create_buffer({64, buffer_usage::indirect, buffer_access::cpu_to_gpu});
+
+    auto* queue = device.create_command_queue();
+    queue->dispatch(1);                                  // no pipeline
+    queue->begin_rendering(composer->backbuffer());
+    queue->bind_pipeline(compute);                       // inside a render pass
+    queue->bind_pipeline(graphics);
+    queue->dispatch(1);                                  // inside a render pass
+    queue->end_rendering();
+    queue->bind_pipeline(graphics);
+    queue->dispatch(1);                                  // graphics pipeline
+    queue->bind_pipeline(compute);
+    queue->draw(3);                                      // compute pipeline outside of a pass
+    queue->dispatch_indirect(storage);                   // not an indirect buffer
+    queue->dispatch_indirect(args, 2);                   // misaligned offset
+    queue->dispatch_indirect(args, 56);                  // 12 bytes of arguments at offset 56 of 64
+    queue->memory_barrier({});                           // empty scope
+    queue->dispatch(1);
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().validation_errors, 9u);
+    EXPECT_EQ(device.statistics().dispatches, 1u);
+}
+
+TEST_F(compute_dispatch_test, storage_images)
+{
+    graphics_device_null device;
+    auto                 pipeline = make_compute_pipeline(device);
+
+    texture_create_info info;
+    info.width = 256;
+    info.height = 256;
+    info.mip_levels = 9;
+    info.usage = texture_usage::storage | texture_usage::sampled;
+    auto target = device.create_texture(info);
+    info.usage = k_default_texture_usage;
+    auto sampled = device.create_texture(info);
+
+    // Mip generation: every level is read from the previous one
+    auto* queue = device.create_command_queue();
+    queue->bind_pipeline(pipeline);
+    for (uint32 level = 1; level < 9; ++level) {
+        image_binding images[] = {
+            {target, level - 1, image_access::read_only, 0},
+            {target, level, image_access::write_only, 1},
+        };
+        queue->bind_storage_images(images);
+        queue->dispatch((256 >> level) / 8 + 1, (256 >> level) / 8 + 1);
+        queue->memory_barrier(barrier_scope::storage_image);
+    }
+    queue->bind_storage_images(image_binding{sampled});   // not a storage texture
+    queue->bind_storage_images(image_binding{target, 9}); // mip level out of range
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().image_binds, 16u);
+    EXPECT_EQ(device.statistics().dispatches, 8u);
+    EXPECT_EQ(device.statistics().barriers, 8u);
+    EXPECT_EQ(device.statistics().validation_errors, 2u);
+}
+
+TEST_F(compute_dispatch_test, commands_survive_recording)
+{
+    graphics_device_null device;
+    auto                 pipeline = make_compute_pipeline(device);
+
+    recording_command_queue recorded;
+    recorded.bind_pipeline(pipeline);
+    recorded.dispatch(3, 4, 5);
+    recorded.memory_barrier(k_all_barrier_scopes);
+    ASSERT_EQ(recorded.stream().size(), 3u);
+
+    auto* queue = device.create_command_queue();
+    replay(recorded.stream(), *queue);
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().validation_errors, 0u);
+    EXPECT_EQ(device.statistics().work_groups, 60u);
+    EXPECT_EQ(device.statistics().barriers, 1u);
+    EXPECT_STREQ(to_string(command_type::dispatch_indirect).data(), "dispatch_indirect");
+    EXPECT_STREQ(to_string(barrier_scope::indirect_args).data(), "indirect_args");
+    EXPECT_STREQ(to_string(image_access::write_only).data(), "write_only");
+}
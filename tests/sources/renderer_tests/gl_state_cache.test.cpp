@@ -0,0 +1,231 @@
+#include <common.test.hpp>
+
+#include <tavros/renderer/internal/opengl/gl_state_cache.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace tavros::renderer::rhi;
+
+namespace
+{
+    // GL entry points are replaced with stubs that record their names, no context is needed
+    std::vector<const char*> g_calls;
+
+#define TAV_GL_STUB(name, ...)                \
+    void APIENTRY stub_##name(__VA_ARGS__)    \
+    {                                         \
+        g_calls.push_back(#name);             \
+    }
+
+    TAV_GL_STUB(glEnable, GLenum)
+    TAV_GL_STUB(glDisable, GLenum)
+    TAV_GL_STUB(glEnablei, GLenum, GLuint)
+    TAV_GL_STUB(glDisablei, GLenum, GLuint)
+    TAV_GL_STUB(glBlendFuncSeparatei, GLuint, GLenum, GLenum, GLenum, GLenum)
+    TAV_GL_STUB(glBlendEquationSeparatei, GLuint, GLenum, GLenum)
+    TAV_GL_STUB(glColorMaski, GLuint, GLboolean, GLboolean, GLboolean, GLboolean)
+    TAV_GL_STUB(glColorMask, GLboolean, GLboolean, GLboolean, GLboolean)
+    TAV_GL_STUB(glDepthMask, GLboolean)
+    TAV_GL_STUB(glDepthFunc, GLenum)
+    TAV_GL_STUB(glDepthRange, GLdouble, GLdouble)
+    TAV_GL_STUB(glStencilFuncSeparate, GLenum, GLenum, GLint, GLuint)
+    TAV_GL_STUB(glStencilOpSeparate, GLenum, GLenum, GLenum, GLenum)
+    TAV_GL_STUB(glStencilMaskSeparate, GLenum, GLuint)
+    TAV_GL_STUB(glCullFace, GLenum)
+    TAV_GL_STUB(glFrontFace, GLenum)
+    TAV_GL_STUB(glPolygonMode, GLenum, GLenum)
+    TAV_GL_STUB(glPolygonOffset, GLfloat, GLfloat)
+    TAV_GL_STUB(glMinSampleShading, GLfloat)
+    TAV_GL_STUB(glViewport, GLint, GLint, GLsizei, GLsizei)
+    TAV_GL_STUB(glScissor, GLint, GLint, GLsizei, GLsizei)
+    TAV_GL_STUB(glUseProgram, GLuint)
+    TAV_GL_STUB(glBindVertexArray, GLuint)
+    TAV_GL_STUB(glBindBuffer, GLenum, GLuint)
+    TAV_GL_STUB(glBindBufferBase, GLenum, GLuint, GLuint)
+    TAV_GL_STUB(glBindBufferRange, GLenum, GLuint, GLuint, GLintptr, GLsizeiptr)
+    TAV_GL_STUB(glBindTexture, GLenum, GLuint)
+    TAV_GL_STUB(glBindSampler, GLuint, GLuint)
+    TAV_GL_STUB(glActiveTexture, GLenum)
+    TAV_GL_STUB(glBindImageTexture, GLuint, GLuint, GLint, GLboolean, GLint, GLenum, GLenum)
+
+#undef TAV_GL_STUB
+
+    GLenum APIENTRY stub_glGetError()
+    {
+        return GL_NO_ERROR;
+    }
+
+    size_t calls(const char* name)
+    {
+        return static_cast<size_t>(std::count_if(g_calls.begin(), g_calls.end(), [name](const char* c) { return std::strcmp(c, name) == 0; }));
+    }
+} // namespace
+
+class gl_state_cache_test : public unittest_scope
+{
+protected:
+    void SetUp() override
+    {
+        unittest_scope::SetUp();
+
+        glad_glEnable = stub_glEnable;
+        glad_glDisable = stub_glDisable;
+        glad_glEnablei = stub_glEnablei;
+        glad_glDisablei = stub_glDisablei;
+        glad_glBlendFuncSeparatei = stub_glBlendFuncSeparatei;
+        glad_glBlendEquationSeparatei = stub_glBlendEquationSeparatei;
+        glad_glColorMaski = stub_glColorMaski;
+        glad_glColorMask = stub_glColorMask;
+        glad_glDepthMask = stub_glDepthMask;
+        glad_glDepthFunc = stub_glDepthFunc;
+        glad_glDepthRange = stub_glDepthRange;
+        glad_glStencilFuncSeparate = stub_glStencilFuncSeparate;
+        glad_glStencilOpSeparate = stub_glStencilOpSeparate;
+        glad_glStencilMaskSeparate = stub_glStencilMaskSeparate;
+        glad_glCullFace = stub_glCullFace;
+        glad_glFrontFace = stub_glFrontFace;
+        glad_glPolygonMode = stub_glPolygonMode;
+        glad_glPolygonOffset = stub_glPolygonOffset;
+        glad_glMinSampleShading = stub_glMinSampleShading;
+        glad_glViewport = stub_glViewport;
+        glad_glScissor = stub_glScissor;
+        glad_glUseProgram = stub_glUseProgram;
+        glad_glBindVertexArray = stub_glBindVertexArray;
+        glad_glBindBuffer = stub_glBindBuffer;
+        glad_glBindBufferBase = stub_glBindBufferBase;
+        glad_glBindBufferRange = stub_glBindBufferRange;
+        glad_glBindTexture = stub_glBindTexture;
+        glad_glBindSampler = stub_glBindSampler;
+        glad_glActiveTexture = stub_glActiveTexture;
+        glad_glBindImageTexture = stub_glBindImageTexture;
+        glad_glGetError = stub_glGetError;
+
+        g_calls.clear();
+    }
+};
+
+TEST_F(gl_state_cache_test, redundant_state_is_filtered)
+{
+    gl_state_cache cache;
+
+    cache.set_enabled(GL_DEPTH_TEST, true);
+    cache.set_enabled(GL_DEPTH_TEST, true);
+    cache.set_enabled(GL_DEPTH_TEST, false);
+    cache.depth_func(GL_LESS);
+    cache.depth_func(GL_LESS);
+    cache.viewport(0, 0, 640, 480);
+    cache.viewport(0, 0, 640, 480);
+    cache.viewport(0, 0, 320, 480);
+
+    EXPECT_EQ(calls("glEnable"), 1u);
+    EXPECT_EQ(calls("glDisable"), 1u);
+    EXPECT_EQ(calls("glDepthFunc"), 1u);
+    EXPECT_EQ(calls("glViewport"), 2u);
+    EXPECT_EQ(cache.frame_statistics().emitted, 5u);
+    EXPECT_EQ(cache.frame_statistics().filtered, 3u);
+
+    // Caps outside the tracked set are always passed through
+    cache.set_enabled(GL_DITHER, true);
+    cache.set_enabled(GL_DITHER, true);
+    EXPECT_EQ(calls("glEnable"), 3u);
+}
+
+TEST_F(gl_state_cache_test, bindings_are_tracked_per_slot)
+{
+    gl_state_cache cache;
+
+    cache.bind_texture(2, GL_TEXTURE_2D, 7);
+    cache.bind_texture(2, GL_TEXTURE_2D, 7);
+    cache.bind_texture(3, GL_TEXTURE_2D, 7);
+    cache.bind_texture(2, GL_TEXTURE_2D, 7);
+    cache.bind_sampler(2, 1);
+    cache.bind_sampler(2, 1);
+    EXPECT_EQ(calls("glBindTexture"), 2u);
+    EXPECT_EQ(calls("glActiveTexture"), 2u);
+    EXPECT_EQ(calls("glBindSampler"), 1u);
+
+    cache.bind_buffer_range(GL_UNIFORM_BUFFER, 0, 5, 0, 0);
+    cache.bind_buffer_range(GL_UNIFORM_BUFFER, 0, 5, 0, 0);
+    cache.bind_buffer_range(GL_UNIFORM_BUFFER, 0, 5, 256, 256);
+    cache.bind_buffer_range(GL_UNIFORM_BUFFER, 0, 5, 256, 256);
+    cache.bind_buffer_range(GL_SHADER_STORAGE_BUFFER, 0, 5, 256, 256);
+    EXPECT_EQ(calls("glBindBufferBase"), 1u);
+    EXPECT_EQ(calls("glBindBufferRange"), 2u);
+
+    // Element buffer binding belongs to the vertex array
+    cache.bind_vertex_array(1);
+    cache.bind_element_buffer(9);
+    cache.bind_element_buffer(9);
+    cache.bind_vertex_array(2);
+    cache.bind_element_buffer(9);
+    EXPECT_EQ(calls("glBindBuffer"), 2u);
+
+    // Indirect buffers are context state and survive vertex array changes
+    cache.bind_draw_indirect_buffer(4);
+    cache.bind_parameter_buffer(4);
+    cache.bind_vertex_array(3);
+    cache.bind_draw_indirect_buffer(4);
+    cache.bind_parameter_buffer(4);
+    cache.bind_dispatch_indirect_buffer(4);
+    cache.bind_dispatch_indirect_buffer(4);
+    EXPECT_EQ(calls("glBindBuffer"), 5u);
+
+    // Image units compare the whole binding, not only the texture
+    cache.bind_image_texture(0, 6, 0, GL_FALSE, GL_READ_ONLY, GL_RGBA8);
+    cache.bind_image_texture(0, 6, 0, GL_FALSE, GL_READ_ONLY, GL_RGBA8);
+    cache.bind_image_texture(0, 6, 1, GL_FALSE, GL_READ_ONLY, GL_RGBA8);
+    cache.bind_image_texture(1, 6, 1, GL_FALSE, GL_WRITE_ONLY, GL_RGBA8);
+    cache.bind_image_texture(1, 6, 1, GL_FALSE, GL_READ_WRITE, GL_RGBA8);
+    EXPECT_EQ(calls("glBindImageTexture"), 4u);
+}
+
+TEST_F(gl_state_cache_test, masks_and_faces)
+{
+    gl_state_cache cache;
+
+    // All bits set must not be mistaken for an unknown mask
+    cache.stencil_mask(GL_FRONT_AND_BACK, 0xffffffff);
+    cache.stencil_mask(GL_FRONT, 0xffffffff);
+    cache.stencil_mask(GL_BACK, 0xff);
+    cache.stencil_mask(GL_FRONT_AND_BACK, 0xff);
+    EXPECT_EQ(calls("glStencilMaskSeparate"), 3u);
+
+    cache.color_mask_all(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    cache.color_mask(3, GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    cache.color_mask(3, GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    cache.color_mask_all(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    EXPECT_EQ(calls("glColorMask"), 2u);
+    EXPECT_EQ(calls("glColorMaski"), 1u);
+
+    cache.set_blend_enabled(0, true);
+    cache.blend_func_separate(0, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+    cache.set_blend_enabled(1, true);
+    cache.blend_func_separate(1, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+    cache.set_blend_enabled(0, true);
+    cache.blend_func_separate(0, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+    EXPECT_EQ(calls("glEnablei"), 2u);
+    EXPECT_EQ(calls("glBlendFuncSeparatei"), 2u);
+}
+
+TEST_F(gl_state_cache_test, invalidate_and_frame_statistics)
+{
+    gl_state_cache cache;
+
+    cache.use_program(3);
+    cache.use_program(3);
+    cache.polygon_offset(1.0f, 2.0f);
+    cache.end_frame();
+    EXPECT_EQ(cache.last_frame_statistics().emitted, 2u);
+    EXPECT_EQ(cache.last_frame_statistics().filtered, 1u);
+    EXPECT_EQ(cache.frame_statistics().emitted, 0u);
+
+    cache.invalidate();
+    cache.use_program(3);
+    cache.polygon_offset(1.0f, 2.0f);
+    EXPECT_EQ(calls("glUseProgram"), 2u);
+    EXPECT_EQ(calls("glPolygonOffset"), 2u);
+    EXPECT_EQ(cache.frame_statistics().emitted, 2u);
+    EXPECT_EQ(cache.frame_statistics().filtered, 0u);
+}
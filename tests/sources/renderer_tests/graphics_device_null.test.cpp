@@ -0,0 +1,241 @@
+#include <renderer_tests/null_device.test.hpp>
+
+#include <tavros/renderer/upload_context.hpp>
+#include <tavros/core/thread/thread_pool.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace tavros::renderer;
+using namespace tavros::renderer::rhi;
+
+namespace
+{
+    buffer_handle make_buffer(graphics_device& device, size_t size, buffer_usage usage, buffer_access access)
+    {
+        return device.create_buffer(buffer_create_info{size, usage, access});
+    }
+} // namespace
+
+class graphics_device_null_test : public unittest_scope
+{
+};
+
+TEST_F(graphics_device_null_test, buffers_are_backed_by_cpu_memory)
+{
+    graphics_device_null device;
+
+    auto stage = make_buffer(device, 256, buffer_usage::stage, buffer_access::cpu_to_gpu);
+    auto vertices = make_buffer(device, 256, buffer_usage::vertex, buffer_access::gpu_only);
+    ASSERT_TRUE(stage.valid());
+    ASSERT_TRUE(vertices.valid());
+
+    auto mapped = device.map_buffer(stage);
+    ASSERT_EQ(mapped.size(), 256u);
+    for (size_t i = 0; i < mapped.size(); ++i) {
+        mapped[i] = static_cast<uint8>(i);
+    }
+    device.unmap_buffer(stage);
+
+    // GPU only memory cannot be mapped, but copies into it are executed
+    EXPECT_TRUE(device.map_buffer(vertices).empty());
+    auto* queue = device.create_command_queue();
+    queue->copy_buffer(stage, vertices, 64, 16, 128);
+    device.submit_command_queue(queue);
+
+    const auto& memory = device.find(vertices)->memory;
+    EXPECT_EQ(memory[128], 16);
+    EXPECT_EQ(memory[191], 79);
+    EXPECT_EQ(memory[192], 0);
+    EXPECT_EQ(device.statistics().copies, 1u);
+    EXPECT_EQ(device.statistics().copied_bytes, 64u);
+
+    // Destroyed handles are rejected
+    device.destroy_buffer(vertices);
+    EXPECT_EQ(device.find(vertices), nullptr);
+    device.destroy_buffer(vertices);
+    EXPECT_EQ(device.statistics().validation_errors, 2u);
+    device.destroy_buffer(stage);
+    EXPECT_EQ(device.statistics().resources_created, 2u);
+    EXPECT_EQ(device.statistics().resources_destroyed, 2u);
+}
+
+TEST_F(graphics_device_null_test, frame_statistics)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    ASSERT_NE(composer, nullptr);
+    auto pipeline = make_pipeline(device);
+    auto indices = make_buffer(device, 600, buffer_usage::index, buffer_access::gpu_only);
+    auto constants = make_buffer(device, 1024, buffer_usage::constant, buffer_access::cpu_to_gpu);
+
+    for (int frame = 0; frame < 3; ++frame) {
+        auto* queue = device.create_command_queue();
+        queue->begin_rendering(composer->backbuffer());
+        queue->set_viewport({0, 0, 640, 480});
+        queue->bind_pipeline(pipeline);
+        queue->bind_index_buffer({indices, index_buffer_format::u16});
+        queue->bind_shader_buffers(buffer_binding{constants, 256, 256, 0});
+        queue->push_constant(uint32(7));
+        queue->draw(6, 0, 10);
+        queue->draw_indexed(300);
+        queue->end_rendering();
+        device.submit_command_queue(queue);
+        composer->present();
+    }
+
+    const auto& stats = device.statistics();
+    EXPECT_EQ(stats.frames, 3u);
+    EXPECT_EQ(stats.submits, 3u);
+    EXPECT_EQ(stats.commands, 27u);
+    EXPECT_EQ(stats.render_passes, 3u);
+    EXPECT_EQ(stats.pipeline_binds, 3u);
+    EXPECT_EQ(stats.buffer_binds, 6u);
+    EXPECT_EQ(stats.push_constant_bytes, 12u);
+    EXPECT_EQ(stats.draws, 6u);
+    EXPECT_EQ(stats.instances, 33u);
+    EXPECT_EQ(stats.vertices, 3u * (60 + 300));
+    EXPECT_EQ(stats.validation_errors, 0u);
+
+    device.reset_statistics();
+    EXPECT_EQ(device.statistics().draws, 0u);
+}
+
+TEST_F(graphics_device_null_test, invalid_commands_are_rejected)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+    auto                 indices = make_buffer(device, 64, buffer_usage::index, buffer_access::gpu_only);
+    auto                 stage = make_buffer(device, 64, buffer_usage::stage, buffer_access::cpu_to_gpu);
+
+    auto* queue = device.create_command_queue();
+    queue->draw(3);                                      // outside of a pass
+    queue->end_rendering();                              // not started
+    queue->begin_rendering(composer->backbuffer());
+    queue->begin_rendering(composer->backbuffer());      // nested pass
+    queue->draw(3);                                      // no pipeline
+    queue->bind_pipeline(pipeline_handle(1, 1234));      // unknown pipeline
+    queue->bind_pipeline(pipeline);
+    queue->draw_indexed(3);                              // no index buffer
+    queue->bind_index_buffer({stage});                   // not an index buffer
+    queue->bind_index_buffer({indices, index_buffer_format::u32});
+    queue->draw_indexed(17);                             // 68 bytes of indices in a 64 byte buffer
+    queue->draw_indexed(16);
+    queue->bind_shader_buffers(buffer_binding{stage, 0, 16, 0}); // not a constant buffer
+    queue->end_rendering();
+    queue->copy_buffer(stage, indices, 65);              // out of range
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().validation_errors, 10u);
+    EXPECT_EQ(device.statistics().draws, 1u);
+
+    // Queues not created by the device are rejected too
+    recording_command_queue foreign;
+    device.submit_command_queue(&foreign);
+    EXPECT_EQ(device.statistics().validation_errors, 11u);
+    EXPECT_EQ(device.statistics().submits, 1u);
+}
+
+TEST_F(graphics_device_null_test, queue_cannot_be_submitted_twice)
+{
+    graphics_device_null device;
+
+    auto* queue = device.create_command_queue();
+    queue->memory_barrier(k_all_barrier_scopes);
+    device.submit_command_queue(queue);
+    device.submit_command_queue(queue); // already back in the pool
+    EXPECT_EQ(device.statistics().validation_errors, 1u);
+    EXPECT_EQ(device.statistics().submits, 1u);
+
+    // The released queue is handed out once, then a new one is created
+    auto* first = device.create_command_queue();
+    auto* second = device.create_command_queue();
+    EXPECT_EQ(first, queue);
+    EXPECT_NE(second, queue);
+
+    device.submit_command_queue(first);
+    device.submit_command_queue(second);
+    EXPECT_EQ(device.statistics().validation_errors, 1u);
+    EXPECT_EQ(device.statistics().submits, 3u);
+}
+
+TEST_F(graphics_device_null_test, upload_context_completes_on_flush)
+{
+    graphics_device_null device;
+    auto                 dst = make_buffer(device, 1024, buffer_usage::vertex, buffer_access::gpu_only);
+
+    {
+        upload_context ctx(&device);
+        auto           batch = ctx.slice(100);
+        ASSERT_EQ(batch.view.size_bytes(), 100u);
+        std::memset(batch.view.data().data(), 0xAB, 100);
+        batch.queue->copy_buffer(batch.view.gpu_buffer(), dst, 100, batch.view.offset_bytes(), 24);
+
+        // Nothing is executed before the flush
+        EXPECT_EQ(device.find(dst)->memory[24], 0);
+        ctx.flush();
+        EXPECT_EQ(device.find(dst)->memory[24], 0xAB);
+        EXPECT_EQ(device.find(dst)->memory[123], 0xAB);
+        EXPECT_EQ(device.find(dst)->memory[124], 0);
+    }
+
+    EXPECT_EQ(device.statistics().validation_errors, 0u);
+    EXPECT_EQ(device.statistics().submits, 1u);
+    device.destroy_buffer(dst);
+}
+
+TEST_F(graphics_device_null_test, stress_frame_build)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr size_t queues = 8;
+    constexpr uint32 draws = 20'000;
+    constexpr int    frames = 30;
+
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+    auto                 constants = make_buffer(device, 1024 * 256, buffer_usage::constant, buffer_access::cpu_to_gpu);
+
+    tavros::core::thread_pool   pool;
+    std::vector<command_queue*> recorded(queues);
+    double                      record_s = 0.0;
+    double                      submit_s = 0.0;
+
+    for (int f = 0; f < frames; ++f) {
+        for (auto& q : recorded) {
+            q = device.create_command_queue();
+        }
+
+        tavros::core::timer tm;
+        pool.run(queues, [&](size_t q) {
+            auto* queue = recorded[q];
+            queue->begin_rendering(composer->backbuffer());
+            queue->bind_pipeline(pipeline);
+            for (uint32 i = 0; i < draws; ++i) {
+                queue->bind_shader_buffers(buffer_binding{constants, (i % 1024) * 256, 256, 1});
+                queue->draw(4);
+            }
+            queue->end_rendering();
+        });
+        record_s += tm.elapsed_seconds();
+
+        tm.restart();
+        for (auto* queue : recorded) {
+            device.submit_command_queue(queue);
+        }
+        composer->present();
+        submit_s += tm.elapsed_seconds();
+    }
+
+    EXPECT_EQ(device.statistics().validation_errors, 0u);
+    EXPECT_EQ(device.statistics().draws, uint64(frames) * queues * draws);
+
+    const double total_draws = static_cast<double>(frames) * queues * draws;
+    std::printf("[ stress   ] %zu queues x %u draws on %zu threads: record %.1f ns/draw, validate and execute %.1f ns/draw\n", queues, draws, pool.concurrency(), record_s * 1e9 / total_draws, submit_s * 1e9 / total_draws);
+}
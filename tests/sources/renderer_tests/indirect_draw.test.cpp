@@ -0,0 +1,250 @@
+#include <renderer_tests/null_device.test.hpp>
+
+#include <tavros/renderer/gpu_indirect_batch.hpp>
+#include <tavros/renderer/rhi/string_utils.hpp>
+#include <tavros/core/timer.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace tavros::renderer;
+using namespace tavros::renderer::rhi;
+
+namespace
+{
+    template<class T>
+    void write(graphics_device& device, buffer_handle buffer, size_t offset, const T& value)
+    {
+        auto mapped = device.map_buffer(buffer);
+        std::memcpy(mapped.data() + offset, &value, sizeof(value));
+        device.unmap_buffer(buffer);
+    }
+} // namespace
+
+class indirect_draw_test : public unittest_scope
+{
+};
+
+TEST_F(indirect_draw_test, batch_packs_records_and_submits_ranges)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+
+    gpu_stream_buffer stream;
+    stream.init(&device, 64 * 1024, buffer_usage::indirect);
+    ASSERT_TRUE(stream.valid());
+
+    gpu_draw_batch batch;
+    ASSERT_TRUE(batch.begin(stream, 100));
+    EXPECT_EQ(batch.capacity(), 100u);
+    EXPECT_TRUE(batch.empty());
+
+    auto* queue = device.create_command_queue();
+    queue->begin_rendering(composer->backbuffer());
+    queue->bind_pipeline(pipeline);
+
+    for (uint32 i = 0; i < 60; ++i) {
+        EXPECT_TRUE(batch.push({6, 2}));
+    }
+    EXPECT_EQ(batch.info().draw_count, 60u);
+    EXPECT_EQ(batch.info().stride, sizeof(draw_indirect_args));
+    batch.submit(*queue);
+    batch.submit(*queue); // nothing new to draw
+
+    // The second submit starts after the records already issued
+    for (uint32 i = 0; i < 60; ++i) {
+        batch.push({3, 1});
+    }
+    EXPECT_TRUE(batch.full());
+    EXPECT_FALSE(batch.push({3, 1}));
+    EXPECT_EQ(batch.info().offset % 4, 0u);
+    batch.submit(*queue);
+
+    queue->end_rendering();
+    device.submit_command_queue(queue);
+
+    const auto& stats = device.statistics();
+    EXPECT_EQ(stats.validation_errors, 0u);
+    EXPECT_EQ(stats.indirect_draws, 2u);
+    EXPECT_EQ(stats.draws, 100u);
+    EXPECT_EQ(stats.instances, 60u * 2 + 40u);
+    EXPECT_EQ(stats.vertices, 60u * 12 + 40u * 3);
+}
+
+TEST_F(indirect_draw_test, begin_fails_when_the_stream_is_full)
+{
+    graphics_device_null device;
+
+    gpu_stream_buffer stream;
+    stream.init(&device, 64 * 1024, buffer_usage::indirect);
+
+    gpu_draw_batch batch;
+    EXPECT_FALSE(batch.begin(stream, 64 * 1024 / sizeof(draw_indirect_args) + 1));
+    EXPECT_FALSE(assert_was_called());
+    EXPECT_EQ(batch.capacity(), 0u);
+    EXPECT_FALSE(batch.push({3, 1}));
+    EXPECT_EQ(stream.size(), 0u);
+
+    // The failed begin does not take any space
+    EXPECT_TRUE(batch.begin(stream, 64 * 1024 / sizeof(draw_indirect_args)));
+    EXPECT_FALSE(batch.begin(stream, 1));
+}
+
+TEST_F(indirect_draw_test, count_buffer_limits_the_draws)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+    auto                 indices = device.create_buffer({1200, buffer_usage::index, buffer_access::gpu_only});
+    auto                 args = device.create_buffer({1024, buffer_usage::indirect, buffer_access::cpu_to_gpu});
+    auto                 count = device.create_buffer({16, buffer_usage::indirect, buffer_access::cpu_to_gpu});
+
+    // Records with a 32 byte stride, the count buffer asks for three of them
+    for (uint32 i = 0; i < 8; ++i) {
+        write(device, args, i * 32, draw_indexed_indirect_args{300, 2, i * 10, 0, 0});
+    }
+    write(device, count, 4, uint32(3));
+
+    draw_indirect_info info;
+    info.buffer = args;
+    info.draw_count = 8;
+    info.stride = 32;
+    info.count_buffer = count;
+    info.count_offset = 4;
+
+    auto* queue = device.create_command_queue();
+    queue->begin_rendering(composer->backbuffer());
+    queue->bind_pipeline(pipeline);
+    queue->bind_index_buffer({indices, index_buffer_format::u16});
+    queue->draw_indexed_indirect(info);
+    queue->end_rendering();
+    device.submit_command_queue(queue);
+
+    // The count is read when the queue is executed and clamped to the draw count
+    write(device, count, 4, uint32(100));
+    info.draw_count = 2;
+    queue = device.create_command_queue();
+    queue->begin_rendering(composer->backbuffer());
+    queue->bind_pipeline(pipeline);
+    queue->bind_index_buffer({indices, index_buffer_format::u16});
+    queue->draw_indexed_indirect(info);
+    queue->end_rendering();
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().validation_errors, 0u);
+    EXPECT_EQ(device.statistics().draws, 5u);
+    EXPECT_EQ(device.statistics().vertices, 5u * 600);
+}
+
+TEST_F(indirect_draw_test, invalid_indirect_draws_are_rejected)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+    auto                 indices = device.create_buffer({64, buffer_usage::index, buffer_access::gpu_only});
+    auto                 vertices = device.create_buffer({256, buffer_usage::vertex, buffer_access::cpu_to_gpu});
+    auto                 args = device.create_buffer({256, buffer_usage::indirect, buffer_access::cpu_to_gpu});
+
+    write(device, args, 0, draw_indexed_indirect_args{16, 1, 0, 0, 0});
+    write(device, args, 20, draw_indexed_indirect_args{16, 1, 20, 0, 0}); // indices [20, 36) of 32
+
+    auto* queue = device.create_command_queue();
+    queue->draw_indirect({args});                               // outside of a pass
+    queue->begin_rendering(composer->backbuffer());
+    queue->bind_pipeline(pipeline);
+    queue->draw_indirect({vertices});                           // not an indirect buffer
+    queue->draw_indirect({args, 2});                            // misaligned offset
+    queue->draw_indirect({args, 0, 2, 8});                      // stride smaller than a record
+    queue->draw_indirect({args, 0, 17});                        // 272 bytes of records in a 256 byte buffer
+    queue->draw_indirect({args, 0, 1, 0, vertices});            // count buffer is not an indirect buffer
+    queue->draw_indirect({args, 0, 1, 0, args, 256});           // count out of range
+    queue->draw_indexed_indirect({args});                       // no index buffer
+    queue->bind_index_buffer({indices, index_buffer_format::u16});
+    queue->draw_indexed_indirect({args, 0, 2});                 // second record is out of range
+    queue->end_rendering();
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().validation_errors, 9u);
+    EXPECT_EQ(device.statistics().draws, 1u);
+    EXPECT_EQ(device.statistics().indirect_draws, 1u);
+}
+
+TEST_F(indirect_draw_test, commands_survive_recording)
+{
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+    auto                 args = device.create_buffer({256, buffer_usage::indirect, buffer_access::cpu_to_gpu});
+    write(device, args, 16, draw_indirect_args{4, 5});
+
+    recording_command_queue recorded;
+    recorded.begin_rendering(composer->backbuffer());
+    recorded.bind_pipeline(pipeline);
+    recorded.draw_indirect({args, 16});
+    recorded.end_rendering();
+
+    // Replayed into the device queue the info is unchanged
+    auto* queue = device.create_command_queue();
+    replay(recorded.stream(), *queue);
+    device.submit_command_queue(queue);
+
+    EXPECT_EQ(device.statistics().validation_errors, 0u);
+    EXPECT_EQ(device.statistics().vertices, 20u);
+    EXPECT_EQ(device.statistics().instances, 5u);
+    EXPECT_STREQ(to_string(command_type::draw_indexed_indirect).data(), "draw_indexed_indirect");
+    EXPECT_STREQ(to_string(buffer_usage::indirect).data(), "indirect");
+}
+
+TEST_F(indirect_draw_test, stress_batch_vs_direct_draws)
+{
+    if (g_stress_skip) {
+        GTEST_SKIP();
+    }
+
+    constexpr uint32 draws = 100'000;
+    constexpr int    frames = 20;
+
+    graphics_device_null device;
+    auto*                composer = make_composer(device);
+    auto                 pipeline = make_pipeline(device);
+
+    gpu_stream_buffer stream;
+    stream.init(&device, draws * sizeof(draw_indirect_args) + 256, buffer_usage::indirect);
+
+    double direct_s = 0.0;
+    double batch_s = 0.0;
+    for (int f = 0; f < frames; ++f) {
+        tavros::core::timer tm;
+        auto*               queue = device.create_command_queue();
+        queue->begin_rendering(composer->backbuffer());
+        queue->bind_pipeline(pipeline);
+        for (uint32 i = 0; i < draws; ++i) {
+            queue->draw(6, i * 6);
+        }
+        queue->end_rendering();
+        device.submit_command_queue(queue);
+        direct_s += tm.elapsed_seconds();
+
+        tm.restart();
+        stream.reset();
+        gpu_draw_batch batch;
+        batch.begin(stream, draws);
+        queue = device.create_command_queue();
+        queue->begin_rendering(composer->backbuffer());
+        queue->bind_pipeline(pipeline);
+        for (uint32 i = 0; i < draws; ++i) {
+            batch.push({6, 1, i * 6});
+        }
+        batch.submit(*queue);
+        queue->end_rendering();
+        device.submit_command_queue(queue);
+        batch_s += tm.elapsed_seconds();
+    }
+
+    EXPECT_EQ(device.statistics().validation_errors, 0u);
+    EXPECT_EQ(device.statistics().draws, uint64(frames) * draws * 2);
+
+    const double total_draws = static_cast<double>(frames) * draws;
+    std::printf("[ stress   ] %u draws: direct %.1f ns/draw, indirect batch %.1f ns/draw\n", draws, direct_s * 1e9 / total_draws, batch_s * 1e9 / total_draws);
+}
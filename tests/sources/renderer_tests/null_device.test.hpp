@@ -0,0 +1,25 @@
+#pragma once
+
+#include <common.test.hpp>
+
+#include <tavros/renderer/internal/null/graphics_device_null.hpp>
+
+// Factories shared by the tests running on graphics_device_null
+
+inline tavros::renderer::rhi::pipeline_handle make_pipeline(tavros::renderer::rhi::graphics_device& device)
+{
+    using namespace tavros::renderer::rhi;
+    auto shader = device.create_shader(shader_create_info{"void main() {}", "void main() {}"});
+    pipeline_create_info info;
+    info.shader_program = shader;
+    return device.create_pipeline(info);
+}
+
+inline tavros::renderer::rhi::frame_composer* make_composer(tavros::renderer::rhi::graphics_device& device)
+{
+    using namespace tavros::renderer::rhi;
+    frame_composer_create_info info;
+    info.width = 640;
+    info.height = 480;
+    return device.get_frame_composer_ptr(device.create_frame_composer(info));
+}